@@ -0,0 +1,253 @@
+/**
+ * @summary chunk_table.h: Defines data structures and functions for working
+ * with chunked data tables. Like the tables defined in table.h, items are
+ * identified by opaque 32-bit handles. Unlike those tables, item records are
+ * never moved after creation - records are stored in fixed-size chunks, and
+ * deleting an item simply marks its slot as free. This keeps pointers to item
+ * records stable and avoids copying large records when items are deleted, at
+ * the cost of iteration having to skip over empty slots.
+ */
+#ifndef __PIL_CHUNK_TABLE_H__
+#define __PIL_CHUNK_TABLE_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#endif
+
+/* @summary Define various constants related to the chunked data table implementation.
+ * CHUNK_TABLE_CHUNK_SHIFT: The number of bits to shift a slot index right by to obtain the chunk index.
+ * CHUNK_TABLE_CHUNK_SIZE: The number of item slots in a single chunk. Each chunk has a single 64-bit occupancy mask.
+ * CHUNK_TABLE_CHUNK_MASK: A mask used to extract the slot index within a chunk from a slot index.
+ * CHUNK_TABLE_CHUNK_NONE: A sentinel value used to terminate the list of chunks with free slots.
+ */
+#ifndef CHUNK_TABLE_CONSTANTS
+#   define CHUNK_TABLE_CONSTANTS
+#   define CHUNK_TABLE_CHUNK_SHIFT   6
+#   define CHUNK_TABLE_CHUNK_SIZE   (1UL << CHUNK_TABLE_CHUNK_SHIFT)
+#   define CHUNK_TABLE_CHUNK_MASK   (CHUNK_TABLE_CHUNK_SIZE - 1)
+#   define CHUNK_TABLE_CHUNK_NONE    0xFFFFFFFFUL
+#endif
+
+/* @summary Retrieve the number of active items in a chunked table.
+ * @param _td A pointer to a CHUNK_TABLE_DESC structure.
+ * @return The number of active items in the table.
+ */
+#ifndef ChunkTable_GetCount
+#define ChunkTable_GetCount(_td)                                               \
+    (_td)->Index->ActiveCount
+#endif
+
+/* @summary Retrieve the capacity of a chunked table.
+ * @param _td A pointer to a CHUNK_TABLE_DESC structure.
+ * @return The maximum number of items that can be stored in the table.
+ */
+#ifndef ChunkTable_GetCapacity
+#define ChunkTable_GetCapacity(_td)                                            \
+    (_td)->Index->TableCapacity
+#endif
+
+/* @summary Retrieve the number of committed chunks in a chunked table.
+ * Chunks with an index less than this value can be passed to ChunkTable_GetChunkMask and ChunkTableScanChunk.
+ * @param _td A pointer to a CHUNK_TABLE_DESC structure.
+ * @return The number of committed chunks.
+ */
+#ifndef ChunkTable_GetChunkCount
+#define ChunkTable_GetChunkCount(_td)                                          \
+    (_td)->Index->ChunkCount
+#endif
+
+/* @summary Retrieve the occupancy mask for a chunk. Bit i is set if slot (_ci * CHUNK_TABLE_CHUNK_SIZE + i) holds a live item.
+ * @param _td A pointer to a CHUNK_TABLE_DESC structure.
+ * @param _ci The zero-based index of the chunk.
+ * @return The 64-bit occupancy mask of the chunk.
+ */
+#ifndef ChunkTable_GetChunkMask
+#define ChunkTable_GetChunkMask(_td, _ci)                                      \
+    (_td)->Index->OccupancyMask[(_ci)]
+#endif
+
+/* @summary Retrieve a pointer to the record stored in a given slot of a chunked table data stream.
+ * Record addresses remain valid until the item is deleted or the table is deleted.
+ * @param _type The typename to return.
+ * @param _td A pointer to a CHUNK_TABLE_DESC structure.
+ * @param _si The zero-based index of the data stream to access.
+ * @param _slot The zero-based slot index of the item, as returned by ChunkTableCreateId or ChunkTableResolve.
+ * @return A pointer (_type*) to the given element.
+ */
+#ifndef ChunkTable_GetStreamElement
+#define ChunkTable_GetStreamElement(_type, _td, _si, _slot)                    \
+    ((_type*)(((uint8_t*)((_td)->Streams[(_si)]->StorageBuffer)) + ((_td)->Streams[(_si)]->ElementSize * (_slot))))
+#endif
+
+/* @summary Define the data associated with the index used to map item handles to slots in a chunked table.
+ * The sparse index portion of an item handle is the slot index of the item record.
+ */
+typedef struct CHUNK_TABLE_INDEX {
+    uint64_t                      *OccupancyMask;                              /* An array of ChunkCount masks, with one bit set for each occupied slot in the chunk. */
+    uint16_t                      *GenerationArray;                            /* An array of ChunkCount * CHUNK_TABLE_CHUNK_SIZE slot generation values. */
+    uint32_t                      *ChunkFreeList;                              /* An array of ChunkCount links used to chain together the chunks that have at least one free slot. */
+    uint32_t                       FreeChunkHead;                              /* The index of the first chunk with a free slot, or CHUNK_TABLE_CHUNK_NONE. */
+    uint32_t                       ActiveCount;                                /* The number of items in the table that are valid. */
+    uint32_t                       ChunkCount;                                 /* The number of chunks whose item records and index data are committed. */
+    uint32_t                       ChunkCapacity;                              /* The maximum number of chunks in the table. */
+    uint32_t                       TableCapacity;                              /* The maximum capacity of the table, in items. Always an even multiple of CHUNK_TABLE_CHUNK_SIZE. */
+} CHUNK_TABLE_INDEX;
+
+/* @summary Define the data used to construct a new chunked data table.
+ */
+typedef struct CHUNK_TABLE_INIT {
+    struct CHUNK_TABLE_INDEX      *Index;                                      /* The CHUNK_TABLE_INDEX associated with the table to initialize. */
+    struct TABLE_DATA_STREAM_DESC *Streams;                                    /* An array of StreamCount descriptors of the TABLE_DATA objects to initialize. */
+    uint32_t                       StreamCount;                                /* The number of valid entries in the Streams array. */
+    uint32_t                       TableCapacity;                              /* The maximum number of items that can be stored in the table. Rounded up to an even multiple of CHUNK_TABLE_CHUNK_SIZE. */
+    uint32_t                       InitialCommit;                              /* The initial table committment, in items. */
+} CHUNK_TABLE_INIT;
+
+/* @summary Define the data used to describe an existing chunked data table.
+ */
+typedef struct CHUNK_TABLE_DESC {
+    struct CHUNK_TABLE_INDEX      *Index;                                      /* The CHUNK_TABLE_INDEX used to map handles to their corresponding slots. */
+    struct TABLE_DATA            **Streams;                                    /* An array of StreamCount data streams representing the table records. Records are addressed by slot index. */
+    uint32_t                       StreamCount;                                /* The number of valid entries in the Streams array. */
+} CHUNK_TABLE_DESC;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Allocate resources for a chunked data table.
+ * The implementation of this function is platform-specific.
+ * @param init Pointer to a CHUNK_TABLE_INIT describing the index and data streams to allocate.
+ * @return Zero if the table is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+ChunkTableCreate
+(
+    struct CHUNK_TABLE_INIT *init
+);
+
+/* @summary Ensure that a chunked data table can accomodate a given number of items.
+ * If necessary and possible, additional chunks are committed and added to the list of chunks with free slots.
+ * The implementation of this function is platform-specific.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the index and data streams for the table.
+ * @param total_need The total number of items the caller needs to store in the table (for example, ChunkTable_GetCount() + 1).
+ * @return Zero if the table can store at least total_need items, or non-zero if an error occurred.
+ */
+PIL_API(int)
+ChunkTableEnsure
+(
+    struct CHUNK_TABLE_DESC *table,
+    uint32_t            total_need
+);
+
+/* @summary Free all resources allocated by a chunked data table.
+ * The implementation of this function is platform-specific.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the index and data streams for the table.
+ */
+PIL_API(void)
+ChunkTableDelete
+(
+    struct CHUNK_TABLE_DESC *table
+);
+
+/* @summary Create a single item identifier in a chunked table.
+ * The caller is responsible for ensuring the table has sufficient committed capacity using the ChunkTableEnsure function.
+ * @param o_slot_index Pointer to a location to update with the slot index to pass to ChunkTable_GetStreamElement.
+ * @param table Pointer to the CHUNK_TABLE_DESC describing the table that owns the item identifier.
+ * @return The table item identifier, or HANDLE_BITS_INVALID if the item cannot be created.
+ */
+PIL_API(HANDLE_BITS)
+ChunkTableCreateId
+(
+    uint32_t       *o_slot_index,
+    struct CHUNK_TABLE_DESC *table
+);
+
+/* @summary Invalidate a single item identifier created by ChunkTableCreateId. No item data is moved.
+ * The corresponding table data should have already had any necessary cleanup performed prior to calling this function.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the table that created the item identifier.
+ * @param bits The HANDLE_BITS identifying the item to delete.
+ * @return Zero if the item was deleted, or non-zero if bits does not identify a live item.
+ */
+PIL_API(int)
+ChunkTableDeleteId
+(
+    struct CHUNK_TABLE_DESC *table,
+    HANDLE_BITS               bits
+);
+
+/* @summary Invalidate all item identifiers in a chunked table, resetting it back to empty. Committed chunks remain committed.
+ * The table data should have already had any necessary cleanup performed prior to the call.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the table to reset.
+ */
+PIL_API(void)
+ChunkTableDeleteAllIds
+(
+    struct CHUNK_TABLE_DESC *table
+);
+
+/* @summary Resolve an item identifier into a slot index that can be used with the ChunkTable_GetStreamElement macro.
+ * @param o_slot_index Pointer to the location to update with the slot index of the item.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the table in which the lookup will be performed.
+ * @param bits The HANDLE_BITS identifying the item to resolve.
+ * @return Non-zero if the item is successfully resolved and o_slot_index is updated, or zero if the handle is not live.
+ */
+PIL_API(int)
+ChunkTableResolve
+(
+    uint32_t       *o_slot_index,
+    struct CHUNK_TABLE_DESC *table,
+    HANDLE_BITS               bits
+);
+
+/* @summary Retrieve the slot indices of all live items in a single chunk, in ascending order.
+ * Iterate over a chunked table by calling this function for each chunk in [0, ChunkTable_GetChunkCount).
+ * Alternatively, test ChunkTable_GetChunkMask directly with a bit scan.
+ * @param o_slots An array of at least CHUNK_TABLE_CHUNK_SIZE elements to receive the slot indices of the live items.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the table to scan.
+ * @param chunk_index The zero-based index of the chunk to scan.
+ * @return The number of slot indices written to o_slots.
+ */
+PIL_API(uint32_t)
+ChunkTableScanChunk
+(
+    uint32_t            *o_slots,
+    struct CHUNK_TABLE_DESC *table,
+    uint32_t         chunk_index
+);
+
+/* @summary Retrieve the handle for the item stored in a given slot. The slot must be occupied.
+ * @param table Pointer to a CHUNK_TABLE_DESC describing the table.
+ * @param slot_index The zero-based index of an occupied slot.
+ * @return The HANDLE_BITS identifying the item in the slot.
+ */
+PIL_API(HANDLE_BITS)
+ChunkTableGetHandle
+(
+    struct CHUNK_TABLE_DESC *table,
+    uint32_t            slot_index
+);
+
+/* @summary Perform an internal self-consistency check on a CHUNK_TABLE_INDEX structure.
+ * Intended to be used for debugging purposes only. Asserts fire for validation errors in debug builds.
+ * @param index The CHUNK_TABLE_INDEX to validate.
+ * @return Non-zero if the index is valid, or zero if the index is not valid.
+ */
+PIL_API(int)
+VerifyChunkTableIndex
+(
+    struct CHUNK_TABLE_INDEX *index
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_CHUNK_TABLE_H__ */
@@ -0,0 +1,299 @@
+/**
+ * @summary entity.h: Defines data structures and functions for managing
+ * entities composed of components. Each unique combination of components
+ * (an archetype) is stored in its own data table, with one data stream per
+ * component type. Queries select the archetypes that have a required set of
+ * components and expose their records as chunks of directly-addressable
+ * component streams, which can be processed serially or handed out to
+ * worker threads.
+ */
+#ifndef __PIL_ENTITY_H__
+#define __PIL_ENTITY_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#endif
+
+/* @summary Forward-declare the types exported by this module.
+ */
+struct  ENTITY_COMPONENT_TYPE;
+struct  ENTITY_ARCHETYPE;
+struct  ENTITY_WORLD;
+struct  ENTITY_WORLD_INIT;
+struct  ENTITY_QUERY;
+struct  ENTITY_CHUNK;
+
+/* @summary Define various constants related to the entity system.
+ * ENTITY_COMPONENT_TYPE_MAX: The maximum number of component types that can be registered with an ENTITY_WORLD.
+ * ENTITY_ARCHETYPE_MAX: The maximum number of archetypes that can be created within an ENTITY_WORLD.
+ * ENTITY_STREAM_NONE: The value stored in ENTITY_ARCHETYPE::StreamIndex for components that have no data stream.
+ * ENTITY_ID_INVALID: The value used to represent an invalid entity identifier.
+ */
+#ifndef ENTITY_CONSTANTS
+#   define ENTITY_CONSTANTS
+#   define ENTITY_COMPONENT_TYPE_MAX    64
+#   define ENTITY_ARCHETYPE_MAX         4096
+#   define ENTITY_STREAM_NONE           0xFF
+#   define ENTITY_ID_INVALID            0ULL
+#endif
+
+/* @summary Construct a COMPONENT_MASK with a single component type set.
+ * @param _cid The zero-based component type identifier, in [0, ENTITY_COMPONENT_TYPE_MAX).
+ * @return The COMPONENT_MASK value.
+ */
+#ifndef ComponentMask_Make
+#define ComponentMask_Make(_cid)                                               \
+    (1ULL << (_cid))
+#endif
+
+/* @summary Determine whether a COMPONENT_MASK satisfies an ENTITY_QUERY.
+ * @param _q A pointer to an ENTITY_QUERY structure.
+ * @param _m The COMPONENT_MASK of an archetype.
+ * @return Non-zero if the archetype has all required components and none of the excluded components.
+ */
+#ifndef EntityQuery_Matches
+#define EntityQuery_Matches(_q, _m)                                            \
+    ((((_m) & (_q)->RequireMask) == (_q)->RequireMask) && (((_m) & (_q)->ExcludeMask) == 0))
+#endif
+
+/* @summary Retrieve the zero-based index of the archetype encoded within an ENTITY_ID.
+ * @param _id The ENTITY_ID value.
+ * @return The zero-based index of the archetype in the ENTITY_WORLD.
+ */
+#ifndef EntityId_GetArchetypeIndex
+#define EntityId_GetArchetypeIndex(_id)                                        \
+    ((uint32_t)((_id) >> 32) - 1)
+#endif
+
+/* @summary Retrieve the table handle encoded within an ENTITY_ID.
+ * @param _id The ENTITY_ID value.
+ * @return The HANDLE_BITS identifying the entity record within its archetype table.
+ */
+#ifndef EntityId_GetHandle
+#define EntityId_GetHandle(_id)                                                \
+    ((HANDLE_BITS)((_id) & 0xFFFFFFFFULL))
+#endif
+
+/* @summary Retrieve a pointer to the first element of a component stream within an ENTITY_CHUNK.
+ * @param _type The component typename.
+ * @param _c A pointer to an ENTITY_CHUNK structure.
+ * @param _cid The zero-based component type identifier. The archetype must store data for the component.
+ * @return A pointer (_type*) to the component value of the first entity in the chunk. The chunk has _c->Count consecutive values.
+ */
+#ifndef EntityChunk_GetComponent
+#define EntityChunk_GetComponent(_type, _c, _cid)                              \
+    Table_GetStreamElement(_type, &(_c)->Archetype->TableDesc, (_c)->Archetype->StreamIndex[(_cid)], (_c)->Begin)
+#endif
+
+/* @summary Retrieve a pointer to the first handle within an ENTITY_CHUNK.
+ * @param _c A pointer to an ENTITY_CHUNK structure.
+ * @return A pointer (HANDLE_BITS*) to the table handle of the first entity in the chunk. The chunk has _c->Count consecutive handles.
+ */
+#ifndef EntityChunk_GetHandles
+#define EntityChunk_GetHandles(_c)                                             \
+    ((_c)->Archetype->TableIndex.HandleArray + (_c)->Begin)
+#endif
+
+/* @summary Entities are identified by a 64-bit value. The upper 32 bits store the archetype index plus one,
+ * and the lower 32 bits store the HANDLE_BITS of the entity record within the archetype table.
+ */
+typedef uint64_t ENTITY_ID;
+
+/* @summary A COMPONENT_MASK has bit i set if component type i is present.
+ */
+typedef uint64_t COMPONENT_MASK;
+
+/* @summary Define the data associated with a registered component type.
+ */
+typedef struct ENTITY_COMPONENT_TYPE {
+    uint32_t                       Size;                                       /* The size of the component data, in bytes. Tag components have a size of zero and no data stream. */
+    uint32_t                       Alignment;                                  /* The required alignment of the component data, in bytes. */
+} ENTITY_COMPONENT_TYPE;
+
+/* @summary Define the data associated with an archetype, which is a table storing all entities with an identical set of components.
+ * Component data streams are stored in ascending order of component type identifier.
+ */
+typedef struct ENTITY_ARCHETYPE {
+    TABLE_DESC                     TableDesc;                                  /* The table descriptor, used for calling the data table functions. */
+    TABLE_INDEX                    TableIndex;                                 /* The table index used to map entity handles to dense record indices. */
+    TABLE_DATA                    *StreamData;                                 /* An array of StreamCount TABLE_DATA, one for each component with non-zero size. */
+    TABLE_DATA                   **StreamList;                                 /* An array of StreamCount pointers into StreamData, referenced by TableDesc. */
+    COMPONENT_MASK                 ComponentMask;                              /* The set of components present on every entity in the archetype. */
+    uint32_t                       StreamCount;                                /* The number of component data streams. */
+    uint8_t                        StreamIndex[ENTITY_COMPONENT_TYPE_MAX];     /* The table stream index for each component type, or ENTITY_STREAM_NONE. */
+} ENTITY_ARCHETYPE;
+
+/* @summary Define the data associated with a set of component types and the archetypes built from them.
+ */
+typedef struct ENTITY_WORLD {
+    struct ENTITY_ARCHETYPE       *ArchetypeList;                              /* An array of ArchetypeCapacity archetypes, of which the first ArchetypeCount are valid. */
+    uint32_t                       ArchetypeCount;                             /* The number of valid archetypes. */
+    uint32_t                       ArchetypeCapacity;                          /* The maximum number of archetypes. */
+    uint32_t                       TableCapacity;                              /* The maximum number of entities in each archetype. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
+    COMPONENT_MASK                 RegisteredMask;                             /* The set of registered component types. */
+    ENTITY_COMPONENT_TYPE          ComponentTypes[ENTITY_COMPONENT_TYPE_MAX];  /* The size and alignment of each registered component type. */
+} ENTITY_WORLD;
+
+/* @summary Define the data used to construct a new ENTITY_WORLD.
+ */
+typedef struct ENTITY_WORLD_INIT {
+    uint32_t                       ArchetypeCapacity;                          /* The maximum number of archetypes, up to ENTITY_ARCHETYPE_MAX. */
+    uint32_t                       TableCapacity;                              /* The maximum number of entities in each archetype, up to TABLE_MAX_OBJECT_COUNT. Memory is committed on-demand. */
+} ENTITY_WORLD_INIT;
+
+/* @summary Define the data used to select the archetypes processed by a query.
+ */
+typedef struct ENTITY_QUERY {
+    COMPONENT_MASK                 RequireMask;                                /* The set of components an archetype must have. */
+    COMPONENT_MASK                 ExcludeMask;                                /* The set of components an archetype must not have. */
+} ENTITY_QUERY;
+
+/* @summary Define a contiguous range of entities within a single archetype, produced by a query.
+ * Chunks remain valid until an entity is created in or deleted from the archetype.
+ */
+typedef struct ENTITY_CHUNK {
+    struct ENTITY_ARCHETYPE       *Archetype;                                  /* The archetype containing the entities. */
+    uint32_t                       ArchetypeIndex;                             /* The zero-based index of the archetype within the ENTITY_WORLD. */
+    uint32_t                       Begin;                                      /* The dense index of the first entity in the chunk. */
+    uint32_t                       Count;                                      /* The number of entities in the chunk. */
+} ENTITY_CHUNK;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Initialize an entity world. No archetypes are created until entities are created.
+ * @param world The ENTITY_WORLD to initialize.
+ * @param init Pointer to an ENTITY_WORLD_INIT describing the capacity of the world.
+ * @return Zero if the world is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+EntityWorldCreate
+(
+    struct ENTITY_WORLD          *world,
+    struct ENTITY_WORLD_INIT      *init
+);
+
+/* @summary Free all resources associated with an entity world, including all archetype tables.
+ * @param world The ENTITY_WORLD to delete.
+ */
+PIL_API(void)
+EntityWorldDelete
+(
+    struct ENTITY_WORLD *world
+);
+
+/* @summary Register a component type with an entity world. Component types must be registered before they are used.
+ * @param world The ENTITY_WORLD with which the component type is registered.
+ * @param component_id The zero-based component type identifier, in [0, ENTITY_COMPONENT_TYPE_MAX).
+ * @param size The size of the component data, in bytes, or zero for a tag component with no data.
+ * @param alignment The required alignment of the component data, in bytes. Must be a power of two no greater than TABLE_STREAM_ALIGN_MAX.
+ * @return Zero if the component type is registered, or non-zero if an error occurred.
+ */
+PIL_API(int)
+EntityRegisterComponent
+(
+    struct ENTITY_WORLD *world,
+    uint32_t      component_id,
+    uint32_t              size,
+    uint32_t         alignment
+);
+
+/* @summary Retrieve the archetype storing entities with a given set of components, creating it if necessary.
+ * @param o_archetype_index Pointer to a location to update with the zero-based index of the archetype.
+ * @param world The ENTITY_WORLD to search.
+ * @param component_mask The set of components. All components must be registered.
+ * @return A pointer to the archetype, or NULL if the archetype could not be created.
+ */
+PIL_API(struct ENTITY_ARCHETYPE*)
+EntityGetArchetype
+(
+    uint32_t  *o_archetype_index,
+    struct ENTITY_WORLD   *world,
+    COMPONENT_MASK component_mask
+);
+
+/* @summary Create an entity with a given set of components. The component data is not initialized.
+ * @param o_chunk Optional pointer to an ENTITY_CHUNK to populate with a single-entity chunk, which can be used to initialize the component data.
+ * @param world The ENTITY_WORLD in which the entity is created.
+ * @param component_mask The set of components the entity has.
+ * @return The identifier of the new entity, or ENTITY_ID_INVALID if the entity could not be created.
+ */
+PIL_API(ENTITY_ID)
+EntityCreate
+(
+    struct ENTITY_CHUNK     *o_chunk,
+    struct ENTITY_WORLD       *world,
+    COMPONENT_MASK    component_mask
+);
+
+/* @summary Delete an entity. The last entity in the archetype is moved into the vacated record.
+ * @param world The ENTITY_WORLD that owns the entity.
+ * @param entity The identifier of the entity to delete.
+ * @return Zero if the entity was deleted, or non-zero if the entity identifier is not valid.
+ */
+PIL_API(int)
+EntityDelete
+(
+    struct ENTITY_WORLD *world,
+    ENTITY_ID           entity
+);
+
+/* @summary Retrieve a pointer to the data for a single component of an entity.
+ * @param world The ENTITY_WORLD that owns the entity.
+ * @param entity The identifier of the entity.
+ * @param component_id The zero-based component type identifier.
+ * @return A pointer to the component data, or NULL if the entity is not valid or does not have data for the component.
+ */
+PIL_API(void*)
+EntityGetComponent
+(
+    struct ENTITY_WORLD *world,
+    ENTITY_ID           entity,
+    uint32_t      component_id
+);
+
+/* @summary Retrieve the number of entities matching a query.
+ * @param world The ENTITY_WORLD to query.
+ * @param query The ENTITY_QUERY specifying the required and excluded components.
+ * @return The number of entities in all matching archetypes.
+ */
+PIL_API(uint32_t)
+EntityQueryCount
+(
+    struct ENTITY_WORLD         *world,
+    struct ENTITY_QUERY const   *query
+);
+
+/* @summary Split the entities matching a query into chunks of at most chunk_size entities.
+ * Each chunk lies within a single archetype, so chunks can be processed independently, for example by dispatching each chunk to a worker thread.
+ * @param o_chunks An array of max_chunks ENTITY_CHUNK to populate. May be NULL if max_chunks is zero.
+ * @param max_chunks The maximum number of chunks to write to o_chunks.
+ * @param world The ENTITY_WORLD to query.
+ * @param query The ENTITY_QUERY specifying the required and excluded components.
+ * @param chunk_size The maximum number of entities in a single chunk, or zero to produce one chunk per matching non-empty archetype.
+ * @return The total number of chunks required, which may exceed max_chunks.
+ */
+PIL_API(uint32_t)
+EntityQueryChunks
+(
+    struct ENTITY_CHUNK         *o_chunks,
+    uint32_t                   max_chunks,
+    struct ENTITY_WORLD            *world,
+    struct ENTITY_QUERY const      *query,
+    uint32_t                   chunk_size
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_ENTITY_H__ */
@@ -1,6 +1,7 @@
 /**
  * @summary memio.h: Define functions for byte swapping and reading and writing 
- * values to and from memory buffers.
+ * values to and from memory buffers. See memio_inline.h for inline versions of 
+ * the single-value functions, suitable for use in inner loops.
  */
 #ifndef __PIL_MEMIO_H__
 #define __PIL_MEMIO_H__
@@ -51,6 +52,110 @@
       (((_v) << 56) & 0xFF00000000000000ULL) )
 #endif
 
+/* @summary Define various constants used by the variable-length integer encodings.
+ * MEMIO_VARINT32_MAX_SIZE: The maximum number of bytes in the LEB128 encoding of a 32-bit value.
+ * MEMIO_VARINT64_MAX_SIZE: The maximum number of bytes in the LEB128 encoding of a 64-bit value.
+ */
+#ifndef MEMIO_VARINT_CONSTANTS
+#   define MEMIO_VARINT_CONSTANTS
+#   define MEMIO_VARINT32_MAX_SIZE        5
+#   define MEMIO_VARINT64_MAX_SIZE        10
+#endif
+
+/* @summary Calculate the maximum number of bytes required to store an array of 32-bit values using the Stream VByte encoding.
+ * @param _count The number of values in the array.
+ * @return The size of the buffer that guarantees WriteArray_svb32 does not overrun.
+ */
+#ifndef StreamVByte_GetMaxSize32
+#define StreamVByte_GetMaxSize32(_count)                                       \
+    ((((_count) + 3) / 4) + ((_count) * 4))
+#endif
+
+/* @summary Define various constants used by the bit packing functions.
+ * MEMIO_BITPACK_BLOCK_SIZE: The number of values in a block packed in the four-lane interleaved layout. See BitPack32.
+ */
+#ifndef MEMIO_BITPACK_CONSTANTS
+#   define MEMIO_BITPACK_CONSTANTS
+#   define MEMIO_BITPACK_BLOCK_SIZE       128
+#endif
+
+/* @summary Calculate the number of bytes used by BitPack32 to store an array of values.
+ * @param _count The number of values in the array.
+ * @param _width The number of bits stored for each value, from 0 to 32.
+ * @return The number of bytes written by BitPack32 and read by BitUnpack32.
+ */
+#ifndef BitPack32_GetSize
+#define BitPack32_GetSize(_count, _width)                                      \
+    ((((_count) / MEMIO_BITPACK_BLOCK_SIZE) * (MEMIO_BITPACK_BLOCK_SIZE / 8) * (_width)) + (((((_count) % MEMIO_BITPACK_BLOCK_SIZE) * (_width)) + 7) / 8))
+#endif
+
+/* @summary Define the rounding modes used when converting floating-point values to a narrower format.
+ */
+typedef enum MEMIO_ROUNDING_MODE {
+    MEMIO_ROUNDING_MODE_NEAREST             =  0UL,                            /* Round to the nearest representable value, with ties rounding to the even value. */
+    MEMIO_ROUNDING_MODE_TRUNCATE            =  1UL,                            /* Round toward zero. */
+} MEMIO_ROUNDING_MODE;
+
+/* @summary Define various constants used by the delta block codec.
+ * MEMIO_DELTA_PACK_MAGIC: The value stored in the Magic field of a MEMIO_DELTA_PACK_HEADER.
+ * MEMIO_DELTA_PACK_RAW: The BitWidth of a block of 64-bit values whose deltas do not fit in 32 bits. The block values are stored unpacked.
+ */
+#ifndef MEMIO_DELTA_PACK_CONSTANTS
+#   define MEMIO_DELTA_PACK_CONSTANTS
+#   define MEMIO_DELTA_PACK_MAGIC         0x4B504C44UL                         /* 'DLPK' */
+#   define MEMIO_DELTA_PACK_RAW           0xFFFFFFFFUL
+#endif
+
+/* @summary Calculate the maximum number of bytes required to store an array using DeltaPack32 or DeltaPack64.
+ * @param _count The number of values in the array.
+ * @param _element_size The size of each value, 4 for DeltaPack32 or 8 for DeltaPack64.
+ * @return The size of the buffer that guarantees DeltaPack32 or DeltaPack64 does not overrun.
+ */
+#ifndef DeltaPack_GetMaxSize
+#define DeltaPack_GetMaxSize(_count, _element_size)                            \
+    (sizeof(MEMIO_DELTA_PACK_HEADER) + ((((_count) + MEMIO_BITPACK_BLOCK_SIZE - 1) / MEMIO_BITPACK_BLOCK_SIZE) * sizeof(MEMIO_DELTA_PACK_BLOCK)) + ((_count) * (_element_size)))
+#endif
+
+/* @summary Define the header at the start of an array encoded by DeltaPack32 or DeltaPack64.
+ * All fields of the header and block directory are stored in little-endian byte order.
+ * The header is followed by BlockCount MEMIO_DELTA_PACK_BLOCK entries, one per MEMIO_BITPACK_BLOCK_SIZE values, and then the packed data of each block.
+ */
+typedef struct MEMIO_DELTA_PACK_HEADER {
+    uint32_t                       Magic;                                      /* The value MEMIO_DELTA_PACK_MAGIC. */
+    uint32_t                       ElementSize;                                /* The size of each value, in bytes, either 4 or 8. */
+    uint32_t                       Count;                                      /* The number of values in the array. */
+    uint32_t                       DataSize;                                   /* The total size of the encoded array, in bytes, including the header. */
+} MEMIO_DELTA_PACK_HEADER;
+
+/* @summary Define the directory entry describing one block of an array encoded by DeltaPack32 or DeltaPack64.
+ * Value i of the block is First + the sum for k <= i of (delta k + MinDelta), where delta 0 is always zero and each delta is stored in BitWidth bits using BitPack32.
+ * Arithmetic wraps modulo 2^32 or 2^64, so unsorted arrays are encoded correctly, just less compactly.
+ */
+typedef struct MEMIO_DELTA_PACK_BLOCK {
+    uint32_t                       DataOffset;                                 /* The byte offset of the packed deltas of the block from the start of the encoded array. */
+    uint32_t                       BitWidth;                                   /* The number of bits stored per delta, from 0 to 32, or MEMIO_DELTA_PACK_RAW. */
+    uint64_t                       First;                                      /* The first value in the block minus MinDelta, or the first value if BitWidth is MEMIO_DELTA_PACK_RAW. */
+    uint64_t                       MinDelta;                                   /* The smallest difference between consecutive values in the block, as a signed value, subtracted from each delta before packing. */
+} MEMIO_DELTA_PACK_BLOCK;
+
+/* @summary Define the maximum number of characters written by the decimal text formatting functions. No nul terminator is written.
+ * MEMIO_TEXT_MAX_UI32: The maximum length of the text written by FormatDecimal_ui32.
+ * MEMIO_TEXT_MAX_SI32: The maximum length of the text written by FormatDecimal_si32.
+ * MEMIO_TEXT_MAX_UI64: The maximum length of the text written by FormatDecimal_ui64.
+ * MEMIO_TEXT_MAX_SI64: The maximum length of the text written by FormatDecimal_si64.
+ * MEMIO_TEXT_MAX_F32: The maximum length of the text written by FormatDecimal_f32.
+ * MEMIO_TEXT_MAX_F64: The maximum length of the text written by FormatDecimal_f64.
+ */
+#ifndef MEMIO_TEXT_CONSTANTS
+#   define MEMIO_TEXT_CONSTANTS
+#   define MEMIO_TEXT_MAX_UI32            10
+#   define MEMIO_TEXT_MAX_SI32            11
+#   define MEMIO_TEXT_MAX_UI64            20
+#   define MEMIO_TEXT_MAX_SI64            20
+#   define MEMIO_TEXT_MAX_F32             22
+#   define MEMIO_TEXT_MAX_F64             25
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -740,6 +845,1105 @@ Write_f64_lsb
     ptrdiff_t offset
 );
 
+/* @summary Swap the bytes of each 16-bit value in an array, in place.
+ * @param data A pointer to the array. The array does not need to be aligned.
+ * @param count The number of 16-bit values in the array.
+ */
+PIL_API(void)
+ByteSwapArray16
+(
+    void   *data, 
+    size_t count
+);
+
+/* @summary Swap the bytes of each 32-bit value in an array, in place.
+ * @param data A pointer to the array. The array does not need to be aligned.
+ * @param count The number of 32-bit values in the array.
+ */
+PIL_API(void)
+ByteSwapArray32
+(
+    void   *data, 
+    size_t count
+);
+
+/* @summary Swap the bytes of each 64-bit value in an array, in place.
+ * @param data A pointer to the array. The array does not need to be aligned.
+ * @param count The number of 64-bit values in the array.
+ */
+PIL_API(void)
+ByteSwapArray64
+(
+    void   *data, 
+    size_t count
+);
+
+/* @summary Read an array of signed 16-bit integer values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_si16_msb
+(
+    int16_t   *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of signed 16-bit integer values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_si16_lsb
+(
+    int16_t   *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of unsigned 16-bit integer values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_ui16_msb
+(
+    uint16_t  *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of unsigned 16-bit integer values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_ui16_lsb
+(
+    uint16_t  *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of signed 32-bit integer values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_si32_msb
+(
+    int32_t   *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of signed 32-bit integer values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_si32_lsb
+(
+    int32_t   *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of unsigned 32-bit integer values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_ui32_msb
+(
+    uint32_t  *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of unsigned 32-bit integer values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_ui32_lsb
+(
+    uint32_t  *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of signed 64-bit integer values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_si64_msb
+(
+    int64_t   *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of signed 64-bit integer values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_si64_lsb
+(
+    int64_t   *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of unsigned 64-bit integer values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_ui64_msb
+(
+    uint64_t  *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of unsigned 64-bit integer values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_ui64_lsb
+(
+    uint64_t  *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of 32-bit floating-point values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_f32_msb
+(
+    float     *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of 32-bit floating-point values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_f32_lsb
+(
+    float     *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of 64-bit floating-point values stored in big-endian (MSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_f64_msb
+(
+    double    *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Read an array of 64-bit floating-point values stored in little-endian (LSB first) format from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the buffer to read from. The buffer does not need to be aligned, and may be the same as dst.
+ * @param count The number of values to read.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+ReadArray_f64_lsb
+(
+    double    *dst, 
+    void const *src, 
+    size_t    count
+);
+
+/* @summary Write an array of signed 16-bit integer values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_si16_msb
+(
+    void                *dst, 
+    int16_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 16-bit integer values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_si16_lsb
+(
+    void                *dst, 
+    int16_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 16-bit integer values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_ui16_msb
+(
+    void                *dst, 
+    uint16_t const     *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 16-bit integer values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_ui16_lsb
+(
+    void                *dst, 
+    uint16_t const     *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 32-bit integer values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_si32_msb
+(
+    void                *dst, 
+    int32_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 32-bit integer values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_si32_lsb
+(
+    void                *dst, 
+    int32_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 32-bit integer values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_ui32_msb
+(
+    void                *dst, 
+    uint32_t const     *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 32-bit integer values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_ui32_lsb
+(
+    void                *dst, 
+    uint32_t const     *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 64-bit integer values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_si64_msb
+(
+    void                *dst, 
+    int64_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 64-bit integer values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_si64_lsb
+(
+    void                *dst, 
+    int64_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 64-bit integer values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_ui64_msb
+(
+    void                *dst, 
+    uint64_t const     *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 64-bit integer values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_ui64_lsb
+(
+    void                *dst, 
+    uint64_t const     *src, 
+    size_t             count
+);
+
+/* @summary Write an array of 32-bit floating-point values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_f32_msb
+(
+    void                *dst, 
+    float const        *src, 
+    size_t             count
+);
+
+/* @summary Write an array of 32-bit floating-point values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_f32_lsb
+(
+    void                *dst, 
+    float const        *src, 
+    size_t             count
+);
+
+/* @summary Write an array of 64-bit floating-point values to a memory location. The values are written in big-endian (MSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_f64_msb
+(
+    void                *dst, 
+    double const       *src, 
+    size_t             count
+);
+
+/* @summary Write an array of 64-bit floating-point values to a memory location. The values are written in little-endian (LSB first) format.
+ * @param dst A pointer to the buffer to write to. The buffer does not need to be aligned, and may be the same as src.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_f64_lsb
+(
+    void                *dst, 
+    double const       *src, 
+    size_t             count
+);
+
+/* @summary Write an unsigned 32-bit integer value to a memory location using the LEB128 variable-length encoding, which stores 7 bits per byte and uses fewer bytes for smaller values.
+ * @param addr A pointer to the buffer to write to. At least MEMIO_VARINT32_MAX_SIZE bytes must be available.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written, from 1 to MEMIO_VARINT32_MAX_SIZE.
+ */
+PIL_API(size_t)
+Write_varint32
+(
+    void       *addr, 
+    uint32_t   value,
+    ptrdiff_t offset
+);
+
+/* @summary Write an unsigned 64-bit integer value to a memory location using the LEB128 variable-length encoding.
+ * @param addr A pointer to the buffer to write to. At least MEMIO_VARINT64_MAX_SIZE bytes must be available.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written, from 1 to MEMIO_VARINT64_MAX_SIZE.
+ */
+PIL_API(size_t)
+Write_varint64
+(
+    void       *addr, 
+    uint64_t   value,
+    ptrdiff_t offset
+);
+
+/* @summary Read an unsigned 32-bit integer value stored using the LEB128 variable-length encoding from a memory location.
+ * @param o_value On return, set to the decoded value.
+ * @param addr A pointer to the encoded value.
+ * @param size The number of bytes available at addr.
+ * @return The number of bytes read, or zero if the value is truncated or does not fit in 32 bits.
+ */
+PIL_API(size_t)
+Read_varint32
+(
+    uint32_t *o_value,
+    void const  *addr,
+    size_t       size
+);
+
+/* @summary Read an unsigned 64-bit integer value stored using the LEB128 variable-length encoding from a memory location.
+ * @param o_value On return, set to the decoded value.
+ * @param addr A pointer to the encoded value.
+ * @param size The number of bytes available at addr.
+ * @return The number of bytes read, or zero if the value is truncated or does not fit in 64 bits.
+ */
+PIL_API(size_t)
+Read_varint64
+(
+    uint64_t *o_value,
+    void const  *addr,
+    size_t       size
+);
+
+/* @summary Write an array of unsigned 32-bit integer values to a memory location using the LEB128 variable-length encoding.
+ * @param dst A pointer to the buffer to write to. At least count * MEMIO_VARINT32_MAX_SIZE bytes must be available.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_varint32
+(
+    void                *dst, 
+    uint32_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 64-bit integer values to a memory location using the LEB128 variable-length encoding.
+ * @param dst A pointer to the buffer to write to. At least count * MEMIO_VARINT64_MAX_SIZE bytes must be available.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_varint64
+(
+    void                *dst, 
+    uint64_t const      *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 32-bit integer values to a memory location using zigzag coding followed by the LEB128 variable-length encoding, so that values of small magnitude use few bytes.
+ * @param dst A pointer to the buffer to write to. At least count * MEMIO_VARINT32_MAX_SIZE bytes must be available.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_zigzag32
+(
+    void                *dst, 
+    int32_t const       *src, 
+    size_t             count
+);
+
+/* @summary Write an array of signed 64-bit integer values to a memory location using zigzag coding followed by the LEB128 variable-length encoding.
+ * @param dst A pointer to the buffer to write to. At least count * MEMIO_VARINT64_MAX_SIZE bytes must be available.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_zigzag64
+(
+    void                *dst, 
+    int64_t const       *src, 
+    size_t             count
+);
+
+/* @summary Read an array of unsigned 32-bit integer values stored using the LEB128 variable-length encoding from a memory location.
+ * Runs of single-byte values are decoded 16 at a time using SIMD instructions where available.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded values.
+ * @param src_size The number of bytes available at src.
+ * @param count The number of values to read.
+ * @return The number of bytes read, or zero if the encoded data is truncated or malformed.
+ */
+PIL_API(size_t)
+ReadArray_varint32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+);
+
+/* @summary Read an array of unsigned 64-bit integer values stored using the LEB128 variable-length encoding from a memory location.
+ * Runs of single-byte values are decoded 16 at a time using SIMD instructions where available.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded values.
+ * @param src_size The number of bytes available at src.
+ * @param count The number of values to read.
+ * @return The number of bytes read, or zero if the encoded data is truncated or malformed.
+ */
+PIL_API(size_t)
+ReadArray_varint64
+(
+    uint64_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+);
+
+/* @summary Read an array of signed 32-bit integer values written by WriteArray_zigzag32 from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded values.
+ * @param src_size The number of bytes available at src.
+ * @param count The number of values to read.
+ * @return The number of bytes read, or zero if the encoded data is truncated or malformed.
+ */
+PIL_API(size_t)
+ReadArray_zigzag32
+(
+    int32_t             *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+);
+
+/* @summary Read an array of signed 64-bit integer values written by WriteArray_zigzag64 from a memory location.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded values.
+ * @param src_size The number of bytes available at src.
+ * @param count The number of values to read.
+ * @return The number of bytes read, or zero if the encoded data is truncated or malformed.
+ */
+PIL_API(size_t)
+ReadArray_zigzag64
+(
+    int64_t             *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+);
+
+/* @summary Write an array of unsigned 32-bit integer values to a memory location using the Stream VByte encoding.
+ * The encoding stores a 2-bit length code for each value in a block of (count + 3) / 4 control bytes, followed by the 1 to 4 low-order bytes of each value in little-endian order.
+ * Separating the lengths from the data allows the decoder to expand four values at a time with a single byte shuffle.
+ * @param dst A pointer to the buffer to write to. At least StreamVByte_GetMaxSize32(count) bytes must be available.
+ * @param src The array of values to write.
+ * @param count The number of values to write.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+WriteArray_svb32
+(
+    void                *dst, 
+    uint32_t const      *src, 
+    size_t             count
+);
+
+/* @summary Read an array of unsigned 32-bit integer values stored using the Stream VByte encoding from a memory location.
+ * Four values are decoded at a time using a byte shuffle when SSSE3 or NEON instructions are available.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded values.
+ * @param src_size The number of bytes available at src.
+ * @param count The number of values to read. This must match the count passed to WriteArray_svb32.
+ * @return The number of bytes read, or zero if the encoded data is truncated.
+ */
+PIL_API(size_t)
+ReadArray_svb32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+);
+
+/* @summary Pack the low-order bits of each value in an array of unsigned 32-bit integers into a memory buffer.
+ * Each group of MEMIO_BITPACK_BLOCK_SIZE values is stored in a four-lane interleaved layout: value i is packed into lane (i % 4), and each lane is a little-endian bit stream spread across every fourth 32-bit word of the block.
+ * This layout allows a block to be packed and unpacked four values at a time using SIMD shifts. The remaining values are stored as a little-endian (LSB first) bit stream, as written by MEMIO_BIT_WRITER.
+ * @param dst A pointer to the buffer to write to. At least BitPack32_GetSize(count, bit_width) bytes must be available. The buffer does not need to be aligned.
+ * @param values The array of values to pack. Bits above bit_width are discarded.
+ * @param count The number of values to pack.
+ * @param bit_width The number of bits to store for each value, from 0 to 32.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+BitPack32
+(
+    void                *dst, 
+    uint32_t const   *values, 
+    size_t             count, 
+    uint32_t       bit_width
+);
+
+/* @summary Unpack an array of unsigned 32-bit integers packed by BitPack32.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the packed data. The buffer does not need to be aligned.
+ * @param count The number of values to unpack. This must match the count passed to BitPack32.
+ * @param bit_width The number of bits stored for each value, from 0 to 32. This must match the bit_width passed to BitPack32.
+ * @return The number of bytes read.
+ */
+PIL_API(size_t)
+BitUnpack32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t             count, 
+    uint32_t       bit_width
+);
+
+/* @summary Calculate the number of bits required to store the largest value in an array of unsigned 32-bit integers.
+ * @param values The array of values to inspect.
+ * @param count The number of values in the array.
+ * @return The bit_width to pass to BitPack32, from 0 (every value is zero) to 32.
+ */
+PIL_API(uint32_t)
+BitWidth32
+(
+    uint32_t const   *values, 
+    size_t             count
+);
+
+/* @summary Convert an array of 32-bit floating-point values to IEEE 754 16-bit (half precision) floating-point values.
+ * Values too large for half precision become infinity (MEMIO_ROUNDING_MODE_NEAREST) or the largest finite half (MEMIO_ROUNDING_MODE_TRUNCATE), and NaNs remain NaNs.
+ * The F16C instructions are used when the compiler targets them, and NEON for MEMIO_ROUNDING_MODE_NEAREST on ARM64. Otherwise an exact software conversion is used.
+ * @param dst The array of half-precision values, in host byte order. Use WriteArray_ui16_lsb or WriteArray_ui16_msb to store them in a fixed byte order.
+ * @param src The array of values to convert.
+ * @param count The number of values to convert.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+ConvertArray_f32_f16
+(
+    uint16_t            *dst, 
+    float const         *src, 
+    size_t             count, 
+    uint32_t   rounding_mode
+);
+
+/* @summary Convert an array of IEEE 754 16-bit (half precision) floating-point values to 32-bit floating-point values. The conversion is exact.
+ * @param dst The array of converted values.
+ * @param src The array of half-precision values, in host byte order.
+ * @param count The number of values to convert.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+ConvertArray_f16_f32
+(
+    float               *dst, 
+    uint16_t const      *src, 
+    size_t             count
+);
+
+/* @summary Convert an array of 32-bit floating-point values to unsigned normalized 8-bit values, mapping [0, 1] to [0, 255].
+ * Values outside of [0, 1] are clamped, and NaNs become zero.
+ * @param dst The array of normalized values.
+ * @param src The array of values to convert.
+ * @param count The number of values to convert.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+ConvertArray_f32_unorm8
+(
+    uint8_t             *dst, 
+    float const         *src, 
+    size_t             count, 
+    uint32_t   rounding_mode
+);
+
+/* @summary Convert an array of unsigned normalized 8-bit values to 32-bit floating-point values in [0, 1].
+ * @param dst The array of converted values.
+ * @param src The array of normalized values.
+ * @param count The number of values to convert.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+ConvertArray_unorm8_f32
+(
+    float               *dst, 
+    uint8_t const       *src, 
+    size_t             count
+);
+
+/* @summary Convert an array of 32-bit floating-point values to signed normalized 16-bit values, mapping [-1, 1] to [-32767, 32767].
+ * Values outside of [-1, 1] are clamped, and NaNs become zero.
+ * @param dst The array of normalized values, in host byte order.
+ * @param src The array of values to convert.
+ * @param count The number of values to convert.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+ConvertArray_f32_snorm16
+(
+    int16_t             *dst, 
+    float const         *src, 
+    size_t             count, 
+    uint32_t   rounding_mode
+);
+
+/* @summary Convert an array of signed normalized 16-bit values to 32-bit floating-point values in [-1, 1]. Both -32768 and -32767 map to -1.
+ * @param dst The array of converted values.
+ * @param src The array of normalized values, in host byte order.
+ * @param count The number of values to convert.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+ConvertArray_snorm16_f32
+(
+    float               *dst, 
+    int16_t const       *src, 
+    size_t             count
+);
+
+/* @summary Compress an array of unsigned 32-bit integers using delta coding, frame-of-reference coding and bit packing in blocks of MEMIO_BITPACK_BLOCK_SIZE values.
+ * The encoding is most compact for sorted or nearly-sorted arrays, such as handle arrays and offset tables. Each block can be decoded independently with DeltaUnpackBlock32.
+ * @param dst A pointer to the buffer to write to. At least DeltaPack_GetMaxSize(count, 4) bytes must be available. The buffer does not need to be aligned.
+ * @param src The array of values to compress.
+ * @param count The number of values to compress.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+DeltaPack32
+(
+    void                *dst, 
+    uint32_t const      *src, 
+    size_t             count
+);
+
+/* @summary Compress an array of unsigned 64-bit integers using delta coding, frame-of-reference coding and bit packing in blocks of MEMIO_BITPACK_BLOCK_SIZE values.
+ * Blocks whose deltas span more than 32 bits are stored unpacked.
+ * @param dst A pointer to the buffer to write to. At least DeltaPack_GetMaxSize(count, 8) bytes must be available. The buffer does not need to be aligned.
+ * @param src The array of values to compress.
+ * @param count The number of values to compress.
+ * @return The number of bytes written.
+ */
+PIL_API(size_t)
+DeltaPack64
+(
+    void                *dst, 
+    uint64_t const      *src, 
+    size_t             count
+);
+
+/* @summary Retrieve the number of values stored in an array encoded by DeltaPack32 or DeltaPack64.
+ * @param src A pointer to the encoded array.
+ * @param src_size The number of bytes available at src.
+ * @param element_size The expected size of each value, 4 or 8.
+ * @return The number of values in the array, or zero if the encoded data is invalid.
+ */
+PIL_API(size_t)
+DeltaPackGetCount
+(
+    void const          *src, 
+    size_t          src_size, 
+    uint32_t    element_size
+);
+
+/* @summary Decompress an array of unsigned 32-bit integers encoded by DeltaPack32.
+ * @param dst The array to which the values will be written. The array must have space for DeltaPackGetCount(src, src_size, 4) values.
+ * @param src A pointer to the encoded array. The buffer does not need to be aligned.
+ * @param src_size The number of bytes available at src.
+ * @return The number of values written to dst, or zero if the encoded data is invalid.
+ */
+PIL_API(size_t)
+DeltaUnpack32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size
+);
+
+/* @summary Decompress an array of unsigned 64-bit integers encoded by DeltaPack64.
+ * @param dst The array to which the values will be written. The array must have space for DeltaPackGetCount(src, src_size, 8) values.
+ * @param src A pointer to the encoded array. The buffer does not need to be aligned.
+ * @param src_size The number of bytes available at src.
+ * @return The number of values written to dst, or zero if the encoded data is invalid.
+ */
+PIL_API(size_t)
+DeltaUnpack64
+(
+    uint64_t            *dst, 
+    void const          *src, 
+    size_t          src_size
+);
+
+/* @summary Decompress a single block of an array of unsigned 32-bit integers encoded by DeltaPack32.
+ * Value i of the array is stored in block (i / MEMIO_BITPACK_BLOCK_SIZE) at index (i % MEMIO_BITPACK_BLOCK_SIZE).
+ * @param dst The array to which the values will be written. The array must have space for MEMIO_BITPACK_BLOCK_SIZE values.
+ * @param src A pointer to the encoded array. The buffer does not need to be aligned.
+ * @param src_size The number of bytes available at src.
+ * @param block_index The zero-based index of the block to decode.
+ * @return The number of values written to dst, or zero if the encoded data is invalid or block_index is out of range.
+ */
+PIL_API(size_t)
+DeltaUnpackBlock32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t       block_index
+);
+
+/* @summary Decompress a single block of an array of unsigned 64-bit integers encoded by DeltaPack64.
+ * @param dst The array to which the values will be written. The array must have space for MEMIO_BITPACK_BLOCK_SIZE values.
+ * @param src A pointer to the encoded array. The buffer does not need to be aligned.
+ * @param src_size The number of bytes available at src.
+ * @param block_index The zero-based index of the block to decode.
+ * @return The number of values written to dst, or zero if the encoded data is invalid or block_index is out of range.
+ */
+PIL_API(size_t)
+DeltaUnpackBlock64
+(
+    uint64_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t       block_index
+);
+
+/* @summary Format an unsigned 32-bit integer as decimal text, two digits at a time using a digit-pair table.
+ * @param dst The buffer to which the text will be written. The buffer must have space for at least MEMIO_TEXT_MAX_UI32 characters. No nul terminator is written.
+ * @param value The value to format.
+ * @return The number of characters written to dst.
+ */
+PIL_API(size_t)
+FormatDecimal_ui32
+(
+    char       *dst, 
+    uint32_t   value
+);
+
+/* @summary Format a signed 32-bit integer as decimal text, two digits at a time using a digit-pair table.
+ * @param dst The buffer to which the text will be written. The buffer must have space for at least MEMIO_TEXT_MAX_SI32 characters. No nul terminator is written.
+ * @param value The value to format.
+ * @return The number of characters written to dst.
+ */
+PIL_API(size_t)
+FormatDecimal_si32
+(
+    char       *dst, 
+    int32_t    value
+);
+
+/* @summary Format an unsigned 64-bit integer as decimal text, two digits at a time using a digit-pair table.
+ * @param dst The buffer to which the text will be written. The buffer must have space for at least MEMIO_TEXT_MAX_UI64 characters. No nul terminator is written.
+ * @param value The value to format.
+ * @return The number of characters written to dst.
+ */
+PIL_API(size_t)
+FormatDecimal_ui64
+(
+    char       *dst, 
+    uint64_t   value
+);
+
+/* @summary Format a signed 64-bit integer as decimal text, two digits at a time using a digit-pair table.
+ * @param dst The buffer to which the text will be written. The buffer must have space for at least MEMIO_TEXT_MAX_SI64 characters. No nul terminator is written.
+ * @param value The value to format.
+ * @return The number of characters written to dst.
+ */
+PIL_API(size_t)
+FormatDecimal_si64
+(
+    char       *dst, 
+    int64_t    value
+);
+
+/* @summary Format a 32-bit floating point value as the shortest decimal text that parses back to the same value.
+ * Values with a decimal exponent from -6 to 20 are written in fixed notation (for example 0.001 or 1234.5), and other values in exponential notation (for example 1.5e+30).
+ * Infinities are written as inf or -inf, and NaN values as nan.
+ * @param dst The buffer to which the text will be written. The buffer must have space for at least MEMIO_TEXT_MAX_F32 characters. No nul terminator is written.
+ * @param value The value to format.
+ * @return The number of characters written to dst.
+ */
+PIL_API(size_t)
+FormatDecimal_f32
+(
+    char       *dst, 
+    float     value
+);
+
+/* @summary Format a 64-bit floating point value as the shortest decimal text that parses back to the same value.
+ * Values with a decimal exponent from -6 to 20 are written in fixed notation (for example 0.001 or 1234.5), and other values in exponential notation (for example 1.5e+300).
+ * Infinities are written as inf or -inf, and NaN values as nan.
+ * @param dst The buffer to which the text will be written. The buffer must have space for at least MEMIO_TEXT_MAX_F64 characters. No nul terminator is written.
+ * @param value The value to format.
+ * @return The number of characters written to dst.
+ */
+PIL_API(size_t)
+FormatDecimal_f64
+(
+    char       *dst, 
+    double    value
+);
+
+/* @summary Parse an unsigned 32-bit integer from decimal text. Up to sixteen digits are converted at once using SIMD instructions where available.
+ * @param o_value On return, set to the parsed value. Not modified if the text is not a valid number.
+ * @param src The text to parse. The text does not need to be nul-terminated, and parsing stops at the first character that is not part of the number.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if the text does not start with a valid number or the value is out of range.
+ */
+PIL_API(size_t)
+ParseDecimal_ui32
+(
+    uint32_t  *o_value, 
+    char const      *src, 
+    size_t      src_size
+);
+
+/* @summary Parse a signed 32-bit integer from decimal text with an optional leading sign.
+ * @param o_value On return, set to the parsed value. Not modified if the text is not a valid number.
+ * @param src The text to parse. The text does not need to be nul-terminated, and parsing stops at the first character that is not part of the number.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if the text does not start with a valid number or the value is out of range.
+ */
+PIL_API(size_t)
+ParseDecimal_si32
+(
+    int32_t   *o_value, 
+    char const      *src, 
+    size_t      src_size
+);
+
+/* @summary Parse an unsigned 64-bit integer from decimal text. Up to sixteen digits are converted at once using SIMD instructions where available.
+ * @param o_value On return, set to the parsed value. Not modified if the text is not a valid number.
+ * @param src The text to parse. The text does not need to be nul-terminated, and parsing stops at the first character that is not part of the number.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if the text does not start with a valid number or the value is out of range.
+ */
+PIL_API(size_t)
+ParseDecimal_ui64
+(
+    uint64_t  *o_value, 
+    char const      *src, 
+    size_t      src_size
+);
+
+/* @summary Parse a signed 64-bit integer from decimal text with an optional leading sign.
+ * @param o_value On return, set to the parsed value. Not modified if the text is not a valid number.
+ * @param src The text to parse. The text does not need to be nul-terminated, and parsing stops at the first character that is not part of the number.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if the text does not start with a valid number or the value is out of range.
+ */
+PIL_API(size_t)
+ParseDecimal_si64
+(
+    int64_t   *o_value, 
+    char const      *src, 
+    size_t      src_size
+);
+
+/* @summary Parse a 32-bit floating point value from decimal text in fixed or exponential notation, or inf or nan, with an optional leading sign.
+ * The result is correctly rounded. Values too large to represent are returned as infinity.
+ * @param o_value On return, set to the parsed value. Not modified if the text is not a valid number.
+ * @param src The text to parse. The text does not need to be nul-terminated, and parsing stops at the first character that is not part of the number.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if the text does not start with a valid number.
+ */
+PIL_API(size_t)
+ParseDecimal_f32
+(
+    float     *o_value, 
+    char const      *src, 
+    size_t      src_size
+);
+
+/* @summary Parse a 64-bit floating point value from decimal text in fixed or exponential notation, or inf or nan, with an optional leading sign.
+ * The result is correctly rounded. Values too large to represent are returned as infinity.
+ * @param o_value On return, set to the parsed value. Not modified if the text is not a valid number.
+ * @param src The text to parse. The text does not need to be nul-terminated, and parsing stops at the first character that is not part of the number.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if the text does not start with a valid number.
+ */
+PIL_API(size_t)
+ParseDecimal_f64
+(
+    double    *o_value, 
+    char const      *src, 
+    size_t      src_size
+);
+
 #ifdef __cplusplus
 }; /* extern "C" */
 #endif
@@ -0,0 +1,1553 @@
+/**
+ * @summary memio_inline.h: Define inline versions of the memory buffer read and
+ * write functions declared in memio.h, and C++ templates keyed on value type and
+ * byte order. Values are loaded and stored with memcpy, which is well-defined
+ * for unaligned addresses and compiles to a single load or store (or movbe) on
+ * targets that support unaligned access. The functions in memio.h remain
+ * exported for code that needs a stable ABI, and are implemented using these.
+ * Zigzag coding, single-value LEB128 variable-length integer reads and writes,
+ * and half-precision and normalized integer conversions are also defined here.
+ */
+#ifndef __PIL_MEMIO_INLINE_H__
+#define __PIL_MEMIO_INLINE_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   include <string.h>
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_MEMIO_H__
+#       include "memio.h"
+#   endif
+#endif
+
+/* @summary Define PIL_MEMIO_CONSTEXPR to mark the byte swap functions constexpr when compiling as C++.
+ * The MSVC byte swap intrinsics cannot be evaluated at compile time, so MSVC uses the portable shift and mask sequence, which it also compiles to a single bswap.
+ */
+#ifndef PIL_MEMIO_CONSTEXPR
+#   if defined(__cplusplus)
+#       define PIL_MEMIO_CONSTEXPR           constexpr
+#   else
+#       define PIL_MEMIO_CONSTEXPR
+#   endif
+#endif
+
+/* @summary Swap the bytes in a two-byte value.
+ * @param v The value to byte swap.
+ * @return The byte swapped value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR uint16_t
+MemioByteSwap16
+(
+    uint16_t v
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_GNUC || PIL_TARGET_COMPILER == PIL_COMPILER_CLANG
+    return __builtin_bswap16(v);
+#else
+    return (uint16_t)(((v >> 8) & 0x00FF) | ((v << 8) & 0xFF00));
+#endif
+}
+
+/* @summary Swap the bytes in a four-byte value.
+ * @param v The value to byte swap.
+ * @return The byte swapped value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR uint32_t
+MemioByteSwap32
+(
+    uint32_t v
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_GNUC || PIL_TARGET_COMPILER == PIL_COMPILER_CLANG
+    return __builtin_bswap32(v);
+#else
+    return ((v >> 24) & 0x000000FFUL) | ((v >> 8) & 0x0000FF00UL) | ((v << 8) & 0x00FF0000UL) | ((v << 24) & 0xFF000000UL);
+#endif
+}
+
+/* @summary Swap the bytes in an eight-byte value.
+ * @param v The value to byte swap.
+ * @return The byte swapped value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR uint64_t
+MemioByteSwap64
+(
+    uint64_t v
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_GNUC || PIL_TARGET_COMPILER == PIL_COMPILER_CLANG
+    return __builtin_bswap64(v);
+#else
+    return ((uint64_t) MemioByteSwap32((uint32_t)(v & 0xFFFFFFFFULL)) << 32) | (uint64_t) MemioByteSwap32((uint32_t)(v >> 32));
+#endif
+}
+
+/* @summary Read a signed 8-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 8-bit integer value at the specified location.
+ */
+static PIL_INLINE int8_t
+ReadInline_si8
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    int8_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(int8_t));
+    return value;
+}
+
+/* @summary Read an unsigned 8-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 8-bit integer value at the specified location.
+ */
+static PIL_INLINE uint8_t
+ReadInline_ui8
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint8_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(uint8_t));
+    return value;
+}
+
+/* @summary Read a signed 16-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 16-bit integer value at the specified location.
+ */
+static PIL_INLINE int16_t
+ReadInline_si16
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    int16_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(int16_t));
+    return value;
+}
+
+/* @summary Read a signed 16-bit integer value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 16-bit integer value at the specified location.
+ */
+static PIL_INLINE int16_t
+ReadInline_si16_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint16_t bits;
+    int16_t  value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint16_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap16(bits);
+#endif
+    memcpy(&value, &bits, sizeof(int16_t));
+    return value;
+}
+
+/* @summary Read a signed 16-bit integer value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 16-bit integer value at the specified location.
+ */
+static PIL_INLINE int16_t
+ReadInline_si16_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint16_t bits;
+    int16_t  value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint16_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap16(bits);
+#endif
+    memcpy(&value, &bits, sizeof(int16_t));
+    return value;
+}
+
+/* @summary Read an unsigned 16-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 16-bit integer value at the specified location.
+ */
+static PIL_INLINE uint16_t
+ReadInline_ui16
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint16_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(uint16_t));
+    return value;
+}
+
+/* @summary Read an unsigned 16-bit integer value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 16-bit integer value at the specified location.
+ */
+static PIL_INLINE uint16_t
+ReadInline_ui16_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint16_t bits;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint16_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap16(bits);
+#endif
+    return bits;
+}
+
+/* @summary Read an unsigned 16-bit integer value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 16-bit integer value at the specified location.
+ */
+static PIL_INLINE uint16_t
+ReadInline_ui16_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint16_t bits;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint16_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap16(bits);
+#endif
+    return bits;
+}
+
+/* @summary Read a signed 32-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 32-bit integer value at the specified location.
+ */
+static PIL_INLINE int32_t
+ReadInline_si32
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    int32_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(int32_t));
+    return value;
+}
+
+/* @summary Read a signed 32-bit integer value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 32-bit integer value at the specified location.
+ */
+static PIL_INLINE int32_t
+ReadInline_si32_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    int32_t  value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy(&value, &bits, sizeof(int32_t));
+    return value;
+}
+
+/* @summary Read a signed 32-bit integer value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 32-bit integer value at the specified location.
+ */
+static PIL_INLINE int32_t
+ReadInline_si32_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    int32_t  value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy(&value, &bits, sizeof(int32_t));
+    return value;
+}
+
+/* @summary Read an unsigned 32-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 32-bit integer value at the specified location.
+ */
+static PIL_INLINE uint32_t
+ReadInline_ui32
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(uint32_t));
+    return value;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 32-bit integer value at the specified location.
+ */
+static PIL_INLINE uint32_t
+ReadInline_ui32_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    return bits;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 32-bit integer value at the specified location.
+ */
+static PIL_INLINE uint32_t
+ReadInline_ui32_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    return bits;
+}
+
+/* @summary Read a signed 64-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 64-bit integer value at the specified location.
+ */
+static PIL_INLINE int64_t
+ReadInline_si64
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    int64_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(int64_t));
+    return value;
+}
+
+/* @summary Read a signed 64-bit integer value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 64-bit integer value at the specified location.
+ */
+static PIL_INLINE int64_t
+ReadInline_si64_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    int64_t  value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy(&value, &bits, sizeof(int64_t));
+    return value;
+}
+
+/* @summary Read a signed 64-bit integer value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The signed 64-bit integer value at the specified location.
+ */
+static PIL_INLINE int64_t
+ReadInline_si64_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    int64_t  value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy(&value, &bits, sizeof(int64_t));
+    return value;
+}
+
+/* @summary Read an unsigned 64-bit integer value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 64-bit integer value at the specified location.
+ */
+static PIL_INLINE uint64_t
+ReadInline_ui64
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(uint64_t));
+    return value;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 64-bit integer value at the specified location.
+ */
+static PIL_INLINE uint64_t
+ReadInline_ui64_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    return bits;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The unsigned 64-bit integer value at the specified location.
+ */
+static PIL_INLINE uint64_t
+ReadInline_ui64_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    return bits;
+}
+
+/* @summary Read a 32-bit floating-point value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The 32-bit floating-point value at the specified location.
+ */
+static PIL_INLINE float
+ReadInline_f32
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    float value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(float));
+    return value;
+}
+
+/* @summary Read a 32-bit floating-point value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The 32-bit floating-point value at the specified location.
+ */
+static PIL_INLINE float
+ReadInline_f32_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    float    value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+/* @summary Read a 32-bit floating-point value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The 32-bit floating-point value at the specified location.
+ */
+static PIL_INLINE float
+ReadInline_f32_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    float    value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+/* @summary Read a 64-bit floating-point value from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The 64-bit floating-point value at the specified location.
+ */
+static PIL_INLINE double
+ReadInline_f64
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    double value;
+    memcpy(&value, (uint8_t const*) addr + offset, sizeof(double));
+    return value;
+}
+
+/* @summary Read a 64-bit floating-point value stored in big endian format (MSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The 64-bit floating-point value at the specified location.
+ */
+static PIL_INLINE double
+ReadInline_f64_msb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    double   value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+/* @summary Read a 64-bit floating-point value stored in little endian format (LSB first) from a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The 64-bit floating-point value at the specified location.
+ */
+static PIL_INLINE double
+ReadInline_f64_lsb
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    double   value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(uint64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+/* @summary Write a signed 8-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si8
+(
+    void       *addr, 
+    int8_t     value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(int8_t));
+    return sizeof(int8_t);
+}
+
+/* @summary Write an unsigned 8-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui8
+(
+    void       *addr, 
+    uint8_t    value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint8_t));
+    return sizeof(uint8_t);
+}
+
+/* @summary Write a signed 16-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si16
+(
+    void       *addr, 
+    int16_t    value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(int16_t));
+    return sizeof(int16_t);
+}
+
+/* @summary Write a signed 16-bit integer value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si16_msb
+(
+    void       *addr, 
+    int16_t    value, 
+    ptrdiff_t offset
+)
+{
+    uint16_t bits;
+    memcpy(&bits, &value, sizeof(int16_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap16(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(int16_t));
+    return sizeof(int16_t);
+}
+
+/* @summary Write a signed 16-bit integer value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si16_lsb
+(
+    void       *addr, 
+    int16_t    value, 
+    ptrdiff_t offset
+)
+{
+    uint16_t bits;
+    memcpy(&bits, &value, sizeof(int16_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap16(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(int16_t));
+    return sizeof(int16_t);
+}
+
+/* @summary Write an unsigned 16-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui16
+(
+    void       *addr, 
+    uint16_t   value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint16_t));
+    return sizeof(uint16_t);
+}
+
+/* @summary Write an unsigned 16-bit integer value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui16_msb
+(
+    void       *addr, 
+    uint16_t   value, 
+    ptrdiff_t offset
+)
+{
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    value = MemioByteSwap16(value);
+#endif
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint16_t));
+    return sizeof(uint16_t);
+}
+
+/* @summary Write an unsigned 16-bit integer value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui16_lsb
+(
+    void       *addr, 
+    uint16_t   value, 
+    ptrdiff_t offset
+)
+{
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    value = MemioByteSwap16(value);
+#endif
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint16_t));
+    return sizeof(uint16_t);
+}
+
+/* @summary Write a signed 32-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si32
+(
+    void       *addr, 
+    int32_t    value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(int32_t));
+    return sizeof(int32_t);
+}
+
+/* @summary Write a signed 32-bit integer value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si32_msb
+(
+    void       *addr, 
+    int32_t    value, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(int32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(int32_t));
+    return sizeof(int32_t);
+}
+
+/* @summary Write a signed 32-bit integer value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si32_lsb
+(
+    void       *addr, 
+    int32_t    value, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(int32_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(int32_t));
+    return sizeof(int32_t);
+}
+
+/* @summary Write an unsigned 32-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui32
+(
+    void       *addr, 
+    uint32_t   value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint32_t));
+    return sizeof(uint32_t);
+}
+
+/* @summary Write an unsigned 32-bit integer value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui32_msb
+(
+    void       *addr, 
+    uint32_t   value, 
+    ptrdiff_t offset
+)
+{
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    value = MemioByteSwap32(value);
+#endif
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint32_t));
+    return sizeof(uint32_t);
+}
+
+/* @summary Write an unsigned 32-bit integer value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui32_lsb
+(
+    void       *addr, 
+    uint32_t   value, 
+    ptrdiff_t offset
+)
+{
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    value = MemioByteSwap32(value);
+#endif
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint32_t));
+    return sizeof(uint32_t);
+}
+
+/* @summary Write a signed 64-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si64
+(
+    void       *addr, 
+    int64_t    value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(int64_t));
+    return sizeof(int64_t);
+}
+
+/* @summary Write a signed 64-bit integer value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si64_msb
+(
+    void       *addr, 
+    int64_t    value, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(int64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(int64_t));
+    return sizeof(int64_t);
+}
+
+/* @summary Write a signed 64-bit integer value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_si64_lsb
+(
+    void       *addr, 
+    int64_t    value, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(int64_t));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(int64_t));
+    return sizeof(int64_t);
+}
+
+/* @summary Write an unsigned 64-bit integer value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui64
+(
+    void       *addr, 
+    uint64_t   value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint64_t));
+    return sizeof(uint64_t);
+}
+
+/* @summary Write an unsigned 64-bit integer value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui64_msb
+(
+    void       *addr, 
+    uint64_t   value, 
+    ptrdiff_t offset
+)
+{
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    value = MemioByteSwap64(value);
+#endif
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint64_t));
+    return sizeof(uint64_t);
+}
+
+/* @summary Write an unsigned 64-bit integer value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_ui64_lsb
+(
+    void       *addr, 
+    uint64_t   value, 
+    ptrdiff_t offset
+)
+{
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    value = MemioByteSwap64(value);
+#endif
+    memcpy((uint8_t*) addr + offset, &value, sizeof(uint64_t));
+    return sizeof(uint64_t);
+}
+
+/* @summary Write a 32-bit floating-point value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_f32
+(
+    void       *addr, 
+    float      value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(float));
+    return sizeof(float);
+}
+
+/* @summary Write a 32-bit floating-point value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_f32_msb
+(
+    void       *addr, 
+    float      value, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(float));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(float));
+    return sizeof(float);
+}
+
+/* @summary Write a 32-bit floating-point value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_f32_lsb
+(
+    void       *addr, 
+    float      value, 
+    ptrdiff_t offset
+)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(float));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap32(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(float));
+    return sizeof(float);
+}
+
+/* @summary Write a 64-bit floating-point value to a memory location. The location does not need to be aligned.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_f64
+(
+    void       *addr, 
+    double     value, 
+    ptrdiff_t offset
+)
+{
+    memcpy((uint8_t*) addr + offset, &value, sizeof(double));
+    return sizeof(double);
+}
+
+/* @summary Write a 64-bit floating-point value to a memory location. The location does not need to be aligned. The value is written in big-endian (MSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_f64_msb
+(
+    void       *addr, 
+    double     value, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(double));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_MSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(double));
+    return sizeof(double);
+}
+
+/* @summary Write a 64-bit floating-point value to a memory location. The location does not need to be aligned. The value is written in little-endian (LSB first) format.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+static PIL_INLINE size_t
+WriteInline_f64_lsb
+(
+    void       *addr, 
+    double     value, 
+    ptrdiff_t offset
+)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(double));
+#if PIL_SYSTEM_ENDIANESS != PIL_ENDIANESS_LSB_FIRST
+    bits = MemioByteSwap64(bits);
+#endif
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(double));
+    return sizeof(double);
+}
+
+/* @summary Map a signed 32-bit integer to an unsigned value such that values of small magnitude map to small values (0, -1, 1, -2, ... map to 0, 1, 2, 3, ...).
+ * @param v The value to encode.
+ * @return The zigzag-coded value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR uint32_t
+MemioZigZagEncode32
+(
+    int32_t v
+)
+{
+    return ((uint32_t) v << 1) ^ (uint32_t)(v >> 31);
+}
+
+/* @summary Map a signed 64-bit integer to an unsigned value such that values of small magnitude map to small values.
+ * @param v The value to encode.
+ * @return The zigzag-coded value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR uint64_t
+MemioZigZagEncode64
+(
+    int64_t v
+)
+{
+    return ((uint64_t) v << 1) ^ (uint64_t)(v >> 63);
+}
+
+/* @summary Recover a signed 32-bit integer from its zigzag-coded value.
+ * @param v The zigzag-coded value.
+ * @return The original signed value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR int32_t
+MemioZigZagDecode32
+(
+    uint32_t v
+)
+{
+    return (int32_t)((v >> 1) ^ (0U - (v & 1)));
+}
+
+/* @summary Recover a signed 64-bit integer from its zigzag-coded value.
+ * @param v The zigzag-coded value.
+ * @return The original signed value.
+ */
+static PIL_INLINE PIL_MEMIO_CONSTEXPR int64_t
+MemioZigZagDecode64
+(
+    uint64_t v
+)
+{
+    return (int64_t)((v >> 1) ^ (0ULL - (v & 1)));
+}
+
+/* @summary Write an unsigned 32-bit integer value to a memory location using the LEB128 variable-length encoding.
+ * @param addr A pointer to the buffer to write to. At least MEMIO_VARINT32_MAX_SIZE bytes must be available.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written, from 1 to MEMIO_VARINT32_MAX_SIZE.
+ */
+static PIL_INLINE size_t
+WriteInline_varint32
+(
+    void       *addr, 
+    uint32_t   value, 
+    ptrdiff_t offset
+)
+{
+    uint8_t *dst = (uint8_t*) addr + offset;
+    size_t     n = 0;
+    while (value >= 0x80) {
+        dst[n++] = (uint8_t)(value | 0x80);
+        value  >>= 7;
+    }
+    dst[n++] = (uint8_t) value;
+    return n;
+}
+
+/* @summary Write an unsigned 64-bit integer value to a memory location using the LEB128 variable-length encoding.
+ * @param addr A pointer to the buffer to write to. At least MEMIO_VARINT64_MAX_SIZE bytes must be available.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written, from 1 to MEMIO_VARINT64_MAX_SIZE.
+ */
+static PIL_INLINE size_t
+WriteInline_varint64
+(
+    void       *addr, 
+    uint64_t   value, 
+    ptrdiff_t offset
+)
+{
+    uint8_t *dst = (uint8_t*) addr + offset;
+    size_t     n = 0;
+    while (value >= 0x80) {
+        dst[n++] = (uint8_t)(value | 0x80);
+        value  >>= 7;
+    }
+    dst[n++] = (uint8_t) value;
+    return n;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored using the LEB128 variable-length encoding from a memory location.
+ * @param o_value On return, set to the decoded value.
+ * @param addr A pointer to the encoded value.
+ * @param size The number of bytes available at addr.
+ * @return The number of bytes read, or zero if the value is truncated or does not fit in 32 bits.
+ */
+static PIL_INLINE size_t
+ReadInline_varint32
+(
+    uint32_t *o_value, 
+    void const  *addr, 
+    size_t       size
+)
+{
+    uint8_t const *src = (uint8_t const*) addr;
+    uint32_t     value = 0;
+    size_t           i;
+    for (i = 0; i < size && i < MEMIO_VARINT32_MAX_SIZE; ++i) {
+        uint32_t  byte = src[i];
+        value |= (byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            if (i == MEMIO_VARINT32_MAX_SIZE - 1 && byte > 0x0F) {
+                break; /* the value does not fit in 32 bits */
+            }
+           *o_value = value;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored using the LEB128 variable-length encoding from a memory location.
+ * @param o_value On return, set to the decoded value.
+ * @param addr A pointer to the encoded value.
+ * @param size The number of bytes available at addr.
+ * @return The number of bytes read, or zero if the value is truncated or does not fit in 64 bits.
+ */
+static PIL_INLINE size_t
+ReadInline_varint64
+(
+    uint64_t *o_value, 
+    void const  *addr, 
+    size_t       size
+)
+{
+    uint8_t const *src = (uint8_t const*) addr;
+    uint64_t     value = 0;
+    size_t           i;
+    for (i = 0; i < size && i < MEMIO_VARINT64_MAX_SIZE; ++i) {
+        uint64_t  byte = src[i];
+        value |= (byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            if (i == MEMIO_VARINT64_MAX_SIZE - 1 && byte > 0x01) {
+                break; /* the value does not fit in 64 bits */
+            }
+           *o_value = value;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/* @summary Convert an IEEE 754 16-bit (half precision) floating-point value to a 32-bit floating-point value. The conversion is exact.
+ * @param h The half-precision value.
+ * @return The equivalent 32-bit floating-point value.
+ */
+static PIL_INLINE float
+MemioHalfToFloat
+(
+    uint16_t h
+)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t expo = (h >> 10) & 0x1F;
+    uint32_t mant =  h & 0x03FF;
+    uint32_t bits;
+    float   value;
+    if (expo == 0x1F) {
+        /* infinity or NaN */
+        bits = sign | 0x7F800000UL | (mant << 13);
+    } else if (expo != 0) {
+        /* normal */
+        bits = sign | ((expo + 112) << 23) | (mant << 13);
+    } else if (mant != 0) {
+        /* subnormal - normalize the mantissa */
+        expo = 113;
+        while ((mant & 0x0400) == 0) {
+            mant <<= 1;
+            expo  -= 1;
+        }
+        bits = sign | (expo << 23) | ((mant & 0x03FF) << 13);
+    } else {
+        bits = sign;
+    }
+    memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+/* @summary Convert a 32-bit floating-point value to an IEEE 754 16-bit (half precision) floating-point value.
+ * @param value The value to convert.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The half-precision value.
+ */
+static PIL_INLINE uint16_t
+MemioFloatToHalf
+(
+    float           value, 
+    uint32_t rounding_mode
+)
+{
+    uint32_t bits;
+    uint32_t sign;
+    uint32_t absx;
+    int32_t  expo;
+    uint32_t mant;
+    uint32_t shift;
+    uint32_t h;
+    uint32_t rem;
+
+    memcpy(&bits, &value, sizeof(float));
+    sign = (bits >> 16) & 0x8000;
+    absx =  bits & 0x7FFFFFFFUL;
+    if (absx >= 0x7F800000UL) {
+        /* infinity, or NaN with the payload truncated and the quiet bit set */
+        return (uint16_t)(sign | 0x7C00 | (absx > 0x7F800000UL ? 0x0200 | ((absx >> 13) & 0x03FF) : 0));
+    }
+    expo = (int32_t)(absx >> 23) - 112;
+    mant = (absx & 0x007FFFFFUL) | 0x00800000UL;
+    if (expo >= 31) {
+        /* too large for half precision */
+        return (uint16_t)(sign | (rounding_mode == MEMIO_ROUNDING_MODE_NEAREST ? 0x7C00 : 0x7BFF));
+    }
+    if (expo > 0) {
+        h     = ((uint32_t) expo << 10) | ((mant >> 13) & 0x03FF);
+        shift = 13;
+    } else {
+        /* subnormal in half precision, or rounds to zero */
+        shift = (uint32_t)(14 - expo);
+        if (shift > 24) {
+            return (uint16_t) sign;
+        }
+        h = mant >> shift;
+    }
+    rem = mant & ((1UL << shift) - 1);
+    if (rounding_mode == MEMIO_ROUNDING_MODE_NEAREST) {
+        uint32_t half = 1UL << (shift - 1);
+        if (rem > half || (rem == half && (h & 1) != 0)) {
+            h += 1; /* a carry into the exponent is correct, and may produce infinity */
+        }
+    }
+    return (uint16_t)(sign | h);
+}
+
+/* @summary Round a 32-bit floating-point value to an integer.
+ * @param value The value to round. The magnitude must be less than 2^22.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The rounded value.
+ */
+static PIL_INLINE int32_t
+MemioRoundFloat
+(
+    float           value, 
+    uint32_t rounding_mode
+)
+{
+    if (rounding_mode == MEMIO_ROUNDING_MODE_NEAREST) {
+        /* adding and subtracting 2^23 discards the fraction using the FPU rounding mode, which is round to nearest even */
+        float bias = value >= 0.0f ? 8388608.0f : -8388608.0f;
+        value = (value + bias) - bias;
+    }
+    return (int32_t) value;
+}
+
+/* @summary Convert a 32-bit floating-point value to an unsigned normalized 8-bit value, mapping [0, 1] to [0, 255].
+ * @param value The value to convert. Values outside of [0, 1] are clamped, and NaN becomes zero.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The normalized value.
+ */
+static PIL_INLINE uint8_t
+MemioFloatToUnorm8
+(
+    float           value, 
+    uint32_t rounding_mode
+)
+{
+    value = value > 0.0f ? value : 0.0f;
+    value = value < 1.0f ? value : 1.0f;
+    return (uint8_t) MemioRoundFloat(value * 255.0f, rounding_mode);
+}
+
+/* @summary Convert an unsigned normalized 8-bit value to a 32-bit floating-point value in [0, 1].
+ * @param value The normalized value.
+ * @return The floating-point value.
+ */
+static PIL_INLINE float
+MemioUnorm8ToFloat
+(
+    uint8_t value
+)
+{
+    return (float) value / 255.0f;
+}
+
+/* @summary Convert a 32-bit floating-point value to a signed normalized 16-bit value, mapping [-1, 1] to [-32767, 32767].
+ * @param value The value to convert. Values outside of [-1, 1] are clamped, and NaN becomes zero.
+ * @param rounding_mode One of the values of the MEMIO_ROUNDING_MODE enumeration.
+ * @return The normalized value.
+ */
+static PIL_INLINE int16_t
+MemioFloatToSnorm16
+(
+    float           value, 
+    uint32_t rounding_mode
+)
+{
+    if (value != value) {
+        return 0;
+    }
+    value = value > -1.0f ? value : -1.0f;
+    value = value <  1.0f ? value :  1.0f;
+    return (int16_t) MemioRoundFloat(value * 32767.0f, rounding_mode);
+}
+
+/* @summary Convert a signed normalized 16-bit value to a 32-bit floating-point value in [-1, 1].
+ * @param value The normalized value. Both -32768 and -32767 map to -1.
+ * @return The floating-point value.
+ */
+static PIL_INLINE float
+MemioSnorm16ToFloat
+(
+    int16_t value
+)
+{
+    float f = (float) value / 32767.0f;
+    return f > -1.0f ? f : -1.0f;
+}
+
+#ifdef __cplusplus
+/* @summary Map a value size to the unsigned integer type of the same size, and the function used to byte swap it.
+ */
+template <size_t N>
+struct MEMIO_BITS;
+
+template <>
+struct MEMIO_BITS<1> {
+    typedef uint8_t  Type;
+    static PIL_INLINE constexpr uint8_t  Swap(uint8_t  v) { return v; }
+};
+
+template <>
+struct MEMIO_BITS<2> {
+    typedef uint16_t Type;
+    static PIL_INLINE constexpr uint16_t Swap(uint16_t v) { return MemioByteSwap16(v); }
+};
+
+template <>
+struct MEMIO_BITS<4> {
+    typedef uint32_t Type;
+    static PIL_INLINE constexpr uint32_t Swap(uint32_t v) { return MemioByteSwap32(v); }
+};
+
+template <>
+struct MEMIO_BITS<8> {
+    typedef uint64_t Type;
+    static PIL_INLINE constexpr uint64_t Swap(uint64_t v) { return MemioByteSwap64(v); }
+};
+
+/* @summary Read a value of a given type and byte order from a memory location. The location does not need to be aligned.
+ * @typeparam T The type of value to read. Must be a 1, 2, 4 or 8 byte trivially-copyable type.
+ * @typeparam Endianess The byte order of the stored value, PIL_ENDIANESS_LSB_FIRST or PIL_ENDIANESS_MSB_FIRST. Defaults to the host byte order.
+ * @param addr A pointer to the buffer to read from.
+ * @param offset The byte offset in the buffer at which the value is located.
+ * @return The value at the specified location.
+ */
+template <typename T, int Endianess = PIL_SYSTEM_ENDIANESS>
+static PIL_INLINE T
+MemioRead
+(
+    void const *addr, 
+    ptrdiff_t offset
+)
+{
+    typename MEMIO_BITS<sizeof(T)>::Type bits;
+    T                                   value;
+    memcpy(&bits, (uint8_t const*) addr + offset, sizeof(T));
+    if (Endianess != PIL_SYSTEM_ENDIANESS) {
+        bits = MEMIO_BITS<sizeof(T)>::Swap(bits);
+    }
+    memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+/* @summary Write a value of a given type and byte order to a memory location. The location does not need to be aligned.
+ * @typeparam T The type of value to write. Must be a 1, 2, 4 or 8 byte trivially-copyable type.
+ * @typeparam Endianess The byte order in which to store the value, PIL_ENDIANESS_LSB_FIRST or PIL_ENDIANESS_MSB_FIRST. Defaults to the host byte order.
+ * @param addr A pointer to the buffer to write to.
+ * @param value The value to write.
+ * @param offset The byte offset in the buffer at which the value will be written.
+ * @return The number of bytes written.
+ */
+template <typename T, int Endianess = PIL_SYSTEM_ENDIANESS>
+static PIL_INLINE size_t
+MemioWrite
+(
+    void       *addr, 
+    T          value, 
+    ptrdiff_t offset
+)
+{
+    typename MEMIO_BITS<sizeof(T)>::Type bits;
+    memcpy(&bits, &value, sizeof(T));
+    if (Endianess != PIL_SYSTEM_ENDIANESS) {
+        bits = MEMIO_BITS<sizeof(T)>::Swap(bits);
+    }
+    memcpy((uint8_t*) addr + offset, &bits, sizeof(T));
+    return sizeof(T);
+}
+#endif /* __cplusplus */
+
+#endif /* __PIL_MEMIO_INLINE_H__ */
@@ -0,0 +1,247 @@
+/**
+ * @summary memio_lz.h: Define the functions used to compress and decompress
+ * memory buffers using a fast LZ77-family block codec. The block format is
+ * byte-oriented and uses the same sequence layout as LZ4, trading compression
+ * ratio for speed so that compressed file payloads can be produced and
+ * consumed faster than they can be read or written. None of the functions
+ * allocate memory; the compressor uses a caller-supplied scratch buffer,
+ * typically allocated from a MEMORY_ARENA.
+ *
+ * A frame wraps a sequence of independently compressed blocks, each with its
+ * own checksum, for storage in a file. Frames can be written incrementally
+ * and, because no block references data in another block, the blocks of a
+ * frame can be located with MemioLzFrameReadBlock and decoded in parallel.
+ */
+#ifndef __PIL_MEMIO_LZ_H__
+#define __PIL_MEMIO_LZ_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_MEMMGR_H__
+#       include "memmgr.h"
+#   endif
+#   ifndef __PIL_MEMIO_STREAM_H__
+#       include "memio_stream.h"
+#   endif
+#endif
+
+/* @summary Define various constants used by the LZ block codec.
+ * MEMIO_LZ_HASH_LOG: The base-2 logarithm of the number of entries in the match-finder hash table.
+ * MEMIO_LZ_SCRATCH_SIZE: The size of the scratch buffer required by MemioLzCompress, in bytes.
+ * MEMIO_LZ_SCRATCH_ALIGN: The required alignment of the scratch buffer passed to MemioLzCompress, in bytes.
+ * MEMIO_LZ_MAX_INPUT_SIZE: The maximum number of bytes that can be compressed as a single block.
+ * MEMIO_LZ_FRAME_MAGIC: The value of the first four bytes of a frame ('LZFR' stored little-endian).
+ * MEMIO_LZ_FRAME_HEADER_SIZE: The size of the frame header, in bytes.
+ * MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE: The size of the header preceding each block of a frame, in bytes.
+ * MEMIO_LZ_FRAME_END_SIZE: The size of the end marker terminating a frame, in bytes.
+ * MEMIO_LZ_FRAME_BLOCK_SIZE_DEFAULT: The default maximum number of uncompressed bytes in each block of a frame.
+ * MEMIO_LZ_FRAME_BLOCK_SIZE_MAX: The largest maximum block size supported by a frame.
+ * MEMIO_LZ_FRAME_BLOCK_STORED: A flag set in the stored size of a frame block whose data is not compressed.
+ */
+#ifndef MEMIO_LZ_CONSTANTS
+#   define MEMIO_LZ_CONSTANTS
+#   define MEMIO_LZ_HASH_LOG                   12
+#   define MEMIO_LZ_SCRATCH_SIZE               ((1UL << MEMIO_LZ_HASH_LOG) * sizeof(uint32_t))
+#   define MEMIO_LZ_SCRATCH_ALIGN              sizeof(uint32_t)
+#   define MEMIO_LZ_MAX_INPUT_SIZE             0x7E000000UL
+#   define MEMIO_LZ_FRAME_MAGIC                0x52465A4CUL
+#   define MEMIO_LZ_FRAME_HEADER_SIZE          8
+#   define MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE    12
+#   define MEMIO_LZ_FRAME_END_SIZE             4
+#   define MEMIO_LZ_FRAME_BLOCK_SIZE_DEFAULT   (256UL * 1024UL)
+#   define MEMIO_LZ_FRAME_BLOCK_SIZE_MAX       (64UL * 1024UL * 1024UL)
+#   define MEMIO_LZ_FRAME_BLOCK_STORED         0x80000000UL
+#endif
+
+/* @summary Calculate the maximum number of bytes MemioLzCompress can produce for an input of a given size.
+ * @param _size The size of the uncompressed data, in bytes. Must not exceed MEMIO_LZ_MAX_INPUT_SIZE.
+ * @return The worst-case size of the compressed data, in bytes.
+ */
+#ifndef MemioLz_GetMaxSize
+#define MemioLz_GetMaxSize(_size)                                              \
+    ((size_t)(_size) + ((size_t)(_size) / 255) + 16)
+#endif
+
+/* @summary Calculate the maximum number of bytes MemioLzFrameCompress can produce for an input of a given size.
+ * Blocks that do not compress are stored, so a frame is never much larger than its content.
+ * @param _size The size of the uncompressed data, in bytes.
+ * @param _block_size The maximum number of uncompressed bytes in each block of the frame.
+ * @return The worst-case size of the frame, in bytes.
+ */
+#ifndef MemioLzFrame_GetMaxSize
+#define MemioLzFrame_GetMaxSize(_size, _block_size)                            \
+    (MEMIO_LZ_FRAME_HEADER_SIZE + MEMIO_LZ_FRAME_END_SIZE + (size_t)(_size) + ((((size_t)(_size) + (_block_size) - 1) / (_block_size)) * MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE))
+#endif
+
+/* @summary Define the data describing a single block of a frame, as returned by MemioLzFrameReadBlock.
+ * Each block can be decoded independently of every other block in the frame.
+ */
+typedef struct MEMIO_LZ_FRAME_BLOCK {
+    uint8_t const                 *Data;                                       /* A pointer to the stored block data within the frame. */
+    uint32_t                       DataSize;                                   /* The size of the stored block data, in bytes. */
+    uint32_t                       ContentSize;                                /* The size of the block data after decompression, in bytes. */
+    uint32_t                       Checksum;                                   /* The checksum of the stored block data. */
+    uint32_t                       Stored;                                     /* Non-zero if the block data is stored without compression. */
+} MEMIO_LZ_FRAME_BLOCK;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Compress a memory buffer as a single block.
+ * @param dst The buffer to which the compressed data will be written.
+ * @param dst_size The size of the destination buffer, in bytes. Use MemioLz_GetMaxSize to guarantee success.
+ * @param src The data to compress.
+ * @param src_size The number of bytes to compress. Must not exceed MEMIO_LZ_MAX_INPUT_SIZE.
+ * @param scratch A buffer of at least MEMIO_LZ_SCRATCH_SIZE bytes, aligned to MEMIO_LZ_SCRATCH_ALIGN, used as the match-finder hash table. The contents on entry are ignored.
+ * @return The number of bytes written to dst, or zero if dst_size is too small to hold the compressed data.
+ */
+PIL_API(size_t)
+MemioLzCompress
+(
+    void             *dst,
+    size_t       dst_size,
+    void const       *src,
+    size_t       src_size,
+    void         *scratch
+);
+
+/* @summary Decompress a block produced by MemioLzCompress. The compressed data is fully validated, so malformed input cannot cause reads or writes outside of the supplied buffers.
+ * @param o_size On return, set to the number of bytes written to dst.
+ * @param dst The buffer to which the decompressed data will be written.
+ * @param dst_size The size of the destination buffer, in bytes.
+ * @param src The compressed data.
+ * @param src_size The size of the compressed data, in bytes.
+ * @return Zero if the block was decompressed, or -1 if the compressed data is malformed or dst_size is too small.
+ */
+PIL_API(int)
+MemioLzDecompress
+(
+    size_t        *o_size,
+    void             *dst,
+    size_t       dst_size,
+    void const       *src,
+    size_t       src_size
+);
+
+/* @summary Write the header that begins a frame. Follow with calls to MemioLzFrameWriteBlock and a call to MemioLzFrameWriteEnd.
+ * @param writer The MEMIO_WRITER to which the frame is written.
+ * @param block_size The maximum number of uncompressed bytes in each block of the frame, up to MEMIO_LZ_FRAME_BLOCK_SIZE_MAX.
+ * @return Zero if the header was written, or -1 if the writer could not grow.
+ */
+PIL_API(int)
+MemioLzFrameWriteHeader
+(
+    struct MEMIO_WRITER *writer,
+    uint32_t         block_size
+);
+
+/* @summary Compress a buffer and write it to a frame as a single, independent block. The block is stored uncompressed if compression does not reduce its size.
+ * @param writer The MEMIO_WRITER to which the frame is written.
+ * @param src The data to compress.
+ * @param src_size The number of bytes to compress. Must be at least one, and no more than the block size written to the frame header.
+ * @param scratch A buffer of at least MEMIO_LZ_SCRATCH_SIZE bytes, aligned to MEMIO_LZ_SCRATCH_ALIGN.
+ * @return Zero if the block was written, or -1 if the writer could not grow.
+ */
+PIL_API(int)
+MemioLzFrameWriteBlock
+(
+    struct MEMIO_WRITER *writer,
+    void const             *src,
+    size_t             src_size,
+    void               *scratch
+);
+
+/* @summary Write the end marker that completes a frame.
+ * @param writer The MEMIO_WRITER to which the frame is written.
+ * @return Zero if the end marker was written, or -1 if the writer could not grow.
+ */
+PIL_API(int)
+MemioLzFrameWriteEnd
+(
+    struct MEMIO_WRITER *writer
+);
+
+/* @summary Compress a memory buffer into a complete frame.
+ * The scratch buffer is allocated from scratch_arena and returned to it before the function returns.
+ * If the writer targets a memory arena, scratch_arena must be a different arena, since the writer can only grow while it holds the most recent allocation.
+ * @param writer The MEMIO_WRITER to which the frame is written, typically targeting a MEMORY_BLOCK.
+ * @param src The data to compress.
+ * @param src_size The number of bytes to compress.
+ * @param block_size The maximum number of uncompressed bytes in each block, up to MEMIO_LZ_FRAME_BLOCK_SIZE_MAX, or zero to use MEMIO_LZ_FRAME_BLOCK_SIZE_DEFAULT.
+ * @param scratch_arena The host MEMORY_ARENA from which the scratch buffer is allocated.
+ * @return Zero if the frame was written, or -1 if the scratch buffer could not be allocated or the writer could not grow.
+ */
+PIL_API(int)
+MemioLzFrameCompress
+(
+    struct MEMIO_WRITER      *writer,
+    void const                  *src,
+    size_t                  src_size,
+    uint32_t              block_size,
+    struct MEMORY_ARENA *scratch_arena
+);
+
+/* @summary Read and validate the header that begins a frame.
+ * @param o_block_size On return, set to the maximum number of uncompressed bytes in each block of the frame.
+ * @param reader The MEMIO_READER positioned at the start of the frame. On return, the reader is positioned at the first block.
+ * @return Zero if the header is valid, or -1 if the data is not a frame.
+ */
+PIL_API(int)
+MemioLzFrameReadHeader
+(
+    uint32_t     *o_block_size,
+    struct MEMIO_READER *reader
+);
+
+/* @summary Locate the next block of a frame without decoding it. Call repeatedly after MemioLzFrameReadHeader to enumerate the blocks of a frame, for example to decode them in parallel.
+ * @param o_block On return, describes the block. Valid only if the function returns 1.
+ * @param reader The MEMIO_READER positioned at a block header. On return, the reader is positioned at the following block header or the end of the frame.
+ * @param block_size The maximum block size returned by MemioLzFrameReadHeader.
+ * @return 1 if a block was read, 0 if the end marker of the frame was read, or -1 if the frame is truncated or malformed.
+ */
+PIL_API(int)
+MemioLzFrameReadBlock
+(
+    struct MEMIO_LZ_FRAME_BLOCK *o_block,
+    struct MEMIO_READER          *reader,
+    uint32_t                  block_size
+);
+
+/* @summary Verify the checksum of a frame block and decode its content. This function may be called concurrently for different blocks of a frame.
+ * @param dst The buffer to which the block content will be written.
+ * @param dst_size The size of the destination buffer, in bytes. Must be at least the ContentSize of the block.
+ * @param block The MEMIO_LZ_FRAME_BLOCK returned by MemioLzFrameReadBlock.
+ * @return Zero if exactly ContentSize bytes were written to dst, or -1 if the checksum does not match or the block data is malformed.
+ */
+PIL_API(int)
+MemioLzFrameDecodeBlock
+(
+    void                                *dst,
+    size_t                          dst_size,
+    struct MEMIO_LZ_FRAME_BLOCK const *block
+);
+
+/* @summary Decompress a complete frame, verifying the checksum of each block.
+ * @param writer The MEMIO_WRITER to which the decompressed content is written, typically targeting a MEMORY_BLOCK.
+ * @param src The frame data.
+ * @param src_size The size of the frame data, in bytes.
+ * @return Zero if the frame was decompressed, or -1 if the frame is malformed, a checksum does not match, or the writer could not grow.
+ */
+PIL_API(int)
+MemioLzFrameDecompress
+(
+    struct MEMIO_WRITER *writer,
+    void const             *src,
+    size_t             src_size
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_MEMIO_LZ_H__ */
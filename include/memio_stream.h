@@ -0,0 +1,1654 @@
+/**
+ * @summary memio_stream.h: Define cursor types used to read and write a
+ * sequence of values to and from a memory buffer without tracking byte offsets
+ * by hand. Callers check bounds once for a batch of values using
+ * MemioReaderRequire or MemioWriterReserve, and then read or write each value
+ * of the batch using the unchecked MemioReaderGet_ and MemioWriterPut_
+ * functions. A writer can target a fixed-size buffer, or grow in place within
+ * a MEMORY_BLOCK or at the end of a MEMORY_ARENA without copying the data
+ * written so far. Bit streams can be read and written on top of a reader or
+ * writer using MEMIO_BIT_READER and MEMIO_BIT_WRITER, and numbers can be read
+ * and written as decimal text using MemioReaderGetDecimal_ and
+ * MemioWriterPutDecimal_.
+ */
+#ifndef __PIL_MEMIO_STREAM_H__
+#define __PIL_MEMIO_STREAM_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   include <assert.h>
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_MEMMGR_H__
+#       include "memmgr.h"
+#   endif
+#   ifndef __PIL_MEMIO_INLINE_H__
+#       include "memio_inline.h"
+#   endif
+#endif
+
+/* @summary Retrieve the number of bytes consumed from the buffer of a MEMIO_READER.
+ * @param _r A pointer to a MEMIO_READER.
+ * @return The byte offset of the read position from the start of the buffer.
+ */
+#ifndef MemioReader_GetOffset
+#define MemioReader_GetOffset(_r)                                              \
+    ((size_t)((_r)->Cursor - (_r)->BufferStart))
+#endif
+
+/* @summary Retrieve the number of bytes remaining in the buffer of a MEMIO_READER.
+ * @param _r A pointer to a MEMIO_READER.
+ * @return The number of bytes between the read position and the end of the buffer.
+ */
+#ifndef MemioReader_GetRemaining
+#define MemioReader_GetRemaining(_r)                                           \
+    ((size_t)((_r)->BufferEnd - (_r)->Cursor))
+#endif
+
+/* @summary Retrieve the number of bytes written to a MEMIO_WRITER.
+ * @param _w A pointer to a MEMIO_WRITER.
+ * @return The byte offset of the write position from the start of the buffer.
+ */
+#ifndef MemioWriter_GetSize
+#define MemioWriter_GetSize(_w)                                                \
+    ((size_t)((_w)->Cursor - (_w)->BufferStart))
+#endif
+
+/* @summary Define the types of storage a MEMIO_WRITER can write to.
+ */
+typedef enum MEMIO_WRITER_TYPE {
+    MEMIO_WRITER_TYPE_BUFFER                =  0UL,                            /* The writer targets a fixed-size, caller-supplied buffer and cannot grow. */
+    MEMIO_WRITER_TYPE_BLOCK                 =  1UL,                            /* The writer targets a MEMORY_BLOCK returned by HostMemoryReserveAndCommit, and grows by increasing the commitment of the block. */
+    MEMIO_WRITER_TYPE_ARENA                 =  2UL,                            /* The writer targets the most recent allocation in a host MEMORY_ARENA, and grows by extending that allocation. */
+} MEMIO_WRITER_TYPE;
+
+/* @summary Define the data associated with a cursor used to read values sequentially from a memory buffer.
+ */
+typedef struct MEMIO_READER {
+    uint8_t const                 *BufferStart;                                /* The start of the buffer. */
+    uint8_t const                 *Cursor;                                     /* The current read position. */
+    uint8_t const                 *BufferEnd;                                  /* One past the last readable byte of the buffer. */
+    int32_t                        Error;                                      /* Zero, or non-zero if MemioReaderRequire failed. Once set, every subsequent MemioReaderRequire fails. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
+} MEMIO_READER;
+
+/* @summary Define the data associated with a cursor used to write values sequentially to a memory buffer.
+ */
+typedef struct MEMIO_WRITER {
+    uint8_t                       *BufferStart;                                /* The start of the buffer. */
+    uint8_t                       *Cursor;                                     /* The current write position. */
+    uint8_t                       *BufferEnd;                                  /* One past the last writable byte of the buffer. Increases when the writer grows. */
+    struct MEMORY_BLOCK           *Block;                                      /* The memory block written to, for MEMIO_WRITER_TYPE_BLOCK. */
+    struct MEMORY_ARENA           *Arena;                                      /* The memory arena written to, for MEMIO_WRITER_TYPE_ARENA. */
+    int32_t                        Error;                                      /* Zero, or non-zero if MemioWriterReserve failed. Once set, every subsequent MemioWriterReserve fails. */
+    uint32_t                       WriterType;                                 /* One of the values of the MEMIO_WRITER_TYPE enumeration. */
+} MEMIO_WRITER;
+
+/* @summary Define the data associated with a cursor used to write a little-endian (LSB first) stream of bit fields to a MEMIO_WRITER.
+ * Completed 32-bit words are written to the underlying writer, so the bit stream grows the same way the writer does.
+ */
+typedef struct MEMIO_BIT_WRITER {
+    struct MEMIO_WRITER           *Writer;                                     /* The writer that receives the completed bytes of the bit stream. */
+    uint64_t                       Bits;                                       /* The pending bits not yet written to Writer, LSB first. */
+    uint32_t                       BitCount;                                   /* The number of valid bits in Bits. Less than 32 between calls. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
+} MEMIO_BIT_WRITER;
+
+/* @summary Define the data associated with a cursor used to read a little-endian (LSB first) stream of bit fields from a MEMIO_READER.
+ * Bits are fetched from the underlying reader 32 at a time, so the reader may be ahead of the bit stream until MemioBitReaderFinish is called.
+ */
+typedef struct MEMIO_BIT_READER {
+    struct MEMIO_READER           *Reader;                                     /* The reader that supplies the bytes of the bit stream. */
+    uint64_t                       Bits;                                       /* The bits fetched from Reader but not yet returned, LSB first. */
+    uint32_t                       BitCount;                                   /* The number of valid bits in Bits. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
+} MEMIO_BIT_READER;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Initialize a MEMIO_READER to read from a memory buffer.
+ * @param o_reader The MEMIO_READER to initialize.
+ * @param buffer The buffer to read from.
+ * @param buffer_size The size of the buffer, in bytes.
+ */
+PIL_API(void)
+MemioReaderInit
+(
+    struct MEMIO_READER *o_reader,
+    void const            *buffer,
+    size_t            buffer_size
+);
+
+/* @summary Initialize a MEMIO_WRITER to write to a fixed-size memory buffer.
+ * @param o_writer The MEMIO_WRITER to initialize.
+ * @param buffer The buffer to write to.
+ * @param buffer_size The size of the buffer, in bytes.
+ */
+PIL_API(void)
+MemioWriterInitBuffer
+(
+    struct MEMIO_WRITER *o_writer,
+    void                  *buffer,
+    size_t            buffer_size
+);
+
+/* @summary Initialize a MEMIO_WRITER to write to a memory block returned by HostMemoryReserveAndCommit, starting at the beginning of the block.
+ * The writer grows by increasing the commitment of the block, up to the reserved size of the block, and updates the block in place.
+ * @param o_writer The MEMIO_WRITER to initialize.
+ * @param block The MEMORY_BLOCK to write to. The block must remain valid for the lifetime of the writer.
+ * @return Zero if the writer is initialized, or -1 if the block is not a valid host memory block.
+ */
+PIL_API(int)
+MemioWriterInitBlock
+(
+    struct MEMIO_WRITER *o_writer,
+    struct MEMORY_BLOCK    *block
+);
+
+/* @summary Initialize a MEMIO_WRITER to write to a new allocation from a host memory arena.
+ * The writer grows by extending its allocation at the end of the arena, which succeeds only while no other allocation has been made from the arena.
+ * Call MemioWriterFinish to return any unused space at the end of the allocation to the arena.
+ * @param o_writer The MEMIO_WRITER to initialize.
+ * @param arena The MEMORY_ARENA to allocate from. The arena must have type MEMORY_ALLOCATOR_TYPE_HOST_HEAP or MEMORY_ALLOCATOR_TYPE_HOST_VMM.
+ * @param initial_size The number of bytes to allocate for the writer up-front.
+ * @param alignment The required alignment of the start of the written data, in bytes.
+ * @return Zero if the writer is initialized, or -1 if the initial allocation could not be made.
+ */
+PIL_API(int)
+MemioWriterInitArena
+(
+    struct MEMIO_WRITER *o_writer,
+    struct MEMORY_ARENA    *arena,
+    size_t           initial_size,
+    size_t              alignment
+);
+
+/* @summary Grow a MEMIO_WRITER so that at least a given number of bytes can be written at the current write position.
+ * This function is the slow path of MemioWriterReserve; call MemioWriterReserve instead.
+ * Growing never moves the data already written. If the writer cannot grow, the Error field of the writer is set.
+ * @param writer The MEMIO_WRITER to grow.
+ * @param size The number of bytes that must be writable at the current write position.
+ * @return Zero if size bytes can be written, or -1 if the writer could not grow.
+ */
+PIL_API(int)
+MemioWriterGrow
+(
+    struct MEMIO_WRITER *writer,
+    size_t                 size
+);
+
+/* @summary Complete writing to a MEMIO_WRITER. For a writer targeting a memory arena, any allocated space past the write position is returned to the arena if the writer holds the most recent allocation.
+ * The data written remains valid, and the writer must not be written to after this call.
+ * @param writer The MEMIO_WRITER to finish.
+ * @return The number of bytes written, or zero if the Error field of the writer is set.
+ */
+PIL_API(size_t)
+MemioWriterFinish
+(
+    struct MEMIO_WRITER *writer
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+/* @summary Check that a given number of bytes can be read from the current read position of a MEMIO_READER.
+ * Call this function once before reading a batch of values with the MemioReaderGet_ functions.
+ * @param reader The MEMIO_READER to check.
+ * @param size The total size of the values to be read, in bytes.
+ * @return Zero if size bytes are available, or -1 if the buffer is too short or an earlier check failed. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderRequire
+(
+    struct MEMIO_READER *reader,
+    size_t                 size
+)
+{
+    if (reader->Error == 0 && size <= (size_t)(reader->BufferEnd - reader->Cursor)) {
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Copy bytes from the current read position of a MEMIO_READER and advance the read position.
+ * The caller must have checked that the bytes are available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @param dst The buffer to copy to.
+ * @param size The number of bytes to copy.
+ */
+static PIL_INLINE void
+MemioReaderGetBytes
+(
+    struct MEMIO_READER *reader,
+    void                     *dst,
+    size_t                   size
+)
+{
+    assert(size <= (size_t)(reader->BufferEnd - reader->Cursor));
+    memcpy(dst, reader->Cursor, size);
+    reader->Cursor += size;
+}
+
+/* @summary Advance the read position of a MEMIO_READER without reading any data.
+ * The caller must have checked that the bytes are available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to update.
+ * @param size The number of bytes to skip.
+ */
+static PIL_INLINE void
+MemioReaderSkip
+(
+    struct MEMIO_READER *reader,
+    size_t                 size
+)
+{
+    assert(size <= (size_t)(reader->BufferEnd - reader->Cursor));
+    reader->Cursor += size;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored using the LEB128 variable-length encoding at the current read position and advance the read position.
+ * Because the encoded length is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the decoded value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the value is truncated or malformed. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGet_varint32
+(
+    uint32_t           *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ReadInline_varint32(o_value, reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored using the LEB128 variable-length encoding at the current read position and advance the read position.
+ * Because the encoded length is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the decoded value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the value is truncated or malformed. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGet_varint64
+(
+    uint64_t           *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ReadInline_varint64(o_value, reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored as decimal text at the current read position and advance the read position past the text.
+ * Because the length of the text is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the parsed value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the text is not a valid number or the value is out of range. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGetDecimal_ui32
+(
+    uint32_t           *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ParseDecimal_ui32(o_value, (char const*) reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read a signed 32-bit integer value stored as decimal text at the current read position and advance the read position past the text.
+ * Because the length of the text is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the parsed value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the text is not a valid number or the value is out of range. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGetDecimal_si32
+(
+    int32_t            *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ParseDecimal_si32(o_value, (char const*) reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored as decimal text at the current read position and advance the read position past the text.
+ * Because the length of the text is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the parsed value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the text is not a valid number or the value is out of range. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGetDecimal_ui64
+(
+    uint64_t           *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ParseDecimal_ui64(o_value, (char const*) reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read a signed 64-bit integer value stored as decimal text at the current read position and advance the read position past the text.
+ * Because the length of the text is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the parsed value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the text is not a valid number or the value is out of range. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGetDecimal_si64
+(
+    int64_t            *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ParseDecimal_si64(o_value, (char const*) reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read a 32-bit floating point value stored as decimal text at the current read position and advance the read position past the text.
+ * Because the length of the text is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the parsed value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the text is not a valid number. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGetDecimal_f32
+(
+    float              *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ParseDecimal_f32(o_value, (char const*) reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read a 64-bit floating point value stored as decimal text at the current read position and advance the read position past the text.
+ * Because the length of the text is not known in advance, this function checks bounds itself and does not require a call to MemioReaderRequire.
+ * @param o_value On return, set to the parsed value.
+ * @param reader The MEMIO_READER to read from.
+ * @return Zero if the value was read, or -1 if the text is not a valid number. On failure, the Error field of the reader is set.
+ */
+static PIL_INLINE int
+MemioReaderGetDecimal_f64
+(
+    double             *o_value,
+    struct MEMIO_READER *reader
+)
+{
+    size_t n = reader->Error == 0 ? ParseDecimal_f64(o_value, (char const*) reader->Cursor, (size_t)(reader->BufferEnd - reader->Cursor)) : 0;
+    if (n != 0) {
+        reader->Cursor += n;
+        return  0;
+    }
+    reader->Error = 1;
+    return -1;
+}
+
+/* @summary Read a signed 8-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 8-bit integer value.
+ */
+static PIL_INLINE int8_t
+MemioReaderGet_si8
+(
+    struct MEMIO_READER *reader
+)
+{
+    int8_t value;
+    assert(reader->Cursor + sizeof(int8_t) <= reader->BufferEnd);
+    value = ReadInline_si8(reader->Cursor, 0);
+    reader->Cursor += sizeof(int8_t);
+    return value;
+}
+
+/* @summary Read an unsigned 8-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 8-bit integer value.
+ */
+static PIL_INLINE uint8_t
+MemioReaderGet_ui8
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint8_t value;
+    assert(reader->Cursor + sizeof(uint8_t) <= reader->BufferEnd);
+    value = ReadInline_ui8(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint8_t);
+    return value;
+}
+
+/* @summary Read a signed 16-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 16-bit integer value.
+ */
+static PIL_INLINE int16_t
+MemioReaderGet_si16
+(
+    struct MEMIO_READER *reader
+)
+{
+    int16_t value;
+    assert(reader->Cursor + sizeof(int16_t) <= reader->BufferEnd);
+    value = ReadInline_si16(reader->Cursor, 0);
+    reader->Cursor += sizeof(int16_t);
+    return value;
+}
+
+/* @summary Read a signed 16-bit integer value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 16-bit integer value.
+ */
+static PIL_INLINE int16_t
+MemioReaderGet_si16_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    int16_t value;
+    assert(reader->Cursor + sizeof(int16_t) <= reader->BufferEnd);
+    value = ReadInline_si16_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(int16_t);
+    return value;
+}
+
+/* @summary Read a signed 16-bit integer value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 16-bit integer value.
+ */
+static PIL_INLINE int16_t
+MemioReaderGet_si16_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    int16_t value;
+    assert(reader->Cursor + sizeof(int16_t) <= reader->BufferEnd);
+    value = ReadInline_si16_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(int16_t);
+    return value;
+}
+
+/* @summary Read an unsigned 16-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 16-bit integer value.
+ */
+static PIL_INLINE uint16_t
+MemioReaderGet_ui16
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint16_t value;
+    assert(reader->Cursor + sizeof(uint16_t) <= reader->BufferEnd);
+    value = ReadInline_ui16(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint16_t);
+    return value;
+}
+
+/* @summary Read an unsigned 16-bit integer value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 16-bit integer value.
+ */
+static PIL_INLINE uint16_t
+MemioReaderGet_ui16_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint16_t value;
+    assert(reader->Cursor + sizeof(uint16_t) <= reader->BufferEnd);
+    value = ReadInline_ui16_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint16_t);
+    return value;
+}
+
+/* @summary Read an unsigned 16-bit integer value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 16-bit integer value.
+ */
+static PIL_INLINE uint16_t
+MemioReaderGet_ui16_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint16_t value;
+    assert(reader->Cursor + sizeof(uint16_t) <= reader->BufferEnd);
+    value = ReadInline_ui16_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint16_t);
+    return value;
+}
+
+/* @summary Read a signed 32-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 32-bit integer value.
+ */
+static PIL_INLINE int32_t
+MemioReaderGet_si32
+(
+    struct MEMIO_READER *reader
+)
+{
+    int32_t value;
+    assert(reader->Cursor + sizeof(int32_t) <= reader->BufferEnd);
+    value = ReadInline_si32(reader->Cursor, 0);
+    reader->Cursor += sizeof(int32_t);
+    return value;
+}
+
+/* @summary Read a signed 32-bit integer value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 32-bit integer value.
+ */
+static PIL_INLINE int32_t
+MemioReaderGet_si32_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    int32_t value;
+    assert(reader->Cursor + sizeof(int32_t) <= reader->BufferEnd);
+    value = ReadInline_si32_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(int32_t);
+    return value;
+}
+
+/* @summary Read a signed 32-bit integer value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 32-bit integer value.
+ */
+static PIL_INLINE int32_t
+MemioReaderGet_si32_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    int32_t value;
+    assert(reader->Cursor + sizeof(int32_t) <= reader->BufferEnd);
+    value = ReadInline_si32_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(int32_t);
+    return value;
+}
+
+/* @summary Read an unsigned 32-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 32-bit integer value.
+ */
+static PIL_INLINE uint32_t
+MemioReaderGet_ui32
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint32_t value;
+    assert(reader->Cursor + sizeof(uint32_t) <= reader->BufferEnd);
+    value = ReadInline_ui32(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint32_t);
+    return value;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 32-bit integer value.
+ */
+static PIL_INLINE uint32_t
+MemioReaderGet_ui32_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint32_t value;
+    assert(reader->Cursor + sizeof(uint32_t) <= reader->BufferEnd);
+    value = ReadInline_ui32_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint32_t);
+    return value;
+}
+
+/* @summary Read an unsigned 32-bit integer value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 32-bit integer value.
+ */
+static PIL_INLINE uint32_t
+MemioReaderGet_ui32_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint32_t value;
+    assert(reader->Cursor + sizeof(uint32_t) <= reader->BufferEnd);
+    value = ReadInline_ui32_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint32_t);
+    return value;
+}
+
+/* @summary Read a signed 64-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 64-bit integer value.
+ */
+static PIL_INLINE int64_t
+MemioReaderGet_si64
+(
+    struct MEMIO_READER *reader
+)
+{
+    int64_t value;
+    assert(reader->Cursor + sizeof(int64_t) <= reader->BufferEnd);
+    value = ReadInline_si64(reader->Cursor, 0);
+    reader->Cursor += sizeof(int64_t);
+    return value;
+}
+
+/* @summary Read a signed 64-bit integer value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 64-bit integer value.
+ */
+static PIL_INLINE int64_t
+MemioReaderGet_si64_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    int64_t value;
+    assert(reader->Cursor + sizeof(int64_t) <= reader->BufferEnd);
+    value = ReadInline_si64_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(int64_t);
+    return value;
+}
+
+/* @summary Read a signed 64-bit integer value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The signed 64-bit integer value.
+ */
+static PIL_INLINE int64_t
+MemioReaderGet_si64_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    int64_t value;
+    assert(reader->Cursor + sizeof(int64_t) <= reader->BufferEnd);
+    value = ReadInline_si64_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(int64_t);
+    return value;
+}
+
+/* @summary Read an unsigned 64-bit integer value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 64-bit integer value.
+ */
+static PIL_INLINE uint64_t
+MemioReaderGet_ui64
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint64_t value;
+    assert(reader->Cursor + sizeof(uint64_t) <= reader->BufferEnd);
+    value = ReadInline_ui64(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint64_t);
+    return value;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 64-bit integer value.
+ */
+static PIL_INLINE uint64_t
+MemioReaderGet_ui64_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint64_t value;
+    assert(reader->Cursor + sizeof(uint64_t) <= reader->BufferEnd);
+    value = ReadInline_ui64_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint64_t);
+    return value;
+}
+
+/* @summary Read an unsigned 64-bit integer value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The unsigned 64-bit integer value.
+ */
+static PIL_INLINE uint64_t
+MemioReaderGet_ui64_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    uint64_t value;
+    assert(reader->Cursor + sizeof(uint64_t) <= reader->BufferEnd);
+    value = ReadInline_ui64_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(uint64_t);
+    return value;
+}
+
+/* @summary Read a 32-bit floating-point value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The 32-bit floating-point value.
+ */
+static PIL_INLINE float
+MemioReaderGet_f32
+(
+    struct MEMIO_READER *reader
+)
+{
+    float value;
+    assert(reader->Cursor + sizeof(float) <= reader->BufferEnd);
+    value = ReadInline_f32(reader->Cursor, 0);
+    reader->Cursor += sizeof(float);
+    return value;
+}
+
+/* @summary Read a 32-bit floating-point value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The 32-bit floating-point value.
+ */
+static PIL_INLINE float
+MemioReaderGet_f32_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    float value;
+    assert(reader->Cursor + sizeof(float) <= reader->BufferEnd);
+    value = ReadInline_f32_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(float);
+    return value;
+}
+
+/* @summary Read a 32-bit floating-point value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The 32-bit floating-point value.
+ */
+static PIL_INLINE float
+MemioReaderGet_f32_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    float value;
+    assert(reader->Cursor + sizeof(float) <= reader->BufferEnd);
+    value = ReadInline_f32_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(float);
+    return value;
+}
+
+/* @summary Read a 64-bit floating-point value at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The 64-bit floating-point value.
+ */
+static PIL_INLINE double
+MemioReaderGet_f64
+(
+    struct MEMIO_READER *reader
+)
+{
+    double value;
+    assert(reader->Cursor + sizeof(double) <= reader->BufferEnd);
+    value = ReadInline_f64(reader->Cursor, 0);
+    reader->Cursor += sizeof(double);
+    return value;
+}
+
+/* @summary Read a 64-bit floating-point value stored in big endian format (MSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The 64-bit floating-point value.
+ */
+static PIL_INLINE double
+MemioReaderGet_f64_msb
+(
+    struct MEMIO_READER *reader
+)
+{
+    double value;
+    assert(reader->Cursor + sizeof(double) <= reader->BufferEnd);
+    value = ReadInline_f64_msb(reader->Cursor, 0);
+    reader->Cursor += sizeof(double);
+    return value;
+}
+
+/* @summary Read a 64-bit floating-point value stored in little endian format (LSB first) at the current read position and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @param reader The MEMIO_READER to read from.
+ * @return The 64-bit floating-point value.
+ */
+static PIL_INLINE double
+MemioReaderGet_f64_lsb
+(
+    struct MEMIO_READER *reader
+)
+{
+    double value;
+    assert(reader->Cursor + sizeof(double) <= reader->BufferEnd);
+    value = ReadInline_f64_lsb(reader->Cursor, 0);
+    reader->Cursor += sizeof(double);
+    return value;
+}
+
+/* @summary Ensure that a given number of bytes can be written at the current write position of a MEMIO_WRITER, growing the writer if necessary.
+ * Call this function once before writing a batch of values with the MemioWriterPut_ functions.
+ * @param writer The MEMIO_WRITER to check.
+ * @param size The total size of the values to be written, in bytes.
+ * @return Zero if size bytes can be written, or -1 if the writer could not grow or an earlier reservation failed. On failure, the Error field of the writer is set.
+ */
+static PIL_INLINE int
+MemioWriterReserve
+(
+    struct MEMIO_WRITER *writer,
+    size_t                 size
+)
+{
+    if (writer->Error == 0 && size <= (size_t)(writer->BufferEnd - writer->Cursor)) {
+        return 0;
+    }
+    return MemioWriterGrow(writer, size);
+}
+
+/* @summary Copy bytes to the current write position of a MEMIO_WRITER and advance the write position.
+ * The caller must have reserved space for the bytes using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param src The data to copy.
+ * @param size The number of bytes to copy.
+ */
+static PIL_INLINE void
+MemioWriterPutBytes
+(
+    struct MEMIO_WRITER *writer,
+    void const               *src,
+    size_t                   size
+)
+{
+    assert(size <= (size_t)(writer->BufferEnd - writer->Cursor));
+    memcpy(writer->Cursor, src, size);
+    writer->Cursor += size;
+}
+
+/* @summary Write an unsigned 32-bit integer value at the current write position using the LEB128 variable-length encoding and advance the write position.
+ * The caller must have reserved MEMIO_VARINT32_MAX_SIZE bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_varint32
+(
+    struct MEMIO_WRITER *writer, 
+    uint32_t                value
+)
+{
+    assert(writer->Cursor + MEMIO_VARINT32_MAX_SIZE <= writer->BufferEnd);
+    writer->Cursor += WriteInline_varint32(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 64-bit integer value at the current write position using the LEB128 variable-length encoding and advance the write position.
+ * The caller must have reserved MEMIO_VARINT64_MAX_SIZE bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_varint64
+(
+    struct MEMIO_WRITER *writer, 
+    uint64_t                value
+)
+{
+    assert(writer->Cursor + MEMIO_VARINT64_MAX_SIZE <= writer->BufferEnd);
+    writer->Cursor += WriteInline_varint64(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 32-bit integer value as decimal text at the current write position and advance the write position. No nul terminator is written.
+ * The caller must have reserved MEMIO_TEXT_MAX_UI32 bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPutDecimal_ui32
+(
+    struct MEMIO_WRITER *writer, 
+    uint32_t               value
+)
+{
+    assert(writer->Cursor + MEMIO_TEXT_MAX_UI32 <= writer->BufferEnd);
+    writer->Cursor += FormatDecimal_ui32((char*) writer->Cursor, value);
+}
+
+/* @summary Write a signed 32-bit integer value as decimal text at the current write position and advance the write position. No nul terminator is written.
+ * The caller must have reserved MEMIO_TEXT_MAX_SI32 bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPutDecimal_si32
+(
+    struct MEMIO_WRITER *writer, 
+    int32_t                value
+)
+{
+    assert(writer->Cursor + MEMIO_TEXT_MAX_SI32 <= writer->BufferEnd);
+    writer->Cursor += FormatDecimal_si32((char*) writer->Cursor, value);
+}
+
+/* @summary Write an unsigned 64-bit integer value as decimal text at the current write position and advance the write position. No nul terminator is written.
+ * The caller must have reserved MEMIO_TEXT_MAX_UI64 bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPutDecimal_ui64
+(
+    struct MEMIO_WRITER *writer, 
+    uint64_t               value
+)
+{
+    assert(writer->Cursor + MEMIO_TEXT_MAX_UI64 <= writer->BufferEnd);
+    writer->Cursor += FormatDecimal_ui64((char*) writer->Cursor, value);
+}
+
+/* @summary Write a signed 64-bit integer value as decimal text at the current write position and advance the write position. No nul terminator is written.
+ * The caller must have reserved MEMIO_TEXT_MAX_SI64 bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPutDecimal_si64
+(
+    struct MEMIO_WRITER *writer, 
+    int64_t                value
+)
+{
+    assert(writer->Cursor + MEMIO_TEXT_MAX_SI64 <= writer->BufferEnd);
+    writer->Cursor += FormatDecimal_si64((char*) writer->Cursor, value);
+}
+
+/* @summary Write a 32-bit floating point value as decimal text in the shortest form that parses back to the same value at the current write position and advance the write position. No nul terminator is written.
+ * The caller must have reserved MEMIO_TEXT_MAX_F32 bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPutDecimal_f32
+(
+    struct MEMIO_WRITER *writer, 
+    float                  value
+)
+{
+    assert(writer->Cursor + MEMIO_TEXT_MAX_F32 <= writer->BufferEnd);
+    writer->Cursor += FormatDecimal_f32((char*) writer->Cursor, value);
+}
+
+/* @summary Write a 64-bit floating point value as decimal text in the shortest form that parses back to the same value at the current write position and advance the write position. No nul terminator is written.
+ * The caller must have reserved MEMIO_TEXT_MAX_F64 bytes for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPutDecimal_f64
+(
+    struct MEMIO_WRITER *writer, 
+    double                 value
+)
+{
+    assert(writer->Cursor + MEMIO_TEXT_MAX_F64 <= writer->BufferEnd);
+    writer->Cursor += FormatDecimal_f64((char*) writer->Cursor, value);
+}
+
+/* @summary Write a signed 8-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si8
+(
+    struct MEMIO_WRITER *writer, 
+    int8_t               value
+)
+{
+    assert(writer->Cursor + sizeof(int8_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si8(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 8-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui8
+(
+    struct MEMIO_WRITER *writer, 
+    uint8_t              value
+)
+{
+    assert(writer->Cursor + sizeof(uint8_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui8(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 16-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si16
+(
+    struct MEMIO_WRITER *writer, 
+    int16_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int16_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si16(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 16-bit integer value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si16_msb
+(
+    struct MEMIO_WRITER *writer, 
+    int16_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int16_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si16_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 16-bit integer value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si16_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    int16_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int16_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si16_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 16-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui16
+(
+    struct MEMIO_WRITER *writer, 
+    uint16_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint16_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui16(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 16-bit integer value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui16_msb
+(
+    struct MEMIO_WRITER *writer, 
+    uint16_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint16_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui16_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 16-bit integer value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui16_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    uint16_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint16_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui16_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 32-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si32
+(
+    struct MEMIO_WRITER *writer, 
+    int32_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int32_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si32(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 32-bit integer value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si32_msb
+(
+    struct MEMIO_WRITER *writer, 
+    int32_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int32_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si32_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 32-bit integer value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si32_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    int32_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int32_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si32_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 32-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui32
+(
+    struct MEMIO_WRITER *writer, 
+    uint32_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint32_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui32(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 32-bit integer value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui32_msb
+(
+    struct MEMIO_WRITER *writer, 
+    uint32_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint32_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui32_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 32-bit integer value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui32_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    uint32_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint32_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui32_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 64-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si64
+(
+    struct MEMIO_WRITER *writer, 
+    int64_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int64_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si64(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 64-bit integer value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si64_msb
+(
+    struct MEMIO_WRITER *writer, 
+    int64_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int64_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si64_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a signed 64-bit integer value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_si64_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    int64_t              value
+)
+{
+    assert(writer->Cursor + sizeof(int64_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_si64_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 64-bit integer value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui64
+(
+    struct MEMIO_WRITER *writer, 
+    uint64_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint64_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui64(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 64-bit integer value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui64_msb
+(
+    struct MEMIO_WRITER *writer, 
+    uint64_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint64_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui64_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write an unsigned 64-bit integer value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_ui64_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    uint64_t             value
+)
+{
+    assert(writer->Cursor + sizeof(uint64_t) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_ui64_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a 32-bit floating-point value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_f32
+(
+    struct MEMIO_WRITER *writer, 
+    float                value
+)
+{
+    assert(writer->Cursor + sizeof(float) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_f32(writer->Cursor, value, 0);
+}
+
+/* @summary Write a 32-bit floating-point value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_f32_msb
+(
+    struct MEMIO_WRITER *writer, 
+    float                value
+)
+{
+    assert(writer->Cursor + sizeof(float) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_f32_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a 32-bit floating-point value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_f32_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    float                value
+)
+{
+    assert(writer->Cursor + sizeof(float) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_f32_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a 64-bit floating-point value at the current write position and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_f64
+(
+    struct MEMIO_WRITER *writer, 
+    double               value
+)
+{
+    assert(writer->Cursor + sizeof(double) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_f64(writer->Cursor, value, 0);
+}
+
+/* @summary Write a 64-bit floating-point value at the current write position and advance the write position. The value is written in big-endian (MSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_f64_msb
+(
+    struct MEMIO_WRITER *writer, 
+    double               value
+)
+{
+    assert(writer->Cursor + sizeof(double) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_f64_msb(writer->Cursor, value, 0);
+}
+
+/* @summary Write a 64-bit floating-point value at the current write position and advance the write position. The value is written in little-endian (LSB first) format.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriterPut_f64_lsb
+(
+    struct MEMIO_WRITER *writer, 
+    double               value
+)
+{
+    assert(writer->Cursor + sizeof(double) <= writer->BufferEnd);
+    writer->Cursor += WriteInline_f64_lsb(writer->Cursor, value, 0);
+}
+
+/* @summary Initialize a MEMIO_BIT_WRITER to append a bit stream at the current write position of a MEMIO_WRITER.
+ * @param o_bits The MEMIO_BIT_WRITER to initialize.
+ * @param writer The MEMIO_WRITER to write to. The writer must not be written to directly until MemioBitWriterFlush is called.
+ */
+static PIL_INLINE void
+MemioBitWriterInit
+(
+    struct MEMIO_BIT_WRITER *o_bits, 
+    struct MEMIO_WRITER     *writer
+)
+{
+    o_bits->Writer   = writer;
+    o_bits->Bits     = 0;
+    o_bits->BitCount = 0;
+    o_bits->Reserved = 0;
+}
+
+/* @summary Append a bit field to a bit stream.
+ * @param bits The MEMIO_BIT_WRITER to write to.
+ * @param value The value to write. Bits above bit_count are discarded.
+ * @param bit_count The number of bits to write, from 1 to 32.
+ */
+static PIL_INLINE void
+MemioBitWriterPut
+(
+    struct MEMIO_BIT_WRITER *bits, 
+    uint32_t                value, 
+    uint32_t            bit_count
+)
+{
+    assert(bit_count >= 1 && bit_count <= 32);
+    bits->Bits     |= ((uint64_t) value & ((1ULL << bit_count) - 1)) << bits->BitCount;
+    bits->BitCount += bit_count;
+    if (bits->BitCount >= 32) {
+        if (MemioWriterReserve(bits->Writer, sizeof(uint32_t)) == 0) {
+            MemioWriterPut_ui32_lsb(bits->Writer, (uint32_t) bits->Bits);
+        }
+        bits->Bits    >>= 32;
+        bits->BitCount -= 32;
+    }
+}
+
+/* @summary Write any pending bits to the underlying MEMIO_WRITER, padding the final byte with zero bits.
+ * After this call the MEMIO_WRITER can be written to directly, or the bit writer can be used to start a new byte-aligned bit stream.
+ * @param bits The MEMIO_BIT_WRITER to flush.
+ * @return Zero if the bit stream was written, or -1 if the underlying writer ran out of space.
+ */
+static PIL_INLINE int
+MemioBitWriterFlush
+(
+    struct MEMIO_BIT_WRITER *bits
+)
+{
+    uint32_t nbytes = (bits->BitCount + 7) / 8;
+    if (MemioWriterReserve(bits->Writer, nbytes) == 0) {
+        for ( ; nbytes > 0; --nbytes) {
+            MemioWriterPut_ui8(bits->Writer, (uint8_t) bits->Bits);
+            bits->Bits >>= 8;
+        }
+    }
+    bits->Bits     = 0;
+    bits->BitCount = 0;
+    return bits->Writer->Error == 0 ? 0 : -1;
+}
+
+/* @summary Initialize a MEMIO_BIT_READER to read a bit stream starting at the current read position of a MEMIO_READER.
+ * @param o_bits The MEMIO_BIT_READER to initialize.
+ * @param reader The MEMIO_READER to read from. The reader must not be read from directly until MemioBitReaderFinish is called.
+ */
+static PIL_INLINE void
+MemioBitReaderInit
+(
+    struct MEMIO_BIT_READER *o_bits, 
+    struct MEMIO_READER     *reader
+)
+{
+    o_bits->Reader   = reader;
+    o_bits->Bits     = 0;
+    o_bits->BitCount = 0;
+    o_bits->Reserved = 0;
+}
+
+/* @summary Read a bit field from a bit stream.
+ * @param bits The MEMIO_BIT_READER to read from.
+ * @param bit_count The number of bits to read, from 1 to 32.
+ * @return The value of the bit field. If the stream is exhausted, missing bits read as zero and the Error field of the underlying reader is set.
+ */
+static PIL_INLINE uint32_t
+MemioBitReaderGet
+(
+    struct MEMIO_BIT_READER *bits, 
+    uint32_t            bit_count
+)
+{
+    uint32_t value;
+    assert(bit_count >= 1 && bit_count <= 32);
+    if (bits->BitCount < bit_count) {
+        MEMIO_READER *reader = bits->Reader;
+        if (MemioReader_GetRemaining(reader) >= sizeof(uint32_t)) {
+            bits->Bits     |= (uint64_t) MemioReaderGet_ui32_lsb(reader) << bits->BitCount;
+            bits->BitCount += 32;
+        } else {
+            while (bits->BitCount < bit_count && MemioReaderRequire(reader, 1) == 0) {
+                bits->Bits     |= (uint64_t) MemioReaderGet_ui8(reader) << bits->BitCount;
+                bits->BitCount += 8;
+            }
+            if (bits->BitCount < bit_count) {
+                bits->BitCount  = bit_count; /* MemioReaderRequire set the Error field */
+            }
+        }
+    }
+    value           = (uint32_t)(bits->Bits & ((1ULL << bit_count) - 1));
+    bits->Bits    >>= bit_count;
+    bits->BitCount -= bit_count;
+    return value;
+}
+
+/* @summary Complete reading a bit stream, discarding any remaining bits of the current byte and returning whole unread bytes to the underlying MEMIO_READER.
+ * After this call the MEMIO_READER is positioned at the first byte following the bit stream.
+ * @param bits The MEMIO_BIT_READER to finish.
+ */
+static PIL_INLINE void
+MemioBitReaderFinish
+(
+    struct MEMIO_BIT_READER *bits
+)
+{
+    bits->Reader->Cursor -= bits->BitCount / 8;
+    bits->Bits            = 0;
+    bits->BitCount        = 0;
+}
+
+#ifdef __cplusplus
+/* @summary Read a value of a given type and byte order at the current read position of a MEMIO_READER and advance the read position.
+ * The caller must have checked that the value is available using MemioReaderRequire.
+ * @typeparam T The type of value to read. Must be a 1, 2, 4 or 8 byte trivially-copyable type.
+ * @typeparam Endianess The byte order of the stored value, PIL_ENDIANESS_LSB_FIRST or PIL_ENDIANESS_MSB_FIRST. Defaults to the host byte order.
+ * @param reader The MEMIO_READER to read from.
+ * @return The value.
+ */
+template <typename T, int Endianess = PIL_SYSTEM_ENDIANESS>
+static PIL_INLINE T
+MemioReaderGet
+(
+    struct MEMIO_READER *reader
+)
+{
+    T value;
+    assert(reader->Cursor + sizeof(T) <= reader->BufferEnd);
+    value = MemioRead<T, Endianess>(reader->Cursor, 0);
+    reader->Cursor += sizeof(T);
+    return value;
+}
+
+/* @summary Write a value of a given type and byte order at the current write position of a MEMIO_WRITER and advance the write position.
+ * The caller must have reserved space for the value using MemioWriterReserve.
+ * @typeparam T The type of value to write. Must be a 1, 2, 4 or 8 byte trivially-copyable type.
+ * @typeparam Endianess The byte order in which to store the value, PIL_ENDIANESS_LSB_FIRST or PIL_ENDIANESS_MSB_FIRST. Defaults to the host byte order.
+ * @param writer The MEMIO_WRITER to write to.
+ * @param value The value to write.
+ */
+template <typename T, int Endianess = PIL_SYSTEM_ENDIANESS>
+static PIL_INLINE void
+MemioWriterPut
+(
+    struct MEMIO_WRITER *writer,
+    T                       value
+)
+{
+    assert(writer->Cursor + sizeof(T) <= writer->BufferEnd);
+    writer->Cursor += MemioWrite<T, Endianess>(writer->Cursor, value, 0);
+}
+#endif /* __cplusplus */
+
+#endif /* __PIL_MEMIO_STREAM_H__ */
@@ -51,12 +51,26 @@
 /* @summary Define various constants related to the data table implementation.
  * TABLE_MIN_OBJECT_COUNT: The minimum capacity for a table.
  * TABLE_MAX_OBJECT_COUNT: The maximum capacity for a table.
+ * TABLE_SPARSE_PAGE_SIZE: The size of a single page of the sparse index, in bytes, when the sparse index is committed on-demand.
+ * TABLE_SPARSE_PAGE_SHIFT: The number of bits to shift a sparse index right by to obtain the sparse page index.
+ * TABLE_SPARSE_PAGE_ENTRIES: The number of sparse index slots in a single page of the sparse index.
+ * TABLE_STREAM_ALIGN_DEFAULT: The alignment and tail padding, in bytes, of a data stream that does not specify an alignment.
+ * TABLE_STREAM_ALIGN_MAX: The maximum alignment and tail padding, in bytes, that can be specified for a data stream.
+ * TABLE_KEY_INDEX_MIN_SLOTS: The minimum number of slots in the hash table of a TABLE_KEY_INDEX.
+ * TABLE_BLOB_ALIGN: The alignment of each blob allocated from a TABLE_BLOB_HEAP, in bytes. Blob sizes are rounded up to a multiple of this value.
  */
 #ifndef TABLE_CONSTANTS
 #   define TABLE_CONSTANTS
 #   define TABLE_MIN_OBJECT_COUNT    1UL
 #   define TABLE_MAX_OBJECT_COUNT   (1UL << HANDLE_INDEX_BITS)
 #   define TABLE_CHUNK_SIZE          1024
+#   define TABLE_SPARSE_PAGE_SIZE    4096
+#   define TABLE_SPARSE_PAGE_SHIFT   10
+#   define TABLE_SPARSE_PAGE_ENTRIES (1UL << TABLE_SPARSE_PAGE_SHIFT)
+#   define TABLE_STREAM_ALIGN_DEFAULT  16
+#   define TABLE_STREAM_ALIGN_MAX      64
+#   define TABLE_KEY_INDEX_MIN_SLOTS   64
+#   define TABLE_BLOB_ALIGN             8
 #endif
 
 /* @summary Read the number of live items in the table from the TABLE_INDEX.
@@ -77,6 +91,17 @@
     (_x)->TableCapacity
 #endif
 
+/* @summary Determine whether the sparse index page containing a given sparse index slot is committed.
+ * Tables created without TABLE_FLAG_PAGED_SPARSE_INDEX always have a fully-committed sparse index.
+ * @param _x A pointer to a TABLE_INDEX structure.
+ * @param _si The zero-based index of the sparse index slot.
+ * @return Non-zero if the sparse index slot can be accessed.
+ */
+#ifndef TableIndex_IsSparseSlotCommitted
+#define TableIndex_IsSparseSlotCommitted(_x, _si)                              \
+    (((_x)->SparsePageMask == NULL) || ((_x)->SparsePageMask[((_si) >> TABLE_SPARSE_PAGE_SHIFT) >> 5] & (1UL << (((_si) >> TABLE_SPARSE_PAGE_SHIFT) & 31))))
+#endif
+
 /* @summary Read a handle value from a TABLE_INDEX.
  * @param _x A pointer to a TABLE_INDEX structure.
  * @param _i The zero-based dense index of the handle to read. The dense index is extracted from the sparse index value.
@@ -106,6 +131,16 @@
     (_d)->ElementSize
 #endif
 
+/* @summary Retrieve the alignment of the storage buffer for a TABLE_DATA.
+ * The storage buffer base address is aligned to this value, and at least this many bytes past the end of the committed records can be read.
+ * @param _d The TABLE_DATA structure to query.
+ * @return The alignment of the storage buffer, in bytes.
+ */
+#ifndef TableData_GetAlignment
+#define TableData_GetAlignment(_d)                                             \
+    (_d)->Alignment
+#endif
+
 /* @summary Retrieve a pointer to the _i'th element in a TABLE_DATA.
  * @param _type The typename to return.
  * @param _d The TABLE_DATA structure to query.
@@ -185,6 +220,18 @@
     ((_type*)(((uint8_t*)((_td)->Streams[(_si)]->StorageBuffer)) + ((_td)->Streams[(_si)]->ElementSize * (_td)->Index->ActiveCount)))
 #endif
 
+/* @summary Retrieve a pointer to one-past the last element in a table data stream, rounded up to the stream alignment.
+ * The bytes between Table_GetStreamEnd and Table_GetStreamEndPadded are readable, so loops over the stream can process whole vectors without a scalar epilogue.
+ * @param _type The typename to return.
+ * @param _td A pointer to a TABLE_DESC structure.
+ * @param _si The zero-based index of the data stream to query.
+ * @return A pointer to the first aligned address at or past the last active element in the data stream. Elements in the padding region are not valid records.
+ */
+#ifndef Table_GetStreamEndPadded
+#define Table_GetStreamEndPadded(_type, _td, _si)                              \
+    ((_type*)(((uint8_t*)((_td)->Streams[(_si)]->StorageBuffer)) + PIL_AlignUp((_td)->Streams[(_si)]->ElementSize * (_td)->Index->ActiveCount, (_td)->Streams[(_si)]->Alignment)))
+#endif
+
 /* @summary Retrieve the number of bytes between elements in a table data stream.
  * @param _td A pointer to a TABLE_DESC structure.
  * @param _si The zero-based index of the data stream to query.
@@ -207,6 +254,35 @@
     ((_type*)(((uint8_t*)((_td)->Streams[(_si)]->StorageBuffer)) + ((_td)->Streams[(_si)]->ElementSize * (_ei))))
 #endif
 
+/* @summary Compute the hash of a key stored in a TABLE_KEY_INDEX (Fibonacci hashing).
+ * @param _k The 64-bit key value. 32-bit keys are zero-extended.
+ * @return The 32-bit hash value of the key. Mask with TABLE_KEY_INDEX::SlotCount-1 to obtain the home slot.
+ */
+#ifndef TableKeyIndex_HashKey
+#define TableKeyIndex_HashKey(_k)                                              \
+    ((uint32_t)(((uint64_t)(_k) * 0x9E3779B97F4A7C15ULL) >> 32))
+#endif
+
+/* @summary Retrieve a pointer to the data of a blob allocated from a TABLE_BLOB_HEAP.
+ * The returned address is valid until the blob is freed or relocated by TableBlobHeapCompact.
+ * @param _bh A pointer to the TABLE_BLOB_HEAP from which the blob was allocated.
+ * @param _span A pointer to the TABLE_BLOB_SPAN stored in the item record.
+ * @return A pointer (uint8_t*) to the first byte of the blob data.
+ */
+#ifndef TableBlobHeap_GetData
+#define TableBlobHeap_GetData(_bh, _span)                                          ((_bh)->HeapBase + (_span)->Offset)
+#endif
+
+/* @summary Retrieve a pointer to the TABLE_BLOB_SPAN stored in a record of a table data stream.
+ * @param _bh A pointer to the TABLE_BLOB_HEAP attached to the table.
+ * @param _td A pointer to a TABLE_DESC structure.
+ * @param _ei The zero-based index of the record.
+ * @return A pointer (TABLE_BLOB_SPAN*) to the span stored in the record.
+ */
+#ifndef TableBlobHeap_GetSpan
+#define TableBlobHeap_GetSpan(_bh, _td, _ei)                                       ((TABLE_BLOB_SPAN*)(Table_GetStreamElement(uint8_t, _td, (_bh)->StreamIndex, _ei) + (_bh)->SpanOffset))
+#endif
+
 /* @summary Items are identified by a handle, which is represented by a bit-packed 32-bit integer.
  */
 typedef uint32_t HANDLE_BITS;
@@ -214,20 +290,25 @@ typedef uint32_t HANDLE_BITS;
 /* @summary Define the data associated with the index used to map a 32-bit integer item ID to a dense array index.
  */
 typedef struct TABLE_INDEX {
-    uint32_t                      *SparseIndex;                                /* The fully committed sparse array used to map item handles to indices in TABLE_DATA and the HandleArray. */
+    uint32_t                      *SparseIndex;                                /* The sparse array used to map item handles to indices in TABLE_DATA and the HandleArray. Fully committed unless TABLE_FLAG_PAGED_SPARSE_INDEX is specified. */
     uint32_t                      *HandleArray;                                /* A partially committed, densely-packed array of the handles associated with each item in the table. */
+    uint32_t                      *SparsePageMask;                             /* A bitmap with one bit set for each committed page of the SparseIndex, or NULL if the SparseIndex is fully committed. */
     uint32_t                       ActiveCount;                                /* The number of items in the table that are valid. */
     uint32_t                       HighWatermark;                              /* The maximum number of items observed in the table since it was created or reset. */
     uint32_t                       CommitCount;                                /* The maximum number of items that can be stored in the table without committing additional memory. */
     uint32_t                       TableCapacity;                              /* The maximum capacity of the table, in items. */
+    uint32_t                       IndexFlags;                                 /* One or more bitwise OR'd values of the TABLE_FLAGS enumeration specified when the table was created. */
 } TABLE_INDEX;
 
 /* @summary Define the structure describing the buffer used to store tightly-packed item data records in a table.
  * All items in a TABLE_DATA have the same type, but a table may have more than one associated TABLE_DATA.
  */
 typedef struct TABLE_DATA {
-    void                          *StorageBuffer;                              /* A pointer to the start of the storage buffer used for storing table records. */
+    void                          *StorageBuffer;                              /* A pointer to the start of the storage buffer used for storing table records. The address is aligned to at least Alignment bytes. */
     uint32_t                       ElementSize;                                /* The size of the record type stored in the table data. */
+    uint32_t                       Alignment;                                  /* The alignment of the storage buffer, in bytes. At least this many bytes past the end of the committed records are also committed. */
+    uint32_t                       DataFlags;                                  /* One or more bitwise OR'd values of the TABLE_DATA_FLAGS enumeration. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
 } TABLE_DATA;
 
 /* @summary Define a structure used to describe a TABLE_DATA representing a data stream.
@@ -236,6 +317,7 @@ typedef struct TABLE_DATA {
 typedef struct TABLE_DATA_STREAM_DESC {
     struct TABLE_DATA             *Data;                                       /* A pointer to the TABLE_DATA to populate. */
     uint32_t                       Size;                                       /* The size of the record type stored in the table data. */
+    uint32_t                       Alignment;                                  /* The power-of-two alignment and tail padding of the data stream, in bytes, up to TABLE_STREAM_ALIGN_MAX, or zero to use TABLE_STREAM_ALIGN_DEFAULT. */
 } TABLE_DATA_STREAM_DESC;
 
 /* @summary Define the data used to construct a new data table.
@@ -246,16 +328,141 @@ typedef struct TABLE_INIT {
     uint32_t                       StreamCount;                                /* The number of valid entries in the Streams array. */
     uint32_t                       TableCapacity;                              /* The maximum number of items that can be stored in the table. */
     uint32_t                       InitialCommit;                              /* The initial table committment, in items. */
+    uint32_t                       TableFlags;                                 /* One or more bitwise OR'd values of the TABLE_FLAGS enumeration. */
 } TABLE_INIT;
 
+/* @summary Define the data stored in a single slot of the hash table of a TABLE_KEY_INDEX.
+ * A slot with a Handle value of HANDLE_BITS_INVALID is empty.
+ */
+typedef struct TABLE_KEY_INDEX_SLOT {
+    uint64_t                       Key;                                        /* The key value, read from the key column of the item record. 32-bit keys are zero-extended. */
+    HANDLE_BITS                    Handle;                                     /* The handle of the item whose record contains the key, or HANDLE_BITS_INVALID if the slot is empty. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
+} TABLE_KEY_INDEX_SLOT;
+
+/* @summary Define the data associated with a secondary index mapping a fixed-size key column in a table data stream to the handle of the item.
+ * The hash table uses open addressing with linear probing and backward-shift deletion.
+ * The index stores item handles rather than dense indices, so the swaps performed when items are deleted do not require the index to be updated.
+ */
+typedef struct TABLE_KEY_INDEX {
+    struct TABLE_KEY_INDEX        *Next;                                       /* The next TABLE_KEY_INDEX attached to the same table, or NULL. */
+    struct TABLE_KEY_INDEX_SLOT   *SlotArray;                                  /* The fully committed array of SlotCount hash table slots. */
+    uint32_t                       SlotCount;                                  /* The number of slots in the hash table. Always a power of two. */
+    uint32_t                       ItemCount;                                  /* The number of occupied slots in the hash table. */
+    uint32_t                       StreamIndex;                                /* The zero-based index of the table data stream containing the key column. */
+    uint32_t                       KeyOffset;                                  /* The byte offset of the key column from the start of each record in the data stream. */
+    uint32_t                       KeySize;                                    /* The size of the key column, in bytes. Either 4 or 8. */
+} TABLE_KEY_INDEX;
+
+/* @summary Define the data used to construct a new TABLE_KEY_INDEX.
+ */
+typedef struct TABLE_KEY_INDEX_INIT {
+    struct TABLE_KEY_INDEX        *KeyIndex;                                   /* The TABLE_KEY_INDEX to initialize. */
+    uint32_t                       StreamIndex;                                /* The zero-based index of the table data stream containing the key column. */
+    uint32_t                       KeyOffset;                                  /* The byte offset of the key column from the start of each record in the data stream. */
+    uint32_t                       KeySize;                                    /* The size of the key column, in bytes. Either 4 or 8. */
+    uint32_t                       InitialCommit;                              /* The number of items the index should be able to store without growing. */
+} TABLE_KEY_INDEX_INIT;
+
+/* @summary Define the data stored in an item record to reference a blob allocated from a TABLE_BLOB_HEAP.
+ * A span with a Size of zero does not reference a blob. The span in a newly-created record must be zeroed before the record is passed to TableBlobAlloc.
+ */
+typedef struct TABLE_BLOB_SPAN {
+    uint32_t                       Offset;                                     /* The byte offset of the blob data from TABLE_BLOB_HEAP::HeapBase. */
+    uint32_t                       Size;                                       /* The size of the blob data, in bytes, as requested by the caller. */
+} TABLE_BLOB_SPAN;
+
+/* @summary Define the data stored in the heap immediately before each blob.
+ * The header allows TableBlobHeapCompact to find the record that owns a blob.
+ */
+typedef struct TABLE_BLOB_HEADER {
+    HANDLE_BITS                    Handle;                                     /* The handle of the item that owns the blob, or HANDLE_BITS_INVALID if the blob has been freed. */
+    uint32_t                       Size;                                       /* The number of bytes occupied by the blob, including the header and alignment padding. */
+} TABLE_BLOB_HEADER;
+
+/* @summary Define the data associated with a heap of variable-length blobs owned by the items in a table.
+ * Each item record stores a TABLE_BLOB_SPAN at a fixed offset within a data stream.
+ * Blobs are allocated linearly, freed when the owning item is deleted or its blob is replaced, and 
+ * reclaimed incrementally by TableBlobHeapCompact, which slides live blobs down and patches their spans.
+ */
+typedef struct TABLE_BLOB_HEAP {
+    struct TABLE_BLOB_HEAP        *Next;                                       /* The next TABLE_BLOB_HEAP attached to the same table, or NULL. */
+    uint8_t                       *HeapBase;                                   /* The base address of the reserved heap address space. */
+    uint32_t                       HeapSize;                                   /* The number of bytes allocated from the heap, including freed blobs not yet reclaimed. */
+    uint32_t                       CommitSize;                                 /* The number of bytes of committed heap memory. */
+    uint32_t                       ReserveSize;                                /* The number of bytes of reserved heap address space. */
+    uint32_t                       FreeBytes;                                  /* The number of bytes occupied by freed blobs that have not been reclaimed. */
+    uint32_t                       CompactRead;                                /* The byte offset of the next blob to be examined by TableBlobHeapCompact. */
+    uint32_t                       CompactWrite;                               /* The byte offset at which TableBlobHeapCompact will place the next live blob. */
+    uint32_t                       StreamIndex;                                /* The zero-based index of the table data stream containing the TABLE_BLOB_SPAN column. */
+    uint32_t                       SpanOffset;                                 /* The byte offset of the TABLE_BLOB_SPAN column from the start of each record in the data stream. */
+} TABLE_BLOB_HEAP;
+
+/* @summary Define the data used to construct a new TABLE_BLOB_HEAP.
+ */
+typedef struct TABLE_BLOB_HEAP_INIT {
+    struct TABLE_BLOB_HEAP        *BlobHeap;                                   /* The TABLE_BLOB_HEAP to initialize. */
+    uint32_t                       StreamIndex;                                /* The zero-based index of the table data stream containing the TABLE_BLOB_SPAN column. */
+    uint32_t                       SpanOffset;                                 /* The byte offset of the TABLE_BLOB_SPAN column from the start of each record in the data stream. */
+    uint32_t                       ReserveSize;                                /* The maximum size of the heap, in bytes. */
+    uint32_t                       InitialCommit;                              /* The initial heap committment, in bytes. */
+} TABLE_BLOB_HEAP_INIT;
+
 /* @summary Define the data used to describe an existing data table.
  */
 typedef struct TABLE_DESC {
     struct TABLE_INDEX            *Index;                                      /* The TABLE_INDEX used to map handles to their corresponding records. */
     struct TABLE_DATA            **Streams;                                    /* An array of StreamCount densely-packed data streams representing the table records. */
     uint32_t                       StreamCount;                                /* The number of valid entries in the Streams array. */
+    struct TABLE_KEY_INDEX        *KeyIndex;                                   /* The head of the list of secondary key indices maintained by the table, or NULL. */
+    struct TABLE_BLOB_HEAP        *BlobHeap;                                   /* The head of the list of blob heaps whose blobs are owned by the table items, or NULL. */
+    struct TABLE_JOURNAL          *Journal;                                    /* The write-ahead journal recording item creation and deletion, or NULL. */
 } TABLE_DESC;
 
+/* @summary Define various flags that can be bitwise OR'd to control the behavior of a data table.
+ */
+typedef enum TABLE_FLAGS {
+    TABLE_FLAGS_NONE                       = (0UL <<  0),                      /* No flags are specified. The sparse index is fully committed when the table is created. */
+    TABLE_FLAG_PAGED_SPARSE_INDEX          = (1UL <<  0),                      /* The sparse index is committed one TABLE_SPARSE_PAGE_SIZE page at a time, as the slots in each page are first used. */
+} TABLE_FLAGS;
+
+/* @summary Define various flags describing the storage of a single table data stream.
+ */
+typedef enum TABLE_DATA_FLAGS {
+    TABLE_DATA_FLAGS_NONE                  = (0UL <<  0),                      /* No flags are specified. The storage buffer is reserved and committed by the table. */
+    TABLE_DATA_FLAG_EXTERNAL_STORAGE       = (1UL <<  0),                      /* The storage buffer is owned by the application and was adopted by TableAdopt. It is never committed or freed by the table. */
+} TABLE_DATA_FLAGS;
+
+/* @summary Define the types of record stored in a table journal.
+ */
+typedef enum TABLE_JOURNAL_RECORD_TYPE {
+    TABLE_JOURNAL_RECORD_TYPE_CREATE_ID    =  1,                               /* TableCreateId returned a handle. Followed by the handle. */
+    TABLE_JOURNAL_RECORD_TYPE_DELETE_ID    =  2,                               /* TableDeleteId was called. Followed by the handle. */
+    TABLE_JOURNAL_RECORD_TYPE_DELETE_IDS   =  3,                               /* TableDeleteIds was called. Followed by the handle count and handles. */
+    TABLE_JOURNAL_RECORD_TYPE_DELETE_ALL   =  4,                               /* TableDeleteAllIds was called. */
+    TABLE_JOURNAL_RECORD_TYPE_WRITE        =  5,                               /* TableJournalWrite was called. Followed by the stream index, size, handle, offset and data. */
+    TABLE_JOURNAL_RECORD_TYPE_INSERT_ID    =  6,                               /* TableInsertId inserted a handle. Followed by the handle. */
+    TABLE_JOURNAL_RECORD_TYPE_REMOVE_ID    =  7,                               /* TableRemoveId was called. Followed by the handle. */
+    TABLE_JOURNAL_RECORD_TYPE_REMOVE_ALL   =  8,                               /* TableRemoveAllIds was called. */
+    TABLE_JOURNAL_RECORD_TYPE_CREATE_KEYED =  9,                               /* TableCreateKeyedId returned a handle. Followed by the handle and the 64-bit key. */
+} TABLE_JOURNAL_RECORD_TYPE;
+
+/* @summary Define the signature for the callback function used to initialize the records of a data stream added to an existing table.
+ * @param records A pointer to the first record of the new data stream.
+ * @param handles The handles of the items in the table, in dense order.
+ * @param count The number of records to initialize.
+ * @param element_size The size of each record, in bytes.
+ * @param context The opaque context data supplied to TableAddStream.
+ */
+typedef void (*PFN_TableStreamInit)
+(
+    void                    *records, 
+    HANDLE_BITS const       *handles, 
+    uint32_t                   count, 
+    uint32_t            element_size, 
+    void                    *context
+);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -271,6 +478,25 @@ TableCreate
     struct TABLE_INIT *init
 );
 
+/* @summary Allocate the index for a data table whose data streams use existing, application-owned record arrays, without copying any records.
+ * The index is built so that item i has dense index i and sparse index i, with generation zero. The new table otherwise behaves like one created with TableCreate.
+ * Each storage array must be aligned to the stream alignment, remain valid until TableDelete is called, and be readable and writable for TableCapacity records plus the stream alignment in tail padding.
+ * The implementation of this function is platform-specific.
+ * @param o_handles Optional pointer to an array of item_count handles to populate with the handles of the adopted items.
+ * @param init Pointer to a TABLE_INIT describing the index and data streams. The InitialCommit field is ignored.
+ * @param stream_storage An array of init->StreamCount pointers to the record arrays for each data stream.
+ * @param item_count The number of valid records in each record array.
+ * @return Zero if the table is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableAdopt
+(
+    HANDLE_BITS           *o_handles, 
+    struct TABLE_INIT          *init, 
+    void * const     *stream_storage, 
+    uint32_t              item_count
+);
+
 /* @summary Ensure that a data table can accomodate a given number of items.
  * If necessary and possible, the table committment is increased to meet the need.
  * The implementation of this function is platform-specific.
@@ -287,6 +513,61 @@ TableEnsure
     uint32_t      chunk_size
 );
 
+/* @summary Ensure that the pages of the sparse index covering a range of sparse index slots are committed.
+ * This function is called internally by TableEnsure and TableInsertId, and does nothing for tables created without TABLE_FLAG_PAGED_SPARSE_INDEX.
+ * The implementation of this function is platform-specific.
+ * @param index Pointer to the TABLE_INDEX whose sparse index pages will be committed.
+ * @param sparse_begin The zero-based index of the first sparse index slot that must be accessible.
+ * @param sparse_end The zero-based index of one-past the last sparse index slot that must be accessible.
+ * @return Zero if all slots in the range [sparse_begin, sparse_end) can be accessed, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableCommitSparseIndex
+(
+    struct TABLE_INDEX *index, 
+    uint32_t     sparse_begin, 
+    uint32_t       sparse_end
+);
+
+/* @summary Attach a new data stream to an existing data table.
+ * The stream is reserved to the table capacity and committed to the current table commitment, so existing records are not copied.
+ * The records for existing items are initialized by init_func if specified, or by copying default_value if specified, or else zero-filled.
+ * The implementation of this function is platform-specific.
+ * @param o_stream_index Pointer to a location to update with the zero-based index of the new data stream.
+ * @param table Pointer to a TABLE_DESC describing the table.
+ * @param stream_capacity The number of entries in the table->Streams array. The call fails if the array is full.
+ * @param stream Pointer to a TABLE_DATA_STREAM_DESC describing the data stream to add.
+ * @param default_value Optional pointer to a record of stream->Size bytes copied into the new record of each existing item, or NULL.
+ * @param init_func Optional callback used to initialize the new records of the existing items, or NULL.
+ * @param init_context Opaque data passed through to init_func.
+ * @return Zero if the data stream is attached to the table, or non-zero if the Streams array is full or an error occurred.
+ */
+PIL_API(int)
+TableAddStream
+(
+    uint32_t                *o_stream_index, 
+    struct TABLE_DESC                *table, 
+    uint32_t                stream_capacity, 
+    struct TABLE_DATA_STREAM_DESC   *stream, 
+    void const               *default_value, 
+    PFN_TableStreamInit           init_func, 
+    void                      *init_context
+);
+
+/* @summary Detach a data stream from an existing data table and free its storage.
+ * Data streams following the removed stream are moved down by one in the Streams array, and the StreamIndex of key indices and blob heaps is updated to match.
+ * The implementation of this function is platform-specific.
+ * @param table Pointer to a TABLE_DESC describing the table.
+ * @param stream_index The zero-based index of the data stream to remove. No key index or blob heap may reference this stream.
+ * @return Zero if the data stream is removed, or non-zero if the stream index is invalid or the stream is still referenced.
+ */
+PIL_API(int)
+TableRemoveStream
+(
+    struct TABLE_DESC                *table, 
+    uint32_t                   stream_index
+);
+
 /* @summary Free all resources allocated by a data table.
  * The implementation of this function is platform-specific.
  * @param table Pointer to a TABLE_DESC describing the index and data streams for the table.
@@ -380,6 +661,7 @@ TableResolve
  * The caller is responsible for ensuring the table has sufficient committed capacity using the TableEnsure function.
  * @param o_record_index Pointer to a location to update with the index value to pass to TableData_GetElementPointer.
  * @param table Pointer to the TABLE_DESC describing the table that owns the item identifier.
+ * The new item is not added to any key index linked to the table; write its key columns and call TableKeyIndexInsert for each index, or use TableCreateKeyedId.
  * @return The table item identifier, or HANDLE_BITS_INVALID if the item cannot be created.
  */
 PIL_API(HANDLE_BITS)
@@ -391,9 +673,11 @@ TableCreateId
 
 /* @summary Insert an existing ID, generated by TableCreateId on a different table, into a data table.
  * The caller is responsible for ensuring the table has sufficient committed capacity using the TableEnsure function.
+ * Items should be added to the table only with TableInsertId and removed only with TableRemoveId, so that the table shares the handle space of the table that created the IDs.
  * @param o_record_index Pointer to a location to update with the index value to pass to TableData_GetElementPointer.
  * @param table Pointer to the TABLE_DESC describing the table into which the key will be inserted.
  * @param bits The HANDLE_BITS representing the externally-created table item identifier.
+ * The item is not added to any key index linked to the table; write its key columns and call TableKeyIndexInsert for each index.
  * @return Zero if the item is inserted successfully, or non-zero if the item identifier cannot be inserted.
  */
 PIL_API(int)
@@ -404,6 +688,201 @@ TableInsertId
     HANDLE_BITS         bits
 );
 
+/* @summary Allocate resources for a secondary key index.
+ * After creation, link the key index into the TABLE_DESC::KeyIndex list of the table it indexes.
+ * Items deleted or removed from the table are automatically removed from all linked key indices, and TableEnsure grows linked key indices.
+ * The implementation of this function is platform-specific.
+ * @param init Pointer to a TABLE_KEY_INDEX_INIT describing the key column and initial capacity of the index.
+ * @return Zero if the key index is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableKeyIndexCreate
+(
+    struct TABLE_KEY_INDEX_INIT *init
+);
+
+/* @summary Ensure that a secondary key index can store a given number of items without exceeding its maximum load factor.
+ * If necessary, the hash table is reallocated and rehashed. This function is called by TableEnsure for each linked key index.
+ * The implementation of this function is platform-specific.
+ * @param key_index The TABLE_KEY_INDEX to grow.
+ * @param total_need The total number of items the caller needs to store in the index.
+ * @return Zero if the index can store at least total_need items, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableKeyIndexEnsure
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    uint32_t               total_need
+);
+
+/* @summary Free all resources allocated by a secondary key index.
+ * The key index should be unlinked from the TABLE_DESC::KeyIndex list before it is deleted.
+ * The implementation of this function is platform-specific.
+ * @param key_index The TABLE_KEY_INDEX to delete.
+ */
+PIL_API(void)
+TableKeyIndexDelete
+(
+    struct TABLE_KEY_INDEX *key_index
+);
+
+/* @summary Add an item to a secondary key index. The key is read from the key column of the item record, which must already be written.
+ * @param key_index The TABLE_KEY_INDEX to update.
+ * @param table Pointer to a TABLE_DESC describing the table that owns the item.
+ * @param bits The HANDLE_BITS identifying the item to add.
+ * @return Zero if the item is added, or non-zero if the key is already present in the index or the index is full.
+ */
+PIL_API(int)
+TableKeyIndexInsert
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    struct TABLE_DESC          *table, 
+    HANDLE_BITS                  bits
+);
+
+/* @summary Find the handle of the item with a given key.
+ * @param key_index The TABLE_KEY_INDEX to search.
+ * @param key The key value to search for. 32-bit keys are zero-extended.
+ * @return The handle of the item with the given key, or HANDLE_BITS_INVALID if no item has the key.
+ */
+PIL_API(HANDLE_BITS)
+TableKeyIndexLookup
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    uint64_t                      key
+);
+
+/* @summary Remove all items from a secondary key index.
+ * @param key_index The TABLE_KEY_INDEX to reset.
+ */
+PIL_API(void)
+TableKeyIndexClear
+(
+    struct TABLE_KEY_INDEX *key_index
+);
+
+/* @summary Create a single table item identifier, write a key into the key column of every key index linked to the table, and add the item to each of those indices.
+ * The caller is responsible for ensuring the table and its key indices have sufficient committed capacity using the TableEnsure and TableKeyIndexEnsure functions.
+ * The key is rejected if it is already present in any linked index, or if it does not fit in a linked index with a 32-bit key column.
+ * @param o_record_index Pointer to a location to update with the index value to pass to TableData_GetElementPointer.
+ * @param table Pointer to the TABLE_DESC describing the table that owns the item identifier. The table must have at least one linked key index.
+ * @param key The key value to associate with the new item.
+ * @return The table item identifier, or HANDLE_BITS_INVALID if the key is already present or the item cannot be created.
+ */
+PIL_API(HANDLE_BITS)
+TableCreateKeyedId
+(
+    uint32_t *o_record_index, 
+    struct TABLE_DESC *table, 
+    uint64_t             key
+);
+
+/* @summary Resolve a key into an array index that can be used with the TableData_GetElementPointer macro.
+ * @param o_record_index Pointer to the location to update with the index value to pass to TableData_GetElementPointer.
+ * @param table Pointer to a TABLE_DESC describing the table in which the lookup will be performed.
+ * @param key_index The TABLE_KEY_INDEX to search.
+ * @param key The key value to search for.
+ * @return The handle of the item with the given key, or HANDLE_BITS_INVALID if no item has the key.
+ */
+PIL_API(HANDLE_BITS)
+TableResolveKey
+(
+    uint32_t            *o_record_index, 
+    struct TABLE_DESC            *table, 
+    struct TABLE_KEY_INDEX   *key_index, 
+    uint64_t                        key
+);
+
+/* @summary Allocate resources for a blob heap.
+ * After creation, link the blob heap into the TABLE_DESC::BlobHeap list of the table whose items own the blobs.
+ * The implementation of this function is platform-specific.
+ * @param init Pointer to a TABLE_BLOB_HEAP_INIT describing the span column and size of the heap.
+ * @return Zero if the blob heap is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableBlobHeapCreate
+(
+    struct TABLE_BLOB_HEAP_INIT *init
+);
+
+/* @summary Ensure that a blob heap can accomodate an allocation without committing additional memory.
+ * The implementation of this function is platform-specific.
+ * @param blob_heap The TABLE_BLOB_HEAP to grow.
+ * @param total_need The total number of bytes the heap must be able to store, including the bytes already allocated.
+ * @return Zero if the heap can store at least total_need bytes, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableBlobHeapEnsure
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    uint32_t               total_need
+);
+
+/* @summary Free all resources allocated to a blob heap.
+ * The blob heap should be unlinked from the TABLE_DESC::BlobHeap list before it is deleted.
+ * The implementation of this function is platform-specific.
+ * @param blob_heap The TABLE_BLOB_HEAP to delete.
+ */
+PIL_API(void)
+TableBlobHeapDelete
+(
+    struct TABLE_BLOB_HEAP *blob_heap
+);
+
+/* @summary Allocate a blob for a table item, freeing any blob the item already owns, and update the span stored in the item record.
+ * @param blob_heap The TABLE_BLOB_HEAP from which the blob should be allocated.
+ * @param table Pointer to a TABLE_DESC describing the table that owns the item.
+ * @param bits The HANDLE_BITS identifying the item that will own the blob.
+ * @param size The size of the blob data, in bytes. Specify zero to free the existing blob without allocating a new one.
+ * @return A pointer to the uninitialized blob data, or NULL if the item is not live, size is zero, or the heap is full.
+ */
+PIL_API(uint8_t*)
+TableBlobAlloc
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_DESC          *table, 
+    HANDLE_BITS                  bits, 
+    uint32_t                     size
+);
+
+/* @summary Free the blob owned by a table item, if any, and reset the span stored in the item record.
+ * Blobs are freed automatically when the owning item is deleted from a table with the blob heap linked to TABLE_DESC::BlobHeap.
+ * @param blob_heap The TABLE_BLOB_HEAP from which the blob was allocated.
+ * @param table Pointer to a TABLE_DESC describing the table that owns the item.
+ * @param bits The HANDLE_BITS identifying the item that owns the blob.
+ */
+PIL_API(void)
+TableBlobFree
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_DESC          *table, 
+    HANDLE_BITS                  bits
+);
+
+/* @summary Perform a bounded amount of blob heap compaction, sliding live blobs toward the start of the heap and updating the spans stored in their item records.
+ * Call periodically, for example once per frame. Blobs may be allocated and freed between calls.
+ * @param blob_heap The TABLE_BLOB_HEAP to compact.
+ * @param table Pointer to a TABLE_DESC describing the table that owns the blobs.
+ * @param max_bytes The maximum number of heap bytes to examine during the call.
+ * @return Non-zero if the compaction pass completed and all freed space has been reclaimed, or zero if more work remains.
+ */
+PIL_API(int)
+TableBlobHeapCompact
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_DESC          *table, 
+    uint32_t                max_bytes
+);
+
+/* @summary Free all blobs in a blob heap and reset it back to empty. Committed memory remains committed.
+ * @param blob_heap The TABLE_BLOB_HEAP to reset.
+ */
+PIL_API(void)
+TableBlobHeapClear
+(
+    struct TABLE_BLOB_HEAP *blob_heap
+);
+
 /* @summary Construct a HANDLE_BITS from its constituient parts.
  * @param sparse_index The zero-based index within the sparse portion of the TABLE_INDEX that is allocated to the item.
  * @param generation The generation value of the data slot allocated to the item.
@@ -499,6 +978,34 @@ TableData_GetElementIndex
     void             *element_ptr
 );
 
+/* @summary Append a record to a table journal. This function is called internally by the table functions that create and delete items.
+ * @param journal The TABLE_JOURNAL to update.
+ * @param record_type One of the values of the TABLE_JOURNAL_RECORD_TYPE enumeration, other than TABLE_JOURNAL_RECORD_TYPE_WRITE and TABLE_JOURNAL_RECORD_TYPE_CREATE_KEYED.
+ * @param handles The handles associated with the record.
+ * @param handle_count The number of handles associated with the record.
+ */
+PIL_API(void)
+TableJournalAppend
+(
+    struct TABLE_JOURNAL *journal,
+    uint32_t          record_type,
+    HANDLE_BITS const    *handles,
+    uint32_t         handle_count
+);
+
+/* @summary Append a TABLE_JOURNAL_RECORD_TYPE_CREATE_KEYED record to a table journal. This function is called internally by TableCreateKeyedId.
+ * @param journal The TABLE_JOURNAL to update.
+ * @param bits The handle of the new item.
+ * @param key The key value written to the key columns of the new item.
+ */
+PIL_API(void)
+TableJournalAppendKeyed
+(
+    struct TABLE_JOURNAL *journal,
+    HANDLE_BITS              bits,
+    uint64_t                  key
+);
+
 #ifdef __cplusplus
 }; /* extern "C" */
 #endif
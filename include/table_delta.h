@@ -0,0 +1,106 @@
+/**
+ * @summary table_delta.h: Define the functions used to replicate a data table
+ * into another table, possibly owned by a different process, by shipping the
+ * differences between two epochs of the source table. The producer keeps a
+ * shadow table holding the previous epoch, encodes a delta by comparing the
+ * source table against the shadow, and applies the delta to both the shadow
+ * and the replica. A replica has the same handles and dense order as the
+ * source table, so dense indices and handles can be used interchangeably.
+ */
+#ifndef __PIL_TABLE_DELTA_H__
+#define __PIL_TABLE_DELTA_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#endif
+
+/* @summary Define various constants used by the table delta encoding.
+ */
+#ifndef TABLE_DELTA_CONSTANTS
+#   define TABLE_DELTA_CONSTANTS
+#   define TABLE_DELTA_MAGIC               0x544C4444UL                        /* 'DDLT' */
+#   define TABLE_DELTA_MAX_VARINT_SIZE     5
+#endif
+
+/* @summary Define the header at the start of every encoded table delta.
+ * The header is followed by StreamCount 32-bit record sizes, the run-length coded handle section, and one run-length coded section per data stream.
+ * Each section is a sequence of (unchanged count, changed count) varint pairs, each followed by the changed handles or records, covering ItemCount dense slots.
+ * Created items and items moved by deletions appear as changed handles. Deleted items are those absent from the handle section.
+ */
+typedef struct TABLE_DELTA_HEADER {
+    uint32_t                       Magic;                                      /* The value TABLE_DELTA_MAGIC. */
+    uint32_t                       StreamCount;                                /* The number of data streams in the source table. */
+    uint64_t                       BaseEpoch;                                  /* The epoch of the table the delta must be applied to. */
+    uint64_t                       Epoch;                                      /* The epoch of the table after the delta is applied. */
+    uint32_t                       ItemCount;                                  /* The number of items in the source table. */
+    uint32_t                       BaseItemCount;                              /* The number of items in the table the delta must be applied to. */
+    uint32_t                       DataSize;                                   /* The total size of the delta, in bytes, including the header. */
+    uint32_t                       ChangeCount;                                /* The number of changed handles and records across all sections. */
+} TABLE_DELTA_HEADER;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Calculate the maximum number of bytes required to encode a delta for a table.
+ * @param table Pointer to a TABLE_DESC describing the source table.
+ * @return The size of the buffer that guarantees TableDeltaEncode succeeds.
+ */
+PIL_API(size_t)
+TableDeltaGetMaxSize
+(
+    struct TABLE_DESC *table
+);
+
+/* @summary Encode the differences between a source table and a shadow table holding an earlier epoch of the source table.
+ * The shadow table must have the same data streams as the source table, and must only be modified by TableDeltaApply.
+ * After encoding, apply the delta to the shadow table so that it holds the new epoch.
+ * @param o_buffer The buffer to which the delta will be written.
+ * @param buffer_size The size of the buffer, in bytes. See TableDeltaGetMaxSize.
+ * @param source Pointer to a TABLE_DESC describing the source table.
+ * @param shadow Pointer to a TABLE_DESC describing the shadow table, which holds epoch base_epoch of the source table.
+ * @param base_epoch The epoch of the shadow table.
+ * @param epoch The epoch of the source table.
+ * @return The number of bytes written to o_buffer, or zero if the tables are incompatible or the buffer is too small.
+ */
+PIL_API(size_t)
+TableDeltaEncode
+(
+    void           *o_buffer,
+    size_t       buffer_size,
+    struct TABLE_DESC *source,
+    struct TABLE_DESC *shadow,
+    uint64_t      base_epoch,
+    uint64_t           epoch
+);
+
+/* @summary Apply a delta produced by TableDeltaEncode to a replica or shadow table.
+ * The table index of the replica is updated directly, so the replica must not be modified by any other function.
+ * A replica starts out as an empty table at epoch zero with the same data streams and capacity as the source table.
+ * @param replica Pointer to a TABLE_DESC describing the table to update.
+ * @param io_epoch On input, the epoch of the replica, which must match the base epoch of the delta. On output, the new epoch of the replica.
+ * @param delta The encoded delta.
+ * @param delta_size The size of the encoded delta, in bytes.
+ * @return Zero if the delta was applied, or non-zero if the delta is invalid or does not apply to the replica.
+ */
+PIL_API(int)
+TableDeltaApply
+(
+    struct TABLE_DESC *replica,
+    uint64_t         *io_epoch,
+    void const          *delta,
+    size_t          delta_size
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_TABLE_DELTA_H__ */
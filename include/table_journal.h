@@ -0,0 +1,161 @@
+/**
+ * @summary table_journal.h: Define the data structures and functions used to
+ * maintain a write-ahead journal of the mutations applied to a data table.
+ * Item creation and deletion and writes to item records are appended to an
+ * in-memory buffer as compact records. The buffered records are written to an
+ * append-only file as a single checksummed group when the buffer fills or the
+ * application commits, and the file is flushed to disk once every few groups.
+ * After a crash, the table is restored from a base snapshot and the complete
+ * groups in the journal are replayed onto it.
+ */
+#ifndef __PIL_TABLE_JOURNAL_H__
+#define __PIL_TABLE_JOURNAL_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#   ifndef __PIL_FILEIO_H__
+#       include "fileio.h"
+#   endif
+#endif
+
+/* @summary Define various constants used by the table journal.
+ */
+#ifndef TABLE_JOURNAL_CONSTANTS
+#   define TABLE_JOURNAL_CONSTANTS
+#   define TABLE_JOURNAL_GROUP_MAGIC       0x4C4E524AUL                        /* 'JRNL' */
+#   define TABLE_JOURNAL_MIN_BUFFER_SIZE   4096
+#   define TABLE_JOURNAL_MAX_WRITE_SIZE    65535
+#endif
+
+/* @summary Determine whether a table journal has encountered a write error.
+ * Once an error occurs, the journal file no longer reflects the table state and a new base snapshot must be taken.
+ * @param _j A pointer to a TABLE_JOURNAL structure.
+ * @return Non-zero if the journal has encountered an error.
+ */
+#ifndef TableJournal_HasError
+#define TableJournal_HasError(_j)                                              \
+    ((_j)->ErrorCode != 0)
+#endif
+
+/* @summary Define the header written to the journal file at the start of each group of records.
+ * A group is replayed only if its header and all of its record data are present and the checksum matches, so a write torn by a crash is ignored.
+ */
+typedef struct TABLE_JOURNAL_GROUP_HEADER {
+    uint32_t                       Magic;                                      /* The value TABLE_JOURNAL_GROUP_MAGIC. */
+    uint32_t                       Sequence;                                   /* The zero-based sequence number of the group within the journal file. */
+    uint32_t                       DataSize;                                   /* The number of bytes of record data following the header. */
+    uint32_t                       Checksum;                                   /* The FNV-1a hash of the record data, seeded with the sequence number. */
+} TABLE_JOURNAL_GROUP_HEADER;
+
+/* @summary Define the data associated with a write-ahead journal attached to a table.
+ * The Buffer holds space for a TABLE_JOURNAL_GROUP_HEADER followed by the records that have not yet been written to the file.
+ */
+typedef struct TABLE_JOURNAL {
+    FILE_HANDLE                    File;                                       /* The append-only journal file, opened with write access. */
+    uint8_t                       *Buffer;                                     /* The buffer used to accumulate the records of the next group. */
+    uint32_t                       BufferSize;                                 /* The number of bytes of the buffer in use, including the group header. */
+    uint32_t                       BufferCapacity;                             /* The size of the buffer, in bytes. */
+    uint32_t                       RecordCount;                                /* The number of records in the buffer. */
+    uint32_t                       Sequence;                                   /* The sequence number of the next group written to the file. */
+    uint32_t                       SyncInterval;                               /* The number of groups written between flushes of the file, or zero to flush only on request. */
+    uint32_t                       UnsyncedGroups;                             /* The number of groups written since the file was last flushed. */
+    int64_t                        FileOffset;                                 /* The byte offset at which the next group is written. */
+    int32_t                        ErrorCode;                                  /* Zero, or -1 if a write to or flush of the file has failed. No further records are written. */
+} TABLE_JOURNAL;
+
+/* @summary Define the data used to construct a new TABLE_JOURNAL.
+ */
+typedef struct TABLE_JOURNAL_INIT {
+    struct TABLE_JOURNAL          *Journal;                                    /* The TABLE_JOURNAL to initialize. */
+    FILE_HANDLE                    File;                                       /* The journal file, created with FileCreate. The journal does not close the file. */
+    uint32_t                       BufferSize;                                 /* The size of the group buffer, in bytes. At least TABLE_JOURNAL_MIN_BUFFER_SIZE. */
+    uint32_t                       SyncInterval;                               /* The number of groups written between flushes of the file, or zero to flush only on request. */
+} TABLE_JOURNAL_INIT;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Allocate the group buffer for a table journal.
+ * Attach the journal to a table by setting TABLE_DESC::Journal. The table and its journal must be accessed from one thread at a time.
+ * @param init Pointer to a TABLE_JOURNAL_INIT describing the journal to create.
+ * @return Zero if the journal is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableJournalCreate
+(
+    struct TABLE_JOURNAL_INIT *init
+);
+
+/* @summary Free the resources allocated to a table journal. Any records not yet committed are discarded, and the file is not closed.
+ * @param journal The TABLE_JOURNAL to delete.
+ */
+PIL_API(void)
+TableJournalDelete
+(
+    struct TABLE_JOURNAL *journal
+);
+
+/* @summary Write the buffered records to the journal file as a single group, and flush the file if requested or if the sync interval has elapsed.
+ * @param journal The TABLE_JOURNAL to commit.
+ * @param sync Specify non-zero to flush the file to disk before returning, making all committed records durable.
+ * @return Zero if the records were committed, or non-zero if the journal has encountered an error.
+ */
+PIL_API(int)
+TableJournalCommit
+(
+    struct TABLE_JOURNAL *journal,
+    int                      sync
+);
+
+/* @summary Write data to a field of an item record and append the write to the table journal.
+ * Writes made directly through Table_GetStreamElement are not journaled.
+ * @param table Pointer to a TABLE_DESC describing the table. If table->Journal is NULL, the data is written but not journaled.
+ * @param bits The handle of the item to update.
+ * @param stream_index The zero-based index of the data stream containing the field. Must be less than 256.
+ * @param field_offset The byte offset of the field from the start of the record.
+ * @param data The data to write.
+ * @param size The number of bytes to write, up to TABLE_JOURNAL_MAX_WRITE_SIZE.
+ * @return Zero if the data is written, or non-zero if the handle or field is invalid.
+ */
+PIL_API(int)
+TableJournalWrite
+(
+    struct TABLE_DESC *table,
+    HANDLE_BITS         bits,
+    uint32_t    stream_index,
+    uint32_t    field_offset,
+    void const         *data,
+    uint32_t            size
+);
+
+/* @summary Replay the contents of a journal file onto a table restored from the base snapshot taken when the journal file was created.
+ * Replay stops at the first incomplete or corrupt group, which is expected at the end of a journal written by a process that crashed.
+ * The table must not have a journal attached during replay. Once replay completes, take a new base snapshot and start a new journal file.
+ * @param o_bytes_used Optional pointer to a location to update with the number of bytes of data that were replayed.
+ * @param table Pointer to a TABLE_DESC describing the table to update.
+ * @param data The contents of the journal file.
+ * @param size The number of bytes of journal data.
+ * @return Zero if all complete groups were replayed, or non-zero if a record could not be applied to the table.
+ */
+PIL_API(int)
+TableJournalReplay
+(
+    uint32_t *o_bytes_used,
+    struct TABLE_DESC *table,
+    void const         *data,
+    uint32_t            size
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_TABLE_JOURNAL_H__ */
@@ -0,0 +1,262 @@
+/**
+ * @summary table_scan.h: Defines data structures and functions for evaluating
+ * predicates over fixed-width columns of table data streams. A scan evaluates
+ * a predicate over all live items in a table and produces a selection of dense
+ * indices. A filter refines an existing selection using another predicate,
+ * which may read a column from a different data stream of the same table.
+ * Aggregates reduce a numeric column, optionally restricted to a selection.
+ * Joins pair up the items of two tables that share a handle space.
+ */
+#ifndef __PIL_TABLE_SCAN_H__
+#define __PIL_TABLE_SCAN_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#endif
+
+/* @summary Retrieve the number of items in a TABLE_SELECTION.
+ * @param _s A pointer to a TABLE_SELECTION structure.
+ * @return The number of dense indices in the selection.
+ */
+#ifndef TableSelection_GetCount
+#define TableSelection_GetCount(_s)                                            \
+    (_s)->Count
+#endif
+
+/* @summary Retrieve the dense index of the _i'th item in a TABLE_SELECTION.
+ * @param _s A pointer to a TABLE_SELECTION structure.
+ * @param _i The zero-based index of the selected item, in [0, TableSelection_GetCount(_s)).
+ * @return The dense index of the item, which can be passed to Table_GetStreamElement.
+ */
+#ifndef TableSelection_GetIndex
+#define TableSelection_GetIndex(_s, _i)                                        \
+    (_s)->Indices[(_i)]
+#endif
+
+/* @summary Define a selection vector produced by a table scan.
+ * The selection stores dense indices in ascending order. Dense indices are only valid until the next operation that deletes or creates items in the table.
+ */
+typedef struct TABLE_SELECTION {
+    uint32_t                      *Indices;                                    /* Caller-managed storage for up to Capacity dense indices. */
+    uint32_t                       Count;                                      /* The number of valid entries in the Indices array. */
+    uint32_t                       Capacity;                                   /* The maximum number of entries that can be written to the Indices array. */
+} TABLE_SELECTION;
+
+/* @summary Retrieve the number of item pairs produced by the most recent call to TableJoin.
+ * @param _j A pointer to a TABLE_JOIN structure.
+ * @return The number of valid entries in the LeftIndices and RightIndices arrays.
+ */
+#ifndef TableJoin_GetCount
+#define TableJoin_GetCount(_j)                                                 \
+    (_j)->Count
+#endif
+
+/* @summary Define the state used to iterate over the items present in both of two tables sharing a handle space.
+ * Two tables share a handle space when the items in one are created with TableCreateId and inserted into the other with TableInsertId.
+ * Each call to TableJoin produces the next batch of item pairs; the dense indices are only valid until the next operation that deletes or creates items in either table.
+ */
+typedef struct TABLE_JOIN {
+    uint32_t                      *LeftIndices;                                /* Caller-managed storage for up to Capacity dense indices into the left table. */
+    uint32_t                      *RightIndices;                               /* Caller-managed storage for up to Capacity dense indices into the right table. */
+    uint32_t                       Count;                                      /* The number of valid entries in the LeftIndices and RightIndices arrays. */
+    uint32_t                       Capacity;                                   /* The maximum number of entries that can be written to the LeftIndices and RightIndices arrays. */
+    uint32_t                       Cursor;                                     /* The dense index in the smaller table at which the next batch starts. Set to zero to begin a join. */
+} TABLE_JOIN;
+
+/* @summary Define the data describing a predicate evaluated against a 32-bit column of a table data stream.
+ * The column value for record i is read from (StorageBuffer + (i * ElementSize) + FieldOffset).
+ * Scans run fastest when the column is stored in its own data stream, with an ElementSize of 4 and a FieldOffset of 0.
+ */
+typedef struct TABLE_SCAN_PREDICATE {
+    uint32_t                       StreamIndex;                                /* The zero-based index of the table data stream containing the column. */
+    uint32_t                       FieldOffset;                                /* The byte offset of the column from the start of each record in the data stream. */
+    uint32_t                       Operation;                                  /* One of the values of the TABLE_SCAN_OPERATION enumeration. */
+    union {
+        struct { float    Min, Max; } F32;                                     /* The inclusive range for TABLE_SCAN_OPERATION_F32_RANGE. NaN values never match. */
+        struct { int32_t  Min, Max; } I32;                                     /* The inclusive range for TABLE_SCAN_OPERATION_I32_RANGE. */
+        struct { uint32_t Min, Max; } U32;                                     /* The inclusive range for TABLE_SCAN_OPERATION_U32_RANGE. */
+        struct { uint32_t Mask, Value;} Bits;                                  /* The mask and test value for TABLE_SCAN_OPERATION_U32_MASK_EQUAL and TABLE_SCAN_OPERATION_U32_MASK_ANY. */
+    } Operand;
+} TABLE_SCAN_PREDICATE;
+
+/* @summary Define the operations that can be performed by a TABLE_SCAN_PREDICATE.
+ */
+typedef enum TABLE_SCAN_OPERATION {
+    TABLE_SCAN_OPERATION_F32_RANGE         =  0,                               /* Select items where Operand.F32.Min <= (float) column <= Operand.F32.Max. */
+    TABLE_SCAN_OPERATION_I32_RANGE         =  1,                               /* Select items where Operand.I32.Min <= (int32_t) column <= Operand.I32.Max. */
+    TABLE_SCAN_OPERATION_U32_RANGE         =  2,                               /* Select items where Operand.U32.Min <= (uint32_t) column <= Operand.U32.Max. */
+    TABLE_SCAN_OPERATION_U32_MASK_EQUAL    =  3,                               /* Select items where (column & Operand.Bits.Mask) == Operand.Bits.Value. */
+    TABLE_SCAN_OPERATION_U32_MASK_ANY      =  4,                               /* Select items where (column & Operand.Bits.Mask) != 0. */
+} TABLE_SCAN_OPERATION;
+
+/* @summary Define the data describing a numeric column of a table data stream used as the input to an aggregate.
+ * The column value for record i is read from (StorageBuffer + (i * ElementSize) + FieldOffset).
+ * Aggregates run fastest when the column is stored in its own data stream, with a FieldOffset of 0.
+ */
+typedef struct TABLE_COLUMN {
+    uint32_t                       StreamIndex;                                /* The zero-based index of the table data stream containing the column. */
+    uint32_t                       FieldOffset;                                /* The byte offset of the column from the start of each record in the data stream. */
+    uint32_t                       ColumnType;                                 /* One of the values of the TABLE_COLUMN_TYPE enumeration. */
+} TABLE_COLUMN;
+
+/* @summary Define the result of an aggregate over a table column.
+ * Integer columns update the I64 fields, and floating-point columns update the F64 fields.
+ * Results for disjoint ranges of the same column can be combined with TableAggregateMerge.
+ */
+typedef struct TABLE_AGGREGATE {
+    int64_t                        SumI64;                                     /* The sum of the integer column values. Wraps on overflow. */
+    int64_t                        MinI64;                                     /* The minimum integer column value, or INT64_MAX if Count is zero. */
+    int64_t                        MaxI64;                                     /* The maximum integer column value, or INT64_MIN if Count is zero. */
+    double                         SumF64;                                     /* The sum of the floating-point column values. float columns are summed in double precision. */
+    double                         MinF64;                                     /* The minimum floating-point column value, or +infinity if Count is zero. */
+    double                         MaxF64;                                     /* The maximum floating-point column value, or -infinity if Count is zero. */
+    uint32_t                       Count;                                      /* The number of column values that contributed to the aggregate. */
+    uint32_t                       ColumnType;                                 /* One of the values of the TABLE_COLUMN_TYPE enumeration. */
+} TABLE_AGGREGATE;
+
+/* @summary Define the types of numeric column that can be aggregated.
+ */
+typedef enum TABLE_COLUMN_TYPE {
+    TABLE_COLUMN_TYPE_INT32                =  0,                               /* The column stores int32_t values. */
+    TABLE_COLUMN_TYPE_INT64                =  1,                               /* The column stores int64_t values. */
+    TABLE_COLUMN_TYPE_FLOAT32              =  2,                               /* The column stores float values. */
+    TABLE_COLUMN_TYPE_FLOAT64              =  3,                               /* The column stores double values. */
+} TABLE_COLUMN_TYPE;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Evaluate a predicate against every live item in a table and store the dense indices of the matching items.
+ * @param o_selection The TABLE_SELECTION to overwrite. The Capacity must be at least Table_GetCount(table).
+ * @param table Pointer to a TABLE_DESC describing the table to scan.
+ * @param predicate The predicate to evaluate.
+ * @return Zero if the scan completed and o_selection was updated, or non-zero if the predicate or selection is invalid.
+ */
+PIL_API(int)
+TableScan
+(
+    struct TABLE_SELECTION             *o_selection,
+    struct TABLE_DESC                        *table,
+    struct TABLE_SCAN_PREDICATE const    *predicate
+);
+
+/* @summary Evaluate a predicate against the items in an existing selection, removing the items that do not match.
+ * Filters can be chained to combine predicates on columns in the same or different data streams.
+ * @param selection The TABLE_SELECTION to refine in-place.
+ * @param table Pointer to a TABLE_DESC describing the table from which the selection was produced.
+ * @param predicate The predicate to evaluate.
+ * @return Zero if the filter completed and the selection was updated, or non-zero if the predicate is invalid.
+ */
+PIL_API(int)
+TableFilter
+(
+    struct TABLE_SELECTION               *selection,
+    struct TABLE_DESC                        *table,
+    struct TABLE_SCAN_PREDICATE const    *predicate
+);
+
+/* @summary Convert the dense indices in a selection to the handles of the corresponding items.
+ * Unlike dense indices, the handles remain valid across operations that move items within the table.
+ * @param o_handles An array of at least TableSelection_GetCount(selection) elements to receive the item handles.
+ * @param table Pointer to a TABLE_DESC describing the table from which the selection was produced.
+ * @param selection The TABLE_SELECTION to convert.
+ */
+PIL_API(void)
+TableSelectionToHandles
+(
+    HANDLE_BITS                       *o_handles,
+    struct TABLE_DESC                     *table,
+    struct TABLE_SELECTION const      *selection
+);
+
+/* @summary Produce the next batch of pairs of dense indices identifying the items present in both of two tables sharing a handle space.
+ * The table with fewer items drives the join, and the sparse index of the other table is probed in batches with prefetching.
+ * Pairs are produced in the dense order of the driving table, and are always reported as (left, right) regardless of which table drives.
+ * Neither table may be modified between the calls that produce the batches of a single join.
+ * @param join The TABLE_JOIN to update. Set Cursor to zero before the first call. Count is overwritten with the number of pairs produced.
+ * @param left Pointer to a TABLE_DESC describing the first table.
+ * @param right Pointer to a TABLE_DESC describing the second table.
+ * @return The number of pairs produced. A return value of zero indicates that the join is complete.
+ */
+PIL_API(uint32_t)
+TableJoin
+(
+    struct TABLE_JOIN                   *join,
+    struct TABLE_DESC                   *left,
+    struct TABLE_DESC                  *right
+);
+
+/* @summary Compute the sum, minimum, maximum and count of a numeric column over a range of items.
+ * To split a large aggregate across threads, give each thread a disjoint range and combine the results with TableAggregateMerge.
+ * The result of aggregating a floating-point column containing NaN values is undefined.
+ * @param o_result The TABLE_AGGREGATE to overwrite with the result.
+ * @param table Pointer to a TABLE_DESC describing the table containing the column.
+ * @param column The column to aggregate.
+ * @param selection An optional selection restricting the items to aggregate. If NULL, the range refers to dense indices.
+ * @param range_begin The zero-based index of the first dense index (or selection entry) to aggregate.
+ * @param range_end One past the last dense index (or selection entry) to aggregate. Clamped to Table_GetCount or TableSelection_GetCount.
+ * @return Zero if the aggregate was computed, or non-zero if the column is invalid.
+ */
+PIL_API(int)
+TableAggregate
+(
+    struct TABLE_AGGREGATE              *o_result,
+    struct TABLE_DESC                       *table,
+    struct TABLE_COLUMN const              *column,
+    struct TABLE_SELECTION const        *selection,
+    uint32_t                           range_begin,
+    uint32_t                             range_end
+);
+
+/* @summary Combine the result of an aggregate over one range of a column into the result for another range of the same column.
+ * @param dst The TABLE_AGGREGATE to update.
+ * @param src The TABLE_AGGREGATE to merge into dst.
+ */
+PIL_API(void)
+TableAggregateMerge
+(
+    struct TABLE_AGGREGATE             *dst,
+    struct TABLE_AGGREGATE const       *src
+);
+
+/* @summary Count the values of a numeric column falling into each of a set of equal-width bins spanning [min_value, max_value).
+ * Values below min_value are counted in the first bin, and values at or above max_value are counted in the last bin. NaN values are not counted.
+ * The counts are added to the existing contents of o_bins, so per-thread results for disjoint ranges can be accumulated by summing bins.
+ * @param o_bins An array of bin_count counters to update.
+ * @param bin_count The number of bins. Must be at least one.
+ * @param min_value The lower bound of the first bin.
+ * @param max_value The upper bound of the last bin. Must be greater than min_value.
+ * @param table Pointer to a TABLE_DESC describing the table containing the column.
+ * @param column The column to count.
+ * @param selection An optional selection restricting the items to count. If NULL, the range refers to dense indices.
+ * @param range_begin The zero-based index of the first dense index (or selection entry) to count.
+ * @param range_end One past the last dense index (or selection entry) to count. Clamped to Table_GetCount or TableSelection_GetCount.
+ * @return Zero if the histogram was updated, or non-zero if the column or bin range is invalid.
+ */
+PIL_API(int)
+TableHistogram
+(
+    uint32_t                               *o_bins,
+    uint32_t                             bin_count,
+    double                               min_value,
+    double                               max_value,
+    struct TABLE_DESC                       *table,
+    struct TABLE_COLUMN const              *column,
+    struct TABLE_SELECTION const        *selection,
+    uint32_t                           range_begin,
+    uint32_t                             range_end
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_TABLE_SCAN_H__ */
@@ -0,0 +1,205 @@
+/**
+ * @summary table_schema.h: Define the data structures and functions used to
+ * describe the record layout of a table data stream as a list of typed fields,
+ * and to serialize and deserialize whole streams in a portable, byte-order
+ * neutral format using that description. Records are converted in chunks of
+ * TABLE_SCHEMA_CHUNK_SIZE records, and within a chunk each field is stored as
+ * a contiguous little-endian column, so conversion runs one field at a time
+ * over many records rather than one record at a time, and the serialized data
+ * compresses well.
+ */
+#ifndef __PIL_TABLE_SCHEMA_H__
+#define __PIL_TABLE_SCHEMA_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#   ifndef __PIL_MEMIO_STREAM_H__
+#       include "memio_stream.h"
+#   endif
+#endif
+
+/* @summary Define various constants used by table schemas.
+ * TABLE_SCHEMA_MAGIC: The value of the first four bytes of a serialized stream ('TSCH' stored little-endian).
+ * TABLE_SCHEMA_CHUNK_SIZE: The number of records converted together, with each field stored as a column, when a stream is serialized.
+ * TABLE_SCHEMA_MAX_FIELDS: The maximum number of fields in a schema.
+ */
+#ifndef TABLE_SCHEMA_CONSTANTS
+#   define TABLE_SCHEMA_CONSTANTS
+#   define TABLE_SCHEMA_MAGIC              0x48435354UL
+#   define TABLE_SCHEMA_CHUNK_SIZE         256
+#   define TABLE_SCHEMA_MAX_FIELDS         256
+#endif
+
+/* @summary Calculate the number of bytes produced by TableSchemaWriteStream for a given number of records.
+ * @param _schema A pointer to a TABLE_SCHEMA initialized by TableSchemaInit.
+ * @param _count The number of records in the stream.
+ * @return The size of the serialized stream, in bytes, including the TABLE_SCHEMA_STREAM_HEADER.
+ */
+#ifndef TableSchema_GetStreamSize
+#define TableSchema_GetStreamSize(_schema, _count)                             \
+    (sizeof(TABLE_SCHEMA_STREAM_HEADER) + ((size_t)(_count) * (_schema)->PackedSize))
+#endif
+
+/* @summary Define the types of value that can be stored in a field of a record.
+ */
+typedef enum TABLE_FIELD_TYPE {
+    TABLE_FIELD_TYPE_BYTES                  =  0UL,                            /* The field is an array of uninterpreted bytes, copied as-is. */
+    TABLE_FIELD_TYPE_SI8                    =  1UL,                            /* The field is an array of signed 8-bit integers. */
+    TABLE_FIELD_TYPE_UI8                    =  2UL,                            /* The field is an array of unsigned 8-bit integers. */
+    TABLE_FIELD_TYPE_SI16                   =  3UL,                            /* The field is an array of signed 16-bit integers. */
+    TABLE_FIELD_TYPE_UI16                   =  4UL,                            /* The field is an array of unsigned 16-bit integers. */
+    TABLE_FIELD_TYPE_SI32                   =  5UL,                            /* The field is an array of signed 32-bit integers. */
+    TABLE_FIELD_TYPE_UI32                   =  6UL,                            /* The field is an array of unsigned 32-bit integers, such as HANDLE_BITS. */
+    TABLE_FIELD_TYPE_SI64                   =  7UL,                            /* The field is an array of signed 64-bit integers. */
+    TABLE_FIELD_TYPE_UI64                   =  8UL,                            /* The field is an array of unsigned 64-bit integers. */
+    TABLE_FIELD_TYPE_F32                    =  9UL,                            /* The field is an array of 32-bit IEEE-754 floating point values. */
+    TABLE_FIELD_TYPE_F64                    = 10UL,                            /* The field is an array of 64-bit IEEE-754 floating point values. */
+    TABLE_FIELD_TYPE_COUNT                  = 11UL,                            /* The number of values in the enumeration. Not a valid field type. */
+} TABLE_FIELD_TYPE;
+
+/* @summary Define the data describing a single field of the records stored in a table data stream.
+ */
+typedef struct TABLE_FIELD_DESC {
+    uint32_t                       Offset;                                     /* The byte offset of the field from the start of each record. */
+    uint32_t                       FieldType;                                  /* One of the values of the TABLE_FIELD_TYPE enumeration. */
+    uint32_t                       Count;                                      /* The number of consecutive values of FieldType in the field, at least one. For TABLE_FIELD_TYPE_BYTES, the size of the field in bytes. */
+    uint32_t                       Endianess;                                  /* The byte order of the values as stored in the record, PIL_ENDIANESS_LSB_FIRST or PIL_ENDIANESS_MSB_FIRST, or PIL_ENDIANESS_UNKNOWN for the host byte order. */
+} TABLE_FIELD_DESC;
+
+/* @summary Define the data describing the layout of the records stored in a table data stream.
+ * Bytes of a record not covered by any field, such as padding, are not serialized.
+ */
+typedef struct TABLE_SCHEMA {
+    struct TABLE_FIELD_DESC const *Fields;                                     /* An array of FieldCount field descriptors. The array is owned by the caller and must remain valid for the lifetime of the schema. */
+    uint32_t                       FieldCount;                                 /* The number of valid entries in the Fields array. */
+    uint32_t                       RecordSize;                                 /* The size of each record in memory, in bytes, which is the ElementSize of the data stream. */
+    uint32_t                       PackedSize;                                 /* The number of bytes each record occupies when serialized. */
+    uint32_t                       SchemaHash;                                 /* A hash of the field types and counts, which must match for data serialized with one schema to be read with another. */
+} TABLE_SCHEMA;
+
+/* @summary Define the header at the start of every serialized data stream.
+ * The header is followed by the records in chunks of ChunkSize records (the last chunk may be shorter).
+ * Within a chunk, each value of each field is stored as a column of little-endian values, in field order.
+ * A field of TABLE_FIELD_TYPE_BYTES is stored as a single column of Count-byte values.
+ */
+typedef struct TABLE_SCHEMA_STREAM_HEADER {
+    uint32_t                       Magic;                                      /* The value TABLE_SCHEMA_MAGIC. */
+    uint32_t                       SchemaHash;                                 /* The SchemaHash of the schema used to write the stream. */
+    uint32_t                       RecordCount;                                /* The number of records in the stream. */
+    uint32_t                       PackedSize;                                 /* The number of bytes each record occupies when serialized. */
+    uint32_t                       ChunkSize;                                  /* The number of records in each chunk, TABLE_SCHEMA_CHUNK_SIZE. */
+    uint32_t                       Reserved;                                   /* Zero. */
+} TABLE_SCHEMA_STREAM_HEADER;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Initialize a schema describing the records of a table data stream, and validate the field descriptions.
+ * @param o_schema The TABLE_SCHEMA to initialize.
+ * @param fields An array of field_count field descriptors. The array is not copied, and must remain valid for the lifetime of the schema.
+ * @param field_count The number of fields in the record, from 1 to TABLE_SCHEMA_MAX_FIELDS.
+ * @param record_size The size of each record in memory, in bytes.
+ * @return Zero if the schema is initialized, or -1 if a field has an invalid type, count or byte order, extends past the end of the record, or overlaps another field.
+ */
+PIL_API(int)
+TableSchemaInit
+(
+    struct TABLE_SCHEMA          *o_schema,
+    struct TABLE_FIELD_DESC const  *fields,
+    uint32_t                   field_count,
+    uint32_t                   record_size
+);
+
+/* @summary Convert an array of records into the serialized form described by a schema, without a header.
+ * @param dst The buffer to which the serialized records are written. The buffer must be at least count * PackedSize bytes.
+ * @param schema The TABLE_SCHEMA describing the records.
+ * @param records A pointer to the first record.
+ * @param count The number of records to convert.
+ * @return The number of bytes written to dst.
+ */
+PIL_API(size_t)
+TableSchemaPackRecords
+(
+    void                        *dst,
+    struct TABLE_SCHEMA const *schema,
+    void const              *records,
+    size_t                     count
+);
+
+/* @summary Convert records from the serialized form described by a schema back into an array of records. Bytes of the records not covered by a field are not modified.
+ * @param records A pointer to the first record to write.
+ * @param schema The TABLE_SCHEMA describing the records.
+ * @param src The serialized records. At least count * PackedSize bytes must be readable.
+ * @param count The number of records to convert.
+ * @return The number of bytes read from src.
+ */
+PIL_API(size_t)
+TableSchemaUnpackRecords
+(
+    void                    *records,
+    struct TABLE_SCHEMA const *schema,
+    void const                  *src,
+    size_t                     count
+);
+
+/* @summary Serialize the first record_count records of a table data stream, preceded by a TABLE_SCHEMA_STREAM_HEADER.
+ * @param writer The MEMIO_WRITER to which the serialized stream is written.
+ * @param schema The TABLE_SCHEMA describing the records of the stream. The RecordSize must match the ElementSize of the stream.
+ * @param stream The TABLE_DATA to serialize.
+ * @param record_count The number of records to serialize, typically the ActiveCount of the table index.
+ * @return Zero if the stream was serialized, or -1 if the schema does not match the stream or the writer could not grow.
+ */
+PIL_API(int)
+TableSchemaWriteStream
+(
+    struct MEMIO_WRITER       *writer,
+    struct TABLE_SCHEMA const *schema,
+    struct TABLE_DATA const   *stream,
+    uint32_t             record_count
+);
+
+/* @summary Read and validate the header of a serialized data stream, so that the caller can ensure the table has room for the records before reading them.
+ * @param o_record_count On return, set to the number of records in the serialized stream.
+ * @param schema The TABLE_SCHEMA describing the records of the stream.
+ * @param reader The MEMIO_READER positioned at the start of the serialized stream. On return, the reader is positioned at the first chunk of records.
+ * @return Zero if the header is valid, or -1 if the data is truncated or was serialized using a different schema.
+ */
+PIL_API(int)
+TableSchemaReadStreamHeader
+(
+    uint32_t          *o_record_count,
+    struct TABLE_SCHEMA const *schema,
+    struct MEMIO_READER       *reader
+);
+
+/* @summary Deserialize the records of a data stream following a header read by TableSchemaReadStreamHeader into a table data stream.
+ * @param stream The TABLE_DATA to write.
+ * @param schema The TABLE_SCHEMA describing the records of the stream. The RecordSize must match the ElementSize of the stream.
+ * @param reader The MEMIO_READER positioned at the first chunk of records. On return, the reader is positioned after the last record.
+ * @param record_count The record count returned by TableSchemaReadStreamHeader.
+ * @param max_records The number of records for which the stream has committed storage, typically the ActiveCount of the table index after making room for record_count records.
+ * @return Zero if the records were read, or -1 if the schema does not match the stream, record_count exceeds max_records, or the data is truncated.
+ */
+PIL_API(int)
+TableSchemaReadStream
+(
+    struct TABLE_DATA         *stream,
+    struct TABLE_SCHEMA const *schema,
+    struct MEMIO_READER       *reader,
+    uint32_t             record_count,
+    uint32_t              max_records
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_TABLE_SCHEMA_H__ */
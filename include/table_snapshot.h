@@ -0,0 +1,221 @@
+/**
+ * @summary table_snapshot.h: Define the data structures and functions used to
+ * give reader threads a consistent, read-only view of a data table while the
+ * owning thread continues to mutate it. The owning thread periodically
+ * publishes a snapshot version of the table index and data streams. Each
+ * version is stored as a set of fixed-size chunks, and chunks whose contents
+ * did not change since the previous version are shared rather than copied.
+ * Readers pin the most recently published version without blocking the
+ * owning thread, and the chunks of a version are reclaimed once no reader
+ * holds it.
+ */
+#ifndef __PIL_TABLE_SNAPSHOT_H__
+#define __PIL_TABLE_SNAPSHOT_H__
+
+#pragma once
+
+#ifndef PIL_NO_INCLUDES
+#   ifndef __PIL_H__
+#       include "pil.h"
+#   endif
+#   ifndef __PIL_TABLE_H__
+#       include "table.h"
+#   endif
+#endif
+
+/* @summary Define various constants used by table snapshots.
+ * TABLE_SNAPSHOT_CHUNK_SIZE: The target size of a single snapshot chunk, in bytes. Chunks hold a power-of-two number of elements.
+ * TABLE_SNAPSHOT_CHUNK_ALIGN: The alignment of the data stored in a snapshot chunk, in bytes.
+ * TABLE_SNAPSHOT_MIN_VERSIONS: The minimum number of versions maintained by a TABLE_SNAPSHOT_SET.
+ * TABLE_SNAPSHOT_REGION_SPARSE: The index of the snapshot region holding a copy of the sparse index.
+ * TABLE_SNAPSHOT_REGION_HANDLE: The index of the snapshot region holding a copy of the dense handle array.
+ * TABLE_SNAPSHOT_REGION_STREAM: The index of the snapshot region holding a copy of the first data stream. Data stream i is stored in region (TABLE_SNAPSHOT_REGION_STREAM + i).
+ */
+#ifndef TABLE_SNAPSHOT_CONSTANTS
+#   define TABLE_SNAPSHOT_CONSTANTS
+#   define TABLE_SNAPSHOT_CHUNK_SIZE       16384
+#   define TABLE_SNAPSHOT_CHUNK_ALIGN      TABLE_STREAM_ALIGN_MAX
+#   define TABLE_SNAPSHOT_MIN_VERSIONS     2
+#   define TABLE_SNAPSHOT_REGION_SPARSE    0
+#   define TABLE_SNAPSHOT_REGION_HANDLE    1
+#   define TABLE_SNAPSHOT_REGION_STREAM    2
+#endif
+
+/* @summary Retrieve the number of items in a snapshot version.
+ * @param _s A pointer to a TABLE_SNAPSHOT structure returned by TableSnapshotAcquire.
+ * @return The number of items in the snapshot.
+ */
+#ifndef TableSnapshot_GetCount
+#define TableSnapshot_GetCount(_s)                                             \
+    (_s)->ItemCount
+#endif
+
+/* @summary Retrieve the epoch of a snapshot version. Each call to TableSnapshotPublish produces a new, larger epoch.
+ * @param _s A pointer to a TABLE_SNAPSHOT structure returned by TableSnapshotAcquire.
+ * @return The 64-bit epoch of the snapshot.
+ */
+#ifndef TableSnapshot_GetEpoch
+#define TableSnapshot_GetEpoch(_s)                                             \
+    (_s)->Epoch
+#endif
+
+/* @summary Retrieve a pointer to an element stored in a snapshot region.
+ * @param _type The type of element stored in the region.
+ * @param _r A pointer to a TABLE_SNAPSHOT_REGION structure.
+ * @param _i The zero-based index of the element. Must be less than the ElementCount of the region.
+ * @return A pointer (_type const*) to the element.
+ */
+#ifndef TableSnapshotRegion_GetElement
+#define TableSnapshotRegion_GetElement(_type, _r, _i)                          \
+    ((_type const*)((_r)->Chunks[(_i) >> (_r)->ChunkShift]->Data + (((_i) & ((1UL << (_r)->ChunkShift) - 1)) * (_r)->ElementSize)))
+#endif
+
+/* @summary Retrieve the handle of the item at a given dense index in a snapshot version.
+ * @param _s A pointer to a TABLE_SNAPSHOT structure returned by TableSnapshotAcquire.
+ * @param _i The zero-based dense index of the item. Must be less than TableSnapshot_GetCount.
+ * @return The HANDLE_BITS of the item.
+ */
+#ifndef TableSnapshot_GetHandle
+#define TableSnapshot_GetHandle(_s, _i)                                        \
+    (*TableSnapshotRegion_GetElement(HANDLE_BITS, &(_s)->Regions[TABLE_SNAPSHOT_REGION_HANDLE], (_i)))
+#endif
+
+/* @summary Retrieve a pointer to the record for an item in a data stream of a snapshot version.
+ * Records are not contiguous across chunk boundaries, so iterate using the dense index rather than by incrementing the pointer.
+ * @param _type The type of record stored in the data stream.
+ * @param _s A pointer to a TABLE_SNAPSHOT structure returned by TableSnapshotAcquire.
+ * @param _si The zero-based index of the data stream in the source table.
+ * @param _i The zero-based dense index of the item. Must be less than TableSnapshot_GetCount.
+ * @return A pointer (_type const*) to the record.
+ */
+#ifndef TableSnapshot_GetStreamElement
+#define TableSnapshot_GetStreamElement(_type, _s, _si, _i)                     \
+    TableSnapshotRegion_GetElement(_type, &(_s)->Regions[TABLE_SNAPSHOT_REGION_STREAM + (_si)], (_i))
+#endif
+
+/* @summary Define the data associated with a single chunk of snapshot data.
+ * A chunk may be shared by several versions, and is only modified by the thread that owns the table.
+ */
+typedef struct TABLE_SNAPSHOT_CHUNK {
+    uint8_t                       *Data;                                       /* The chunk data, aligned to TABLE_SNAPSHOT_CHUNK_ALIGN bytes. */
+    uint32_t                       DataSize;                                   /* The number of bytes of valid data in the chunk. */
+    uint32_t                       RefCount;                                   /* The number of versions referencing the chunk. */
+} TABLE_SNAPSHOT_CHUNK;
+
+/* @summary Define the data associated with a copy of the sparse index, the handle array, or a data stream within a snapshot version.
+ */
+typedef struct TABLE_SNAPSHOT_REGION {
+    struct TABLE_SNAPSHOT_CHUNK  **Chunks;                                     /* An array of ChunkCapacity chunk pointers, of which ChunkCount are valid. */
+    uint32_t                       ElementCount;                               /* The number of valid elements in the region. */
+    uint32_t                       ElementSize;                                /* The size of a single element, in bytes. */
+    uint32_t                       ChunkShift;                                 /* The base-2 logarithm of the number of elements stored in each chunk. */
+    uint32_t                       ChunkCount;                                 /* The number of valid entries in the Chunks array. */
+    uint32_t                       ChunkCapacity;                              /* The number of chunks required to hold a copy of a table at full capacity. */
+} TABLE_SNAPSHOT_REGION;
+
+/* @summary Define the data associated with a single snapshot version of a table.
+ * The contents of a version do not change while it is pinned by a reader.
+ */
+typedef struct TABLE_SNAPSHOT {
+    struct TABLE_SNAPSHOT_REGION  *Regions;                                    /* An array of RegionCount regions. See TABLE_SNAPSHOT_REGION_SPARSE, TABLE_SNAPSHOT_REGION_HANDLE and TABLE_SNAPSHOT_REGION_STREAM. */
+    uint64_t                       Epoch;                                      /* The epoch at which the version was published, or zero if the version is unused. */
+    uint32_t                       ItemCount;                                  /* The number of items in the table when the version was published. */
+    uint32_t                       RegionCount;                                /* The number of regions in the version, which is the table StreamCount + TABLE_SNAPSHOT_REGION_STREAM. */
+    int32_t                        PinCount;                                   /* The number of readers holding the version. Accessed atomically. */
+    uint32_t                       Reserved;                                   /* Padding. Do not use. */
+} TABLE_SNAPSHOT;
+
+/* @summary Define the data associated with the set of snapshot versions published for a single table.
+ */
+typedef struct TABLE_SNAPSHOT_SET {
+    struct TABLE_DESC             *Table;                                      /* The table from which versions are published. */
+    struct TABLE_SNAPSHOT         *Versions;                                   /* An array of VersionCount versions. */
+    struct TABLE_SNAPSHOT         *Current;                                    /* The most recently published version, or NULL. Accessed atomically. */
+    uint8_t                       *Scratch;                                    /* A TABLE_SNAPSHOT_CHUNK_SIZE byte buffer used to stage chunks of a paged sparse index. */
+    uint64_t                       Epoch;                                      /* The epoch of the most recently published version. */
+    uint32_t                       VersionCount;                               /* The number of entries in the Versions array. */
+    uint32_t                       StreamCount;                                /* The number of data streams in the table when the set was created. */
+} TABLE_SNAPSHOT_SET;
+
+/* @summary Define the data used to construct a new TABLE_SNAPSHOT_SET.
+ */
+typedef struct TABLE_SNAPSHOT_SET_INIT {
+    struct TABLE_SNAPSHOT_SET     *SnapshotSet;                                /* The TABLE_SNAPSHOT_SET to initialize. */
+    struct TABLE_DESC             *Table;                                      /* The table from which versions are published. */
+    uint32_t                       VersionCount;                               /* The maximum number of versions that can exist at once, including the current version. At least TABLE_SNAPSHOT_MIN_VERSIONS. */
+} TABLE_SNAPSHOT_SET_INIT;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @summary Allocate the version descriptors for a table snapshot set. No version is published until TableSnapshotPublish is called.
+ * @param init Pointer to a TABLE_SNAPSHOT_SET_INIT describing the snapshot set to create.
+ * @return Zero if the snapshot set is successfully initialized, or non-zero if an error occurred.
+ */
+PIL_API(int)
+TableSnapshotSetCreate
+(
+    struct TABLE_SNAPSHOT_SET_INIT *init
+);
+
+/* @summary Free all resources allocated to a table snapshot set. No reader may hold a version of the set.
+ * @param snapshot_set The TABLE_SNAPSHOT_SET to delete.
+ */
+PIL_API(void)
+TableSnapshotSetDelete
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set
+);
+
+/* @summary Publish the current state of the table as a new snapshot version, and reclaim the chunks of any older version no longer held by a reader.
+ * Chunks whose contents are identical to the corresponding chunk of the previous version are shared, so the cost is proportional to the number of changed chunks.
+ * This function must be called from the thread that owns the table, while the table is not being modified.
+ * @param snapshot_set The TABLE_SNAPSHOT_SET to update.
+ * @return Zero if the version was published, or non-zero if every version is held by a reader, the table streams have changed, or memory could not be allocated.
+ */
+PIL_API(int)
+TableSnapshotPublish
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set
+);
+
+/* @summary Pin the most recently published snapshot version so that it can be read. The version remains valid until it is passed to TableSnapshotRelease.
+ * This function may be called from any thread, and does not block the thread that owns the table.
+ * @param snapshot_set The TABLE_SNAPSHOT_SET to read.
+ * @return A pointer to the pinned version, or NULL if no version has been published.
+ */
+PIL_API(struct TABLE_SNAPSHOT*)
+TableSnapshotAcquire
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set
+);
+
+/* @summary Release a snapshot version pinned by TableSnapshotAcquire. The version must not be accessed after it is released.
+ * @param snapshot The TABLE_SNAPSHOT to release.
+ */
+PIL_API(void)
+TableSnapshotRelease
+(
+    struct TABLE_SNAPSHOT *snapshot
+);
+
+/* @summary Resolve an item handle into a dense index within a snapshot version.
+ * @param o_record_index Pointer to the location to update with the dense index to pass to TableSnapshot_GetHandle and TableSnapshot_GetStreamElement.
+ * @param snapshot The TABLE_SNAPSHOT returned by TableSnapshotAcquire.
+ * @param bits The handle of the item.
+ * @return Non-zero if the item was live when the version was published, or zero if the handle is not valid in the version.
+ */
+PIL_API(int)
+TableSnapshotResolve
+(
+    uint32_t *o_record_index,
+    struct TABLE_SNAPSHOT *snapshot,
+    HANDLE_BITS       bits
+);
+
+#ifdef __cplusplus
+}; /* extern "C" */
+#endif
+
+#endif /* __PIL_TABLE_SNAPSHOT_H__ */
@@ -0,0 +1,361 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pil.h"
+#include "table.h"
+
+#if PIL_TARGET_PLATFORM == PIL_PLATFORM_WIN32
+#   include <Windows.h>
+#else
+#   include <time.h>
+#endif
+
+/* @summary Define various constants used to configure the benchmark.
+ * BENCH_BATCH_SIZE: The number of operations timed together to produce a single latency sample. Individual operations are too short to time reliably.
+ * BENCH_MAX_STREAMS: The maximum number of data streams in a benchmarked table.
+ */
+#ifndef BENCH_CONSTANTS
+#   define BENCH_CONSTANTS
+#   define BENCH_BATCH_SIZE        64
+#   define BENCH_MAX_STREAMS       8
+#endif
+
+/* @summary Define the data associated with a table under test.
+ */
+typedef struct BENCH_TABLE {
+    TABLE_DESC     TableDesc;
+    TABLE_INDEX    TableIndex;
+    TABLE_DATA     StreamData[BENCH_MAX_STREAMS];
+    TABLE_DATA    *TableStreams[BENCH_MAX_STREAMS];
+} BENCH_TABLE;
+
+/* @summary Define the latency samples and totals collected for a single benchmarked operation.
+ */
+typedef struct BENCH_SAMPLES {
+    uint64_t      *Samples;                          /* An array of per-operation latencies, in nanoseconds, one for each batch. */
+    uint32_t       SampleCount;                      /* The number of valid entries in the Samples array. */
+    uint32_t       OpCount;                          /* The total number of operations performed. */
+    uint64_t       TotalNanoseconds;                 /* The total time taken by all operations. */
+} BENCH_SAMPLES;
+
+/* @summary Read a monotonic timestamp.
+ * @return The current time, in nanoseconds, relative to an arbitrary epoch.
+ */
+static uint64_t
+BenchTimestamp
+(
+    void
+)
+{
+#if PIL_TARGET_PLATFORM == PIL_PLATFORM_WIN32
+    static LARGE_INTEGER frequency = {};
+    LARGE_INTEGER            ticks;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&ticks);
+    return (uint64_t)(ticks.QuadPart / frequency.QuadPart) * 1000000000ULL + (uint64_t)((ticks.QuadPart % frequency.QuadPart) * 1000000000ULL / frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+/* @summary Generate a pseudo-random 32-bit value using the xorshift32 algorithm.
+ * @param state The generator state to update. Must be non-zero.
+ * @return The next pseudo-random value.
+ */
+static uint32_t
+BenchRandom
+(
+    uint32_t *state
+)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x <<  5;
+   *state = x;
+    return x;
+}
+
+/* @summary Shuffle an array of handles into a pseudo-random order so that lookups do not simply walk memory.
+ * @param handles The array of handles to shuffle.
+ * @param count The number of handles in the array.
+ * @param seed The initial generator state. Must be non-zero.
+ */
+static void
+BenchShuffle
+(
+    HANDLE_BITS *handles,
+    uint32_t       count,
+    uint32_t        seed
+)
+{
+    HANDLE_BITS t;
+    uint32_t    i, j;
+    for (i = count; i > 1; --i) {
+        j = BenchRandom(&seed) % i;
+        t = handles[i - 1];
+        handles[i - 1] = handles[j];
+        handles[j] = t;
+    }
+}
+
+/* @summary Create a table with a given number of streams of a given record size.
+ * @param t The BENCH_TABLE to initialize.
+ * @param capacity The maximum number of items in the table.
+ * @param stream_count The number of data streams, up to BENCH_MAX_STREAMS.
+ * @param record_size The size of the records in each data stream.
+ * @return Zero if the table was created, or non-zero if an error occurred.
+ */
+static int
+BenchCreateTable
+(
+    BENCH_TABLE            *t,
+    uint32_t         capacity,
+    uint32_t     stream_count,
+    uint32_t      record_size
+)
+{
+    TABLE_INIT                           init = {};
+    TABLE_DATA_STREAM_DESC streams[BENCH_MAX_STREAMS];
+    uint32_t                                i;
+
+    for (i = 0; i < stream_count; ++i) {
+        streams[i].Data      = &t->StreamData[i];
+        streams[i].Size      = record_size;
+        streams[i].Alignment = 0;
+        t->TableStreams[i]   = &t->StreamData[i];
+    }
+    init.Index         = &t->TableIndex;
+    init.Streams       = streams;
+    init.StreamCount   = stream_count;
+    init.TableCapacity = capacity;
+    init.InitialCommit = 0;
+    init.TableFlags    = TABLE_FLAGS_NONE;
+    if (TableCreate(&init) != 0) {
+        return -1;
+    }
+    t->TableDesc.Index       = &t->TableIndex;
+    t->TableDesc.Streams     = t->TableStreams;
+    t->TableDesc.StreamCount = stream_count;
+    t->TableDesc.KeyIndex    = NULL;
+    t->TableDesc.BlobHeap    = NULL;
+    t->TableDesc.Journal     = NULL;
+    return 0;
+}
+
+/* @summary Add a latency sample for a batch of operations.
+ * @param samples The BENCH_SAMPLES to update.
+ * @param nanoseconds The time taken by the batch.
+ * @param op_count The number of operations in the batch.
+ */
+static void
+BenchAddSample
+(
+    BENCH_SAMPLES *samples,
+    uint64_t   nanoseconds,
+    uint32_t      op_count
+)
+{
+    samples->Samples[samples->SampleCount++] = nanoseconds / op_count;
+    samples->TotalNanoseconds += nanoseconds;
+    samples->OpCount          += op_count;
+}
+
+/* @summary Compare two latency samples for qsort.
+ */
+static int
+BenchCompareSamples
+(
+    void const *a,
+    void const *b
+)
+{
+    uint64_t x = *(uint64_t const*) a;
+    uint64_t y = *(uint64_t const*) b;
+    return (x < y) ? -1 : ((x > y) ? 1 : 0);
+}
+
+/* @summary Write one CSV result row for a benchmarked operation, and reset the samples.
+ * @param op The name of the operation.
+ * @param item_count The number of items in the table.
+ * @param stream_count The number of data streams in the table.
+ * @param record_size The size of each record, in bytes.
+ * @param samples The BENCH_SAMPLES collected for the operation.
+ */
+static void
+BenchReport
+(
+    char const         *op,
+    uint32_t    item_count,
+    uint32_t  stream_count,
+    uint32_t   record_size,
+    BENCH_SAMPLES *samples
+)
+{
+    uint64_t *s = samples->Samples;
+    uint32_t  n = samples->SampleCount;
+    double  ops = samples->TotalNanoseconds > 0 ? (double) samples->OpCount * 1.0e9 / (double) samples->TotalNanoseconds : 0.0;
+
+    if (n == 0) {
+        return;
+    }
+    qsort(s, n, sizeof(uint64_t), BenchCompareSamples);
+    printf("%s,%u,%u,%u,%u,%llu,%.0f,%llu,%llu,%llu,%llu\n", op, item_count, stream_count, record_size, samples->OpCount,
+        (unsigned long long) samples->TotalNanoseconds, ops,
+        (unsigned long long) s[(n * 50) / 100],
+        (unsigned long long) s[(n * 90) / 100],
+        (unsigned long long) s[(n * 99) / 100],
+        (unsigned long long) s[n - 1]);
+    samples->SampleCount      = 0;
+    samples->OpCount          = 0;
+    samples->TotalNanoseconds = 0;
+}
+
+/* @summary Run all benchmarked operations for one table configuration.
+ * @param item_count The number of items to create.
+ * @param stream_count The number of data streams in the table.
+ * @param record_size The size of each record, in bytes.
+ * @return Zero if the configuration ran, or non-zero if an error occurred.
+ */
+static int
+BenchConfiguration
+(
+    uint32_t    item_count,
+    uint32_t  stream_count,
+    uint32_t   record_size
+)
+{
+    BENCH_TABLE          t;
+    BENCH_SAMPLES  samples;
+    HANDLE_BITS   *handles = (HANDLE_BITS*) malloc(item_count * sizeof(HANDLE_BITS));
+    uint64_t      checksum = 0;
+    uint64_t            t0;
+    uint32_t            ix;
+    uint32_t          i, j;
+    uint32_t     batch_end;
+    uint32_t    half_count = item_count / 2;
+
+    samples.Samples          = (uint64_t*) malloc(((item_count / BENCH_BATCH_SIZE) + 1) * sizeof(uint64_t));
+    samples.SampleCount      = 0;
+    samples.OpCount          = 0;
+    samples.TotalNanoseconds = 0;
+    if (handles == NULL || samples.Samples == NULL || BenchCreateTable(&t, item_count, stream_count, record_size) != 0) {
+        fprintf(stderr, "ERROR: Failed to create table with %u items, %u streams of %u bytes.\n", item_count, stream_count, record_size);
+        free(samples.Samples);
+        free(handles);
+        return -1;
+    }
+
+    /* create: commit memory and allocate handles, writing the first stream as an application would */
+    for (i = 0; i < item_count; i = batch_end) {
+        batch_end = (i + BENCH_BATCH_SIZE) < item_count ? (i + BENCH_BATCH_SIZE) : item_count;
+        t0 = BenchTimestamp();
+        for (j = i; j < batch_end; ++j) {
+            if (TableEnsure(&t.TableDesc, j + 1, TABLE_CHUNK_SIZE) != 0) {
+                fprintf(stderr, "ERROR: Failed to commit memory for %u items, %u streams of %u bytes.\n", j + 1, stream_count, record_size);
+                TableDelete(&t.TableDesc);
+                free(samples.Samples);
+                free(handles);
+                return -1;
+            }
+            handles[j] = TableCreateId(&ix, &t.TableDesc);
+           *Table_GetStreamElement(uint32_t, &t.TableDesc, 0, ix) = j;
+        }
+        BenchAddSample(&samples, BenchTimestamp() - t0, batch_end - i);
+    }
+    BenchReport("create", item_count, stream_count, record_size, &samples);
+
+    /* iterate: visit every record of every stream in dense order */
+    for (i = 0; i < item_count; i = batch_end) {
+        batch_end = (i + BENCH_BATCH_SIZE) < item_count ? (i + BENCH_BATCH_SIZE) : item_count;
+        t0 = BenchTimestamp();
+        for (j = i; j < batch_end; ++j) {
+            for (ix = 0; ix < stream_count; ++ix) {
+                checksum += *Table_GetStreamElement(uint32_t, &t.TableDesc, ix, j);
+            }
+        }
+        BenchAddSample(&samples, BenchTimestamp() - t0, batch_end - i);
+    }
+    BenchReport("iterate", item_count, stream_count, record_size, &samples);
+
+    /* resolve: look up every handle in a random order and read its record */
+    BenchShuffle(handles, item_count, 0x9E3779B9UL);
+    for (i = 0; i < item_count; i = batch_end) {
+        batch_end = (i + BENCH_BATCH_SIZE) < item_count ? (i + BENCH_BATCH_SIZE) : item_count;
+        t0 = BenchTimestamp();
+        for (j = i; j < batch_end; ++j) {
+            if (TableResolve(&ix, &t.TableDesc, handles[j])) {
+                checksum += *Table_GetStreamElement(uint32_t, &t.TableDesc, 0, ix);
+            }
+        }
+        BenchAddSample(&samples, BenchTimestamp() - t0, batch_end - i);
+    }
+    BenchReport("resolve", item_count, stream_count, record_size, &samples);
+
+    /* delete: delete the first half of the shuffled handles one at a time */
+    for (i = 0; i < half_count; i = batch_end) {
+        batch_end = (i + BENCH_BATCH_SIZE) < half_count ? (i + BENCH_BATCH_SIZE) : half_count;
+        t0 = BenchTimestamp();
+        for (j = i; j < batch_end; ++j) {
+            TableDeleteId(&t.TableDesc, handles[j]);
+        }
+        BenchAddSample(&samples, BenchTimestamp() - t0, batch_end - i);
+    }
+    BenchReport("delete", item_count, stream_count, record_size, &samples);
+
+    /* bulk-delete: delete the remaining handles in batches with TableDeleteIds */
+    for (i = half_count; i < item_count; i = batch_end) {
+        batch_end = (i + BENCH_BATCH_SIZE) < item_count ? (i + BENCH_BATCH_SIZE) : item_count;
+        t0 = BenchTimestamp();
+        TableDeleteIds(&t.TableDesc, &handles[i], batch_end - i);
+        BenchAddSample(&samples, BenchTimestamp() - t0, batch_end - i);
+    }
+    BenchReport("bulk-delete", item_count, stream_count, record_size, &samples);
+
+    /* print the checksum so the compiler cannot discard the reads */
+    fprintf(stderr, "checksum %llu\n", (unsigned long long) checksum);
+    TableDelete(&t.TableDesc);
+    free(samples.Samples);
+    free(handles);
+    return 0;
+}
+
+/* @summary Run the table benchmarks and write the results to stdout as CSV.
+ * Usage: bench_table [max_items]
+ * The optional max_items argument limits the largest table size that is benchmarked.
+ */
+int main
+(
+    int    argc,
+    char **argv
+)
+{
+    uint32_t const   item_counts[] = { 1024, 65536, 1000000 };
+    uint32_t const stream_counts[] = { 1, 4 };
+    uint32_t const  record_sizes[] = { 16, 64, 256 };
+    uint32_t             max_items = TABLE_MAX_OBJECT_COUNT;
+    uint32_t               c, s, r;
+    int                     result = 0;
+
+    if (argc > 1) {
+        max_items = (uint32_t) strtoul(argv[1], NULL, 10);
+    }
+    printf("op,items,streams,record_size,ops,total_ns,ops_per_sec,p50_ns,p90_ns,p99_ns,max_ns\n");
+    for (c = 0; c < sizeof(item_counts) / sizeof(item_counts[0]); ++c) {
+        if (item_counts[c] > max_items) {
+            continue;
+        }
+        for (s = 0; s < sizeof(stream_counts) / sizeof(stream_counts[0]); ++s) {
+            for (r = 0; r < sizeof(record_sizes) / sizeof(record_sizes[0]); ++r) {
+                if (BenchConfiguration(item_counts[c], stream_counts[s], record_sizes[r]) != 0) {
+                    result = 1;
+                }
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,1428 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pil.h"
+#include "memmgr.h"
+#include "memio.h"
+#include "memio_inline.h"
+#include "memio_stream.h"
+#include "memio_lz.h"
+#include "table.h"
+#include "table_schema.h"
+
+/* @summary The array lengths exercised by every round-trip test.
+ * The lengths straddle the 16-value SIMD groups and the 128-value bit packing blocks.
+ */
+static size_t const TestCounts[] = {
+    0, 1, 15, 16, 17, 127, 128, 129
+};
+#define TEST_COUNT_NUM          (sizeof(TestCounts) / sizeof(TestCounts[0]))
+#define TEST_COUNT_MAX          129
+
+/* @summary Generate the next value of a xorshift64 pseudo-random sequence.
+ * @param state The generator state, which must be non-zero.
+ * @return The next value in the sequence.
+ */
+static uint64_t
+TestRandom
+(
+    uint64_t *state
+)
+{
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+   *state = x;
+    return x;
+}
+
+/* @summary Fill an array with 64-bit values of varying magnitude, so that variable-length encodings use every encoded length.
+ * @param dst The array to fill.
+ * @param count The number of values to generate.
+ * @param seed The non-zero seed of the sequence.
+ */
+static void
+TestFillValues
+(
+    uint64_t  *dst,
+    size_t   count,
+    uint64_t  seed
+)
+{
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        uint64_t r = TestRandom(&seed);
+        dst[i] = r >> (r & 63);
+    }
+}
+
+static int
+Test_ByteSwapArray
+(
+    void
+)
+{   /* swap arrays of 16, 32 and 64-bit values at an unaligned address, compare
+     * each value with the scalar swap, and ensure that swapping twice restores
+     * the array. write and read the values in both byte orders. */
+    uint64_t  values[TEST_COUNT_MAX];
+    uint64_t  result[TEST_COUNT_MAX];
+    uint8_t   buffer[TEST_COUNT_MAX * 8 + 1];
+    uint8_t  swapped[TEST_COUNT_MAX * 8 + 1];
+    size_t      c, i;
+
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        TestFillValues(values, n, 0x9E3779B97F4A7C15ULL + n);
+        memcpy(buffer + 1, values, n * 8);
+        memcpy(swapped+ 1, values, n * 8);
+        ByteSwapArray16(swapped + 1, n);
+        for (i = 0; i < n; ++i) {
+            uint16_t v; uint16_t s;
+            memcpy(&v, buffer  + 1 + i * 2, 2);
+            memcpy(&s, swapped + 1 + i * 2, 2);
+            if (s != (uint16_t) ByteSwap2(v)) {
+                assert(0 && "ByteSwapArray16 incorrect");
+                return 0;
+            }
+        }
+        ByteSwapArray16(swapped + 1, n);
+        ByteSwapArray32(swapped + 1, n);
+        for (i = 0; i < n; ++i) {
+            uint32_t v; uint32_t s;
+            memcpy(&v, buffer  + 1 + i * 4, 4);
+            memcpy(&s, swapped + 1 + i * 4, 4);
+            if (s != (uint32_t) ByteSwap4(v)) {
+                assert(0 && "ByteSwapArray32 incorrect");
+                return 0;
+            }
+        }
+        ByteSwapArray32(swapped + 1, n);
+        ByteSwapArray64(swapped + 1, n);
+        for (i = 0; i < n; ++i) {
+            uint64_t v; uint64_t s;
+            memcpy(&v, buffer  + 1 + i * 8, 8);
+            memcpy(&s, swapped + 1 + i * 8, 8);
+            if (s != (uint64_t) ByteSwap8(v)) {
+                assert(0 && "ByteSwapArray64 incorrect");
+                return 0;
+            }
+        }
+        ByteSwapArray64(swapped + 1, n);
+        if (memcmp(buffer + 1, swapped + 1, n * 8) != 0) {
+            assert(0 && "Swapping twice did not restore the array");
+            return 0;
+        }
+        /* the big-endian form stores the most significant byte first */
+        if (WriteArray_ui64_msb(buffer + 1, values, n) != n * 8 || (n > 0 && buffer[1] != (uint8_t)(values[0] >> 56))) {
+            assert(0 && "WriteArray_ui64_msb incorrect");
+            return 0;
+        }
+        if (ReadArray_ui64_msb(result, buffer + 1, n) != n * 8 || memcmp(result, values, n * 8) != 0) {
+            assert(0 && "ReadArray_ui64_msb incorrect");
+            return 0;
+        }
+        if (WriteArray_ui64_lsb(buffer + 1, values, n) != n * 8 || (n > 0 && buffer[1] != (uint8_t)(values[0]))) {
+            assert(0 && "WriteArray_ui64_lsb incorrect");
+            return 0;
+        }
+        if (ReadArray_ui64_lsb(result, buffer + 1, n) != n * 8 || memcmp(result, values, n * 8) != 0) {
+            assert(0 && "ReadArray_ui64_lsb incorrect");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* @summary Check that the exported, inline and template forms of a read and write function agree on the bytes stored and the value loaded, at every offset within an 8-byte word.
+ * @typeparam T The type of value to read and write.
+ * @typeparam Endianess The byte order of the stored value, PIL_ENDIANESS_LSB_FIRST or PIL_ENDIANESS_MSB_FIRST.
+ * @param value The value to write.
+ * @param write The exported write function, for example Write_ui32_msb.
+ * @param write_inline The inline write function, for example WriteInline_ui32_msb.
+ * @param read The exported read function, for example Read_ui32_msb.
+ * @param read_inline The inline read function, for example ReadInline_ui32_msb.
+ * @return Non-zero if the checks pass.
+ */
+template <typename T, int Endianess>
+static int
+TestInlineValue
+(
+    T                                          value,
+    size_t (*write       )(void*, T, ptrdiff_t),
+    size_t (*write_inline)(void*, T, ptrdiff_t),
+    T      (*read        )(void*, ptrdiff_t),
+    T      (*read_inline )(void const*, ptrdiff_t)
+)
+{
+    uint8_t        a[24];
+    uint8_t        b[24];
+    uint8_t        c[24];
+    uint8_t        d[24];
+    T          loaded[4];
+    uint64_t        bits;
+    MEMIO_WRITER  writer;
+    MEMIO_READER  reader;
+    ptrdiff_t     offset;
+    size_t          i, k;
+    typename MEMIO_BITS<sizeof(T)>::Type raw;
+
+    memcpy(&raw, &value, sizeof(T));
+    bits = (uint64_t) raw;
+    for (offset = 0; offset < 8; ++offset) {
+        memset(a, 0xEE, sizeof(a));
+        memset(b, 0xEE, sizeof(b));
+        memset(c, 0xEE, sizeof(c));
+        memset(d, 0xEE, sizeof(d));
+        if (write(a, value, offset) != sizeof(T) || write_inline(b, value, offset) != sizeof(T) || MemioWrite<T, Endianess>(c, value, offset) != sizeof(T)) {
+            return 0;
+        }
+        MemioWriterInitBuffer(&writer, d + offset, sizeof(T));
+        MemioWriterPut<T, Endianess>(&writer, value);
+        if (MemioWriter_GetSize(&writer) != sizeof(T)) {
+            return 0;
+        }
+        /* every form writes the same bytes, and nothing outside of the value */
+        if (memcmp(a, b, sizeof(a)) != 0 || memcmp(a, c, sizeof(a)) != 0 || memcmp(a, d, sizeof(a)) != 0) {
+            return 0;
+        }
+        for (k = 0; k < sizeof(T); ++k) {
+            size_t shift = Endianess == PIL_ENDIANESS_MSB_FIRST ? (sizeof(T) - 1 - k) * 8 : k * 8;
+            if (a[offset + k] != (uint8_t)(bits >> shift)) {
+                return 0;
+            }
+        }
+        if (a[offset + sizeof(T)] != 0xEE || (offset > 0 && a[offset - 1] != 0xEE)) {
+            return 0;
+        }
+        loaded[0] = read(a, offset);
+        loaded[1] = read_inline(a, offset);
+        loaded[2] = MemioRead<T, Endianess>(a, offset);
+        MemioReaderInit(&reader, a + offset, sizeof(T));
+        loaded[3] = MemioReaderGet<T, Endianess>(&reader);
+        if (MemioReader_GetRemaining(&reader) != 0) {
+            return 0;
+        }
+        for (i = 0; i < 4; ++i) {
+            if (memcmp(&loaded[i], &value, sizeof(T)) != 0) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* @summary Run TestInlineValue for the exported and inline functions with a given name suffix.
+ * @param _type The type of value to read and write.
+ * @param _suffix The suffix of the function names, for example ui32_msb.
+ * @param _endianess The byte order used by the functions.
+ * @param _value The value to write.
+ * @return Non-zero if the checks pass.
+ */
+#define TEST_INLINE_VALUE(_type, _suffix, _endianess, _value)                  \
+    TestInlineValue<_type, _endianess>((_type)(_value), Write_##_suffix, WriteInline_##_suffix, Read_##_suffix, ReadInline_##_suffix)
+
+static int
+Test_InlineReadWrite
+(
+    void
+)
+{   /* read and write values of every type and byte order at unaligned offsets
+     * with the exported functions, the inline functions and the templates,
+     * and check the stored bytes against the expected byte order. */
+    uint64_t seed = 0x6A09E667F3BCC909ULL;
+    size_t      i;
+
+    /* the byte swap functions can be evaluated at compile time */
+    static_assert(MemioByteSwap16(0x1122U) == 0x2211U, "MemioByteSwap16 is not constexpr");
+    static_assert(MemioByteSwap32(0x11223344UL) == 0x44332211UL, "MemioByteSwap32 is not constexpr");
+    static_assert(MemioByteSwap64(0x1122334455667788ULL) == 0x8877665544332211ULL, "MemioByteSwap64 is not constexpr");
+
+    for (i = 0; i < 64; ++i) {
+        uint64_t r = TestRandom(&seed);
+        double   d = (double)(int64_t) r / 7.0;
+        float    f = (float ) d;
+        if (!TEST_INLINE_VALUE(int8_t  , si8     , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(uint8_t , ui8     , PIL_SYSTEM_ENDIANESS   , r)) {
+            assert(0 && "8-bit inline read/write incorrect");
+            return 0;
+        }
+        if (!TEST_INLINE_VALUE(int16_t , si16    , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(int16_t , si16_msb, PIL_ENDIANESS_MSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(int16_t , si16_lsb, PIL_ENDIANESS_LSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(uint16_t, ui16    , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(uint16_t, ui16_msb, PIL_ENDIANESS_MSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(uint16_t, ui16_lsb, PIL_ENDIANESS_LSB_FIRST, r)) {
+            assert(0 && "16-bit inline read/write incorrect");
+            return 0;
+        }
+        if (!TEST_INLINE_VALUE(int32_t , si32    , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(int32_t , si32_msb, PIL_ENDIANESS_MSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(int32_t , si32_lsb, PIL_ENDIANESS_LSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(uint32_t, ui32    , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(uint32_t, ui32_msb, PIL_ENDIANESS_MSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(uint32_t, ui32_lsb, PIL_ENDIANESS_LSB_FIRST, r)) {
+            assert(0 && "32-bit inline read/write incorrect");
+            return 0;
+        }
+        if (!TEST_INLINE_VALUE(int64_t , si64    , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(int64_t , si64_msb, PIL_ENDIANESS_MSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(int64_t , si64_lsb, PIL_ENDIANESS_LSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(uint64_t, ui64    , PIL_SYSTEM_ENDIANESS   , r) ||
+            !TEST_INLINE_VALUE(uint64_t, ui64_msb, PIL_ENDIANESS_MSB_FIRST, r) ||
+            !TEST_INLINE_VALUE(uint64_t, ui64_lsb, PIL_ENDIANESS_LSB_FIRST, r)) {
+            assert(0 && "64-bit inline read/write incorrect");
+            return 0;
+        }
+        if (!TEST_INLINE_VALUE(float   , f32     , PIL_SYSTEM_ENDIANESS   , f) ||
+            !TEST_INLINE_VALUE(float   , f32_msb , PIL_ENDIANESS_MSB_FIRST, f) ||
+            !TEST_INLINE_VALUE(float   , f32_lsb , PIL_ENDIANESS_LSB_FIRST, f) ||
+            !TEST_INLINE_VALUE(double  , f64     , PIL_SYSTEM_ENDIANESS   , d) ||
+            !TEST_INLINE_VALUE(double  , f64_msb , PIL_ENDIANESS_MSB_FIRST, d) ||
+            !TEST_INLINE_VALUE(double  , f64_lsb , PIL_ENDIANESS_LSB_FIRST, d)) {
+            assert(0 && "Floating point inline read/write incorrect");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int
+Test_MemioWriter
+(
+    void
+)
+{   /* grow writers targeting a fixed buffer, a reserved memory block and the
+     * end of a memory arena, read the data back, and ensure that a writer
+     * fails rather than moving its data when it cannot grow in place. */
+    MEMORY_ARENA_INIT  init;
+    MEMORY_ARENA      arena;
+    MEMORY_BLOCK      block;
+    MEMIO_WRITER     writer;
+    MEMIO_READER     reader;
+    uint8_t       buffer[8];
+    uint8_t         *start;
+    uint8_t         *other;
+    uint64_t    next_offset;
+    uint32_t              i;
+    int                 res = 1;
+
+    memset(&arena, 0, sizeof(arena));
+    memset(&block, 0, sizeof(block));
+
+    /* a fixed buffer cannot grow, and a failed reservation is sticky */
+    MemioWriterInitBuffer(&writer, buffer, sizeof(buffer));
+    if (MemioWriterReserve(&writer, sizeof(buffer) + 1) == 0 || writer.Error == 0 || MemioWriterReserve(&writer, 1) == 0 || MemioWriterFinish(&writer) != 0) {
+        assert(0 && "Fixed-size MEMIO_WRITER grew");
+        return 0;
+    }
+
+    /* a block writer grows by committing more of the reservation */
+    if (HostMemoryReserveAndCommit(&block, 1024 * 1024, 4096, HOST_MEMORY_ALLOCATION_FLAGS_READWRITE) == NULL) {
+        assert(0 && "HostMemoryReserveAndCommit failed");
+        return 0;
+    }
+    if (MemioWriterInitBlock(&writer, &block) != 0 || writer.BufferStart != block.HostAddress || writer.WriterType != MEMIO_WRITER_TYPE_BLOCK) {
+        assert(0 && "MemioWriterInitBlock failed");
+        res = 0; goto end;
+    }
+    for (i = 0; i < 100000; ++i) {
+        if (MemioWriterReserve(&writer, sizeof(uint32_t)) != 0) {
+            assert(0 && "Block MEMIO_WRITER failed to grow");
+            res = 0; goto end;
+        }
+        MemioWriterPut_ui32_lsb(&writer, (uint32_t)(i * 2654435761UL));
+    }
+    if (block.BytesCommitted < 400000 || writer.BufferStart != block.HostAddress || writer.BufferEnd != block.HostAddress + block.BytesCommitted) {
+        assert(0 && "Block MEMIO_WRITER did not update the block commitment");
+        res = 0; goto end;
+    }
+    if (MemioWriterFinish(&writer) != 400000) {
+        assert(0 && "Block MEMIO_WRITER size incorrect");
+        res = 0; goto end;
+    }
+    MemioReaderInit(&reader, block.HostAddress, 400000);
+    for (i = 0; i < 100000; ++i) {
+        if (MemioReaderRequire(&reader, sizeof(uint32_t)) != 0 || MemioReaderGet_ui32_lsb(&reader) != (uint32_t)(i * 2654435761UL)) {
+            assert(0 && "Block MEMIO_WRITER data incorrect");
+            res = 0; goto end;
+        }
+    }
+    if (MemioReaderRequire(&reader, 1) == 0 || reader.Error == 0) {
+        assert(0 && "MEMIO_READER read past the end of the buffer");
+        res = 0; goto end;
+    }
+    /* growing past the reservation fails without moving the data */
+    MemioWriterInitBlock(&writer, &block);
+    if (MemioWriterReserve(&writer, (size_t) block.BytesReserved + 1) == 0 || writer.Error == 0 || MemioWriterFinish(&writer) != 0) {
+        assert(0 && "Block MEMIO_WRITER grew past its reservation");
+        res = 0; goto end;
+    }
+
+    /* an arena writer grows by extending its allocation at the end of the arena */
+    memset(&init, 0, sizeof(init));
+    init.AllocatorName   = "Test_MemioWriter";
+    init.ReserveSize     = 64 * 1024;
+    init.CommittedSize   = 64 * 1024;
+    init.AllocatorType   = MEMORY_ALLOCATOR_TYPE_HOST_HEAP;
+    init.AllocationFlags = HOST_MEMORY_ALLOCATION_FLAGS_READWRITE;
+    init.ArenaFlags      = MEMORY_ARENA_FLAG_INTERNAL;
+    if (MemoryArenaCreate(&arena, &init) != 0) {
+        assert(0 && "MemoryArenaCreate failed");
+        res = 0; goto end;
+    }
+    if (MemioWriterInitArena(&writer, &arena, 16, 16) != 0 || writer.WriterType != MEMIO_WRITER_TYPE_ARENA) {
+        assert(0 && "MemioWriterInitArena failed");
+        res = 0; goto end;
+    }
+    start = writer.BufferStart;
+    for (i = 0; i < 20000; ++i) {
+        if (MemioWriterReserve(&writer, 1) != 0) {
+            assert(0 && "Arena MEMIO_WRITER failed to grow");
+            res = 0; goto end;
+        }
+        MemioWriterPut_ui8(&writer, (uint8_t)(i * 7));
+    }
+    if (writer.BufferStart != start || (size_t)(writer.BufferEnd - start) <= 20000) {
+        assert(0 && "Arena MEMIO_WRITER moved or did not grow");
+        res = 0; goto end;
+    }
+    /* finishing returns the unused tail of the allocation to the arena */
+    if (MemioWriterFinish(&writer) != 20000 || writer.BufferEnd != start + 20000 || (uint8_t*)(uintptr_t)(arena.MemoryStart + arena.NextOffset) != start + 20000) {
+        assert(0 && "Arena MEMIO_WRITER did not return the unused tail");
+        res = 0; goto end;
+    }
+    for (i = 0; i < 20000; ++i) {
+        if (start[i] != (uint8_t)(i * 7)) {
+            assert(0 && "Arena MEMIO_WRITER data incorrect");
+            res = 0; goto end;
+        }
+    }
+    if ((other = (uint8_t*) MemoryArenaAllocateHost(NULL, &arena, 16, 1)) != start + 20000) {
+        assert(0 && "Arena allocation after MemioWriterFinish did not reuse the tail");
+        res = 0; goto end;
+    }
+
+    /* the writer cannot grow once another allocation follows it in the arena */
+    if (MemioWriterInitArena(&writer, &arena, 16, 1) != 0) {
+        assert(0 && "MemioWriterInitArena failed");
+        res = 0; goto end;
+    }
+    start = writer.BufferStart;
+    if ((other = (uint8_t*) MemoryArenaAllocateHost(NULL, &arena, 16, 1)) == NULL) {
+        assert(0 && "MemoryArenaAllocateHost failed");
+        res = 0; goto end;
+    }
+    next_offset = arena.NextOffset;
+    if (MemioWriterReserve(&writer, 16) != 0) {
+        assert(0 && "Arena MEMIO_WRITER could not use its initial allocation");
+        res = 0; goto end;
+    }
+    MemioWriterPutBytes(&writer, "0123456789abcdef", 16);
+    if (MemioWriterReserve(&writer, 1) == 0 || writer.Error == 0 || writer.BufferEnd != other || arena.NextOffset != next_offset) {
+        assert(0 && "Arena MEMIO_WRITER grew over a following allocation");
+        res = 0; goto end;
+    }
+    /* finishing a failed writer does not reset the arena under the following allocation */
+    if (MemioWriterFinish(&writer) != 0 || arena.NextOffset != next_offset || memcmp(start, "0123456789abcdef", 16) != 0) {
+        assert(0 && "Failed arena MEMIO_WRITER modified the arena");
+        res = 0; goto end;
+    }
+
+    /* the writer cannot grow past the end of the arena */
+    if (MemioWriterInitArena(&writer, &arena, 16, 1) != 0) {
+        assert(0 && "MemioWriterInitArena failed");
+        res = 0; goto end;
+    }
+    next_offset = arena.NextOffset;
+    if (MemioWriterReserve(&writer, 64 * 1024) == 0 || writer.Error == 0 || arena.NextOffset != next_offset) {
+        assert(0 && "Arena MEMIO_WRITER grew past the end of the arena");
+        res = 0; goto end;
+    }
+
+end:
+    MemoryArenaDelete(&arena);
+    if (block.HostAddress != NULL) {
+        HostMemoryRelease(block.HostAddress);
+    }
+    return res;
+}
+
+static int
+Test_Varint
+(
+    void
+)
+{   /* round-trip arrays through the LEB128, zigzag and Stream VByte encodings,
+     * then ensure that truncated and over-long encodings are rejected. */
+    static uint8_t const over_long32[6] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+    static uint8_t const too_wide32 [5] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x1F };
+    static uint8_t const over_long64[11]= { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+    static uint8_t const too_wide64 [10]= { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03 };
+    uint64_t  values[TEST_COUNT_MAX];
+    uint64_t  dec64 [TEST_COUNT_MAX];
+    uint32_t  val32 [TEST_COUNT_MAX];
+    uint32_t  dec32 [TEST_COUNT_MAX];
+    int32_t   sig32 [TEST_COUNT_MAX];
+    int32_t   dsig32[TEST_COUNT_MAX];
+    int64_t   sig64 [TEST_COUNT_MAX];
+    int64_t   dsig64[TEST_COUNT_MAX];
+    uint8_t   buffer[TEST_COUNT_MAX * MEMIO_VARINT64_MAX_SIZE];
+    uint32_t       v32;
+    uint64_t       v64;
+    size_t   c, i, size;
+
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        TestFillValues(values, n, 0xD1B54A32D192ED03ULL + n);
+        for (i = 0; i < n; ++i) {
+            val32[i] = (uint32_t)(values[i] >> 32) >> (values[i] & 31);
+            sig32[i] = (int32_t)  val32[i];
+            sig64[i] = (int64_t)  values[i];
+        }
+        if (n > 2) {
+            /* single-byte runs take the SIMD path, so include one */
+            val32[1] = 0; val32[2] = 127; sig32[1] = INT32_MIN; sig64[1] = INT64_MIN;
+        }
+        size = WriteArray_varint32(buffer, val32, n);
+        if (ReadArray_varint32(dec32, buffer, size, n) != size || memcmp(dec32, val32, n * 4) != 0) {
+            assert(0 && "varint32 round trip failed");
+            return 0;
+        }
+        if (n > 0 && ReadArray_varint32(dec32, buffer, size - 1, n) != 0) {
+            assert(0 && "Truncated varint32 array accepted");
+            return 0;
+        }
+        size = WriteArray_varint64(buffer, values, n);
+        if (ReadArray_varint64(dec64, buffer, size, n) != size || memcmp(dec64, values, n * 8) != 0) {
+            assert(0 && "varint64 round trip failed");
+            return 0;
+        }
+        if (n > 0 && ReadArray_varint64(dec64, buffer, size - 1, n) != 0) {
+            assert(0 && "Truncated varint64 array accepted");
+            return 0;
+        }
+        size = WriteArray_zigzag32(buffer, sig32, n);
+        if (ReadArray_zigzag32(dsig32, buffer, size, n) != size || memcmp(dsig32, sig32, n * 4) != 0) {
+            assert(0 && "zigzag32 round trip failed");
+            return 0;
+        }
+        size = WriteArray_zigzag64(buffer, sig64, n);
+        if (ReadArray_zigzag64(dsig64, buffer, size, n) != size || memcmp(dsig64, sig64, n * 8) != 0) {
+            assert(0 && "zigzag64 round trip failed");
+            return 0;
+        }
+        if (n > 0 && ReadArray_zigzag64(dsig64, buffer, size - 1, n) != 0) {
+            assert(0 && "Truncated zigzag64 array accepted");
+            return 0;
+        }
+        size = WriteArray_svb32(buffer, val32, n);
+        if (size > StreamVByte_GetMaxSize32(n) || ReadArray_svb32(dec32, buffer, size, n) != size || memcmp(dec32, val32, n * 4) != 0) {
+            assert(0 && "Stream VByte round trip failed");
+            return 0;
+        }
+        if (n > 0 && ReadArray_svb32(dec32, buffer, size - 1, n) != 0) {
+            assert(0 && "Truncated Stream VByte array accepted");
+            return 0;
+        }
+    }
+    /* boundary values and malformed single values */
+    if (Write_varint32(buffer, UINT32_MAX, 0) != MEMIO_VARINT32_MAX_SIZE || Read_varint32(&v32, buffer, MEMIO_VARINT32_MAX_SIZE) != MEMIO_VARINT32_MAX_SIZE || v32 != UINT32_MAX) {
+        assert(0 && "varint32 UINT32_MAX round trip failed");
+        return 0;
+    }
+    if (Write_varint64(buffer, UINT64_MAX, 0) != MEMIO_VARINT64_MAX_SIZE || Read_varint64(&v64, buffer, MEMIO_VARINT64_MAX_SIZE) != MEMIO_VARINT64_MAX_SIZE || v64 != UINT64_MAX) {
+        assert(0 && "varint64 UINT64_MAX round trip failed");
+        return 0;
+    }
+    if (Write_varint32(buffer, 0, 0) != 1 || Read_varint32(&v32, buffer, 0) != 0) {
+        assert(0 && "Empty varint32 input accepted");
+        return 0;
+    }
+    if (Read_varint32(&v32, over_long32, sizeof(over_long32)) != 0 || Read_varint32(&v32, too_wide32, sizeof(too_wide32)) != 0) {
+        assert(0 && "Malformed varint32 accepted");
+        return 0;
+    }
+    if (Read_varint64(&v64, over_long64, sizeof(over_long64)) != 0 || Read_varint64(&v64, too_wide64, sizeof(too_wide64)) != 0) {
+        assert(0 && "Malformed varint64 accepted");
+        return 0;
+    }
+    if (ReadArray_varint32(dec32, over_long32, sizeof(over_long32), 1) != 0 || ReadArray_varint64(dec64, over_long64, sizeof(over_long64), 1) != 0) {
+        assert(0 && "Malformed varint array accepted");
+        return 0;
+    }
+    return 1;
+}
+
+static int
+Test_BitPack
+(
+    void
+)
+{   /* pack and unpack arrays at every bit width, and ensure that the packed
+     * size matches BitPack32_GetSize and that nothing is written past it. */
+    uint64_t  values[TEST_COUNT_MAX];
+    uint32_t  val32 [TEST_COUNT_MAX];
+    uint32_t  dec32 [TEST_COUNT_MAX + 1];
+    uint8_t   buffer[TEST_COUNT_MAX * 4 + 1];
+    uint32_t     width;
+    uint32_t      mask;
+    size_t    c, i, size;
+
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        TestFillValues(values, n, 0x2545F4914F6CDD1DULL + n);
+        for (width = 0; width <= 32; ++width) {
+            mask = width == 32 ? 0xFFFFFFFFUL : (1UL << width) - 1;
+            for (i = 0; i < n; ++i) {
+                val32[i] = (uint32_t) values[i];
+            }
+            size = BitPack32_GetSize(n, width);
+            memset(buffer, 0xCD, sizeof(buffer));
+            dec32[n] = 0xCDCDCDCDUL;
+            if (BitPack32(buffer, val32, n, width) != size || buffer[size] != 0xCD) {
+                assert(0 && "BitPack32 size incorrect");
+                return 0;
+            }
+            if (BitUnpack32(dec32, buffer, n, width) != size || dec32[n] != 0xCDCDCDCDUL) {
+                assert(0 && "BitUnpack32 size incorrect");
+                return 0;
+            }
+            for (i = 0; i < n; ++i) {
+                if (dec32[i] != (val32[i] & mask)) {
+                    assert(0 && "BitUnpack32 value incorrect");
+                    return 0;
+                }
+                val32[i] &= mask;
+            }
+            if (n > 0 && BitWidth32(val32, n) > width) {
+                assert(0 && "BitWidth32 incorrect");
+                return 0;
+            }
+        }
+    }
+    val32[0] = 0; val32[1] = 0x10000UL;
+    if (BitWidth32(val32, 1) != 0 || BitWidth32(val32, 2) != 17) {
+        assert(0 && "BitWidth32 incorrect");
+        return 0;
+    }
+    return 1;
+}
+
+static int
+Test_BitStream
+(
+    void
+)
+{   /* write two bit streams of mixed field widths separated by a byte written
+     * directly to the writer, read them back, and check that each stream ends
+     * on a byte boundary and that reads past the end return zero bits. */
+    uint32_t          values[TEST_COUNT_MAX];
+    uint32_t          widths[TEST_COUNT_MAX];
+    uint8_t           buffer[TEST_COUNT_MAX * 4 + 16];
+    uint8_t const  short_buf[3] = { 0x34, 0x12, 0xAB };
+    MEMIO_WRITER      writer;
+    MEMIO_READER      reader;
+    MEMIO_BIT_WRITER   bitsw;
+    MEMIO_BIT_READER   bitsr;
+    uint64_t            seed = 0x3C6EF372FE94F82BULL;
+    size_t        c, i, size;
+    size_t          nbits[2];
+    uint32_t               s;
+
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        nbits[0] = nbits[1] = 0;
+        for (i = 0; i < n; ++i) {
+            uint64_t r = TestRandom(&seed);
+            widths[i]  = (uint32_t)(r % 32) + 1;
+            values[i]  = (uint32_t)(r >> 32) & (uint32_t)((1ULL << widths[i]) - 1);
+            nbits[i & 1] += widths[i];
+        }
+        /* even fields go to the first stream and odd fields to the second */
+        MemioWriterInitBuffer(&writer, buffer, sizeof(buffer));
+        for (s = 0; s < 2; ++s) {
+            MemioBitWriterInit(&bitsw, &writer);
+            /* set the bits above each field, which must be discarded */
+            for (i = s; i < n; i += 2) {
+                MemioBitWriterPut(&bitsw, values[i] | ~((uint32_t)((1ULL << widths[i]) - 1)), widths[i]);
+            }
+            if (MemioBitWriterFlush(&bitsw) != 0 || MemioWriter_GetSize(&writer) != (s == 0 ? 0 : (nbits[0] + 7) / 8 + 1) + (nbits[s] + 7) / 8) {
+                assert(0 && "MemioBitWriterFlush did not end on a byte boundary");
+                return 0;
+            }
+            if (s == 0 && MemioWriterReserve(&writer, 1) == 0) {
+                MemioWriterPut_ui8(&writer, 0xA5);
+            }
+        }
+        size = MemioWriterFinish(&writer);
+        if (size != (nbits[0] + 7) / 8 + 1 + (nbits[1] + 7) / 8) {
+            assert(0 && "Bit stream size incorrect");
+            return 0;
+        }
+        MemioReaderInit(&reader, buffer, size);
+        for (s = 0; s < 2; ++s) {
+            MemioBitReaderInit(&bitsr, &reader);
+            for (i = s; i < n; i += 2) {
+                if (MemioBitReaderGet(&bitsr, widths[i]) != values[i]) {
+                    assert(0 && "Bit stream round trip failed");
+                    return 0;
+                }
+            }
+            MemioBitReaderFinish(&bitsr);
+            if (reader.Error != 0 || MemioReader_GetOffset(&reader) != (s == 0 ? 0 : (nbits[0] + 7) / 8 + 1) + (nbits[s] + 7) / 8) {
+                assert(0 && "MemioBitReaderFinish did not end on a byte boundary");
+                return 0;
+            }
+            if (s == 0 && (MemioReaderRequire(&reader, 1) != 0 || MemioReaderGet_ui8(&reader) != 0xA5)) {
+                assert(0 && "Data following a bit stream incorrect");
+                return 0;
+            }
+        }
+        if (MemioReader_GetRemaining(&reader) != 0) {
+            assert(0 && "Bit stream not fully consumed");
+            return 0;
+        }
+    }
+
+    /* reading past the end returns zero bits and sets the reader error */
+    MemioReaderInit(&reader, short_buf, sizeof(short_buf));
+    MemioBitReaderInit(&bitsr, &reader);
+    if (MemioBitReaderGet(&bitsr, 12) != 0x234 || MemioBitReaderGet(&bitsr, 8) != 0xB1 || reader.Error != 0) {
+        assert(0 && "Bit stream read from a short buffer incorrect");
+        return 0;
+    }
+    if (MemioBitReaderGet(&bitsr, 16) != 0x000A || reader.Error == 0) {
+        assert(0 && "Bit stream read past the end of the buffer accepted");
+        return 0;
+    }
+    /* writing past the end of a fixed buffer fails when the stream is flushed */
+    MemioWriterInitBuffer(&writer, buffer, 4);
+    MemioBitWriterInit(&bitsw, &writer);
+    MemioBitWriterPut(&bitsw, 0xFFFFFFFFUL, 32);
+    MemioBitWriterPut(&bitsw, 0x5, 3);
+    if (MemioBitWriterFlush(&bitsw) == 0 || writer.Error == 0 || MemioWriterFinish(&writer) != 0) {
+        assert(0 && "Bit stream written past the end of the buffer");
+        return 0;
+    }
+    return 1;
+}
+
+static int
+Test_HalfNormalized
+(
+    void
+)
+{   /* convert every half-precision value to float and back, check rounding at
+     * the overflow threshold, and round-trip every unorm8 and snorm16 value. */
+    uint16_t *half  = (uint16_t*) malloc(65536 * sizeof(uint16_t));
+    uint16_t *half2 = (uint16_t*) malloc(65536 * sizeof(uint16_t));
+    float    *f32   = (float   *) malloc(65536 * sizeof(float));
+    int16_t  *sn    = (int16_t *) malloc(65536 * sizeof(int16_t));
+    uint8_t   un[256];
+    uint8_t   un2[256];
+    float     edge[4];
+    uint16_t  hedge[4];
+    uint32_t  i, c;
+    int       res = 1;
+
+    for (i = 0; i < 65536; ++i) {
+        half[i] = (uint16_t) i;
+    }
+    /* convert in slices of the test lengths so that every vector tail is used */
+    for (i = 0, c = 0; i < 65536; c = (c + 1) % TEST_COUNT_NUM) {
+        size_t n = TestCounts[c];
+        if (n > 65536 - i) n = 65536 - i;
+        if (ConvertArray_f16_f32(f32 + i, half + i, n) != n * sizeof(float)) {
+            assert(0 && "ConvertArray_f16_f32 size incorrect");
+            res = 0; goto end;
+        }
+        if (ConvertArray_f32_f16(half2 + i, f32 + i, n, MEMIO_ROUNDING_MODE_NEAREST) != n * sizeof(uint16_t)) {
+            assert(0 && "ConvertArray_f32_f16 size incorrect");
+            res = 0; goto end;
+        }
+        i += (uint32_t) n;
+    }
+    for (i = 0; i < 65536; ++i) {
+        int is_nan = (i & 0x7C00) == 0x7C00 && (i & 0x03FF) != 0;
+        if (is_nan ? (f32[i] == f32[i] || (half2[i] & 0x7C00) != 0x7C00 || (half2[i] & 0x03FF) == 0) : half2[i] != half[i]) {
+            assert(0 && "Half-precision round trip failed");
+            res = 0; goto end;
+        }
+    }
+    if (f32[0x3C00] != 1.0f || f32[0xC000] != -2.0f || f32[0x7BFF] != 65504.0f || f32[0x0001] != ldexpf(1.0f, -24)) {
+        assert(0 && "ConvertArray_f16_f32 value incorrect");
+        res = 0; goto end;
+    }
+    edge[0] = 65520.0f; edge[1] = 65519.0f; edge[2] = -1.0e10f; edge[3] = ldexpf(1.0f, -26);
+    ConvertArray_f32_f16(hedge, edge, 4, MEMIO_ROUNDING_MODE_NEAREST);
+    if (hedge[0] != 0x7C00 || hedge[1] != 0x7BFF || hedge[2] != 0xFC00 || hedge[3] != 0x0000) {
+        assert(0 && "ConvertArray_f32_f16 rounding incorrect (nearest)");
+        res = 0; goto end;
+    }
+    ConvertArray_f32_f16(hedge, edge, 4, MEMIO_ROUNDING_MODE_TRUNCATE);
+    if (hedge[0] != 0x7BFF || hedge[1] != 0x7BFF || hedge[2] != 0xFBFF || hedge[3] != 0x0000) {
+        assert(0 && "ConvertArray_f32_f16 rounding incorrect (truncate)");
+        res = 0; goto end;
+    }
+
+    for (i = 0; i < 256; ++i) {
+        un[i] = (uint8_t) i;
+    }
+    ConvertArray_unorm8_f32(f32, un, 256);
+    ConvertArray_f32_unorm8(un2, f32, 256, MEMIO_ROUNDING_MODE_NEAREST);
+    if (memcmp(un, un2, sizeof(un)) != 0 || f32[0] != 0.0f || f32[255] != 1.0f) {
+        assert(0 && "unorm8 round trip failed");
+        res = 0; goto end;
+    }
+    edge[0] = -1.0f; edge[1] = 2.0f; edge[2] = nanf(""); edge[3] = 0.5f;
+    ConvertArray_f32_unorm8(un2, edge, 4, MEMIO_ROUNDING_MODE_NEAREST);
+    if (un2[0] != 0 || un2[1] != 255 || un2[2] != 0 || un2[3] != 128) {
+        assert(0 && "ConvertArray_f32_unorm8 clamping incorrect");
+        res = 0; goto end;
+    }
+    ConvertArray_f32_unorm8(un2, edge, 4, MEMIO_ROUNDING_MODE_TRUNCATE);
+    if (un2[3] != 127) {
+        assert(0 && "ConvertArray_f32_unorm8 truncation incorrect");
+        res = 0; goto end;
+    }
+
+    for (i = 0; i < 65536; ++i) {
+        sn[i] = (int16_t)(i - 32768);
+    }
+    ConvertArray_snorm16_f32(f32, sn, 65536);
+    ConvertArray_f32_snorm16((int16_t*) half2, f32, 65536, MEMIO_ROUNDING_MODE_NEAREST);
+    for (i = 1; i < 65536; ++i) {
+        if (((int16_t*) half2)[i] != sn[i]) {
+            assert(0 && "snorm16 round trip failed");
+            res = 0; goto end;
+        }
+    }
+    if (f32[0] != -1.0f || f32[1] != -1.0f || ((int16_t*) half2)[0] != -32767) {
+        assert(0 && "snorm16 -32768 handling incorrect");
+        res = 0; goto end;
+    }
+    edge[0] = -2.0f; edge[1] = 2.0f; edge[2] = nanf(""); edge[3] = 0.0f;
+    ConvertArray_f32_snorm16(sn, edge, 4, MEMIO_ROUNDING_MODE_NEAREST);
+    if (sn[0] != -32767 || sn[1] != 32767 || sn[2] != 0 || sn[3] != 0) {
+        assert(0 && "ConvertArray_f32_snorm16 clamping incorrect");
+        res = 0; goto end;
+    }
+
+end:
+    free(sn);
+    free(f32);
+    free(half2);
+    free(half);
+    return res;
+}
+
+static int
+Test_DeltaPack
+(
+    void
+)
+{   /* round-trip sorted, unsorted and wide-gapped arrays through the delta
+     * codec, decode each block independently, and ensure that truncated or
+     * corrupted encodings are rejected rather than read out of bounds. */
+    uint64_t   values[TEST_COUNT_MAX];
+    uint64_t   dec64 [TEST_COUNT_MAX];
+    uint32_t   val32 [TEST_COUNT_MAX];
+    uint32_t   dec32 [TEST_COUNT_MAX];
+    uint8_t   *buffer = (uint8_t*) malloc(DeltaPack_GetMaxSize(TEST_COUNT_MAX, 8));
+    uint8_t   *copy   = (uint8_t*) malloc(DeltaPack_GetMaxSize(TEST_COUNT_MAX, 8));
+    MEMIO_DELTA_PACK_HEADER header;
+    MEMIO_DELTA_PACK_BLOCK   block;
+    size_t      c, i, k, size;
+    uint32_t    pattern;
+    int         res = 1;
+
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        for (pattern = 0; pattern < 3; ++pattern) {
+            uint64_t seed = 0x5851F42D4C957F2DULL + n;
+            uint64_t sum  = 1000;
+            for (i = 0; i < n; ++i) {
+                uint64_t r = TestRandom(&seed);
+                switch (pattern) {
+                    case 0 : sum += r & 0xFF; values[i] = sum; break;      /* sorted, small gaps */
+                    case 1 : values[i] = r >> (r & 63); break;             /* unsorted */
+                    default: sum += r >> 8; values[i] = sum; break;        /* gaps wider than 32 bits */
+                }
+                val32[i] = (uint32_t) values[i];
+            }
+            size = DeltaPack32(buffer, val32, n);
+            if (size > DeltaPack_GetMaxSize(n, 4) || DeltaPackGetCount(buffer, size, 4) != n || DeltaUnpack32(dec32, buffer, size) != n || memcmp(dec32, val32, n * 4) != 0) {
+                assert(0 && "DeltaPack32 round trip failed");
+                res = 0; goto end;
+            }
+            for (k = 0; k * MEMIO_BITPACK_BLOCK_SIZE < n; ++k) {
+                size_t bn = n - k * MEMIO_BITPACK_BLOCK_SIZE;
+                if (bn > MEMIO_BITPACK_BLOCK_SIZE) bn = MEMIO_BITPACK_BLOCK_SIZE;
+                if (DeltaUnpackBlock32(dec32, buffer, size, k) != bn || memcmp(dec32, val32 + k * MEMIO_BITPACK_BLOCK_SIZE, bn * 4) != 0) {
+                    assert(0 && "DeltaUnpackBlock32 failed");
+                    res = 0; goto end;
+                }
+            }
+            if (DeltaUnpackBlock32(dec32, buffer, size, k) != 0) {
+                assert(0 && "DeltaUnpackBlock32 accepted an out-of-range block");
+                res = 0; goto end;
+            }
+            if (n > 0 && (DeltaUnpack32(dec32, buffer, size - 1) != 0 || DeltaPackGetCount(buffer, size - 1, 4) != 0)) {
+                assert(0 && "Truncated DeltaPack32 data accepted");
+                res = 0; goto end;
+            }
+            if (DeltaPackGetCount(buffer, size, 8) != 0) {
+                assert(0 && "DeltaPack32 data accepted as 64-bit");
+                res = 0; goto end;
+            }
+
+            size = DeltaPack64(buffer, values, n);
+            if (size > DeltaPack_GetMaxSize(n, 8) || DeltaPackGetCount(buffer, size, 8) != n || DeltaUnpack64(dec64, buffer, size) != n || memcmp(dec64, values, n * 8) != 0) {
+                assert(0 && "DeltaPack64 round trip failed");
+                res = 0; goto end;
+            }
+            for (k = 0; k * MEMIO_BITPACK_BLOCK_SIZE < n; ++k) {
+                size_t bn = n - k * MEMIO_BITPACK_BLOCK_SIZE;
+                if (bn > MEMIO_BITPACK_BLOCK_SIZE) bn = MEMIO_BITPACK_BLOCK_SIZE;
+                if (DeltaUnpackBlock64(dec64, buffer, size, k) != bn || memcmp(dec64, values + k * MEMIO_BITPACK_BLOCK_SIZE, bn * 8) != 0) {
+                    assert(0 && "DeltaUnpackBlock64 failed");
+                    res = 0; goto end;
+                }
+            }
+            if (n > 0 && DeltaUnpack64(dec64, buffer, size - 1) != 0) {
+                assert(0 && "Truncated DeltaPack64 data accepted");
+                res = 0; goto end;
+            }
+            if (n == 0) {
+                continue;
+            }
+            /* corrupt the header and the block directory */
+            memcpy(copy, buffer, size);
+            copy[0] ^= 0xFF;
+            if (DeltaPackGetCount(copy, size, 8) != 0 || DeltaUnpack64(dec64, copy, size) != 0) {
+                assert(0 && "DeltaPack64 data with a bad magic accepted");
+                res = 0; goto end;
+            }
+            memcpy(copy, buffer, size);
+            memcpy(&header, copy, sizeof(header));
+            header.Count = 0xFFFFFFFFUL;
+            memcpy(copy, &header, sizeof(header));
+            if (DeltaUnpack64(dec64, copy, size) != 0) {
+                assert(0 && "DeltaPack64 data with a bad count accepted");
+                res = 0; goto end;
+            }
+            memcpy(copy, buffer, size);
+            memcpy(&block, copy + sizeof(header), sizeof(block));
+            block.BitWidth = 33;
+            memcpy(copy + sizeof(header), &block, sizeof(block));
+            if (DeltaUnpack64(dec64, copy, size) != 0) {
+                assert(0 && "DeltaPack64 block with a bad bit width accepted");
+                res = 0; goto end;
+            }
+            memcpy(copy, buffer, size);
+            memcpy(&block, copy + sizeof(header), sizeof(block));
+            block.DataOffset = (uint32_t) size;
+            memcpy(copy + sizeof(header), &block, sizeof(block));
+            if (block.BitWidth != 0 && DeltaUnpack64(dec64, copy, size) != 0) {
+                assert(0 && "DeltaPack64 block with a bad data offset accepted");
+                res = 0; goto end;
+            }
+        }
+    }
+
+end:
+    free(copy);
+    free(buffer);
+    return res;
+}
+
+/* @summary Fill a buffer with data of a given kind for compression tests.
+ * @param dst The buffer to fill.
+ * @param size The number of bytes to write.
+ * @param kind 0 for zeros, 1 for repetitive text and 2 for incompressible bytes.
+ */
+static void
+TestFillBytes
+(
+    uint8_t     *dst,
+    size_t      size,
+    uint32_t    kind
+)
+{
+    static char const text[] = "the quick brown fox jumps over the lazy dog; ";
+    uint64_t          seed   = 0x853C49E6748FEA9BULL + size;
+    size_t               i;
+    for (i = 0; i < size; ++i) {
+        switch (kind) {
+            case 0 : dst[i] = 0; break;
+            case 1 : dst[i] = (uint8_t) text[(i * 7 / 5) % (sizeof(text) - 1)]; break;
+            default: dst[i] = (uint8_t) TestRandom(&seed); break;
+        }
+    }
+}
+
+static int
+Test_LzFrame
+(
+    void
+)
+{   /* compress blocks and multi-block frames of compressible and random data,
+     * decompress them, and ensure that every truncation of a frame and a
+     * corrupted byte in a block are detected. */
+    size_t const   max_size = 70000;
+    size_t const     sizes[]= { 0, 1, 15, 16, 17, 127, 128, 129, 4096, 70000 };
+    uint8_t          *src   = (uint8_t*) malloc(max_size);
+    uint8_t          *dec   = (uint8_t*) malloc(max_size);
+    size_t const  comp_max  = MemioLz_GetMaxSize(max_size) + MemioLzFrame_GetMaxSize(max_size, 4096);
+    uint8_t          *comp  = (uint8_t*) malloc(comp_max);
+    void          *scratch  = malloc(MEMIO_LZ_SCRATCH_SIZE);
+    MEMIO_WRITER    writer;
+    size_t       s, size, off;
+    size_t        comp_size;
+    size_t         dec_size;
+    uint32_t           kind;
+    int                 res = 1;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        size = sizes[s];
+        for (kind = 0; kind < 3; ++kind) {
+            TestFillBytes(src, size, kind);
+            comp_size = MemioLzCompress(comp, MemioLz_GetMaxSize(size), src, size, scratch);
+            if (comp_size == 0 || MemioLzDecompress(&dec_size, dec, max_size, comp, comp_size) != 0 || dec_size != size || memcmp(dec, src, size) != 0) {
+                assert(0 && "LZ block round trip failed");
+                res = 0; goto end;
+            }
+            if (size > 0 && MemioLzDecompress(&dec_size, dec, size - 1, comp, comp_size) == 0) {
+                assert(0 && "LZ block decompressed into a short buffer");
+                res = 0; goto end;
+            }
+            if (size > 16 && MemioLzDecompress(&dec_size, dec, max_size, comp, comp_size - 1) == 0 && dec_size == size) {
+                assert(0 && "Truncated LZ block decompressed completely");
+                res = 0; goto end;
+            }
+
+            /* a frame of 4KB blocks */
+            MemioWriterInitBuffer(&writer, comp, comp_max);
+            if (MemioLzFrameWriteHeader(&writer, 4096) != 0) {
+                assert(0 && "MemioLzFrameWriteHeader failed");
+                res = 0; goto end;
+            }
+            for (off = 0; off < size; off += 4096) {
+                size_t n = size - off < 4096 ? size - off : 4096;
+                if (MemioLzFrameWriteBlock(&writer, src + off, n, scratch) != 0) {
+                    assert(0 && "MemioLzFrameWriteBlock failed");
+                    res = 0; goto end;
+                }
+            }
+            if (MemioLzFrameWriteEnd(&writer) != 0) {
+                assert(0 && "MemioLzFrameWriteEnd failed");
+                res = 0; goto end;
+            }
+            comp_size = MemioWriterFinish(&writer);
+            MemioWriterInitBuffer(&writer, dec, max_size);
+            if (MemioLzFrameDecompress(&writer, comp, comp_size) != 0 || MemioWriter_GetSize(&writer) != size || memcmp(dec, src, size) != 0) {
+                assert(0 && "LZ frame round trip failed");
+                res = 0; goto end;
+            }
+            if (size <= 4096) {
+                /* every proper prefix of the frame is rejected */
+                for (off = 0; off < comp_size; ++off) {
+                    MemioWriterInitBuffer(&writer, dec, max_size);
+                    if (MemioLzFrameDecompress(&writer, comp, off) == 0) {
+                        assert(0 && "Truncated LZ frame accepted");
+                        res = 0; goto end;
+                    }
+                }
+            }
+            if (size > 0) {
+                /* a flipped byte in the first block fails its checksum */
+                comp[MEMIO_LZ_FRAME_HEADER_SIZE + MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE] ^= 0x5A;
+                MemioWriterInitBuffer(&writer, dec, max_size);
+                if (MemioLzFrameDecompress(&writer, comp, comp_size) == 0) {
+                    assert(0 && "Corrupted LZ frame accepted");
+                    res = 0; goto end;
+                }
+            }
+        }
+    }
+    /* decoding garbage must fail without reading or writing out of bounds */
+    TestFillBytes(src, 4096, 2);
+    for (off = 1; off <= 4096; off *= 2) {
+        MemioLzDecompress(&dec_size, dec, 4096, src, off);
+    }
+
+end:
+    free(scratch);
+    free(comp);
+    free(dec);
+    free(src);
+    return res;
+}
+
+static int
+Test_TableSchema
+(
+    void
+)
+{   /* pack and unpack records with fields in both byte orders, serialize a
+     * table data stream into a second stream of the same table, and ensure 
+     * that truncated streams, streams larger than the destination and 
+     * mismatched schemas are rejected. */
+    typedef struct SCHEMA_ITEM {
+        uint16_t            A;
+        int32_t             B[3];
+        uint64_t            C;
+        float               D;
+        double              E;
+        uint8_t             F[5];
+    } SCHEMA_ITEM;
+    TABLE_FIELD_DESC const fields[6] = {
+        { PIL_OffsetOf(SCHEMA_ITEM, A), TABLE_FIELD_TYPE_UI16 , 1, PIL_ENDIANESS_MSB_FIRST },
+        { PIL_OffsetOf(SCHEMA_ITEM, B), TABLE_FIELD_TYPE_SI32 , 3, PIL_ENDIANESS_LSB_FIRST },
+        { PIL_OffsetOf(SCHEMA_ITEM, C), TABLE_FIELD_TYPE_UI64 , 1, PIL_ENDIANESS_UNKNOWN   },
+        { PIL_OffsetOf(SCHEMA_ITEM, D), TABLE_FIELD_TYPE_F32  , 1, PIL_ENDIANESS_MSB_FIRST },
+        { PIL_OffsetOf(SCHEMA_ITEM, E), TABLE_FIELD_TYPE_F64  , 1, PIL_ENDIANESS_UNKNOWN   },
+        { PIL_OffsetOf(SCHEMA_ITEM, F), TABLE_FIELD_TYPE_BYTES, 5, PIL_ENDIANESS_UNKNOWN   }
+    };
+    SCHEMA_ITEM          *items  = (SCHEMA_ITEM*) calloc(TEST_COUNT_MAX, sizeof(SCHEMA_ITEM));
+    SCHEMA_ITEM          *items2 = (SCHEMA_ITEM*) calloc(TEST_COUNT_MAX, sizeof(SCHEMA_ITEM));
+    uint8_t              *packed = NULL;
+    TABLE_SCHEMA          schema;
+    TABLE_SCHEMA           other;
+    TABLE_DESC              desc = {};
+    TABLE_INDEX            index = {};
+    TABLE_DATA           data[2] = {};
+    TABLE_DATA       *streams[2] = { &data[0], &data[1] };
+    TABLE_INIT              init = {};
+    TABLE_DATA_STREAM_DESC sd[2] = {
+        { &data[0], sizeof(SCHEMA_ITEM), 0 },
+        { &data[1], sizeof(SCHEMA_ITEM), 0 }
+    };
+    MEMIO_WRITER          writer;
+    MEMIO_READER          reader;
+    uint64_t                seed = 0xBF58476D1CE4E5B9ULL;
+    uint32_t        record_count;
+    uint32_t                  ix;
+    size_t         c, i, j, size;
+    int                      res = 1;
+
+    if (TableSchemaInit(&schema, fields, 6, sizeof(SCHEMA_ITEM)) != 0 || schema.PackedSize != 2 + 12 + 8 + 4 + 8 + 5) {
+        assert(0 && "TableSchemaInit failed");
+        res = 0; goto end;
+    }
+    if (TableSchemaInit(&other, fields, 5, sizeof(SCHEMA_ITEM)) != 0 || other.SchemaHash == schema.SchemaHash) {
+        assert(0 && "TableSchemaInit hash does not depend on the fields");
+        res = 0; goto end;
+    }
+    packed = (uint8_t*) malloc(TableSchema_GetStreamSize(&schema, TEST_COUNT_MAX));
+    for (i = 0; i < TEST_COUNT_MAX; ++i) {
+        items[i].A    = (uint16_t) TestRandom(&seed);
+        items[i].B[0] = (int32_t ) TestRandom(&seed);
+        items[i].B[1] = INT32_MIN;
+        items[i].B[2] = (int32_t ) i;
+        items[i].C    = TestRandom(&seed);
+        items[i].D    = (float ) i * 0.5f;
+        items[i].E    = (double) TestRandom(&seed) / 3.0;
+        for (j = 0; j < 5; ++j) {
+            items[i].F[j] = (uint8_t)(i + j);
+        }
+    }
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        memset(items2, 0, TEST_COUNT_MAX * sizeof(SCHEMA_ITEM));
+        size = TableSchemaPackRecords(packed, &schema, items, n);
+        if (size != n * schema.PackedSize || TableSchemaUnpackRecords(items2, &schema, packed, n) != size) {
+            assert(0 && "TableSchemaPackRecords size incorrect");
+            res = 0; goto end;
+        }
+        if (n > 0 && (packed[0] != (uint8_t)(items[0].A >> 8) || packed[n * 2] != (uint8_t) items[0].B[0])) {
+            assert(0 && "TableSchemaPackRecords byte order incorrect");
+            res = 0; goto end;
+        }
+        if (memcmp(items, items2, n * sizeof(SCHEMA_ITEM)) != 0) {
+            assert(0 && "Schema round trip failed");
+            res = 0; goto end;
+        }
+    }
+
+    init.Index          = &index;
+    init.Streams        = sd;
+    init.StreamCount    = 2;
+    init.TableCapacity  = TEST_COUNT_MAX;
+    init.InitialCommit  = TEST_COUNT_MAX;
+    if (TableCreate(&init) != 0) {
+        assert(0 && "TableCreate failed");
+        res = 0; goto end;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 2;
+    for (c = 0; c < TEST_COUNT_NUM; ++c) {
+        size_t n = TestCounts[c];
+        while (Table_GetCount(&desc) < n) {
+            TableCreateId(&ix, &desc);
+            memcpy(Table_GetStreamElement(SCHEMA_ITEM, &desc, 0, ix), &items[ix], sizeof(SCHEMA_ITEM));
+        }
+        memset(data[1].StorageBuffer, 0, TEST_COUNT_MAX * sizeof(SCHEMA_ITEM));
+        MemioWriterInitBuffer(&writer, packed, TableSchema_GetStreamSize(&schema, TEST_COUNT_MAX));
+        if (TableSchemaWriteStream(&writer, &schema, &data[0], (uint32_t) n) != 0 || (size = MemioWriterFinish(&writer)) != TableSchema_GetStreamSize(&schema, n)) {
+            assert(0 && "TableSchemaWriteStream failed");
+            res = 0; goto end;
+        }
+        MemioReaderInit(&reader, packed, size);
+        if (TableSchemaReadStreamHeader(&record_count, &schema, &reader) != 0 || record_count != n || TableSchemaReadStream(&data[1], &schema, &reader, record_count, (uint32_t) n) != 0) {
+            assert(0 && "TableSchemaReadStream failed");
+            res = 0; goto end;
+        }
+        if (MemioReader_GetRemaining(&reader) != 0 || memcmp(data[0].StorageBuffer, data[1].StorageBuffer, n * sizeof(SCHEMA_ITEM)) != 0) {
+            assert(0 && "Schema stream round trip failed");
+            res = 0; goto end;
+        }
+        if (n == 0) {
+            continue;
+        }
+        MemioReaderInit(&reader, packed, size - 1);
+        if (TableSchemaReadStreamHeader(&record_count, &schema, &reader) == 0 && TableSchemaReadStream(&data[1], &schema, &reader, record_count, (uint32_t) n) == 0) {
+            assert(0 && "Truncated schema stream accepted");
+            res = 0; goto end;
+        }
+        MemioReaderInit(&reader, packed, size);
+        if (TableSchemaReadStreamHeader(&record_count, &schema, &reader) == 0 && TableSchemaReadStream(&data[1], &schema, &reader, record_count, (uint32_t) n - 1) == 0) {
+            assert(0 && "Schema stream larger than the destination accepted");
+            res = 0; goto end;
+        }
+        TableSchemaInit(&other, fields, 5, sizeof(SCHEMA_ITEM));
+        MemioReaderInit(&reader, packed, size);
+        if (TableSchemaReadStreamHeader(&record_count, &other, &reader) == 0) {
+            assert(0 && "Schema stream read with a different schema");
+            res = 0; goto end;
+        }
+        MemioReaderInit(&reader, packed, sizeof(TABLE_SCHEMA_STREAM_HEADER) - 1);
+        if (TableSchemaReadStreamHeader(&record_count, &schema, &reader) == 0) {
+            assert(0 && "Truncated schema stream header accepted");
+            res = 0; goto end;
+        }
+    }
+
+end:
+    TableDelete(&desc);
+    free(packed);
+    free(items2);
+    free(items);
+    return res;
+}
+
+/* @summary Check that an integer formats to the same text as printf, and that the text parses back to the value.
+ * @return Non-zero if the checks pass.
+ */
+static int
+TestDecimalU64
+(
+    uint64_t value
+)
+{
+    char     text[MEMIO_TEXT_MAX_UI64 + 1];
+    char      ref[32];
+    uint64_t  parsed = 0;
+    size_t         n = FormatDecimal_ui64(text, value);
+    snprintf(ref, sizeof(ref), "%llu", (unsigned long long) value);
+    return n == strlen(ref) && memcmp(text, ref, n) == 0 && ParseDecimal_ui64(&parsed, text, n) == n && parsed == value;
+}
+
+static int
+TestDecimalS64
+(
+    int64_t value
+)
+{
+    char     text[MEMIO_TEXT_MAX_SI64 + 1];
+    char      ref[32];
+    int64_t   parsed = 0;
+    size_t         n = FormatDecimal_si64(text, value);
+    snprintf(ref, sizeof(ref), "%lld", (long long) value);
+    return n == strlen(ref) && memcmp(text, ref, n) == 0 && ParseDecimal_si64(&parsed, text, n) == n && parsed == value;
+}
+
+/* @summary Check that a double formats to text that both ParseDecimal_f64 and strtod convert back to the same bits.
+ * @return Non-zero if the checks pass.
+ */
+static int
+TestDecimalF64
+(
+    double value
+)
+{
+    char     text[MEMIO_TEXT_MAX_F64 + 1];
+    double   parsed = 0;
+    double   ref;
+    size_t   n = FormatDecimal_f64(text, value);
+    text[n] = '\0';
+    ref     = strtod(text, NULL);
+    return n <= MEMIO_TEXT_MAX_F64 && ParseDecimal_f64(&parsed, text, n) == n && memcmp(&parsed, &value, sizeof(double)) == 0 && memcmp(&ref, &value, sizeof(double)) == 0;
+}
+
+static int
+TestDecimalF32
+(
+    float value
+)
+{
+    char     text[MEMIO_TEXT_MAX_F32 + 1];
+    float    parsed = 0;
+    float    ref;
+    size_t   n = FormatDecimal_f32(text, value);
+    text[n] = '\0';
+    ref     = strtof(text, NULL);
+    return n <= MEMIO_TEXT_MAX_F32 && ParseDecimal_f32(&parsed, text, n) == n && memcmp(&parsed, &value, sizeof(float)) == 0 && memcmp(&ref, &value, sizeof(float)) == 0;
+}
+
+static int
+Test_Decimal
+(
+    void
+)
+{   /* format and parse integer and floating point boundary values, compare
+     * the text with printf and strtod, and ensure out-of-range and malformed
+     * text is rejected without modifying the output value. */
+    static double const f64_edges[] = {
+        0.0, -0.0, 1.0, -1.0, 0.1, 1.0 / 3.0, 5e-324, 2.2250738585072014e-308, 1e23, 9007199254740993.0, 1.7976931348623157e308, 1e-7, 1e21, 123456.789
+    };
+    static float const f32_edges[] = {
+        0.0f, -0.0f, 1.0f, 0.1f, 1.0f / 3.0f, 1.4e-45f, 1.17549435e-38f, 3.40282347e38f, 16777217.0f, 1e-7f, 1e21f
+    };
+    char        text[64];
+    uint64_t    seed = 0x94D049BB133111EBULL;
+    uint64_t     u64 = 7;
+    int64_t      s64 = 7;
+    uint32_t     u32 = 7;
+    int32_t      s32 = 7;
+    double       f64 = 7;
+    size_t      i, n;
+
+    if (!TestDecimalU64(0) || !TestDecimalU64(UINT64_MAX) || !TestDecimalU64(10000000000000000000ULL) || !TestDecimalU64(9999999999999999ULL)) {
+        assert(0 && "ui64 decimal edge values failed");
+        return 0;
+    }
+    if (!TestDecimalS64(0) || !TestDecimalS64(INT64_MIN) || !TestDecimalS64(INT64_MAX) || !TestDecimalS64(-1)) {
+        assert(0 && "si64 decimal edge values failed");
+        return 0;
+    }
+    for (i = 0; i < 10000; ++i) {
+        uint64_t r = TestRandom(&seed);
+        if (!TestDecimalU64(r >> (r & 63)) || !TestDecimalS64((int64_t) r >> (r & 63))) {
+            assert(0 && "Integer decimal round trip failed");
+            return 0;
+        }
+    }
+    n = FormatDecimal_ui32(text, UINT32_MAX);
+    if (n != 10 || memcmp(text, "4294967295", 10) != 0 || ParseDecimal_ui32(&u32, text, n) != n || u32 != UINT32_MAX) {
+        assert(0 && "ui32 decimal UINT32_MAX failed");
+        return 0;
+    }
+    n = FormatDecimal_si32(text, INT32_MIN);
+    if (n != 11 || memcmp(text, "-2147483648", 11) != 0 || ParseDecimal_si32(&s32, text, n) != n || s32 != INT32_MIN) {
+        assert(0 && "si32 decimal INT32_MIN failed");
+        return 0;
+    }
+    /* values one past each limit are rejected, and the output is not modified */
+    u32 = 7; s32 = 7; u64 = 7; s64 = 7;
+    if (ParseDecimal_ui32(&u32, "4294967296", 10) != 0 || ParseDecimal_si32(&s32, "2147483648", 10) != 0 || ParseDecimal_si32(&s32, "-2147483649", 11) != 0) {
+        assert(0 && "32-bit decimal overflow accepted");
+        return 0;
+    }
+    if (ParseDecimal_ui64(&u64, "18446744073709551616", 20) != 0 || ParseDecimal_ui64(&u64, "99999999999999999999", 20) != 0 || ParseDecimal_ui64(&u64, "100000000000000000000", 21) != 0) {
+        assert(0 && "ui64 decimal overflow accepted");
+        return 0;
+    }
+    if (ParseDecimal_si64(&s64, "9223372036854775808", 19) != 0 || ParseDecimal_si64(&s64, "-9223372036854775809", 20) != 0) {
+        assert(0 && "si64 decimal overflow accepted");
+        return 0;
+    }
+    if (u32 != 7 || s32 != 7 || u64 != 7 || s64 != 7) {
+        assert(0 && "Rejected decimal text modified the output value");
+        return 0;
+    }
+    if (ParseDecimal_ui64(&u64, "", 0) != 0 || ParseDecimal_ui64(&u64, "x1", 2) != 0 || ParseDecimal_si64(&s64, "-", 1) != 0 || ParseDecimal_ui32(&u32, "123", 2) != 2 || u32 != 12) {
+        assert(0 && "Malformed or bounded decimal text handled incorrectly");
+        return 0;
+    }
+    if (ParseDecimal_ui64(&u64, "18446744073709551615x", 21) != 20 || u64 != UINT64_MAX) {
+        assert(0 && "Decimal parsing did not stop at a non-digit");
+        return 0;
+    }
+
+    for (i = 0; i < sizeof(f64_edges) / sizeof(f64_edges[0]); ++i) {
+        if (!TestDecimalF64(f64_edges[i]) || !TestDecimalF64(-f64_edges[i])) {
+            assert(0 && "f64 decimal edge value failed");
+            return 0;
+        }
+    }
+    for (i = 0; i < sizeof(f32_edges) / sizeof(f32_edges[0]); ++i) {
+        if (!TestDecimalF32(f32_edges[i]) || !TestDecimalF32(-f32_edges[i])) {
+            assert(0 && "f32 decimal edge value failed");
+            return 0;
+        }
+    }
+    n = FormatDecimal_f64(text, 1e23);
+    if (n != 5 || memcmp(text, "1e+23", 5) != 0) {
+        assert(0 && "1e23 is not formatted as the shortest text");
+        return 0;
+    }
+    n = FormatDecimal_f64(text, 5e-324);
+    if (n != 6 || memcmp(text, "5e-324", 6) != 0) {
+        assert(0 && "5e-324 is not formatted as the shortest text");
+        return 0;
+    }
+    for (i = 0; i < 20000; ++i) {
+        uint64_t bits64 = TestRandom(&seed);
+        uint32_t bits32 = (uint32_t)(bits64 >> 32);
+        double   d;
+        float    f;
+        memcpy(&d, &bits64, sizeof(d));
+        memcpy(&f, &bits32, sizeof(f));
+        if ((isfinite(d) && !TestDecimalF64(d)) || (isfinite(f) && !TestDecimalF32(f))) {
+            assert(0 && "Floating point decimal round trip failed");
+            return 0;
+        }
+    }
+    if (ParseDecimal_f64(&f64, "1e400", 5) != 5 || !isinf(f64) || ParseDecimal_f64(&f64, "-1e400", 6) != 6 || !(isinf(f64) && f64 < 0)) {
+        assert(0 && "Overflowing f64 text did not produce infinity");
+        return 0;
+    }
+    if (ParseDecimal_f64(&f64, "1e-400", 6) != 6 || f64 != 0.0 || ParseDecimal_f64(&f64, "2.4703282292062328e-324", 23) != 23 || f64 != 5e-324) {
+        assert(0 && "Underflowing f64 text rounded incorrectly");
+        return 0;
+    }
+    f64 = 7;
+    if (ParseDecimal_f64(&f64, "", 0) != 0 || ParseDecimal_f64(&f64, "e5", 2) != 0 || ParseDecimal_f64(&f64, "-", 1) != 0 || f64 != 7) {
+        assert(0 && "Malformed f64 text accepted");
+        return 0;
+    }
+    return 1;
+}
+
+int main
+(
+    int    argc, 
+    char **argv
+)
+{
+    (void) argc;
+    (void) argv;
+
+    Test_ByteSwapArray();
+    Test_InlineReadWrite();
+    Test_MemioWriter();
+    Test_Varint();
+    Test_BitPack();
+    Test_BitStream();
+    Test_HalfNormalized();
+    Test_DeltaPack();
+    Test_LzFrame();
+    Test_TableSchema();
+    Test_Decimal();
+
+    return 0;
+}
@@ -1,6 +1,15 @@
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include "pil.h"
+#include "memmgr.h"
 #include "table.h"
+#include "chunk_table.h"
+#include "entity.h"
+#include "table_scan.h"
+#include "table_journal.h"
+#include "table_delta.h"
+#include "table_snapshot.h"
 
 #define CONTAINER_ITEM_STREAM_INDEX    0
 
@@ -53,22 +62,25 @@ DebugHandleBits
 static void
 CreateContainer
 (
-    CONTAINER *c, 
-    uint32_t num
+    CONTAINER     *c, 
+    uint32_t     num, 
+    uint32_t  commit, 
+    uint32_t   flags
 )
 {
     uint32_t const          stream_count = 1;
     uint32_t                      result = 0;
     TABLE_INIT                table_init = {};
     TABLE_DATA_STREAM_DESC table_data[1] = {
-        { &c->ItemData, sizeof(ITEM) }
+        { &c->ItemData, sizeof(ITEM), 0 }
     };
 
     table_init.Index         = &c->TableIndex;
     table_init.Streams       = table_data;
     table_init.StreamCount   = stream_count;
     table_init.TableCapacity = num;
-    table_init.InitialCommit = num;
+    table_init.InitialCommit = commit;
+    table_init.TableFlags    = flags;
     if ((result = TableCreate(&table_init)) != 0) {
         assert(0 && "TableCreate failed");
         return;
@@ -77,6 +89,9 @@ CreateContainer
     c->TableDesc.Index       = &c->TableIndex;
     c->TableDesc.Streams     = c->TableStreams;
     c->TableDesc.StreamCount = stream_count;
+    c->TableDesc.KeyIndex    = nullptr;
+    c->TableDesc.BlobHeap    = nullptr;
+    c->TableDesc.Journal     = nullptr;
 }
 
 static void
@@ -98,6 +113,9 @@ ContainerPush
     ITEM       *item;
     HANDLE_BITS bits;
     uint32_t       i;
+    if (TableEnsure(&c->TableDesc, Container_GetCount(c) + 1, TABLE_CHUNK_SIZE) != 0) {
+        return HANDLE_BITS_INVALID;
+    }
     if((bits = TableCreateId(&i, &c->TableDesc)) != HANDLE_BITS_INVALID) {
         item = Container_ItemStreamAt(c, i);
         item->Value = value;
@@ -194,7 +212,7 @@ Test_Generation
     uint32_t  i;
     CONTAINER c;
 
-    CreateContainer(&c, 4);
+    CreateContainer(&c, 4, 4, TABLE_FLAGS_NONE);
     for (i = 0; i < HANDLE_GENER_MASK+1; ++i) {
         HANDLE_BITS h = ContainerPush(&c,  i);
         if (HandleBitsExtractGeneration(h) != (i & HANDLE_GENER_MASK)) {
@@ -221,7 +239,7 @@ Test_FullStateValidationOne
     CONTAINER          c;
     int             i, j;
 
-    CreateContainer(&c, C);
+    CreateContainer(&c, C, C, TABLE_FLAGS_NONE);
     for (j = 0; j < 64; ++j) {
         for (i = 0; i < C; ++i) { /* allocate one at a time */
             if ((handles[i] = ContainerPush(&c, i)) == HANDLE_BITS_INVALID) {
@@ -281,7 +299,7 @@ Test_FullStateValidationMany
 
     assert(C%4 == 0);
 
-    CreateContainer(&c, C);
+    CreateContainer(&c, C, C, TABLE_FLAGS_NONE);
     for (j = 0; j < 64; ++j) {
         for (i = 0; i < C; ++i) { /* allocate one at a time */
             if ((handles[i] = ContainerPush(&c, i)) == HANDLE_BITS_INVALID) {
@@ -309,6 +327,1761 @@ end:
 #   undef  C
 }
 
+static int
+Test_PagedSparseIndex
+(
+    void
+)
+{   /* create a table with the maximum capacity and a paged sparse index.
+     * ensure that only the sparse pages covering the issued handles are committed,
+     * and that the table can be reset and refilled. */
+#   define C    3000
+    HANDLE_BITS *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    int              res = 1;
+    CONTAINER          c;
+    uint32_t        i, j;
+
+    CreateContainer(&c, TABLE_MAX_OBJECT_COUNT, 0, TABLE_FLAG_PAGED_SPARSE_INDEX);
+    for (j = 0; j < 4; ++j) {
+        for (i = 0; i < C; ++i) {
+            if ((handles[i] = ContainerPush(&c, i)) == HANDLE_BITS_INVALID) {
+                assert(handles[i] != HANDLE_BITS_INVALID);
+                res  = 0; goto end;
+            }
+        }
+        if (VerifyTableIndex(&c.TableIndex) == 0) {
+            assert(0 && "Table index verification failed (paged)");
+            res  = 0; goto end;
+        }
+        for (i = 0; i < TABLE_MAX_OBJECT_COUNT; i += TABLE_SPARSE_PAGE_ENTRIES) {
+            uint32_t expect = i < c.TableIndex.CommitCount;
+            if ((TableIndex_IsSparseSlotCommitted(&c.TableIndex, i) != 0) != expect) {
+                assert(0 && "Unexpected sparse page commitment");
+                res  = 0; goto end;
+            }
+        }
+        for (i = 0; i < C; ++i) {
+            if (ContainerLookUp(&c, handles[i])->Value != (int) i) {
+                assert(0 && "ContainerLookUp(&c, handles[i])->Value == i");
+                res  = 0; goto end;
+            }
+        }
+        if (j & 1) {
+            TableDeleteAllIds(&c.TableDesc);
+        } else {
+            for (i = 0; i < C; ++i) {
+                ContainerDel1(&c, handles[i]);
+            }
+        }
+        if (VerifyTableIndex(&c.TableIndex) == 0) {
+            assert(0 && "Table index verification failed (paged reset)");
+            res  = 0; goto end;
+        }
+    }
+
+end:
+    DeleteContainer(&c);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_StreamAlignment
+(
+    void
+)
+{   /* create a table with an odd-sized record and a 64-byte aligned stream.
+     * fill the table to its committed capacity and ensure that the stream is
+     * aligned and that the tail padding past the last record can be read. */
+#   define C    1000
+    TABLE_DESC             desc = {};
+    TABLE_INDEX           index = {};
+    TABLE_DATA             data = {};
+    TABLE_DATA       *streams[1]= { &data };
+    TABLE_INIT             init = {};
+    TABLE_DATA_STREAM_DESC sd[1]= {
+        { &data, 3, 64 }
+    };
+    uint8_t               *p_itr;
+    uint8_t               *p_end;
+    uint32_t                sum = 0;
+    uint32_t                  i;
+    int                     res = 1;
+
+    init.Index         = &index;
+    init.Streams       = sd;
+    init.StreamCount   = 1;
+    init.TableCapacity = C;
+    init.InitialCommit = C;
+    if (TableCreate(&init) != 0) {
+        assert(0 && "TableCreate failed");
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 1;
+    for (i = 0; i < C; ++i) {
+        uint32_t  ix;
+        if (TableCreateId(&ix, &desc) == HANDLE_BITS_INVALID) {
+            assert(0 && "TableCreateId failed");
+            res  = 0; goto end;
+        }
+        Table_GetStreamElement(uint8_t, &desc, 0, ix)[0] = 1;
+    }
+    p_itr = Table_GetStreamBegin(uint8_t, &desc, 0);
+    p_end = Table_GetStreamEndPadded(uint8_t, &desc, 0);
+    if ((((uintptr_t) p_itr) & 63) != 0 || (((uintptr_t) p_end) & 63) != 0) {
+        assert(0 && "Stream is not aligned");
+        res  = 0; goto end;
+    }
+    while (p_itr != p_end) {
+        sum += *p_itr++;
+    }
+    if (sum != C) {
+        assert(sum == C);
+        res  = 0; goto end;
+    }
+
+end:
+    TableDelete(&desc);
+    return res;
+#   undef  C
+}
+
+static int
+Test_KeyIndex
+(
+    void
+)
+{   /* create a table with a secondary key index on a 64-bit key column.
+     * create items, delete some one at a time and some in bulk, and ensure 
+     * that every key resolves to the correct record after each step. */
+#   define C    4096
+    typedef struct KEYED_ITEM {
+        int                 Value;
+        uint32_t            Key32;
+        uint64_t            Key;
+    } KEYED_ITEM;
+    HANDLE_BITS        *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    HANDLE_BITS           *dels =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    TABLE_DESC             desc = {};
+    TABLE_INDEX           index = {};
+    TABLE_DATA             data = {};
+    TABLE_DATA       *streams[1]= { &data };
+    TABLE_INIT             init = {};
+    TABLE_KEY_INDEX        kidx = {};
+    TABLE_KEY_INDEX       kidx32= {};
+    TABLE_KEY_INDEX_INIT  kinit = {};
+    TABLE_DATA_STREAM_DESC sd[1]= {
+        { &data, sizeof(KEYED_ITEM), 0 }
+    };
+    uint32_t         i, n, ndel;
+    int                     res = 1;
+
+    init.Index          = &index;
+    init.Streams        = sd;
+    init.StreamCount    = 1;
+    init.TableCapacity  = C;
+    init.InitialCommit  = 0;
+    kinit.KeyIndex      = &kidx;
+    kinit.StreamIndex   = 0;
+    kinit.KeyOffset     = PIL_OffsetOf(KEYED_ITEM, Key);
+    kinit.KeySize       = sizeof(uint64_t);
+    kinit.InitialCommit = 0;
+    if (TableCreate(&init) != 0 || TableKeyIndexCreate(&kinit) != 0) {
+        assert(0 && "TableCreate failed");
+        free(dels); free(handles);
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 1;
+    desc.KeyIndex    = &kidx;
+    for (i = 0; i < C; ++i) {
+        uint32_t  ix;
+        if (TableEnsure(&desc, i + 1, TABLE_CHUNK_SIZE) != 0) {
+            assert(0 && "TableEnsure failed");
+            res  = 0; goto end;
+        }
+        if ((handles[i] = TableCreateKeyedId(&ix, &desc, 0x100000000ULL * i + 7)) == HANDLE_BITS_INVALID) {
+            assert(0 && "TableCreateKeyedId failed");
+            res  = 0; goto end;
+        }
+        Table_GetStreamElement(KEYED_ITEM, &desc, 0, ix)->Value = (int) i;
+    }
+    if (TableCreateKeyedId(&i, &desc, 7) != HANDLE_BITS_INVALID) {
+        assert(0 && "TableCreateKeyedId accepted a duplicate key");
+        res  = 0; goto end;
+    }
+    for (i = 0, ndel = 0; i < C; ++i) {
+        if ((i % 3) == 0) {
+            TableDeleteId(&desc, handles[i]);
+        } else if ((i % 3) == 1) {
+            dels[ndel++] = handles[i];
+        }
+    }
+    TableDeleteIds(&desc, dels, ndel);
+    if (VerifyTableIndex(&index) == 0 || kidx.ItemCount != Table_GetCount(&desc)) {
+        assert(0 && "Table index verification failed (keyed)");
+        res  = 0; goto end;
+    }
+    for (i = 0, n = 0; i < C; ++i) {
+        uint32_t  ix;
+        HANDLE_BITS h = TableResolveKey(&ix, &desc, &kidx, 0x100000000ULL * i + 7);
+        if ((i % 3) == 2) {
+            if (h != handles[i] || Table_GetStreamElement(KEYED_ITEM, &desc, 0, ix)->Value != (int) i) {
+                assert(0 && "Key did not resolve to the expected item");
+                res  = 0; goto end;
+            } n++;
+        } else if (h != HANDLE_BITS_INVALID) {
+            assert(0 && "Deleted key still resolves");
+            res  = 0; goto end;
+        }
+    }
+    TableDeleteAllIds(&desc);
+    if (kidx.ItemCount != 0 || TableKeyIndexLookup(&kidx, 0x100000000ULL * 2 + 7) != HANDLE_BITS_INVALID) {
+        assert(0 && "Key index not cleared");
+        res  = 0; goto end;
+    }
+    /* link a second index on a 32-bit key column; keyed creation must maintain both */
+    kinit.KeyIndex      = &kidx32;
+    kinit.KeyOffset     = PIL_OffsetOf(KEYED_ITEM, Key32);
+    kinit.KeySize       = sizeof(uint32_t);
+    kinit.InitialCommit = 1;
+    if (TableKeyIndexCreate(&kinit) != 0) {
+        assert(0 && "TableKeyIndexCreate failed (32-bit)");
+        res  = 0; goto end;
+    }
+    kidx.Next = &kidx32;
+    if ((handles[0] = TableCreateKeyedId(&i, &desc, 9)) == HANDLE_BITS_INVALID) {
+        assert(0 && "TableCreateKeyedId failed (two indices)");
+        res  = 0; goto end;
+    }
+    if (TableResolveKey(&n, &desc, &kidx32, 9) != handles[0] || n != i || Table_GetStreamElement(KEYED_ITEM, &desc, 0, i)->Key32 != 9) {
+        assert(0 && "Key not added to the second index");
+        res  = 0; goto end;
+    }
+    if (TableCreateKeyedId(&i, &desc, 0x100000009ULL) != HANDLE_BITS_INVALID || Table_GetCount(&desc) != 1 || kidx.ItemCount != 1) {
+        assert(0 && "TableCreateKeyedId accepted a key wider than a linked index");
+        res  = 0; goto end;
+    }
+    TableDeleteId(&desc, handles[0]);
+    if (kidx.ItemCount != 0 || kidx32.ItemCount != 0) {
+        assert(0 && "Keys not removed from both indices");
+        res  = 0; goto end;
+    }
+
+end:
+    kidx.Next = NULL;
+    TableKeyIndexDelete(&kidx32);
+    TableKeyIndexDelete(&kidx);
+    TableDelete(&desc);
+    free(dels);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_ChunkTable
+(
+    void
+)
+{   /* create items in a chunked table with large records, delete every other
+     * item, and ensure that the surviving records did not move, that stale 
+     * handles fail to resolve, and that chunk iteration visits only live items. */
+#   define C    1024
+    typedef struct LARGE_ITEM {
+        uint32_t            Value;
+        uint8_t             Payload[4092];
+    } LARGE_ITEM;
+    HANDLE_BITS        *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    LARGE_ITEM          **items =(LARGE_ITEM **) malloc(C * sizeof(LARGE_ITEM*));
+    CHUNK_TABLE_DESC       desc = {};
+    CHUNK_TABLE_INDEX     index = {};
+    CHUNK_TABLE_INIT       init = {};
+    TABLE_DATA             data = {};
+    TABLE_DATA       *streams[1]= { &data };
+    TABLE_DATA_STREAM_DESC sd[1]= {
+        { &data, sizeof(LARGE_ITEM), 0 }
+    };
+    uint32_t     slots[CHUNK_TABLE_CHUNK_SIZE];
+    uint32_t          i, j, n, s;
+    int                     res = 1;
+
+    init.Index          = &index;
+    init.Streams        = sd;
+    init.StreamCount    = 1;
+    init.TableCapacity  = C;
+    init.InitialCommit  = 0;
+    if (ChunkTableCreate(&init) != 0) {
+        assert(0 && "ChunkTableCreate failed");
+        free(items); free(handles);
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 1;
+    for (i = 0; i < C; ++i) {
+        if (ChunkTableEnsure(&desc, ChunkTable_GetCount(&desc) + 1) != 0) {
+            assert(0 && "ChunkTableEnsure failed");
+            res  = 0; goto end;
+        }
+        if ((handles[i] = ChunkTableCreateId(&s, &desc)) == HANDLE_BITS_INVALID) {
+            assert(0 && "ChunkTableCreateId failed");
+            res  = 0; goto end;
+        }
+        items[i] = ChunkTable_GetStreamElement(LARGE_ITEM, &desc, 0, s);
+        items[i]->Value = i;
+    }
+    if (ChunkTableEnsure(&desc, C + 1) == 0) {
+        assert(0 && "ChunkTableEnsure exceeded capacity");
+        res  = 0; goto end;
+    }
+    for (i = 0; i < C; i += 2) {
+        if (ChunkTableDeleteId(&desc, handles[i]) != 0) {
+            assert(0 && "ChunkTableDeleteId failed");
+            res  = 0; goto end;
+        }
+    }
+    if (VerifyChunkTableIndex(&index) == 0 || ChunkTable_GetCount(&desc) != C / 2) {
+        assert(0 && "Chunk table index verification failed");
+        res  = 0; goto end;
+    }
+    for (i = 0; i < C; ++i) {
+        int   live = ChunkTableResolve(&s, &desc, handles[i]);
+        if ((i & 1) == 0 && live) {
+            assert(0 && "Deleted handle still resolves");
+            res  = 0; goto end;
+        }
+        if ((i & 1) != 0 && (!live || ChunkTable_GetStreamElement(LARGE_ITEM, &desc, 0, s) != items[i] || items[i]->Value != i)) {
+            assert(0 && "Live record moved or failed to resolve");
+            res  = 0; goto end;
+        }
+    }
+    for (i = 0, n = 0; i < ChunkTable_GetChunkCount(&desc); ++i) {
+        uint32_t count = ChunkTableScanChunk(slots, &desc, i);
+        for (j = 0; j < count; ++j) {
+            if ((ChunkTable_GetStreamElement(LARGE_ITEM, &desc, 0, slots[j])->Value & 1) == 0) {
+                assert(0 && "Chunk scan visited a deleted item");
+                res  = 0; goto end;
+            }
+        }
+        n += count;
+    }
+    if (n != C / 2) {
+        assert(0 && "Chunk scan item count mismatch");
+        res  = 0; goto end;
+    }
+    /* freed slots are reused with a new generation */
+    for (i = 0; i < C; i += 2) {
+        if ((handles[i] = ChunkTableCreateId(&s, &desc)) == HANDLE_BITS_INVALID) {
+            assert(0 && "ChunkTableCreateId failed to reuse a slot");
+            res  = 0; goto end;
+        }
+    }
+    if (ChunkTableCreateId(&s, &desc) != HANDLE_BITS_INVALID || VerifyChunkTableIndex(&index) == 0) {
+        assert(0 && "Chunk table free list corrupt");
+        res  = 0; goto end;
+    }
+    ChunkTableDeleteAllIds(&desc);
+    if (ChunkTable_GetCount(&desc) != 0 || ChunkTableResolve(&s, &desc, handles[1]) != 0 || VerifyChunkTableIndex(&index) == 0) {
+        assert(0 && "ChunkTableDeleteAllIds failed");
+        res  = 0; goto end;
+    }
+
+end:
+    ChunkTableDelete(&desc);
+    free(items);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_BlobHeap
+(
+    void
+)
+{   /* create items that each own a variable-length blob, replace and delete 
+     * some of the blobs, then compact the heap a few bytes at a time and 
+     * ensure that every live item still references its own blob data. */
+#   define C    1024
+    typedef struct BLOB_ITEM {
+        uint32_t            Value;
+        TABLE_BLOB_SPAN     Blob;
+    } BLOB_ITEM;
+    HANDLE_BITS        *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    TABLE_DESC             desc = {};
+    TABLE_INDEX           index = {};
+    TABLE_DATA             data = {};
+    TABLE_DATA       *streams[1]= { &data };
+    TABLE_INIT             init = {};
+    TABLE_BLOB_HEAP        heap = {};
+    TABLE_BLOB_HEAP_INIT  hinit = {};
+    TABLE_DATA_STREAM_DESC sd[1]= {
+        { &data, sizeof(BLOB_ITEM), 0 }
+    };
+    BLOB_ITEM             *item;
+    uint8_t               *blob;
+    uint32_t        i, j, size;
+    uint32_t         heap_size;
+    int                     res = 1;
+
+    init.Index          = &index;
+    init.Streams        = sd;
+    init.StreamCount    = 1;
+    init.TableCapacity  = C;
+    init.InitialCommit  = C;
+    hinit.BlobHeap      = &heap;
+    hinit.StreamIndex   = 0;
+    hinit.SpanOffset    = PIL_OffsetOf(BLOB_ITEM, Blob);
+    hinit.ReserveSize   = 4 * 1024 * 1024;
+    hinit.InitialCommit = 0;
+    if (TableCreate(&init) != 0 || TableBlobHeapCreate(&hinit) != 0) {
+        assert(0 && "TableCreate failed");
+        free(handles);
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 1;
+    desc.BlobHeap    = &heap;
+    for (i = 0; i < C; ++i) {
+        uint32_t  ix;
+        if ((handles[i] = TableCreateId(&ix, &desc)) == HANDLE_BITS_INVALID) {
+            assert(0 && "TableCreateId failed");
+            res  = 0; goto end;
+        }
+        item = Table_GetStreamElement(BLOB_ITEM, &desc, 0, ix);
+        item->Value       = i;
+        item->Blob.Offset = 0;
+        item->Blob.Size   = 0;
+        size = 1 + (i % 100);
+        if ((blob = TableBlobAlloc(&heap, &desc, handles[i], size)) == NULL) {
+            assert(0 && "TableBlobAlloc failed");
+            res  = 0; goto end;
+        }
+        memset(blob, (int)(i & 0xFF), size);
+    }
+    heap_size = heap.HeapSize;
+    for (i = 0; i < C; ++i) {
+        if ((i % 4) == 0) {
+            TableDeleteId(&desc, handles[i]);
+            handles[i] = HANDLE_BITS_INVALID;
+        } else if ((i % 4) == 1) {
+            /* replace the blob with a larger one */
+            size = 101 + (i % 100);
+            blob = TableBlobAlloc(&heap, &desc, handles[i], size);
+            memset(blob, (int)(i & 0xFF), size);
+        } else if ((i % 4) == 2) {
+            TableBlobFree(&heap, &desc, handles[i]);
+        }
+    }
+    if (heap.FreeBytes == 0 || heap.HeapSize <= heap_size) {
+        assert(0 && "Blobs were not freed");
+        res  = 0; goto end;
+    }
+    while (TableBlobHeapCompact(&heap, &desc, 256) == 0) {
+        /* empty */
+    }
+    if (heap.FreeBytes != 0 || heap.HeapSize >= heap_size) {
+        assert(0 && "Blob heap not compacted");
+        res  = 0; goto end;
+    }
+    for (i = 0; i < C; ++i) {
+        uint32_t  ix;
+        if (handles[i] == HANDLE_BITS_INVALID) {
+            continue;
+        }
+        if (TableResolve(&ix, &desc, handles[i]) == 0) {
+            assert(0 && "TableResolve failed");
+            res  = 0; goto end;
+        }
+        item = Table_GetStreamElement(BLOB_ITEM, &desc, 0, ix);
+        size =((i % 4) == 1) ? 101 + (i % 100) : ((i % 4) == 2) ? 0 : 1 + (i % 100);
+        if (item->Value != i || item->Blob.Size != size) {
+            assert(0 && "Blob span is incorrect");
+            res  = 0; goto end;
+        }
+        for (j = 0, blob = TableBlobHeap_GetData(&heap, &item->Blob); j < size; ++j) {
+            if (blob[j] != (uint8_t)(i & 0xFF)) {
+                assert(0 && "Blob data is incorrect");
+                res  = 0; goto end;
+            }
+        }
+    }
+    TableDeleteAllIds(&desc);
+    if (heap.HeapSize != 0) {
+        assert(0 && "Blob heap not cleared");
+        res  = 0; goto end;
+    }
+
+end:
+    TableBlobHeapDelete(&heap);
+    TableDelete(&desc);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableScan
+(
+    void
+)
+{   /* create a table with a packed float column and an interleaved record 
+     * stream, scan the float column for a range, filter the selection with 
+     * a mask test on the second stream, and compare with a scalar loop. */
+#   define C    1003
+    typedef struct FLAG_ITEM {
+        uint32_t            Flags;
+        int32_t             Id;
+    } FLAG_ITEM;
+    uint32_t           *indices =(uint32_t   *) malloc(C * sizeof(uint32_t));
+    HANDLE_BITS        *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    TABLE_DESC             desc = {};
+    TABLE_INDEX           index = {};
+    TABLE_DATA         data0    = {};
+    TABLE_DATA         data1    = {};
+    TABLE_DATA       *streams[2]= { &data0, &data1 };
+    TABLE_INIT             init = {};
+    TABLE_SELECTION         sel = {};
+    TABLE_SCAN_PREDICATE  range = {};
+    TABLE_SCAN_PREDICATE  flags = {};
+    TABLE_DATA_STREAM_DESC sd[2]= {
+        { &data0, sizeof(float)    , 0 },
+        { &data1, sizeof(FLAG_ITEM), 0 }
+    };
+    uint32_t          i, j, n;
+    int                     res = 1;
+
+    init.Index          = &index;
+    init.Streams        = sd;
+    init.StreamCount    = 2;
+    init.TableCapacity  = C;
+    init.InitialCommit  = C;
+    if (TableCreate(&init) != 0) {
+        assert(0 && "TableCreate failed");
+        free(handles); free(indices);
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 2;
+    for (i = 0; i < C; ++i) {
+        uint32_t  ix;
+        handles[i] = TableCreateId(&ix, &desc);
+       *Table_GetStreamElement(float    , &desc, 0, ix)        = (float)((i * 37) % 101) - 50.0f;
+        Table_GetStreamElement(FLAG_ITEM, &desc, 1, ix)->Flags = i & 0xF;
+        Table_GetStreamElement(FLAG_ITEM, &desc, 1, ix)->Id    = (int32_t) i - 500;
+    }
+    for (i = 0; i < C; i += 7) {
+        TableDeleteId(&desc, handles[i]);
+    }
+    sel.Indices               = indices;
+    sel.Capacity              = C;
+    range.StreamIndex         = 0;
+    range.FieldOffset         = 0;
+    range.Operation           = TABLE_SCAN_OPERATION_F32_RANGE;
+    range.Operand.F32.Min     =-10.0f;
+    range.Operand.F32.Max     = 20.0f;
+    flags.StreamIndex         = 1;
+    flags.FieldOffset         = PIL_OffsetOf(FLAG_ITEM, Flags);
+    flags.Operation           = TABLE_SCAN_OPERATION_U32_MASK_EQUAL;
+    flags.Operand.Bits.Mask   = 0x3;
+    flags.Operand.Bits.Value  = 0x1;
+    if (TableScan(&sel, &desc, &range) != 0 || TableFilter(&sel, &desc, &flags) != 0) {
+        assert(0 && "TableScan failed");
+        res  = 0; goto end;
+    }
+    for (i = 0, j = 0, n = Table_GetCount(&desc); i < n; ++i) {
+        float    f = *Table_GetStreamElement(float, &desc, 0, i);
+        uint32_t m =  Table_GetStreamElement(FLAG_ITEM, &desc, 1, i)->Flags;
+        if (f >= -10.0f && f <= 20.0f && (m & 0x3) == 0x1) {
+            if (j >= TableSelection_GetCount(&sel) || TableSelection_GetIndex(&sel, j) != i) {
+                assert(0 && "Selection does not match scalar scan");
+                res  = 0; goto end;
+            } j++;
+        }
+    }
+    if (j != TableSelection_GetCount(&sel)) {
+        assert(0 && "Selection contains extra items");
+        res  = 0; goto end;
+    }
+    /* an interleaved column uses the scalar path */
+    range.StreamIndex         = 1;
+    range.FieldOffset         = PIL_OffsetOf(FLAG_ITEM, Id);
+    range.Operation           = TABLE_SCAN_OPERATION_I32_RANGE;
+    range.Operand.I32.Min     =-100;
+    range.Operand.I32.Max     = 99;
+    if (TableScan(&sel, &desc, &range) != 0) {
+        assert(0 && "TableScan failed");
+        res  = 0; goto end;
+    }
+    TableSelectionToHandles(handles, &desc, &sel);
+    for (i = 0; i < TableSelection_GetCount(&sel); ++i) {
+        uint32_t ix;
+        int32_t  id;
+        if (TableResolve(&ix, &desc, handles[i]) == 0 || ix != TableSelection_GetIndex(&sel, i)) {
+            assert(0 && "TableSelectionToHandles failed");
+            res  = 0; goto end;
+        }
+        id = Table_GetStreamElement(FLAG_ITEM, &desc, 1, ix)->Id;
+        if (id < -100 || id > 99) {
+            assert(0 && "Selected item does not match predicate");
+            res  = 0; goto end;
+        }
+    }
+    for (i = 0, j = 0, n = Table_GetCount(&desc); i < n; ++i) {
+        int32_t  id = Table_GetStreamElement(FLAG_ITEM, &desc, 1, i)->Id;
+        j += (id >= -100 && id <= 99) ? 1 : 0;
+    }
+    if (TableSelection_GetCount(&sel) != j) {
+        assert(0 && "Selection count incorrect");
+        res  = 0; goto end;
+    }
+
+end:
+    TableDelete(&desc);
+    free(handles);
+    free(indices);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableAggregate
+(
+    void
+)
+{   /* aggregate packed and interleaved columns of every supported type, 
+     * over the whole table, split into two ranges and merged, and over a 
+     * selection, and compare the results with scalar loops. */
+#   define C    1001
+    typedef struct MIXED_ITEM {
+        int64_t             I64;
+        double              F64;
+        int32_t             I32;
+        float               F32;
+    } MIXED_ITEM;
+    uint32_t           *indices =(uint32_t*) malloc(C * sizeof(uint32_t));
+    TABLE_DESC             desc = {};
+    TABLE_INDEX           index = {};
+    TABLE_DATA         data[5]  = {};
+    TABLE_DATA       *streams[5]= { &data[0], &data[1], &data[2], &data[3], &data[4] };
+    TABLE_INIT             init = {};
+    TABLE_SELECTION         sel = {};
+    TABLE_AGGREGATE      agg[2] = {};
+    TABLE_COLUMN         col[8] = {
+        { 0, 0, TABLE_COLUMN_TYPE_INT32   },
+        { 1, 0, TABLE_COLUMN_TYPE_INT64   },
+        { 2, 0, TABLE_COLUMN_TYPE_FLOAT32 },
+        { 3, 0, TABLE_COLUMN_TYPE_FLOAT64 },
+        { 4, PIL_OffsetOf(MIXED_ITEM, I32), TABLE_COLUMN_TYPE_INT32   },
+        { 4, PIL_OffsetOf(MIXED_ITEM, I64), TABLE_COLUMN_TYPE_INT64   },
+        { 4, PIL_OffsetOf(MIXED_ITEM, F32), TABLE_COLUMN_TYPE_FLOAT32 },
+        { 4, PIL_OffsetOf(MIXED_ITEM, F64), TABLE_COLUMN_TYPE_FLOAT64 }
+    };
+    TABLE_DATA_STREAM_DESC sd[5]= {
+        { &data[0], sizeof(int32_t)   , 0 },
+        { &data[1], sizeof(int64_t)   , 0 },
+        { &data[2], sizeof(float)     , 0 },
+        { &data[3], sizeof(double)    , 0 },
+        { &data[4], sizeof(MIXED_ITEM), 0 }
+    };
+    uint32_t         bins[8] = {};
+    uint32_t          i, c, n;
+    int                     res = 1;
+
+    init.Index          = &index;
+    init.Streams        = sd;
+    init.StreamCount    = 5;
+    init.TableCapacity  = C;
+    init.InitialCommit  = C;
+    if (TableCreate(&init) != 0) {
+        assert(0 && "TableCreate failed");
+        free(indices);
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 5;
+    for (i = 0; i < C; ++i) {
+        uint32_t   ix;
+        int32_t     v = (int32_t)((i * 7919) % 2003) - 1000;
+        MIXED_ITEM *m;
+        TableCreateId(&ix, &desc);
+       *Table_GetStreamElement(int32_t, &desc, 0, ix) = v;
+       *Table_GetStreamElement(int64_t, &desc, 1, ix) = (int64_t) v * 1000000;
+       *Table_GetStreamElement(float  , &desc, 2, ix) = (float ) v * 0.5f;
+       *Table_GetStreamElement(double , &desc, 3, ix) = (double) v * 0.25;
+        m = Table_GetStreamElement(MIXED_ITEM, &desc, 4, ix);
+        m->I32 = v; m->I64 = (int64_t) v * 1000000; m->F32 = (float) v * 0.5f; m->F64 = (double) v * 0.25;
+    }
+    for (i = 0, n = 0; i < C; i += 3) {
+        indices[n++] = i;
+    }
+    sel.Indices  = indices;
+    sel.Count    = n;
+    sel.Capacity = C;
+    for (c = 0; c < 8; ++c) {
+        uint32_t  si = col[c].StreamIndex;
+        uint32_t  fo = col[c].FieldOffset;
+        int64_t  sum = 0, mn = INT64_MAX, mx = INT64_MIN;
+        double  fsum = 0, fmn = HUGE_VAL, fmx = -HUGE_VAL;
+        for (i = 0; i < C; ++i) {
+            uint8_t *p = Table_GetStreamElement(uint8_t, &desc, si, i) + fo;
+            int64_t  iv = 0;
+            double   fv = 0;
+            switch (col[c].ColumnType) {
+                case TABLE_COLUMN_TYPE_INT32  : iv = *(int32_t*) p; break;
+                case TABLE_COLUMN_TYPE_INT64  : iv = *(int64_t*) p; break;
+                case TABLE_COLUMN_TYPE_FLOAT32: fv = *(float  *) p; break;
+                case TABLE_COLUMN_TYPE_FLOAT64: fv = *(double *) p; break;
+            }
+            sum += iv; mn = iv < mn ? iv : mn; mx = iv > mx ? iv : mx;
+            fsum+= fv; fmn= fv < fmn? fv : fmn; fmx= fv > fmx? fv : fmx;
+        }
+        TableAggregate(&agg[0], &desc, &col[c], NULL, 0, 517);
+        TableAggregate(&agg[1], &desc, &col[c], NULL, 517, ~0U);
+        TableAggregateMerge(&agg[0], &agg[1]);
+        if (agg[0].Count != C) {
+            assert(0 && "Aggregate count incorrect");
+            res  = 0; goto end;
+        }
+        if (col[c].ColumnType <= TABLE_COLUMN_TYPE_INT64) {
+            if (agg[0].SumI64 != sum || agg[0].MinI64 != mn || agg[0].MaxI64 != mx) {
+                assert(0 && "Integer aggregate incorrect");
+                res  = 0; goto end;
+            }
+        } else {
+            if (fabs(agg[0].SumF64 - fsum) > 1e-6 || agg[0].MinF64 != fmn || agg[0].MaxF64 != fmx) {
+                assert(0 && "Floating-point aggregate incorrect");
+                res  = 0; goto end;
+            }
+        }
+        /* the same values, restricted to a selection */
+        TableAggregate(&agg[1], &desc, &col[c], &sel, 0, ~0U);
+        for (i = 0, sum = 0, fsum = 0; i < n; ++i) {
+            uint8_t *p = Table_GetStreamElement(uint8_t, &desc, si, indices[i]) + fo;
+            switch (col[c].ColumnType) {
+                case TABLE_COLUMN_TYPE_INT32  : sum += *(int32_t*) p; break;
+                case TABLE_COLUMN_TYPE_INT64  : sum += *(int64_t*) p; break;
+                case TABLE_COLUMN_TYPE_FLOAT32: fsum+= *(float  *) p; break;
+                case TABLE_COLUMN_TYPE_FLOAT64: fsum+= *(double *) p; break;
+            }
+        }
+        if (agg[1].Count != n || agg[1].SumI64 != sum || fabs(agg[1].SumF64 - fsum) > 1e-6) {
+            assert(0 && "Selection aggregate incorrect");
+            res  = 0; goto end;
+        }
+    }
+    /* values are in [-1000, 1002], so each bin of width 250 holds about 250 values */
+    if (TableHistogram(bins, 8, -1000.0, 1000.0, &desc, &col[0], NULL, 0, ~0U) != 0) {
+        assert(0 && "TableHistogram failed");
+        res  = 0; goto end;
+    }
+    for (i = 0, n = 0; i < 8; ++i) {
+        n += bins[i];
+    }
+    if (n != C || bins[0] < 100 || bins[7] < 100) {
+        assert(0 && "Histogram incorrect");
+        res  = 0; goto end;
+    }
+    /* the packed and interleaved layouts of each type, over a range that clips values at both ends,
+     * must produce the same bins as the same values counted through a selection of every item */
+    for (i = 0; i < C; ++i) {
+        indices[i] = i;
+    }
+    sel.Count = C;
+    for (c = 0; c < 8; ++c) {
+        uint32_t  sbins[7] = {};
+        uint32_t  dbins[7] = {};
+        TableHistogram(dbins, 7, -500.0, 500.0, &desc, &col[c], NULL, 3, C - 2);
+        TableHistogram(sbins, 7, -500.0, 500.0, &desc, &col[c], &sel, 3, C - 2);
+        if (memcmp(dbins, sbins, sizeof(dbins)) != 0) {
+            assert(0 && "Histogram of packed column incorrect");
+            res  = 0; goto end;
+        }
+    }
+
+end:
+    TableDelete(&desc);
+    free(indices);
+    return res;
+#   undef  C
+}
+
+static int
+Test_EntityQuery
+(
+    void
+)
+{   /* create entities in several archetypes, run a query over the archetypes
+     * with a required component set, update components through the chunk 
+     * stream pointers, and ensure the updates are visible through the ids. */
+#   define C    3000
+    enum {
+        COMPONENT_POSITION = 0,
+        COMPONENT_VELOCITY = 1,
+        COMPONENT_HEALTH   = 2,
+        COMPONENT_FROZEN   = 3
+    };
+    typedef struct VEC3 {
+        float               X, Y, Z;
+    } VEC3;
+    ENTITY_ID               *ids =(ENTITY_ID   *) malloc(C * sizeof(ENTITY_ID));
+    ENTITY_CHUNK         *chunks =(ENTITY_CHUNK*) malloc(C * sizeof(ENTITY_CHUNK));
+    ENTITY_WORLD           world = {};
+    ENTITY_WORLD_INIT       init = {};
+    ENTITY_QUERY           query = {};
+    ENTITY_CHUNK           chunk;
+    COMPONENT_MASK       masks[4]= {
+        ComponentMask_Make(COMPONENT_POSITION) | ComponentMask_Make(COMPONENT_VELOCITY),
+        ComponentMask_Make(COMPONENT_POSITION) | ComponentMask_Make(COMPONENT_VELOCITY) | ComponentMask_Make(COMPONENT_HEALTH),
+        ComponentMask_Make(COMPONENT_POSITION) | ComponentMask_Make(COMPONENT_VELOCITY) | ComponentMask_Make(COMPONENT_FROZEN),
+        ComponentMask_Make(COMPONENT_POSITION)
+    };
+    uint32_t          i, j, k, n;
+    uint32_t              expect = 0;
+    int                      res = 1;
+
+    init.ArchetypeCapacity = 16;
+    init.TableCapacity     = C;
+    if (EntityWorldCreate(&world, &init) != 0) {
+        assert(0 && "EntityWorldCreate failed");
+        free(chunks); free(ids);
+        return 0;
+    }
+    EntityRegisterComponent(&world, COMPONENT_POSITION, sizeof(VEC3) , PIL_ALIGN_OF(VEC3));
+    EntityRegisterComponent(&world, COMPONENT_VELOCITY, sizeof(VEC3) , PIL_ALIGN_OF(VEC3));
+    EntityRegisterComponent(&world, COMPONENT_HEALTH  , sizeof(int32_t), PIL_ALIGN_OF(int32_t));
+    EntityRegisterComponent(&world, COMPONENT_FROZEN  , 0, 1);
+    for (i = 0; i < C; ++i) {
+        if ((ids[i] = EntityCreate(&chunk, &world, masks[i % 4])) == ENTITY_ID_INVALID) {
+            assert(0 && "EntityCreate failed");
+            res  = 0; goto end;
+        }
+        EntityChunk_GetComponent(VEC3, &chunk, COMPONENT_POSITION)->X = (float) i;
+        if (masks[i % 4] & ComponentMask_Make(COMPONENT_VELOCITY)) {
+            EntityChunk_GetComponent(VEC3, &chunk, COMPONENT_VELOCITY)->X = 1.0f;
+        }
+    }
+    if (world.ArchetypeCount != 4) {
+        assert(0 && "Unexpected archetype count");
+        res  = 0; goto end;
+    }
+    for (i = 0; i < C; i += 5) {
+        EntityDelete(&world, ids[i]);
+    }
+    for (i = 0; i < C; ++i) {
+        if ((i % 5) != 0 && (i % 4) <= 1) {
+            expect++;
+        }
+    }
+    query.RequireMask = ComponentMask_Make(COMPONENT_POSITION) | ComponentMask_Make(COMPONENT_VELOCITY);
+    query.ExcludeMask = ComponentMask_Make(COMPONENT_FROZEN);
+    if (EntityQueryCount(&world, &query) != expect) {
+        assert(0 && "EntityQueryCount incorrect");
+        res  = 0; goto end;
+    }
+    n = EntityQueryChunks(chunks, C, &world, &query, 64);
+    for (i = 0, k = 0; i < n; ++i) {
+        VEC3 *pos = EntityChunk_GetComponent(VEC3, &chunks[i], COMPONENT_POSITION);
+        VEC3 *vel = EntityChunk_GetComponent(VEC3, &chunks[i], COMPONENT_VELOCITY);
+        for (j = 0; j < chunks[i].Count; ++j) {
+            pos[j].X += vel[j].X;
+        }
+        k += chunks[i].Count;
+    }
+    if (k != expect) {
+        assert(0 && "EntityQueryChunks count incorrect");
+        res  = 0; goto end;
+    }
+    for (i = 0; i < C; ++i) {
+        VEC3 *pos;
+        if ((i % 5) == 0) {
+            continue; /* deleted */
+        }
+        pos = (VEC3*) EntityGetComponent(&world, ids[i], COMPONENT_POSITION);
+        if (pos == NULL || pos->X != (float) i + (((i % 4) <= 1) ? 1.0f : 0.0f)) {
+            assert(0 && "Component update not visible");
+            res  = 0; goto end;
+        }
+        if (EntityGetComponent(&world, ids[i], COMPONENT_FROZEN) != NULL) {
+            assert(0 && "Tag component has data");
+            res  = 0; goto end;
+        }
+    }
+
+end:
+    EntityWorldDelete(&world);
+    free(chunks);
+    free(ids);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableJoin
+(
+    void
+)
+{   /* create an "all" table and an "active" table sharing its handle space,
+     * insert a subset of the live handles and some stale handles into the 
+     * active table, and join the two tables in both argument orders. */
+#   define C    20000
+#   define B    100
+    HANDLE_BITS      *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    uint32_t     left_indices[B];
+    uint32_t    right_indices[B];
+    CONTAINER             all;
+    CONTAINER          active;
+    TABLE_JOIN           join = {};
+    uint32_t       i, n, pass;
+    uint32_t           expect = 0;
+    uint32_t            total;
+    int                   res = 1;
+
+    CreateContainer(&all   , C, C, TABLE_FLAGS_NONE);
+    CreateContainer(&active, C, C, TABLE_FLAGS_NONE);
+    for (i = 0; i < C; ++i) {
+        handles[i] = ContainerPush(&all, (int) i);
+    }
+    for (i = 0; i < C; i += 7) {
+        TableDeleteId(&all.TableDesc, handles[i]);
+    }
+    for (i = 0; i < C; ++i) {
+        uint32_t ix;
+        if ((i % 7) == 0) {
+            /* insert the stale handles of deleted items */
+            if (TableInsertId(&ix, &active.TableDesc, handles[i]) != 0) {
+                assert(0 && "TableInsertId failed for stale handle");
+                res = 0; goto end;
+            }
+            Container_ItemStreamAt(&active, ix)->Value = -1;
+        } else if ((i % 3) == 0) {
+            if (TableInsertId(&ix, &active.TableDesc, handles[i]) != 0) {
+                assert(0 && "TableInsertId failed");
+                res = 0; goto end;
+            }
+            Container_ItemStreamAt(&active, ix)->Value = (int) i;
+            expect++;
+        }
+    }
+    /* re-creating items reuses the slots of the deleted items with a new generation */
+    for (i = 0; i < C; i += 14) {
+        uint32_t ix;
+        TableCreateId(&ix, &all.TableDesc);
+        Container_ItemStreamAt(&all, ix)->Value = -2;
+    }
+    if (Container_GetCount(&active) <= expect) {
+        assert(0 && "Active table count incorrect");
+        res = 0; goto end;
+    }
+    for (pass = 0; pass < 2; ++pass) {
+        TABLE_DESC *left  = pass == 0 ? &active.TableDesc : &all.TableDesc;
+        TABLE_DESC *right = pass == 0 ? &all.TableDesc : &active.TableDesc;
+        join.LeftIndices  = left_indices;
+        join.RightIndices = right_indices;
+        join.Capacity     = B;
+        join.Cursor       = 0;
+        total             = 0;
+        while ((n = TableJoin(&join, left, right)) != 0) {
+            for (i = 0; i < n; ++i) {
+                ITEM *l = Table_GetStreamElement(ITEM, left , CONTAINER_ITEM_STREAM_INDEX, left_indices [i]);
+                ITEM *r = Table_GetStreamElement(ITEM, right, CONTAINER_ITEM_STREAM_INDEX, right_indices[i]);
+                if (l->Value != r->Value || l->Value < 0) {
+                    assert(0 && "TableJoin produced mismatched pair");
+                    res = 0; goto end;
+                }
+            }
+            total += n;
+        }
+        if (total != expect) {
+            assert(0 && "TableJoin pair count incorrect");
+            res = 0; goto end;
+        }
+    }
+
+end:
+    DeleteContainer(&active);
+    DeleteContainer(&all);
+    free(handles);
+    return res;
+#   undef  B
+#   undef  C
+}
+
+static void
+InitStreamFromHandle
+(
+    void              *records, 
+    HANDLE_BITS const *handles, 
+    uint32_t             count, 
+    uint32_t      element_size, 
+    void              *context
+)
+{
+    uint32_t *values = (uint32_t*) records;
+    uint32_t       i;
+    (void) element_size;
+    (void) context;
+    for (i = 0; i < count; ++i) {
+        values[i] = handles[i];
+    }
+}
+
+static int
+Test_TableAddStream
+(
+    void
+)
+{   /* create a table with a single stream, attach two streams at runtime, 
+     * ensure existing records are initialized and new items can be stored 
+     * in all streams, then remove a stream and check the remaining data. */
+#   define C    5000
+    HANDLE_BITS      *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    TABLE_DESC           desc = {};
+    TABLE_INDEX         index = {};
+    TABLE_DATA          data0 = {};
+    TABLE_DATA          data1 = {};
+    TABLE_DATA          data2 = {};
+    TABLE_DATA    *streams[3] = { &data0, nullptr, nullptr };
+    TABLE_INIT           init = {};
+    TABLE_DATA_STREAM_DESC sd0= { &data0, sizeof(ITEM), 0 };
+    TABLE_DATA_STREAM_DESC sd1= { &data1, sizeof(double), 0 };
+    TABLE_DATA_STREAM_DESC sd2= { &data2, sizeof(uint32_t), 0 };
+    double     default_value  = 0.5;
+    uint32_t   stream1, stream2;
+    uint32_t                i;
+    int                   res = 1;
+
+    init.Index          = &index;
+    init.Streams        = &sd0;
+    init.StreamCount    = 1;
+    init.TableCapacity  = C;
+    init.InitialCommit  = 0;
+    if (TableCreate(&init) != 0) {
+        assert(0 && "TableCreate failed");
+        free(handles);
+        return 0;
+    }
+    desc.Index       = &index;
+    desc.Streams     = streams;
+    desc.StreamCount = 1;
+    for (i = 0; i < C / 2; ++i) {
+        uint32_t ix;
+        TableEnsure(&desc, i + 1, TABLE_CHUNK_SIZE);
+        handles[i] = TableCreateId(&ix, &desc);
+        Table_GetStreamElement(ITEM, &desc, 0, ix)->Value = (int) i;
+    }
+    if (TableAddStream(&stream1, &desc, 3, &sd1, &default_value, nullptr, nullptr) != 0 || stream1 != 1) {
+        assert(0 && "TableAddStream with default value failed");
+        res = 0; goto end;
+    }
+    if (TableAddStream(&stream2, &desc, 3, &sd2, nullptr, InitStreamFromHandle, nullptr) != 0 || stream2 != 2) {
+        assert(0 && "TableAddStream with callback failed");
+        res = 0; goto end;
+    }
+    for (i = 0; i < C / 2; ++i) {
+        if (*Table_GetStreamElement(double, &desc, stream1, i) != default_value) {
+            assert(0 && "Default value not applied");
+            res = 0; goto end;
+        }
+        if (*Table_GetStreamElement(uint32_t, &desc, stream2, i) != Table_GetHandle(&desc, i)) {
+            assert(0 && "Init callback not applied");
+            res = 0; goto end;
+        }
+    }
+    for (i = C / 2; i < C; ++i) {
+        uint32_t ix;
+        if (TableEnsure(&desc, i + 1, TABLE_CHUNK_SIZE) != 0) {
+            assert(0 && "TableEnsure failed after TableAddStream");
+            res = 0; goto end;
+        }
+        handles[i] = TableCreateId(&ix, &desc);
+        Table_GetStreamElement(ITEM, &desc, 0, ix)->Value = (int) i;
+       *Table_GetStreamElement(double  , &desc, stream1, ix) = (double) i;
+       *Table_GetStreamElement(uint32_t, &desc, stream2, ix) = handles[i];
+    }
+    for (i = 0; i < C; i += 3) {
+        TableDeleteId(&desc, handles[i]);
+    }
+    if (TableRemoveStream(&desc, stream1) != 0 || desc.StreamCount != 2 || data1.StorageBuffer != nullptr) {
+        assert(0 && "TableRemoveStream failed");
+        res = 0; goto end;
+    }
+    for (i = 0; i < Table_GetCount(&desc); ++i) {
+        uint32_t value = *Table_GetStreamElement(uint32_t, &desc, 1, i);
+        int       item = Table_GetStreamElement(ITEM, &desc, 0, i)->Value;
+        if (value != Table_GetHandle(&desc, i) || handles[item] != value) {
+            assert(0 && "Stream data incorrect after TableRemoveStream");
+            res = 0; goto end;
+        }
+    }
+
+end:
+    TableDelete(&desc);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableJournal
+(
+    void
+)
+{   /* journal a series of creates, writes and deletes applied to one table,
+     * replay the journal file onto an identical empty table, and ensure the
+     * tables have the same items. then replay a journal with a torn tail. */
+#   define C    3000
+    char_native_t         path[] = L"test_table.journal";
+    HANDLE_BITS         *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    HANDLE_BITS      *delete_ids =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    uint8_t           *file_data = NULL;
+    CONTAINER                  a;
+    CONTAINER                  b;
+    CONTAINER                  t;
+    TABLE_JOURNAL        journal = {};
+    TABLE_JOURNAL_INIT     jinit = {};
+    IO_CREATE_DATA         cdata = {};
+    IO_CREATE_RESULT        cres = {};
+    IO_READ_DATA           rdata = {};
+    IO_READ_RESULT          rres = {};
+    IO_CLOSE_DATA          xdata = {};
+    IO_CLOSE_RESULT         xres = {};
+    uint32_t           file_size;
+    uint32_t        delete_count = 0;
+    uint32_t                used;
+    uint32_t                   i;
+    int                    value;
+    int                      res = 1;
+
+    CreateContainer(&a, C, 0, TABLE_FLAGS_NONE);
+    CreateContainer(&b, C, 0, TABLE_FLAGS_NONE);
+    CreateContainer(&t, C, 0, TABLE_FLAGS_NONE);
+    cdata.Path      = path;
+    cdata.OpenHints = FILE_OPEN_HINT_FLAG_READ | FILE_OPEN_HINT_FLAG_WRITE | FILE_OPEN_HINT_FLAG_TEMPORARY;
+    if (FileCreate(&cres, &cdata) != 0) {
+        assert(0 && "FileCreate failed");
+        res = 0; goto end;
+    }
+    jinit.Journal      = &journal;
+    jinit.File         = cres.File;
+    jinit.BufferSize   = TABLE_JOURNAL_MIN_BUFFER_SIZE;
+    jinit.SyncInterval = 4;
+    if (TableJournalCreate(&jinit) != 0) {
+        assert(0 && "TableJournalCreate failed");
+        res = 0; goto end;
+    }
+    a.TableDesc.Journal = &journal;
+    for (i = 0; i < C; ++i) {
+        value      = (int)(i * 3);
+        handles[i] = ContainerPush(&a, 0);
+        TableJournalWrite(&a.TableDesc, handles[i], CONTAINER_ITEM_STREAM_INDEX, PIL_OffsetOf(ITEM, Value), &value, sizeof(int));
+        if ((i % 500) == 499) {
+            TableJournalCommit(&journal, 0);
+        }
+    }
+    for (i = 0; i < C; i += 5) {
+        TableDeleteId(&a.TableDesc, handles[i]);
+    }
+    for (i = 1; i < C; i += 5) {
+        delete_ids[delete_count++] = handles[i];
+    }
+    TableDeleteIds(&a.TableDesc, delete_ids, delete_count);
+    for (i = 0; i < 100; ++i) {
+        HANDLE_BITS bits = ContainerPush(&a, 0);
+        value = -(int) i;
+        TableJournalWrite(&a.TableDesc, bits, CONTAINER_ITEM_STREAM_INDEX, PIL_OffsetOf(ITEM, Value), &value, sizeof(int));
+    }
+    if (TableJournalCommit(&journal, 1) != 0 || TableJournal_HasError(&journal)) {
+        assert(0 && "TableJournalCommit failed");
+        res = 0; goto end;
+    }
+    a.TableDesc.Journal = nullptr;
+
+    file_size        = (uint32_t) journal.FileOffset;
+    file_data        = (uint8_t*) malloc(file_size);
+    rdata.File       = cres.File;
+    rdata.Destination= file_data;
+    rdata.ReadOffset = 0;
+    rdata.ReadAmount = file_size;
+    if (FileRead(&rres, &rdata) != 0 || rres.TransferAmount != file_size) {
+        assert(0 && "FileRead failed");
+        res = 0; goto end;
+    }
+    if (TableJournalReplay(&used, &b.TableDesc, file_data, file_size) != 0 || used != file_size) {
+        assert(0 && "TableJournalReplay failed");
+        res = 0; goto end;
+    }
+    if (Container_GetCount(&a) != Container_GetCount(&b)) {
+        assert(0 && "Replayed table count incorrect");
+        res = 0; goto end;
+    }
+    for (i = 0; i < Container_GetCount(&a); ++i) {
+        if (Container_HandleAt(&a, i) != Container_HandleAt(&b, i) || Container_ItemStreamAt(&a, i)->Value != Container_ItemStreamAt(&b, i)->Value) {
+            assert(0 && "Replayed table data incorrect");
+            res = 0; goto end;
+        }
+    }
+    /* a group cut short by a crash is not replayed */
+    if (TableJournalReplay(&used, &t.TableDesc, file_data, file_size - 3) != 0 || used >= file_size - 3 || Container_GetCount(&t) >= Container_GetCount(&a)) {
+        assert(0 && "TableJournalReplay applied a torn group");
+        res = 0; goto end;
+    }
+
+end:
+    TableJournalDelete(&journal);
+    if (cres.Success) {
+        xdata.File = cres.File;
+        FileClose(&xres, &xdata);
+    }
+    DeleteContainer(&t);
+    DeleteContainer(&b);
+    DeleteContainer(&a);
+    free(file_data);
+    free(delete_ids);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+/* @summary Read the committed contents of a journal file and replay them onto a table.
+ * @return Zero if the journal was read and completely replayed, or non-zero if an error occurred.
+ */
+static int
+ReplayJournalFile
+(
+    TABLE_DESC        *table, 
+    TABLE_JOURNAL   *journal
+)
+{
+    IO_READ_DATA     rdata = {};
+    IO_READ_RESULT    rres = {};
+    uint32_t     file_size = (uint32_t) journal->FileOffset;
+    uint8_t     *file_data = (uint8_t*) malloc(file_size);
+    uint32_t          used = 0;
+    int             result = -1;
+
+    rdata.File       = journal->File;
+    rdata.Destination= file_data;
+    rdata.ReadOffset = 0;
+    rdata.ReadAmount = file_size;
+    if (FileRead(&rres, &rdata) == 0 && rres.TransferAmount == file_size) {
+        if (TableJournalReplay(&used, table, file_data, file_size) == 0 && used == file_size) {
+            result = 0;
+        }
+    }
+    free(file_data);
+    return result;
+}
+
+static int
+Test_TableJournalKeyed
+(
+    void
+)
+{   /* journal keyed creates applied to a table with a key index, and inserts
+     * and removes applied to a table sharing its handles. replay each journal
+     * and ensure the keys, key index and handles are restored. */
+#   define C    200
+    char_native_t         path[] = L"test_table_keyed.journal";
+    HANDLE_BITS         *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    CONTAINER                  a;
+    CONTAINER                  b;
+    TABLE_KEY_INDEX        akidx = {};
+    TABLE_KEY_INDEX        bkidx = {};
+    TABLE_KEY_INDEX_INIT   kinit = {};
+    TABLE_JOURNAL        journal = {};
+    TABLE_JOURNAL_INIT     jinit = {};
+    IO_CREATE_DATA         cdata = {};
+    IO_CREATE_RESULT        cres = {};
+    IO_CLOSE_DATA          xdata = {};
+    IO_CLOSE_RESULT         xres = {};
+    uint32_t                  ix;
+    uint32_t                i, n;
+    int                      res = 1;
+
+    CreateContainer(&a, C, 0, TABLE_FLAGS_NONE);
+    CreateContainer(&b, C, 0, TABLE_FLAGS_NONE);
+    kinit.StreamIndex   = CONTAINER_ITEM_STREAM_INDEX;
+    kinit.KeyOffset     = PIL_OffsetOf(ITEM, Value);
+    kinit.KeySize       = sizeof(uint32_t);
+    kinit.InitialCommit = 0;
+    kinit.KeyIndex      = &akidx;
+    if (TableKeyIndexCreate(&kinit) != 0) {
+        assert(0 && "TableKeyIndexCreate failed");
+        res = 0; goto end;
+    }
+    kinit.KeyIndex      = &bkidx;
+    if (TableKeyIndexCreate(&kinit) != 0) {
+        assert(0 && "TableKeyIndexCreate failed");
+        res = 0; goto end;
+    }
+    a.TableDesc.KeyIndex = &akidx;
+    b.TableDesc.KeyIndex = &bkidx;
+    cdata.Path      = path;
+    cdata.OpenHints = FILE_OPEN_HINT_FLAG_READ | FILE_OPEN_HINT_FLAG_WRITE | FILE_OPEN_HINT_FLAG_TEMPORARY;
+    if (FileCreate(&cres, &cdata) != 0) {
+        assert(0 && "FileCreate failed");
+        res = 0; goto end;
+    }
+    jinit.Journal      = &journal;
+    jinit.File         = cres.File;
+    jinit.BufferSize   = TABLE_JOURNAL_MIN_BUFFER_SIZE;
+    jinit.SyncInterval = 0;
+    if (TableJournalCreate(&jinit) != 0) {
+        assert(0 && "TableJournalCreate failed");
+        res = 0; goto end;
+    }
+    a.TableDesc.Journal = &journal;
+    for (i = 0; i < C; ++i) {
+        if (TableEnsure(&a.TableDesc, i + 1, TABLE_CHUNK_SIZE) != 0) {
+            assert(0 && "TableEnsure failed");
+            res = 0; goto end;
+        }
+        if ((handles[i] = TableCreateKeyedId(&ix, &a.TableDesc, 1000 + i)) == HANDLE_BITS_INVALID) {
+            assert(0 && "TableCreateKeyedId failed");
+            res = 0; goto end;
+        }
+    }
+    for (i = 0; i < C; i += 4) {
+        TableDeleteId(&a.TableDesc, handles[i]);
+    }
+    a.TableDesc.Journal = nullptr;
+    if (TableJournalCommit(&journal, 1) != 0 || ReplayJournalFile(&b.TableDesc, &journal) != 0) {
+        assert(0 && "TableJournalReplay failed (keyed)");
+        res = 0; goto end;
+    }
+    if (Container_GetCount(&a) != Container_GetCount(&b) || bkidx.ItemCount != akidx.ItemCount) {
+        assert(0 && "Replayed keyed table count incorrect");
+        res = 0; goto end;
+    }
+    for (i = 0; i < C; ++i) {
+        HANDLE_BITS h = TableResolveKey(&ix, &b.TableDesc, &bkidx, 1000 + i);
+        if (h != ((i % 4) == 0 ? HANDLE_BITS_INVALID : handles[i]) || (h != HANDLE_BITS_INVALID && Container_ItemStreamAt(&b, ix)->Value != (int)(1000 + i))) {
+            assert(0 && "Replayed key did not resolve to the expected item");
+            res = 0; goto end;
+        }
+    }
+
+    /* start a new journal on the same file for a table that shares the handles of a */
+    TableJournalDelete(&journal);
+    if (TableJournalCreate(&jinit) != 0) {
+        assert(0 && "TableJournalCreate failed");
+        res = 0; goto end;
+    }
+    a.TableDesc.KeyIndex = nullptr;
+    b.TableDesc.KeyIndex = nullptr;
+    DeleteContainer(&b);
+    DeleteContainer(&a);
+    CreateContainer(&a, C, 0, TABLE_FLAGS_NONE);
+    CreateContainer(&b, C, 0, TABLE_FLAGS_NONE);
+    a.TableDesc.Journal = &journal;
+    for (i = 0, n = 0; i < C; ++i) {
+        if ((i % 4) == 0) {
+            continue;
+        }
+        if (TableEnsure(&a.TableDesc, ++n, TABLE_CHUNK_SIZE) != 0 || TableInsertId(&ix, &a.TableDesc, handles[i]) != 0) {
+            assert(0 && "TableInsertId failed");
+            res = 0; goto end;
+        }
+    }
+    for (i = 1; i < C; i += 4) {
+        TableRemoveId(&a.TableDesc, handles[i]);
+    }
+    TableRemoveAllIds(&a.TableDesc);
+    for (i = 2; i < C; i += 4) {
+        if (TableInsertId(&ix, &a.TableDesc, handles[i]) != 0) {
+            assert(0 && "TableInsertId failed");
+            res = 0; goto end;
+        }
+    }
+    TableRemoveId(&a.TableDesc, handles[2]);
+    a.TableDesc.Journal = nullptr;
+    if (TableJournalCommit(&journal, 1) != 0 || ReplayJournalFile(&b.TableDesc, &journal) != 0) {
+        assert(0 && "TableJournalReplay failed (insert/remove)");
+        res = 0; goto end;
+    }
+    if (Container_GetCount(&a) != Container_GetCount(&b) || Container_GetCount(&b) != (C / 4) - 1) {
+        assert(0 && "Replayed table count incorrect (insert/remove)");
+        res = 0; goto end;
+    }
+    for (i = 0; i < Container_GetCount(&a); ++i) {
+        if (Container_HandleAt(&a, i) != Container_HandleAt(&b, i)) {
+            assert(0 && "Replayed handles incorrect (insert/remove)");
+            res = 0; goto end;
+        }
+    }
+
+end:
+    TableJournalDelete(&journal);
+    if (cres.Success) {
+        xdata.File = cres.File;
+        FileClose(&xres, &xdata);
+    }
+    TableKeyIndexDelete(&bkidx);
+    TableKeyIndexDelete(&akidx);
+    DeleteContainer(&b);
+    DeleteContainer(&a);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableDelta
+(
+    void
+)
+{   /* mutate a source table over several epochs, replicate each epoch via
+     * a shadow table into a replica, and ensure the replica has the same 
+     * handles and data as the source, that small changes are small, and 
+     * that the replica can create items after the table shrinks. */
+#   define C    4000
+    HANDLE_BITS         *handles =(HANDLE_BITS*) malloc(C * sizeof(HANDLE_BITS));
+    uint8_t              *buffer = NULL;
+    CONTAINER                src;
+    CONTAINER             shadow;
+    CONTAINER            replica;
+    uint64_t        shadow_epoch = 0;
+    uint64_t       replica_epoch = 0;
+    uint64_t               epoch;
+    uint32_t          live_count = 0;
+    uint32_t                i, j;
+    size_t                  size;
+    int                      res = 1;
+
+    CreateContainer(&src    , C, 0, TABLE_FLAGS_NONE);
+    CreateContainer(&shadow , C, 0, TABLE_FLAGS_NONE);
+    CreateContainer(&replica, C, 0, TABLE_FLAG_PAGED_SPARSE_INDEX);
+    buffer = (uint8_t*) malloc(TableDeltaGetMaxSize(&src.TableDesc) + (C * 64));
+    for (epoch = 1; epoch <= 8; ++epoch) {
+        if (epoch == 1) {
+            for (i = 0; i < C / 2; ++i) {
+                handles[live_count++] = ContainerPush(&src, (int) i);
+            }
+        } else if (epoch == 5) {
+            /* an epoch with no changes */
+        } else if (epoch == 6) {
+            /* an epoch that shrinks the table */
+            for (i = 0; i < 50; ++i) {
+                j = (uint32_t)((i * 104729) % live_count);
+                TableDeleteId(&src.TableDesc, handles[j]);
+                handles[j] = handles[--live_count];
+            }
+        } else {
+            for (i = 0; i < 10 && live_count > 0; ++i) {
+                j = (uint32_t)((epoch * 7919 + i * 104729) % live_count);
+                TableDeleteId(&src.TableDesc, handles[j]);
+                handles[j] = handles[--live_count];
+            }
+            for (i = 0; i < 20; ++i) {
+                handles[live_count++] = ContainerPush(&src, (int)(epoch * 1000 + i));
+            }
+            for (i = 0; i < live_count; i += 97) {
+                uint32_t ix;
+                TableResolve(&ix, &src.TableDesc, handles[i]);
+                Container_ItemStreamAt(&src, ix)->Value += 1;
+            }
+        }
+        size = TableDeltaEncode(buffer, TableDeltaGetMaxSize(&src.TableDesc), &src.TableDesc, &shadow.TableDesc, shadow_epoch, epoch);
+        if (size == 0) {
+            assert(0 && "TableDeltaEncode failed");
+            res = 0; goto end;
+        }
+        if (epoch > 1 && epoch != 6 && size > 4096) {
+            assert(0 && "TableDeltaEncode delta too large");
+            res = 0; goto end;
+        }
+        if (epoch == 5 && ((TABLE_DELTA_HEADER*) buffer)->ChangeCount != 0) {
+            assert(0 && "TableDeltaEncode reported changes for an unchanged table");
+            res = 0; goto end;
+        }
+        if (TableDeltaApply(&shadow.TableDesc, &shadow_epoch, buffer, size) != 0 || TableDeltaApply(&replica.TableDesc, &replica_epoch, buffer, size) != 0) {
+            assert(0 && "TableDeltaApply failed");
+            res = 0; goto end;
+        }
+        if (VerifyTableIndex(&shadow.TableIndex) == 0 || VerifyTableIndex(&replica.TableIndex) == 0) {
+            assert(0 && "TableDeltaApply left an inconsistent table index");
+            res = 0; goto end;
+        }
+        if (TableDeltaApply(&replica.TableDesc, &replica_epoch, buffer, size) == 0) {
+            assert(0 && "TableDeltaApply accepted a delta for the wrong epoch");
+            res = 0; goto end;
+        }
+        if (Container_GetCount(&replica) != Container_GetCount(&src) || replica_epoch != epoch) {
+            assert(0 && "Replica count incorrect");
+            res = 0; goto end;
+        }
+        for (i = 0; i < Container_GetCount(&src); ++i) {
+            if (Container_HandleAt(&src, i) != Container_HandleAt(&replica, i) || Container_ItemStreamAt(&src, i)->Value != Container_ItemStreamAt(&replica, i)->Value) {
+                assert(0 && "Replica data incorrect");
+                res = 0; goto end;
+            }
+        }
+        for (i = 0; i < live_count; ++i) {
+            uint32_t ix;
+            if (TableResolve(&ix, &replica.TableDesc, handles[i]) == 0 || Container_HandleAt(&src, ix) != handles[i]) {
+                assert(0 && "Replica handle does not resolve");
+                res = 0; goto end;
+            }
+        }
+    }
+    for (j = 0; j < 3; ++j) {
+        /* hand-build deltas that replace the last two handles with a repeated 
+         * handle, the handle of an unchanged slot, or an out-of-range handle, 
+         * and ensure each is rejected without modifying the replica. */
+        TABLE_DELTA_HEADER header = {};
+        uint8_t              *pos = buffer + sizeof(TABLE_DELTA_HEADER);
+        uint32_t            count = Container_GetCount(&replica);
+        uint32_t       elem_size;
+        HANDLE_BITS       bad[2];
+        bad[0] = HANDLE_FLAG_MASK_PACKED | ((C - 1) << HANDLE_INDEX_SHIFT);
+        bad[1] = j == 0 ? bad[0] : (j == 1 ? Container_HandleAt(&replica, 0) : HANDLE_FLAG_MASK_PACKED | ((C + 1) << HANDLE_INDEX_SHIFT));
+        for (i = 0; i < replica.TableDesc.StreamCount; ++i) {
+            elem_size = replica.TableDesc.Streams[i]->ElementSize;
+            memcpy(pos, &elem_size, sizeof(uint32_t)); pos += sizeof(uint32_t);
+        }
+        *pos++ = (uint8_t)(0x80 | ((count - 2) & 0x7F)); *pos++ = (uint8_t)((count - 2) >> 7); *pos++ = 2;
+        memcpy(pos, bad, sizeof(bad)); pos += sizeof(bad);
+        for (i = 0; i < replica.TableDesc.StreamCount; ++i) {
+            *pos++ = (uint8_t)(0x80 | (count & 0x7F)); *pos++ = (uint8_t)(count >> 7); *pos++ = 0;
+        }
+        header.Magic         = TABLE_DELTA_MAGIC;
+        header.StreamCount   = replica.TableDesc.StreamCount;
+        header.BaseEpoch     = replica_epoch;
+        header.Epoch         = replica_epoch + 1;
+        header.ItemCount     = count;
+        header.BaseItemCount = count;
+        header.DataSize      = (uint32_t)(pos - buffer);
+        memcpy(buffer, &header, sizeof(TABLE_DELTA_HEADER));
+        if (TableDeltaApply(&replica.TableDesc, &replica_epoch, buffer, header.DataSize) == 0) {
+            assert(0 && "TableDeltaApply accepted a malformed delta");
+            res = 0; goto end;
+        }
+        for (i = 0; i < count; ++i) {
+            uint32_t ix;
+            if (Container_HandleAt(&replica, i) != Container_HandleAt(&src, i) || TableResolve(&ix, &replica.TableDesc, Container_HandleAt(&src, i)) == 0 || ix != i) {
+                assert(0 && "TableDeltaApply modified the replica before rejecting a delta");
+                res = 0; goto end;
+            }
+        }
+    }
+    /* items created on the replica reuse the sparse indices freed by the 
+     * deltas without disturbing the replicated items */
+    for (i = 0; i < 100; ++i) {
+        ContainerPush(&replica, -1);
+    }
+    if (VerifyTableIndex(&replica.TableIndex) == 0) {
+        assert(0 && "TableCreateId on the replica left an inconsistent table index");
+        res = 0; goto end;
+    }
+    for (i = 0; i < live_count; ++i) {
+        uint32_t ix, jx;
+        if (TableResolve(&ix, &replica.TableDesc, handles[i]) == 0 || TableResolve(&jx, &src.TableDesc, handles[i]) == 0 || Container_ItemStreamAt(&replica, ix)->Value != Container_ItemStreamAt(&src, jx)->Value) {
+            assert(0 && "TableCreateId on the replica reused a live handle");
+            res = 0; goto end;
+        }
+    }
+
+end:
+    DeleteContainer(&replica);
+    DeleteContainer(&shadow);
+    DeleteContainer(&src);
+    free(buffer);
+    free(handles);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableSnapshot
+(
+    void
+)
+{   /* publish versions of a table while readers hold older versions, and
+     * ensure that each version is unaffected by later changes, that the
+     * unchanged chunks are shared, and that released versions are reused. */
+#   define C    20000
+    TABLE_SNAPSHOT_SET_INIT init;
+    TABLE_SNAPSHOT_SET       set;
+    TABLE_SNAPSHOT           *s1 = NULL;
+    TABLE_SNAPSHOT           *s2 = NULL;
+    TABLE_SNAPSHOT           *s3 = NULL;
+    CONTAINER                  c;
+    HANDLE_BITS          deleted;
+    uint32_t                  ix;
+    uint32_t                   i;
+    int                      res = 1;
+
+    CreateContainer(&c, C, 0, TABLE_FLAG_PAGED_SPARSE_INDEX);
+    for (i = 0; i < C; ++i) {
+        ContainerPush(&c, (int) i);
+    }
+    init.SnapshotSet  = &set;
+    init.Table        = &c.TableDesc;
+    init.VersionCount = 3;
+    if (TableSnapshotSetCreate(&init) != 0) {
+        assert(0 && "TableSnapshotSetCreate failed");
+        DeleteContainer(&c);
+        return 0;
+    }
+    if (TableSnapshotAcquire(&set) != NULL) {
+        assert(0 && "TableSnapshotAcquire returned a version before any was published");
+        res = 0; goto end;
+    }
+    if (TableSnapshotPublish(&set) != 0 || (s1 = TableSnapshotAcquire(&set)) == NULL) {
+        assert(0 && "TableSnapshotPublish failed");
+        res = 0; goto end;
+    }
+    /* modify the first item and delete the second, which moves the last item into its slot */
+    Container_ItemStreamAt(&c, 0)->Value = -1;
+    deleted = Container_HandleAt(&c, 1);
+    TableDeleteId(&c.TableDesc, deleted);
+    if (TableSnapshotPublish(&set) != 0 || (s2 = TableSnapshotAcquire(&set)) == NULL) {
+        assert(0 && "TableSnapshotPublish failed");
+        res = 0; goto end;
+    }
+    if (TableSnapshot_GetCount(s1) != C || TableSnapshot_GetCount(s2) != C - 1 || TableSnapshot_GetEpoch(s2) <= TableSnapshot_GetEpoch(s1)) {
+        assert(0 && "Snapshot counts incorrect");
+        res = 0; goto end;
+    }
+    for (i = 0; i < C - 1; ++i) {
+        if (TableSnapshot_GetHandle(s2, i) != Container_HandleAt(&c, i) || TableSnapshot_GetStreamElement(ITEM, s2, 0, i)->Value != Container_ItemStreamAt(&c, i)->Value) {
+            assert(0 && "Snapshot data incorrect");
+            res = 0; goto end;
+        }
+        if (TableSnapshot_GetStreamElement(ITEM, s1, 0, i)->Value != (int) i) {
+            assert(0 && "Older snapshot was modified");
+            res = 0; goto end;
+        }
+    }
+    if (s1->Regions[TABLE_SNAPSHOT_REGION_STREAM].Chunks[1] != s2->Regions[TABLE_SNAPSHOT_REGION_STREAM].Chunks[1]) {
+        assert(0 && "Unchanged chunk was not shared");
+        res = 0; goto end;
+    }
+    if (TableSnapshotResolve(&ix, s1, deleted) == 0 || ix != 1 || TableSnapshotResolve(&ix, s2, deleted) != 0) {
+        assert(0 && "TableSnapshotResolve failed");
+        res = 0; goto end;
+    }
+    if (TableSnapshotResolve(&ix, s2, Container_HandleAt(&c, C - 2)) == 0 || ix != C - 2) {
+        assert(0 && "TableSnapshotResolve failed");
+        res = 0; goto end;
+    }
+    /* the third version is free; after publishing it, every version is current or held */
+    if (TableSnapshotPublish(&set) != 0 || TableSnapshotPublish(&set) == 0) {
+        assert(0 && "TableSnapshotPublish did not respect pinned versions");
+        res = 0; goto end;
+    }
+    TableSnapshotRelease(s1); s1 = NULL;
+    if (TableSnapshotPublish(&set) != 0 || (s3 = TableSnapshotAcquire(&set)) == NULL || TableSnapshot_GetCount(s3) != C - 1) {
+        assert(0 && "TableSnapshotPublish did not reuse a released version");
+        res = 0; goto end;
+    }
+    if (TableSnapshot_GetStreamElement(ITEM, s2, 0, 1)->Value != C - 1) {
+        assert(0 && "Held snapshot was modified");
+        res = 0; goto end;
+    }
+
+end:
+    TableSnapshotRelease(s3);
+    TableSnapshotRelease(s2);
+    TableSnapshotRelease(s1);
+    TableSnapshotSetDelete(&set);
+    DeleteContainer(&c);
+    return res;
+#   undef  C
+}
+
+static int
+Test_TableAdopt
+(
+    void
+)
+{   /* adopt a pre-filled record array into a new table, and ensure that the
+     * adopted items resolve and that the table can be modified and grown. */
+#   define N    100000
+#   define C   (N + 4096)
+    ITEM                   *storage = (ITEM*) HostMemoryAllocateHeap(NULL, (C * sizeof(ITEM)) + TABLE_STREAM_ALIGN_DEFAULT, TABLE_STREAM_ALIGN_DEFAULT);
+    HANDLE_BITS            *handles = (HANDLE_BITS*) malloc(N * sizeof(HANDLE_BITS));
+    void          *stream_storage[1]= { storage };
+    TABLE_INIT           table_init = {};
+    TABLE_DATA_STREAM_DESC  desc[1] = {};
+    CONTAINER                     c;
+    HANDLE_BITS                bits;
+    uint32_t                     ix;
+    uint32_t                      i;
+    int                         res = 1;
+
+    for (i = 0; i < N; ++i) {
+        storage[i].Value = (int) i;
+    }
+    desc[0].Data             = &c.ItemData;
+    desc[0].Size             = sizeof(ITEM);
+    table_init.Index         = &c.TableIndex;
+    table_init.Streams       = desc;
+    table_init.StreamCount   = 1;
+    table_init.TableCapacity = C;
+    table_init.TableFlags    = TABLE_FLAG_PAGED_SPARSE_INDEX;
+    if (TableAdopt(handles, &table_init, stream_storage, N) != 0) {
+        assert(0 && "TableAdopt failed");
+        HostMemoryFreeHeap(storage);
+        free(handles);
+        return 0;
+    }
+    c.TableStreams[0]       = &c.ItemData;
+    c.TableDesc.Index       = &c.TableIndex;
+    c.TableDesc.Streams     = c.TableStreams;
+    c.TableDesc.StreamCount = 1;
+    c.TableDesc.KeyIndex    = nullptr;
+    c.TableDesc.BlobHeap    = nullptr;
+    c.TableDesc.Journal     = nullptr;
+    if (Container_GetCount(&c) != N || Container_ItemStreamBegin(&c) != storage) {
+        assert(0 && "TableAdopt did not adopt the storage");
+        res = 0; goto end;
+    }
+    for (i = 0; i < N; ++i) {
+        if (TableResolve(&ix, &c.TableDesc, handles[i]) == 0 || ix != i || Container_HandleAt(&c, i) != handles[i]) {
+            assert(0 && "Adopted handle does not resolve");
+            res = 0; goto end;
+        }
+    }
+    /* deleted slots are recycled, and new items beyond the adopted count are written to the adopted storage */
+    TableDeleteId(&c.TableDesc, handles[10]);
+    for (i = 0; i < 2000; ++i) {
+        if ((bits = ContainerPush(&c, -(int) i)) == HANDLE_BITS_INVALID) {
+            assert(0 && "ContainerPush failed on an adopted table");
+            res = 0; goto end;
+        }
+        if (ContainerLookUp(&c, bits)->Value != -(int) i) {
+            assert(0 && "ContainerLookUp failed on an adopted table");
+            res = 0; goto end;
+        }
+    }
+    if (storage[N + 1998].Value != -1999 || storage[10].Value != N - 1) {
+        assert(0 && "Adopted storage contents incorrect");
+        res = 0; goto end;
+    }
+
+end:
+    DeleteContainer(&c);
+    if (storage[0].Value != 0) {
+        assert(0 && "TableDelete modified the adopted storage");
+        res = 0;
+    }
+    HostMemoryFreeHeap(storage);
+    free(handles);
+    return res;
+#   undef  C
+#   undef  N
+}
+
 int main
 (
     int    argc, 
@@ -321,6 +2094,21 @@ int main
     Test_Generation();
     Test_FullStateValidationOne();
     Test_FullStateValidationMany();
+    Test_PagedSparseIndex();
+    Test_StreamAlignment();
+    Test_KeyIndex();
+    Test_ChunkTable();
+    Test_BlobHeap();
+    Test_TableScan();
+    Test_TableAggregate();
+    Test_EntityQuery();
+    Test_TableJoin();
+    Test_TableAddStream();
+    Test_TableJournal();
+    Test_TableJournalKeyed();
+    Test_TableDelta();
+    Test_TableSnapshot();
+    Test_TableAdopt();
 
     return 0;
 }
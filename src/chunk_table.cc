@@ -0,0 +1,263 @@
+/**
+ * @summary chunk_table.cc: Implement the platform-agnostic components of the
+ * chunked data table module.
+ */
+#include <string.h>
+#include "chunk_table.h"
+
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#   include <intrin.h>
+#endif
+
+/* @summary Construct a HANDLE_BITS from a slot index and generation value.
+ * @param _slot_index The zero-based slot index allocated to the item.
+ * @param _generation The generation value of the slot allocated to the item.
+ * @return The HANDLE_BITS identifying the item.
+ */
+#ifndef ChunkTable_MakeHandleBits
+#define ChunkTable_MakeHandleBits(_slot_index, _generation)                    \
+     (HANDLE_FLAG_MASK_PACKED |                                                \
+    (((_slot_index) & HANDLE_INDEX_MASK) << HANDLE_INDEX_SHIFT) |              \
+    (((_generation) & HANDLE_GENER_MASK) << HANDLE_GENER_SHIFT))
+#endif
+
+/* @summary Extract the slot index encoded within a HANDLE_BITS.
+ * @param _bits The HANDLE_BITS value.
+ * @return The zero-based slot index allocated to the item.
+ */
+#ifndef ChunkTable_HandleBitsExtractSlotIndex
+#define ChunkTable_HandleBitsExtractSlotIndex(_bits)                           \
+    (((_bits) & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT)
+#endif
+
+/* @summary Extract the generation value encoded within a HANDLE_BITS.
+ * @param _bits The HANDLE_BITS value.
+ * @return The generation value portion of the handle.
+ */
+#ifndef ChunkTable_HandleBitsExtractGeneration
+#define ChunkTable_HandleBitsExtractGeneration(_bits)                          \
+    (((_bits) & HANDLE_GENER_MASK_PACKED) >> HANDLE_GENER_SHIFT)
+#endif
+
+/* @summary Find the index of the least-significant set bit in a non-zero 64-bit value.
+ * @param word The value to scan. Must be non-zero.
+ * @return The zero-based index of the least-significant set bit.
+ */
+static PIL_INLINE uint32_t
+ChunkTableBitScanForward
+(
+    uint64_t word
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return (uint32_t) bit;
+#else
+    return (uint32_t) __builtin_ctzll(word);
+#endif
+}
+
+PIL_API(HANDLE_BITS)
+ChunkTableCreateId
+(
+    uint32_t       *o_slot_index,
+    struct CHUNK_TABLE_DESC *table
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    uint32_t     chunk_index = index->FreeChunkHead;
+    uint32_t      slot_index;
+    uint64_t            mask;
+
+    if (chunk_index == CHUNK_TABLE_CHUNK_NONE) {
+        /* the caller must call ChunkTableEnsure prior to creating the item */
+        *o_slot_index = 0;
+        return HANDLE_BITS_INVALID;
+    }
+    /* claim the lowest free slot in the first non-full chunk */
+    mask        = index->OccupancyMask[chunk_index];
+    slot_index  =(chunk_index << CHUNK_TABLE_CHUNK_SHIFT) + ChunkTableBitScanForward(~mask);
+    mask       |=(1ULL << (slot_index & CHUNK_TABLE_CHUNK_MASK));
+    index->OccupancyMask[chunk_index] = mask;
+    if (mask == ~0ULL) {
+        /* the chunk is now full - remove it from the free list */
+        index->FreeChunkHead = index->ChunkFreeList[chunk_index];
+        index->ChunkFreeList[chunk_index] = CHUNK_TABLE_CHUNK_NONE;
+    }
+    index->ActiveCount++;
+    *o_slot_index = slot_index;
+    return ChunkTable_MakeHandleBits(slot_index, index->GenerationArray[slot_index]);
+}
+
+PIL_API(int)
+ChunkTableDeleteId
+(
+    struct CHUNK_TABLE_DESC *table,
+    HANDLE_BITS               bits
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    uint32_t      slot_index;
+    uint32_t     chunk_index;
+    uint64_t        slot_bit;
+    uint64_t            mask;
+
+    if (ChunkTableResolve(&slot_index, table, bits) == 0) {
+        return -1;
+    }
+    chunk_index = slot_index >> CHUNK_TABLE_CHUNK_SHIFT;
+    slot_bit    = 1ULL << (slot_index & CHUNK_TABLE_CHUNK_MASK);
+    mask        = index->OccupancyMask[chunk_index];
+    if (mask == ~0ULL) {
+        /* the chunk was full and now has a free slot - return it to the free list */
+        index->ChunkFreeList[chunk_index] = index->FreeChunkHead;
+        index->FreeChunkHead = chunk_index;
+    }
+    /* invalidate any outstanding handles to the slot. no item data is moved. */
+    index->OccupancyMask  [chunk_index] = mask & ~slot_bit;
+    index->GenerationArray[slot_index ] =(uint16_t)((index->GenerationArray[slot_index] + 1) & HANDLE_GENER_MASK);
+    index->ActiveCount--;
+    return 0;
+}
+
+PIL_API(void)
+ChunkTableDeleteAllIds
+(
+    struct CHUNK_TABLE_DESC *table
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    uint32_t     chunk_count = index->ChunkCount;
+    uint32_t      slot_index;
+    uint32_t     chunk_index;
+    uint64_t            mask;
+
+    for (chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+        /* bump the generation of each occupied slot so outstanding handles become invalid */
+        mask = index->OccupancyMask[chunk_index];
+        while (mask != 0) {
+            slot_index = (chunk_index << CHUNK_TABLE_CHUNK_SHIFT) + ChunkTableBitScanForward(mask);
+            index->GenerationArray[slot_index] = (uint16_t)((index->GenerationArray[slot_index] + 1) & HANDLE_GENER_MASK);
+            mask &= mask - 1;
+        }
+        /* rebuild the free list so that lower chunks are filled first */
+        index->OccupancyMask[chunk_index] = 0;
+        index->ChunkFreeList[chunk_index] =(chunk_index + 1 < chunk_count) ? (chunk_index + 1) : CHUNK_TABLE_CHUNK_NONE;
+    }
+    index->FreeChunkHead = (chunk_count > 0) ? 0 : CHUNK_TABLE_CHUNK_NONE;
+    index->ActiveCount   = 0;
+}
+
+PIL_API(int)
+ChunkTableResolve
+(
+    uint32_t       *o_slot_index,
+    struct CHUNK_TABLE_DESC *table,
+    HANDLE_BITS               bits
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    uint32_t      slot_index = ChunkTable_HandleBitsExtractSlotIndex (bits);
+    uint32_t      generation = ChunkTable_HandleBitsExtractGeneration(bits);
+    uint32_t     chunk_index = slot_index >> CHUNK_TABLE_CHUNK_SHIFT;
+
+    if ((bits & HANDLE_FLAG_MASK_PACKED) == 0 || chunk_index >= index->ChunkCount) {
+        *o_slot_index = 0;
+        return 0;
+    }
+    if ((index->OccupancyMask[chunk_index] & (1ULL << (slot_index & CHUNK_TABLE_CHUNK_MASK))) == 0) {
+        *o_slot_index = 0;
+        return 0;
+    }
+    if (index->GenerationArray[slot_index] != generation) {
+        *o_slot_index = 0;
+        return 0;
+    }
+    *o_slot_index = slot_index;
+    return 1;
+}
+
+PIL_API(uint32_t)
+ChunkTableScanChunk
+(
+    uint32_t            *o_slots,
+    struct CHUNK_TABLE_DESC *table,
+    uint32_t         chunk_index
+)
+{
+    uint64_t   mask = table->Index->OccupancyMask[chunk_index];
+    uint32_t   base = chunk_index << CHUNK_TABLE_CHUNK_SHIFT;
+    uint32_t  count = 0;
+
+    while (mask != 0) {
+        o_slots[count++] = base + ChunkTableBitScanForward(mask);
+        mask &= mask - 1;
+    }
+    return count;
+}
+
+PIL_API(HANDLE_BITS)
+ChunkTableGetHandle
+(
+    struct CHUNK_TABLE_DESC *table,
+    uint32_t            slot_index
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    assert((index->OccupancyMask[slot_index >> CHUNK_TABLE_CHUNK_SHIFT] & (1ULL << (slot_index & CHUNK_TABLE_CHUNK_MASK))) != 0);
+    return ChunkTable_MakeHandleBits(slot_index, index->GenerationArray[slot_index]);
+}
+
+PIL_API(int)
+VerifyChunkTableIndex
+(
+    struct CHUNK_TABLE_INDEX *index
+)
+{
+    uint32_t  chunk_count = index->ChunkCount;
+    uint32_t active_count = 0;
+    uint32_t   free_count = 0;
+    uint32_t   list_count = 0;
+    uint32_t  chunk_index;
+
+    if (chunk_count > index->ChunkCapacity) {
+        assert(chunk_count <= index->ChunkCapacity);
+        return 0;
+    }
+    for (chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+        uint64_t mask = index->OccupancyMask[chunk_index];
+        uint64_t bits = mask;
+        while (bits != 0) {
+            active_count++;
+            bits &= bits - 1;
+        }
+        if (mask != ~0ULL) {
+            free_count++;
+        }
+    }
+    if (active_count != index->ActiveCount) {
+        assert(active_count == index->ActiveCount);
+        return 0;
+    }
+    /* every non-full chunk must appear on the free list exactly once, and no full chunk may appear */
+    for (chunk_index = index->FreeChunkHead; chunk_index != CHUNK_TABLE_CHUNK_NONE; chunk_index = index->ChunkFreeList[chunk_index]) {
+        if (chunk_index >= chunk_count) {
+            assert(chunk_index < chunk_count);
+            return 0;
+        }
+        if (index->OccupancyMask[chunk_index] == ~0ULL) {
+            assert(index->OccupancyMask[chunk_index] != ~0ULL);
+            return 0;
+        }
+        if (++list_count > free_count) {
+            assert(list_count <= free_count);
+            return 0;
+        }
+    }
+    if (list_count != free_count) {
+        assert(list_count == free_count);
+        return 0;
+    }
+    return 1;
+}
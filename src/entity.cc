@@ -0,0 +1,343 @@
+/**
+ * @summary entity.cc: Implement the platform-agnostic entity-component system
+ * built on top of the data table module.
+ */
+#include <string.h>
+#include "memmgr.h"
+#include "entity.h"
+
+/* @summary Construct an ENTITY_ID from an archetype index and a table handle.
+ * @param _ai The zero-based index of the archetype.
+ * @param _bits The HANDLE_BITS of the entity record within the archetype table.
+ * @return The ENTITY_ID value.
+ */
+#ifndef EntityId_Make
+#define EntityId_Make(_ai, _bits)                                              \
+    ((((ENTITY_ID)(_ai) + 1) << 32) | (ENTITY_ID)(_bits))
+#endif
+
+/* @summary Resolve an entity identifier into its archetype and dense record index.
+ * @param o_dense_index Pointer to a location to update with the dense index of the entity record.
+ * @param world The ENTITY_WORLD that owns the entity.
+ * @param entity The identifier of the entity.
+ * @return A pointer to the archetype containing the entity, or NULL if the entity is not valid.
+ */
+static ENTITY_ARCHETYPE*
+EntityResolve
+(
+    uint32_t   *o_dense_index,
+    struct ENTITY_WORLD *world,
+    ENTITY_ID           entity
+)
+{
+    uint32_t archetype_index = EntityId_GetArchetypeIndex(entity);
+    ENTITY_ARCHETYPE      *a;
+    if (entity == ENTITY_ID_INVALID || archetype_index >= world->ArchetypeCount) {
+        return NULL;
+    }
+    a = &world->ArchetypeList[archetype_index];
+    if (TableResolve(o_dense_index, &a->TableDesc, EntityId_GetHandle(entity)) == 0) {
+        return NULL;
+    }
+    return a;
+}
+
+/* @summary Free all resources associated with an archetype.
+ * @param archetype The ENTITY_ARCHETYPE to delete.
+ */
+static void
+EntityArchetypeDelete
+(
+    struct ENTITY_ARCHETYPE *archetype
+)
+{
+    TableDelete(&archetype->TableDesc);
+    if (archetype->StreamData != NULL) {
+        HostMemoryFreeHeap(archetype->StreamData);
+        archetype->StreamData = NULL;
+        archetype->StreamList = NULL;
+    }
+}
+
+PIL_API(int)
+EntityWorldCreate
+(
+    struct ENTITY_WORLD          *world,
+    struct ENTITY_WORLD_INIT      *init
+)
+{
+    ENTITY_ARCHETYPE *list = NULL;
+
+    if (init->ArchetypeCapacity == 0 || init->ArchetypeCapacity > ENTITY_ARCHETYPE_MAX) {
+        assert(init->ArchetypeCapacity > 0);
+        assert(init->ArchetypeCapacity <= ENTITY_ARCHETYPE_MAX);
+        return -1;
+    }
+    if (init->TableCapacity < TABLE_MIN_OBJECT_COUNT || init->TableCapacity > TABLE_MAX_OBJECT_COUNT) {
+        assert(init->TableCapacity >= TABLE_MIN_OBJECT_COUNT);
+        assert(init->TableCapacity <= TABLE_MAX_OBJECT_COUNT);
+        return -1;
+    }
+    if ((list = HostMemoryAllocateHeapArray(ENTITY_ARCHETYPE, init->ArchetypeCapacity)) == NULL) {
+        return -1;
+    }
+    memset(world, 0, sizeof(ENTITY_WORLD));
+    world->ArchetypeList     = list;
+    world->ArchetypeCount    = 0;
+    world->ArchetypeCapacity = init->ArchetypeCapacity;
+    world->TableCapacity     = init->TableCapacity;
+    world->RegisteredMask    = 0;
+    return 0;
+}
+
+PIL_API(void)
+EntityWorldDelete
+(
+    struct ENTITY_WORLD *world
+)
+{
+    uint32_t i, n;
+    for (i = 0, n = world->ArchetypeCount; i < n; ++i) {
+        EntityArchetypeDelete(&world->ArchetypeList[i]);
+    }
+    if (world->ArchetypeList != NULL) {
+        HostMemoryFreeHeap(world->ArchetypeList);
+        world->ArchetypeList = NULL;
+    }
+    world->ArchetypeCount    = 0;
+    world->ArchetypeCapacity = 0;
+    world->RegisteredMask    = 0;
+}
+
+PIL_API(int)
+EntityRegisterComponent
+(
+    struct ENTITY_WORLD *world,
+    uint32_t      component_id,
+    uint32_t              size,
+    uint32_t         alignment
+)
+{
+    if (component_id >= ENTITY_COMPONENT_TYPE_MAX) {
+        assert(component_id < ENTITY_COMPONENT_TYPE_MAX);
+        return -1;
+    }
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > TABLE_STREAM_ALIGN_MAX) {
+        assert(alignment != 0);
+        assert((alignment & (alignment - 1)) == 0);
+        assert(alignment <= TABLE_STREAM_ALIGN_MAX);
+        return -1;
+    }
+    if (world->RegisteredMask & ComponentMask_Make(component_id)) {
+        assert((world->RegisteredMask & ComponentMask_Make(component_id)) == 0 && "Component type already registered");
+        return -1;
+    }
+    world->ComponentTypes[component_id].Size      = size;
+    world->ComponentTypes[component_id].Alignment = alignment;
+    world->RegisteredMask |= ComponentMask_Make(component_id);
+    return 0;
+}
+
+PIL_API(struct ENTITY_ARCHETYPE*)
+EntityGetArchetype
+(
+    uint32_t  *o_archetype_index,
+    struct ENTITY_WORLD   *world,
+    COMPONENT_MASK component_mask
+)
+{
+    TABLE_DATA_STREAM_DESC streams[ENTITY_COMPONENT_TYPE_MAX];
+    TABLE_INIT                init;
+    ENTITY_ARCHETYPE            *a;
+    uint8_t                  *data = NULL;
+    uint32_t          stream_count = 0;
+    uint32_t                  i, n;
+
+    for (i = 0, n = world->ArchetypeCount; i < n; ++i) {
+        if (world->ArchetypeList[i].ComponentMask == component_mask) {
+           *o_archetype_index = i;
+            return &world->ArchetypeList[i];
+        }
+    }
+    if ((component_mask & ~world->RegisteredMask) != 0) {
+        assert((component_mask & ~world->RegisteredMask) == 0 && "Unregistered component type");
+        return NULL;
+    }
+    if (world->ArchetypeCount == world->ArchetypeCapacity) {
+        assert(world->ArchetypeCount < world->ArchetypeCapacity);
+        return NULL;
+    }
+    a = &world->ArchetypeList[world->ArchetypeCount];
+    memset(a, 0, sizeof(ENTITY_ARCHETYPE));
+    memset(a->StreamIndex, ENTITY_STREAM_NONE, sizeof(a->StreamIndex));
+    for (i = 0; i < ENTITY_COMPONENT_TYPE_MAX; ++i) {
+        if ((component_mask & ComponentMask_Make(i)) && world->ComponentTypes[i].Size > 0) {
+            a->StreamIndex[i] = (uint8_t) stream_count++;
+        }
+    }
+    if (stream_count > 0) {
+        /* TABLE_DATA and TABLE_DATA* are stored in a single allocation */
+        if ((data = (uint8_t*) HostMemoryAllocateHeap(NULL, stream_count * (sizeof(TABLE_DATA) + sizeof(TABLE_DATA*)), PIL_ALIGN_OF(TABLE_DATA))) == NULL) {
+            return NULL;
+        }
+        a->StreamData = (TABLE_DATA  *)(data);
+        a->StreamList = (TABLE_DATA **)(data + stream_count * sizeof(TABLE_DATA));
+    }
+    for (i = 0; i < ENTITY_COMPONENT_TYPE_MAX; ++i) {
+        if (a->StreamIndex[i] != ENTITY_STREAM_NONE) {
+            uint32_t si = a->StreamIndex[i];
+            a->StreamData[si].StorageBuffer = NULL;
+            a->StreamList[si]       = &a->StreamData[si];
+            streams[si].Data        = &a->StreamData[si];
+            streams[si].Size        = world->ComponentTypes[i].Size;
+            streams[si].Alignment   = world->ComponentTypes[i].Alignment > TABLE_STREAM_ALIGN_DEFAULT ? world->ComponentTypes[i].Alignment : 0;
+        }
+    }
+    init.Index         = &a->TableIndex;
+    init.Streams       = streams;
+    init.StreamCount   = stream_count;
+    init.TableCapacity = world->TableCapacity;
+    init.InitialCommit = 0;
+    init.TableFlags    = TABLE_FLAG_PAGED_SPARSE_INDEX;
+    if (TableCreate(&init) != 0) {
+        if (data != NULL) {
+            HostMemoryFreeHeap(data);
+        }
+        return NULL;
+    }
+    a->TableDesc.Index       = &a->TableIndex;
+    a->TableDesc.Streams     = a->StreamList;
+    a->TableDesc.StreamCount = stream_count;
+    a->TableDesc.KeyIndex    = NULL;
+    a->TableDesc.BlobHeap    = NULL;
+    a->TableDesc.Journal     = NULL;
+    a->ComponentMask         = component_mask;
+    a->StreamCount           = stream_count;
+   *o_archetype_index        = world->ArchetypeCount++;
+    return a;
+}
+
+PIL_API(ENTITY_ID)
+EntityCreate
+(
+    struct ENTITY_CHUNK     *o_chunk,
+    struct ENTITY_WORLD       *world,
+    COMPONENT_MASK    component_mask
+)
+{
+    ENTITY_ARCHETYPE         *a;
+    uint32_t    archetype_index;
+    uint32_t        dense_index;
+    HANDLE_BITS            bits;
+
+    if ((a = EntityGetArchetype(&archetype_index, world, component_mask)) == NULL) {
+        return ENTITY_ID_INVALID;
+    }
+    if (TableEnsure(&a->TableDesc, Table_GetCount(&a->TableDesc) + 1, TABLE_CHUNK_SIZE) != 0) {
+        return ENTITY_ID_INVALID;
+    }
+    if ((bits = TableCreateId(&dense_index, &a->TableDesc)) == HANDLE_BITS_INVALID) {
+        return ENTITY_ID_INVALID;
+    }
+    if (o_chunk != NULL) {
+        o_chunk->Archetype      = a;
+        o_chunk->ArchetypeIndex = archetype_index;
+        o_chunk->Begin          = dense_index;
+        o_chunk->Count          = 1;
+    }
+    return EntityId_Make(archetype_index, bits);
+}
+
+PIL_API(int)
+EntityDelete
+(
+    struct ENTITY_WORLD *world,
+    ENTITY_ID           entity
+)
+{
+    ENTITY_ARCHETYPE    *a;
+    uint32_t   dense_index;
+
+    if ((a = EntityResolve(&dense_index, world, entity)) == NULL) {
+        return -1;
+    }
+    TableDeleteId(&a->TableDesc, EntityId_GetHandle(entity));
+    return 0;
+}
+
+PIL_API(void*)
+EntityGetComponent
+(
+    struct ENTITY_WORLD *world,
+    ENTITY_ID           entity,
+    uint32_t      component_id
+)
+{
+    ENTITY_ARCHETYPE    *a;
+    uint32_t   dense_index;
+
+    if (component_id >= ENTITY_COMPONENT_TYPE_MAX) {
+        return NULL;
+    }
+    if ((a = EntityResolve(&dense_index, world, entity)) == NULL) {
+        return NULL;
+    }
+    if (a->StreamIndex[component_id] == ENTITY_STREAM_NONE) {
+        return NULL;
+    }
+    return Table_GetStreamElement(void, &a->TableDesc, a->StreamIndex[component_id], dense_index);
+}
+
+PIL_API(uint32_t)
+EntityQueryCount
+(
+    struct ENTITY_WORLD         *world,
+    struct ENTITY_QUERY const   *query
+)
+{
+    uint32_t count = 0;
+    uint32_t  i, n;
+    for (i = 0, n = world->ArchetypeCount; i < n; ++i) {
+        if (EntityQuery_Matches(query, world->ArchetypeList[i].ComponentMask)) {
+            count += Table_GetCount(&world->ArchetypeList[i].TableDesc);
+        }
+    }
+    return count;
+}
+
+PIL_API(uint32_t)
+EntityQueryChunks
+(
+    struct ENTITY_CHUNK         *o_chunks,
+    uint32_t                   max_chunks,
+    struct ENTITY_WORLD            *world,
+    struct ENTITY_QUERY const      *query,
+    uint32_t                   chunk_size
+)
+{
+    ENTITY_ARCHETYPE *a;
+    uint32_t      count = 0;
+    uint32_t     active;
+    uint32_t      begin;
+    uint32_t       size;
+    uint32_t       i, n;
+
+    for (i = 0, n = world->ArchetypeCount; i < n; ++i) {
+        a = &world->ArchetypeList[i];
+        if (!EntityQuery_Matches(query, a->ComponentMask)) {
+            continue;
+        }
+        active = Table_GetCount(&a->TableDesc);
+        size   = chunk_size != 0 ? chunk_size : active;
+        for (begin = 0; begin < active; begin += size) {
+            if (count < max_chunks) {
+                o_chunks[count].Archetype      = a;
+                o_chunks[count].ArchetypeIndex = i;
+                o_chunks[count].Begin          = begin;
+                o_chunks[count].Count          = (active - begin) < size ? (active - begin) : size;
+            }
+            count++;
+        }
+    }
+    return count;
+}
@@ -1,248 +1,221 @@
 /**
  * @summary memio.cc: Implement the memory buffer I/O functions.
  */
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include "memio.h"
+#include "memio_inline.h"
 
-/* @summary Reads a 16-bit value from a buffer and performs a byte swap operation on it before returning it as the final destination type (16-bit unsigned.)
- * @param addr A pointer to the buffer from which the value will be read.
- * @param offset The offset into the buffer at which to read the value.
- * @return The byte-swapped value.
- */
-static PIL_INLINE uint16_t
-ReadSwap_i16
-(
-    void       *addr, 
-    ptrdiff_t offset
-)
-{
-    uint8_t   *src = ((uint8_t *)addr) + offset;
-    return ByteSwap2(*(uint16_t*) src);
-}
-
-/* @summary Reads a 32-bit value from a buffer and performs a byte swap operation on it before returning it as the final destination type (32-bit unsigned.)
- * @param addr A pointer to the buffer from which the value will be read.
- * @param offset The offset into the buffer at which to read the value.
- * @return The byte-swapped value.
- */
-static PIL_INLINE uint32_t
-ReadSwap_i32
-(
-    void       *addr, 
-    ptrdiff_t offset
-)
-{
-    uint8_t   *src = ((uint8_t *)addr) + offset;
-    return ByteSwap4(*(uint32_t*) src);
-}
-
-/* @summary Reads a 64-bit value from a buffer and performs a byte swap operation on it before returning it as the final destination type (64-bit unsigned.)
- * @param addr A pointer to the buffer from which the value will be read.
- * @param offset The offset into the buffer at which to read the value.
- * @return The byte-swapped value.
- */
-static PIL_INLINE uint64_t
-ReadSwap_i64
-(
-    void       *addr, 
-    ptrdiff_t offset
-)
-{
-    uint8_t   *src = ((uint8_t *)addr) + offset;
-    return ByteSwap8(*(uint64_t*) src);
-}
-
-/* @summary Reads a 32-bit value from a buffer and performs a byte swap operation on it before returning it as the final destination type (32-bit floating point.)
- * @param addr A pointer to the buffer from which the value will be read.
- * @param offset The offset into the buffer at which to read the value.
- * @return The byte-swapped value.
- */
-static PIL_INLINE float
-ReadSwap_f32
-(
-    void       *addr, 
-    ptrdiff_t offset
-)
-{
-    typedef union {
-        uint32_t  u32;
-        float f32;
-    } ui32_or_f32;
-
-    ui32_or_f32   val;
-    uint8_t      *src = ((uint8_t *)addr) + offset;
-    val.u32 = ByteSwap4(*(uint32_t*) src);
-    return val.f32;
-}
-
-/* @summary Reads a 64-bit value from a buffer and performs a byte swap operation on it before returning it as the final destination type (64-bit floating point.)
- * @param addr A pointer to the buffer from which the value will be read.
- * @param offset The offset into the buffer at which to read the value.
- * @return The byte-swapped value.
- */
-static PIL_INLINE double
-ReadSwap_f64
-(
-    void       *addr, 
-    ptrdiff_t offset
-)
-{
-    typedef union {
-        uint64_t  u64;
-        double    f64;
-    } ui64_or_f64;
-
-    ui64_or_f64   val;
-    uint8_t      *src = ((uint8_t *)addr) + offset;
-    val.u64 = ByteSwap8(*(uint64_t*) src);
-    return val.f64;
-}
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#   include <intrin.h>
+#endif
 
-/* @summary Perform a byte swapping operation on a signed 16-bit integer value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
- */
-static PIL_INLINE void
-SwapWrite_si16
-(
-    void       *addr,
-    int16_t    value,
-    ptrdiff_t offset
-)
-{
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint16_t*)dst = ByteSwap2(*(uint16_t*) &value);
-}
+#if PIL_TARGET_ARCHITECTURE == PIL_ARCHITECTURE_X64
+#   include <emmintrin.h>
+#   define MEMIO_USE_SSE2     1
+#   define MEMIO_USE_NEON     0
+#   if defined(__SSSE3__) || defined(__AVX__)
+#       include <tmmintrin.h>
+#       define MEMIO_USE_SSSE3    1
+#   else
+#       define MEMIO_USE_SSSE3    0
+#   endif
+#   if defined(__F16C__) || (PIL_TARGET_COMPILER == PIL_COMPILER_MSVC && defined(__AVX2__))
+#       include <immintrin.h>
+#       define MEMIO_USE_F16C     1
+#   else
+#       define MEMIO_USE_F16C     0
+#   endif
+#elif PIL_TARGET_ARCHITECTURE == PIL_ARCHITECTURE_ARM64
+#   include <arm_neon.h>
+#   define MEMIO_USE_SSE2     0
+#   define MEMIO_USE_SSSE3    0
+#   define MEMIO_USE_F16C     0
+#   define MEMIO_USE_NEON     1
+#else
+#   define MEMIO_USE_SSE2     0
+#   define MEMIO_USE_SSSE3    0
+#   define MEMIO_USE_F16C     0
+#   define MEMIO_USE_NEON     0
+#endif
 
-/* @summary Perform a byte swapping operation on an unsigned 16-bit integer value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+/* @summary Copy an array of values whose byte order already matches the requested byte order.
+ * @param dst The destination buffer.
+ * @param src The source buffer, which may be the same as dst.
+ * @param n_bytes The number of bytes to copy.
+ * @return The number of bytes copied.
  */
-static PIL_INLINE void
-SwapWrite_ui16
+static PIL_INLINE size_t
+CopyArray
 (
-    void       *addr,
-    uint16_t   value,
-    ptrdiff_t offset
+    void         *dst, 
+    void const   *src, 
+    size_t    n_bytes
 )
 {
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint16_t*)dst = ByteSwap2(value);
+    if (dst != src) {
+        memmove(dst, src, n_bytes);
+    } return n_bytes;
 }
 
-/* @summary Perform a byte swapping operation on a signed 32-bit integer value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+#if MEMIO_USE_SSE2
+/* @summary Swap the bytes of each 16-bit lane of a 128-bit vector.
  */
-static PIL_INLINE void
-SwapWrite_si32
+static PIL_INLINE __m128i
+ByteSwapVector16
 (
-    void       *addr,
-    int32_t    value,
-    ptrdiff_t offset
+    __m128i v
 )
 {
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint32_t*)dst = ByteSwap4(*(uint32_t*) &value);
+#   if MEMIO_USE_SSSE3
+    return _mm_shuffle_epi8(v, _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+#   else
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+#   endif
 }
 
-/* @summary Perform a byte swapping operation on an unsigned 32-bit integer value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+/* @summary Swap the bytes of each 32-bit lane of a 128-bit vector.
  */
-static PIL_INLINE void
-SwapWrite_ui32
+static PIL_INLINE __m128i
+ByteSwapVector32
 (
-    void       *addr,
-    uint32_t   value,
-    ptrdiff_t offset
+    __m128i v
 )
 {
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint32_t*)dst = ByteSwap4(value);
+#   if MEMIO_USE_SSSE3
+    return _mm_shuffle_epi8(v, _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3));
+#   else
+    /* swap the 16-bit halves of each lane, then the bytes of each half */
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return ByteSwapVector16(v);
+#   endif
 }
 
-/* @summary Perform a byte swapping operation on a signed 64-bit integer value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+/* @summary Swap the bytes of each 64-bit lane of a 128-bit vector.
  */
-static PIL_INLINE void
-SwapWrite_si64
+static PIL_INLINE __m128i
+ByteSwapVector64
 (
-    void       *addr,
-    int64_t    value,
-    ptrdiff_t offset
+    __m128i v
 )
 {
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint64_t*)dst = ByteSwap8(*(uint64_t*) &value);
+#   if MEMIO_USE_SSSE3
+    return _mm_shuffle_epi8(v, _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7));
+#   else
+    /* reverse the 16-bit quarters of each lane, then the bytes of each quarter */
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+    return ByteSwapVector16(v);
+#   endif
 }
+#endif /* MEMIO_USE_SSE2 */
 
-/* @summary Perform a byte swapping operation on an unsigned 64-bit integer value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+/* @summary Byte swap an array of 16-bit values from one buffer into another.
+ * The bulk of the array is swapped 16 bytes at a time using SIMD shuffles, and the remaining values are swapped individually.
+ * @param dst The destination buffer. The buffer does not need to be aligned.
+ * @param src The source buffer, which may be the same as dst. The buffer does not need to be aligned.
+ * @param count The number of values to swap.
+ * @return The number of bytes written to dst.
  */
-static PIL_INLINE void
-SwapWrite_ui64
+static size_t
+ByteSwapCopy16
 (
-    void       *addr,
-    uint64_t   value,
-    ptrdiff_t offset
+    void       *dst, 
+    void const *src, 
+    size_t    count
 )
 {
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint64_t*)dst = ByteSwap8(value);
+    uint8_t       *d = (uint8_t      *) dst;
+    uint8_t const *s = (uint8_t const*) src;
+    size_t         i = 0;
+    uint16_t       v;
+#if MEMIO_USE_SSE2
+    for ( ; i + 8 <= count; i += 8) {
+        _mm_storeu_si128((__m128i*)(d + i * 2), ByteSwapVector16(_mm_loadu_si128((__m128i const*)(s + i * 2))));
+    }
+#elif MEMIO_USE_NEON
+    for ( ; i + 8 <= count; i += 8) {
+        vst1q_u8(d + i * 2, vrev16q_u8(vld1q_u8(s + i * 2)));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        memcpy(&v, s + i * 2, sizeof(uint16_t)); v = MemioByteSwap16(v);
+        memcpy(d + i * 2, &v, sizeof(uint16_t));
+    }
+    return count * sizeof(uint16_t);
 }
 
-/* @summary Perform a byte swapping operation on a 32-bit floating point value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+/* @summary Byte swap an array of 32-bit values from one buffer into another.
+ * The bulk of the array is swapped 16 bytes at a time using SIMD shuffles, and the remaining values are swapped individually.
+ * @param dst The destination buffer. The buffer does not need to be aligned.
+ * @param src The source buffer, which may be the same as dst. The buffer does not need to be aligned.
+ * @param count The number of values to swap.
+ * @return The number of bytes written to dst.
  */
-static PIL_INLINE void
-SwapWrite_f32
+static size_t
+ByteSwapCopy32
 (
-    void       *addr,
-    float      value,
-    ptrdiff_t offset
+    void       *dst, 
+    void const *src, 
+    size_t    count
 )
 {
-    typedef union {
-        uint32_t  u32;
-        float     f32;
-    } ui32_or_f32;
-
-    ui32_or_f32 v;  v.f32 = value;
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint32_t*)dst = ByteSwap4(v.u32);
+    uint8_t       *d = (uint8_t      *) dst;
+    uint8_t const *s = (uint8_t const*) src;
+    size_t         i = 0;
+    uint32_t       v;
+#if MEMIO_USE_SSE2
+    for ( ; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i*)(d + i * 4), ByteSwapVector32(_mm_loadu_si128((__m128i const*)(s + i * 4))));
+    }
+#elif MEMIO_USE_NEON
+    for ( ; i + 4 <= count; i += 4) {
+        vst1q_u8(d + i * 4, vrev32q_u8(vld1q_u8(s + i * 4)));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        memcpy(&v, s + i * 4, sizeof(uint32_t)); v = MemioByteSwap32(v);
+        memcpy(d + i * 4, &v, sizeof(uint32_t));
+    }
+    return count * sizeof(uint32_t);
 }
 
-/* @summary Perform a byte swapping operation on a 64-bit floating point value and write it to a memory location.
- * @param addr A pointer to the buffer where the value will be written.
- * @param value The value to write to the buffer.
- * @param offset The offset into the buffer at which to write the value.
+/* @summary Byte swap an array of 64-bit values from one buffer into another.
+ * The bulk of the array is swapped 16 bytes at a time using SIMD shuffles, and the remaining value, if any, is swapped individually.
+ * @param dst The destination buffer. The buffer does not need to be aligned.
+ * @param src The source buffer, which may be the same as dst. The buffer does not need to be aligned.
+ * @param count The number of values to swap.
+ * @return The number of bytes written to dst.
  */
-static PIL_INLINE void
-SwapWrite_f64
+static size_t
+ByteSwapCopy64
 (
-    void           *addr,
-    double  value,
-    ptrdiff_t offset
+    void       *dst, 
+    void const *src, 
+    size_t    count
 )
 {
-    typedef union {
-        uint64_t  u64;
-        double    f64;
-    } ui64_or_f64;
-
-    ui64_or_f64 v;  v.f64 = value;
-    uint8_t * dst = ((uint8_t *) addr) + offset;
-  *(uint64_t*)dst = ByteSwap8(v.u64);
+    uint8_t       *d = (uint8_t      *) dst;
+    uint8_t const *s = (uint8_t const*) src;
+    size_t         i = 0;
+    uint64_t       v;
+#if MEMIO_USE_SSE2
+    for ( ; i + 2 <= count; i += 2) {
+        _mm_storeu_si128((__m128i*)(d + i * 8), ByteSwapVector64(_mm_loadu_si128((__m128i const*)(s + i * 8))));
+    }
+#elif MEMIO_USE_NEON
+    for ( ; i + 2 <= count; i += 2) {
+        vst1q_u8(d + i * 8, vrev64q_u8(vld1q_u8(s + i * 8)));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        memcpy(&v, s + i * 8, sizeof(uint64_t)); v = MemioByteSwap64(v);
+        memcpy(d + i * 8, &v, sizeof(uint64_t));
+    }
+    return count * sizeof(uint64_t);
 }
 
 PIL_API(int)
@@ -270,7 +243,7 @@ Read_si8
     ptrdiff_t offset
 )
 {
-    return *(int8_t *)(((uint8_t *) addr)+offset);
+    return ReadInline_si8(addr, offset);
 }
 
 PIL_API(uint8_t)
@@ -280,7 +253,7 @@ Read_ui8
     ptrdiff_t offset
 )
 {
-    return *(uint8_t *)(((uint8_t *) addr)+offset);
+    return ReadInline_ui8(addr, offset);
 }
 
 PIL_API(int16_t)
@@ -290,7 +263,7 @@ Read_si16
     ptrdiff_t offset
 )
 {
-    return *(int16_t*)(((uint8_t *) addr)+offset);
+    return ReadInline_si16(addr, offset);
 }
 
 PIL_API(int16_t)
@@ -300,11 +273,7 @@ Read_si16_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(int16_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (int16_t )ReadSwap_i16(addr, offset);
-#endif
+    return ReadInline_si16_msb(addr, offset);
 }
 
 PIL_API(int16_t)
@@ -314,11 +283,7 @@ Read_si16_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(int16_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (int16_t )ReadSwap_i16(addr, offset);
-#endif
+    return ReadInline_si16_lsb(addr, offset);
 }
 
 PIL_API(uint16_t)
@@ -328,7 +293,7 @@ Read_ui16
     ptrdiff_t offset
 )
 {
-    return *(uint16_t*)(((uint8_t *) addr)+offset);
+    return ReadInline_ui16(addr, offset);
 }
 
 PIL_API(uint16_t)
@@ -338,11 +303,7 @@ Read_ui16_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(uint16_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (uint16_t )ReadSwap_i16(addr, offset);
-#endif
+    return ReadInline_ui16_msb(addr, offset);
 }
 
 PIL_API(uint16_t)
@@ -352,11 +313,7 @@ Read_ui16_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(uint16_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (uint16_t )ReadSwap_i16(addr, offset);
-#endif
+    return ReadInline_ui16_lsb(addr, offset);
 }
 
 PIL_API(int32_t)
@@ -366,7 +323,7 @@ Read_si32
     ptrdiff_t offset
 )
 {
-    return *(int32_t*)(((uint8_t *) addr)+offset);
+    return ReadInline_si32(addr, offset);
 }
 
 PIL_API(int32_t)
@@ -376,11 +333,7 @@ Read_si32_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(int32_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (int32_t )ReadSwap_i32(addr, offset);
-#endif
+    return ReadInline_si32_msb(addr, offset);
 }
 
 PIL_API(int32_t)
@@ -390,11 +343,7 @@ Read_si32_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(int32_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (int32_t )ReadSwap_i32(addr, offset);
-#endif
+    return ReadInline_si32_lsb(addr, offset);
 }
 
 PIL_API(uint32_t)
@@ -404,7 +353,7 @@ Read_ui32
     ptrdiff_t offset
 )
 {
-    return *(uint32_t*)(((uint8_t *) addr)+offset);
+    return ReadInline_ui32(addr, offset);
 }
 
 PIL_API(uint32_t)
@@ -414,11 +363,7 @@ Read_ui32_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(uint32_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (uint32_t )ReadSwap_i32(addr, offset);
-#endif
+    return ReadInline_ui32_msb(addr, offset);
 }
 
 PIL_API(uint32_t)
@@ -428,11 +373,7 @@ Read_ui32_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(uint32_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (uint32_t )ReadSwap_i32(addr, offset);
-#endif
+    return ReadInline_ui32_lsb(addr, offset);
 }
 
 PIL_API(int64_t)
@@ -442,7 +383,7 @@ Read_si64
     ptrdiff_t offset
 )
 {
-    return *(int64_t*)(((uint8_t *) addr)+offset);
+    return ReadInline_si64(addr, offset);
 }
 
 PIL_API(int64_t)
@@ -452,11 +393,7 @@ Read_si64_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(int64_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (int64_t )ReadSwap_i64(addr, offset);
-#endif
+    return ReadInline_si64_msb(addr, offset);
 }
 
 PIL_API(int64_t)
@@ -466,11 +403,7 @@ Read_si64_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(int64_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (int64_t )ReadSwap_i64(addr, offset);
-#endif
+    return ReadInline_si64_lsb(addr, offset);
 }
 
 PIL_API(uint64_t)
@@ -480,7 +413,7 @@ Read_ui64
     ptrdiff_t offset
 )
 {
-    return *(uint64_t*)(((uint8_t *) addr)+offset);
+    return ReadInline_ui64(addr, offset);
 }
 
 PIL_API(uint64_t)
@@ -490,11 +423,7 @@ Read_ui64_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(uint64_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (uint64_t )ReadSwap_i64(addr, offset);
-#endif
+    return ReadInline_ui64_msb(addr, offset);
 }
 
 PIL_API(uint64_t)
@@ -504,11 +433,7 @@ Read_ui64_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(uint64_t*)(((uint8_t *) addr)+offset);
-#else
-    return  (uint64_t )ReadSwap_i64(addr, offset);
-#endif
+    return ReadInline_ui64_lsb(addr, offset);
 }
 
 PIL_API(float)
@@ -518,7 +443,7 @@ Read_f32
     ptrdiff_t offset
 )
 {
-    return *(float*)(((uint8_t *) addr)+offset);
+    return ReadInline_f32(addr, offset);
 }
 
 PIL_API(float)
@@ -528,11 +453,7 @@ Read_f32_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(float*)(((uint8_t *) addr)+offset);
-#else
-    return  (float )ReadSwap_f32(addr, offset);
-#endif
+    return ReadInline_f32_msb(addr, offset);
 }
 
 PIL_API(float)
@@ -542,11 +463,7 @@ Read_f32_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(float*)(((uint8_t *) addr)+offset);
-#else
-    return  (float )ReadSwap_f32(addr, offset);
-#endif
+    return ReadInline_f32_lsb(addr, offset);
 }
 
 PIL_API(double)
@@ -556,7 +473,7 @@ Read_f64
     ptrdiff_t offset
 )
 {
-    return *(double*)(((uint8_t *) addr)+offset);
+    return ReadInline_f64(addr, offset);
 }
 
 PIL_API(double)
@@ -566,11 +483,7 @@ Read_f64_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    return *(double*)(((uint8_t *) addr)+offset);
-#else
-    return  (double )ReadSwap_f64(addr, offset);
-#endif
+    return ReadInline_f64_msb(addr, offset);
 }
 
 PIL_API(double)
@@ -580,11 +493,7 @@ Read_f64_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    return *(double*)(((uint8_t *) addr)+offset);
-#else
-    return  (double )ReadSwap_f64(addr, offset);
-#endif
+    return ReadInline_f64_lsb(addr, offset);
 }
 
 PIL_API(size_t)
@@ -595,8 +504,7 @@ Write_si8
     ptrdiff_t offset
 )
 {
-    *(int8_t *)(((uint8_t*) addr)+offset) = value;
-    return sizeof(int8_t);
+    return WriteInline_si8(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -607,8 +515,7 @@ Write_ui8
     ptrdiff_t offset
 )
 {
-    *(uint8_t *)(((uint8_t*) addr)+offset) = value;
-    return sizeof(uint8_t);
+    return WriteInline_ui8(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -619,8 +526,7 @@ Write_si16
     ptrdiff_t offset
 )
 {
-    *(int16_t*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(int16_t);
+    return WriteInline_si16(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -631,12 +537,7 @@ Write_si16_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(int16_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_si16(addr, value, offset);
-#endif
-    return sizeof(int16_t);
+    return WriteInline_si16_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -647,12 +548,7 @@ Write_si16_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(int16_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_si16(addr, value, offset);
-#endif
-    return sizeof(int16_t);
+    return WriteInline_si16_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -663,8 +559,7 @@ Write_ui16
     ptrdiff_t offset
 )
 {
-    *(uint16_t*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(uint16_t);
+    return WriteInline_ui16(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -675,12 +570,7 @@ Write_ui16_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(uint16_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_ui16(addr, value, offset);
-#endif
-    return sizeof(uint16_t);
+    return WriteInline_ui16_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -691,12 +581,7 @@ Write_ui16_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(uint16_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_ui16(addr, value, offset);
-#endif
-    return sizeof(uint16_t);
+    return WriteInline_ui16_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -707,8 +592,7 @@ Write_si32
     ptrdiff_t offset
 )
 {
-    *(int32_t*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(int32_t);
+    return WriteInline_si32(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -719,12 +603,7 @@ Write_si32_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(int32_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_si32(addr, value, offset);
-#endif
-    return sizeof(int32_t);
+    return WriteInline_si32_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -735,12 +614,7 @@ Write_si32_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(int32_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_si32(addr, value, offset);
-#endif
-    return sizeof(int32_t);
+    return WriteInline_si32_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -751,8 +625,7 @@ Write_ui32
     ptrdiff_t offset
 )
 {
-    *(uint32_t*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(uint32_t);
+    return WriteInline_ui32(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -763,12 +636,7 @@ Write_ui32_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(uint32_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_ui32(addr, value, offset);
-#endif
-    return sizeof(uint32_t);
+    return WriteInline_ui32_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -779,12 +647,7 @@ Write_ui32_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(uint32_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_ui32(addr, value, offset);
-#endif
-    return sizeof(uint32_t);
+    return WriteInline_ui32_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -795,8 +658,7 @@ Write_si64
     ptrdiff_t offset
 )
 {
-    *(int64_t*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(int64_t);
+    return WriteInline_si64(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -807,12 +669,7 @@ Write_si64_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(int64_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_si64(addr, value, offset);
-#endif
-    return sizeof(int64_t);
+    return WriteInline_si64_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -823,12 +680,7 @@ Write_si64_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(int64_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_si64(addr, value, offset);
-#endif
-    return sizeof(int64_t);
+    return WriteInline_si64_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -839,8 +691,7 @@ Write_ui64
     ptrdiff_t offset
 )
 {
-    *(uint64_t*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(uint64_t);
+    return WriteInline_ui64(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -851,12 +702,7 @@ Write_ui64_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(uint64_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_ui64(addr, value, offset);
-#endif
-    return sizeof(uint64_t);
+    return WriteInline_ui64_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -867,12 +713,7 @@ Write_ui64_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(uint64_t*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_ui64(addr, value, offset);
-#endif
-    return sizeof(uint64_t);
+    return WriteInline_ui64_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -883,8 +724,7 @@ Write_f32
     ptrdiff_t offset
 )
 {
-    *(float*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(float);
+    return WriteInline_f32(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -895,12 +735,7 @@ Write_f32_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(float*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_f32(addr, value, offset);
-#endif
-    return sizeof(float);
+    return WriteInline_f32_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -911,12 +746,7 @@ Write_f32_lsb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(float*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_f32(addr, value, offset);
-#endif
-    return sizeof(float);
+    return WriteInline_f32_lsb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -927,8 +757,7 @@ Write_f64
     ptrdiff_t offset
 )
 {
-    *(double*)(((uint8_t*) addr)+offset) = value;
-    return sizeof(double);
+    return WriteInline_f64(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -939,12 +768,7 @@ Write_f64_msb
     ptrdiff_t offset
 )
 {
-#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
-    *(double*)(((uint8_t*) addr)+offset) = value;
-#else
-    SwapWrite_f64(addr, value, offset);
-#endif
-    return sizeof(double);
+    return WriteInline_f64_msb(addr, value, offset);
 }
 
 PIL_API(size_t)
@@ -954,12 +778,3996 @@ Write_f64_lsb
     double     value,
     ptrdiff_t offset
 )
+{
+    return WriteInline_f64_lsb(addr, value, offset);
+}
+
+PIL_API(void)
+ByteSwapArray16
+(
+    void   *data, 
+    size_t count
+)
+{
+    (void) ByteSwapCopy16(data, data, count);
+}
+
+PIL_API(void)
+ByteSwapArray32
+(
+    void   *data, 
+    size_t count
+)
+{
+    (void) ByteSwapCopy32(data, data, count);
+}
+
+PIL_API(void)
+ByteSwapArray64
+(
+    void   *data, 
+    size_t count
+)
+{
+    (void) ByteSwapCopy64(data, data, count);
+}
+
+PIL_API(size_t)
+ReadArray_si16_msb
+(
+    int16_t   *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_si16_lsb
+(
+    int16_t   *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_ui16_msb
+(
+    uint16_t  *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_ui16_lsb
+(
+    uint16_t  *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_si32_msb
+(
+    int32_t   *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_si32_lsb
+(
+    int32_t   *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_ui32_msb
+(
+    uint32_t  *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_ui32_lsb
+(
+    uint32_t  *dst, 
+    void const *src, 
+    size_t    count
+)
 {
 #if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
-    *(double*)(((uint8_t*) addr)+offset) = value;
+    return CopyArray(dst, src, count * sizeof(uint32_t));
 #else
-    SwapWrite_f64(addr, value, offset);
+    return ByteSwapCopy32(dst, src, count);
 #endif
-    return sizeof(double);
 }
 
+PIL_API(size_t)
+ReadArray_si64_msb
+(
+    int64_t   *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_si64_lsb
+(
+    int64_t   *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_ui64_msb
+(
+    uint64_t  *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_ui64_lsb
+(
+    uint64_t  *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_f32_msb
+(
+    float     *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(float));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_f32_lsb
+(
+    float     *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(float));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_f64_msb
+(
+    double    *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(double));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+ReadArray_f64_lsb
+(
+    double    *dst, 
+    void const *src, 
+    size_t    count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(double));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_si16_msb
+(
+    void                *dst, 
+    int16_t const      *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_si16_lsb
+(
+    void                *dst, 
+    int16_t const      *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_ui16_msb
+(
+    void                *dst, 
+    uint16_t const     *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_ui16_lsb
+(
+    void                *dst, 
+    uint16_t const     *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint16_t));
+#else
+    return ByteSwapCopy16(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_si32_msb
+(
+    void                *dst, 
+    int32_t const      *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_si32_lsb
+(
+    void                *dst, 
+    int32_t const      *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_ui32_msb
+(
+    void                *dst, 
+    uint32_t const     *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_ui32_lsb
+(
+    void                *dst, 
+    uint32_t const     *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint32_t));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_si64_msb
+(
+    void                *dst, 
+    int64_t const      *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_si64_lsb
+(
+    void                *dst, 
+    int64_t const      *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(int64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_ui64_msb
+(
+    void                *dst, 
+    uint64_t const     *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_ui64_lsb
+(
+    void                *dst, 
+    uint64_t const     *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(uint64_t));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_f32_msb
+(
+    void                *dst, 
+    float const        *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(float));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_f32_lsb
+(
+    void                *dst, 
+    float const        *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(float));
+#else
+    return ByteSwapCopy32(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_f64_msb
+(
+    void                *dst, 
+    double const       *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_MSB_FIRST
+    return CopyArray(dst, src, count * sizeof(double));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+PIL_API(size_t)
+WriteArray_f64_lsb
+(
+    void                *dst, 
+    double const       *src, 
+    size_t             count
+)
+{
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return CopyArray(dst, src, count * sizeof(double));
+#else
+    return ByteSwapCopy64(dst, src, count);
+#endif
+}
+
+/* @summary The total number of data bytes used by the four values described by a Stream VByte control byte.
+ */
+static uint8_t const MemioStreamVByteLength[256] = {
+     4,  5,  6,  7,  5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,
+     5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,
+     6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+     7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+     5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,
+     6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+     7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+     8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+     6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+     7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+     8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+     9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15,
+     7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+     8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+     9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15,
+    10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15, 13, 14, 15, 16,
+};
+
+#if MEMIO_USE_SSSE3 || MEMIO_USE_NEON
+/* @summary The byte shuffle that expands the data bytes of the four values described by a Stream VByte control byte into four 32-bit lanes.
+ * Entries with the high bit set produce a zero byte.
+ */
+static uint8_t const MemioStreamVByteShuffle[256][16] = {
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0x0A, 0x0B, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0x0B, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0x0B, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0x0B, 0x0C, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0xFF, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0x0A, 0x0B, 0x0C, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0x0B, 0x0C, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0x0B, 0x0C, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0x0B, 0x0C, 0x0D, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0xFF },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0xFF },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07 },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08 },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0xFF, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08 },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0xFF, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0x0A, 0x0B, 0x0C, 0x0D },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0x08 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0x0B, 0x0C, 0x0D },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0x0A, 0x0B, 0x0C, 0x0D },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0xFF, 0x0B, 0x0C, 0x0D, 0x0E },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0xFF, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xFF, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E },
+    { 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C },
+    { 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D },
+    { 0x00, 0x01, 0x02, 0xFF, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F },
+};
+#endif
+
+/* @summary Find the index of the least-significant set bit in a non-zero 64-bit value.
+ * @param word The value to scan. Must be non-zero.
+ * @return The zero-based index of the least-significant set bit.
+ */
+static PIL_INLINE uint32_t
+MemioBitScanForward
+(
+    uint64_t word
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return (uint32_t) bit;
+#else
+    return (uint32_t) __builtin_ctzll(word);
+#endif
+}
+
+/* @summary Find the index of the most-significant set bit in a non-zero 64-bit value.
+ * @param word The value to scan. Must be non-zero.
+ * @return The zero-based index of the most-significant set bit.
+ */
+static PIL_INLINE uint32_t
+MemioBitScanReverse
+(
+    uint64_t word
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+    unsigned long bit;
+    _BitScanReverse64(&bit, word);
+    return (uint32_t) bit;
+#else
+    return (uint32_t)(63 - __builtin_clzll(word));
+#endif
+}
+
+/* @summary Decode a LEB128-coded value of up to eight bytes without branching on its length.
+ * The eight bytes starting at src are loaded at once, the terminating byte is located with a bit scan, and the 7-bit groups are gathered with shifts and masks.
+ * @param o_value On return, set to the decoded value.
+ * @param src The encoded value. At least eight bytes must be readable.
+ * @param max_size The maximum encoded length accepted, MEMIO_VARINT32_MAX_SIZE or 8.
+ * @return The number of bytes read, or zero if the value is longer than max_size bytes.
+ */
+static PIL_INLINE size_t
+MemioDecodeVarintFast
+(
+    uint64_t      *o_value,
+    uint8_t const *src,
+    size_t    max_size
+)
+{
+    uint64_t    w = ReadInline_ui64_lsb(src, 0);
+    uint64_t stop = ~w & (0x8080808080808080ULL >> ((8 - max_size) * 8));
+    uint32_t bits;
+    if (stop == 0) {
+        return 0;
+    }
+    bits = MemioBitScanForward(stop) + 1;
+    w   &= bits < 64 ? ((1ULL << bits) - 1) : ~0ULL;
+   *o_value = ((w      ) & 0x000000000000007FULL) | ((w >> 1) & 0x0000000000003F80ULL) | 
+              ((w >>  2) & 0x00000000001FC000ULL) | ((w >> 3) & 0x000000000FE00000ULL) | 
+              ((w >>  4) & 0x00000007F0000000ULL) | ((w >> 5) & 0x000003F800000000ULL) | 
+              ((w >>  6) & 0x0001FC0000000000ULL) | ((w >> 7) & 0x00FE000000000000ULL);
+    return bits >> 3;
+}
+
+/* @summary Build a mask with bit i set if byte i of a 16-byte block of LEB128-coded data has its continuation bit set.
+ * @param src The 16 encoded bytes.
+ * @return The 16-bit continuation mask.
+ */
+static PIL_INLINE uint32_t
+MemioContinuationMask
+(
+    uint8_t const *src
+)
+{
+#if MEMIO_USE_SSE2
+    return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((__m128i const*) src));
+#elif MEMIO_USE_NEON
+    static uint8_t const weight[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t bits = vandq_u8(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(src)), vdupq_n_s8(0)), vld1q_u8(weight));
+    return (uint32_t) vaddv_u8(vget_low_u8(bits)) | ((uint32_t) vaddv_u8(vget_high_u8(bits)) << 8);
+#else
+    uint32_t m = 0;
+    size_t   i;
+    for (i = 0; i < 16; ++i) {
+        m |= (uint32_t)(src[i] >> 7) << i;
+    }
+    return m;
+#endif
+}
+
+/* @summary Expand a block of 16 single-byte LEB128-coded values into 32-bit values.
+ * @param dst The array to which the 16 values will be written.
+ * @param src The 16 encoded bytes, none of which has its continuation bit set.
+ */
+static PIL_INLINE void
+MemioExpandBytes32
+(
+    uint32_t      *dst,
+    uint8_t const *src
+)
+{
+#if MEMIO_USE_SSE2
+    __m128i v  = _mm_loadu_si128((__m128i const*) src);
+    __m128i z  = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(v, z);
+    __m128i hi = _mm_unpackhi_epi8(v, z);
+    _mm_storeu_si128((__m128i*)(dst +  0), _mm_unpacklo_epi16(lo, z));
+    _mm_storeu_si128((__m128i*)(dst +  4), _mm_unpackhi_epi16(lo, z));
+    _mm_storeu_si128((__m128i*)(dst +  8), _mm_unpacklo_epi16(hi, z));
+    _mm_storeu_si128((__m128i*)(dst + 12), _mm_unpackhi_epi16(hi, z));
+#elif MEMIO_USE_NEON
+    uint8x16_t v  = vld1q_u8(src);
+    uint16x8_t lo = vmovl_u8(vget_low_u8 (v));
+    uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+    vst1q_u32(dst +  0, vmovl_u16(vget_low_u16 (lo)));
+    vst1q_u32(dst +  4, vmovl_u16(vget_high_u16(lo)));
+    vst1q_u32(dst +  8, vmovl_u16(vget_low_u16 (hi)));
+    vst1q_u32(dst + 12, vmovl_u16(vget_high_u16(hi)));
+#else
+    size_t i;
+    for (i = 0; i < 16; ++i) {
+        dst[i] = src[i];
+    }
+#endif
+}
+
+/* @summary Expand a block of 16 single-byte LEB128-coded values into 64-bit values.
+ * @param dst The array to which the 16 values will be written.
+ * @param src The 16 encoded bytes, none of which has its continuation bit set.
+ */
+static PIL_INLINE void
+MemioExpandBytes64
+(
+    uint64_t      *dst,
+    uint8_t const *src
+)
+{
+#if MEMIO_USE_SSE2
+    __m128i v = _mm_loadu_si128((__m128i const*) src);
+    __m128i z = _mm_setzero_si128();
+    __m128i w[4];
+    size_t  i;
+    w[0] = _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, z), z);
+    w[1] = _mm_unpackhi_epi16(_mm_unpacklo_epi8(v, z), z);
+    w[2] = _mm_unpacklo_epi16(_mm_unpackhi_epi8(v, z), z);
+    w[3] = _mm_unpackhi_epi16(_mm_unpackhi_epi8(v, z), z);
+    for (i = 0; i < 4; ++i) {
+        _mm_storeu_si128((__m128i*)(dst + i * 4 + 0), _mm_unpacklo_epi32(w[i], z));
+        _mm_storeu_si128((__m128i*)(dst + i * 4 + 2), _mm_unpackhi_epi32(w[i], z));
+    }
+#elif MEMIO_USE_NEON
+    uint8x16_t v  = vld1q_u8(src);
+    uint16x8_t lo = vmovl_u8(vget_low_u8 (v));
+    uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+    uint32x4_t w[4];
+    size_t     i;
+    w[0] = vmovl_u16(vget_low_u16 (lo));
+    w[1] = vmovl_u16(vget_high_u16(lo));
+    w[2] = vmovl_u16(vget_low_u16 (hi));
+    w[3] = vmovl_u16(vget_high_u16(hi));
+    for (i = 0; i < 4; ++i) {
+        vst1q_u64(dst + i * 4 + 0, vmovl_u32(vget_low_u32 (w[i])));
+        vst1q_u64(dst + i * 4 + 2, vmovl_u32(vget_high_u32(w[i])));
+    }
+#else
+    size_t i;
+    for (i = 0; i < 16; ++i) {
+        dst[i] = src[i];
+    }
+#endif
+}
+
+PIL_API(size_t)
+Write_varint32
+(
+    void       *addr, 
+    uint32_t   value,
+    ptrdiff_t offset
+)
+{
+    return WriteInline_varint32(addr, value, offset);
+}
+
+PIL_API(size_t)
+Write_varint64
+(
+    void       *addr, 
+    uint64_t   value,
+    ptrdiff_t offset
+)
+{
+    return WriteInline_varint64(addr, value, offset);
+}
+
+PIL_API(size_t)
+Read_varint32
+(
+    uint32_t *o_value,
+    void const  *addr,
+    size_t       size
+)
+{
+    return ReadInline_varint32(o_value, addr, size);
+}
+
+PIL_API(size_t)
+Read_varint64
+(
+    uint64_t *o_value,
+    void const  *addr,
+    size_t       size
+)
+{
+    return ReadInline_varint64(o_value, addr, size);
+}
+
+PIL_API(size_t)
+WriteArray_varint32
+(
+    void                *dst, 
+    uint32_t const      *src, 
+    size_t             count
+)
+{
+    uint8_t *d = (uint8_t*) dst;
+    size_t   n = 0;
+    size_t   i;
+    for (i = 0; i < count; ++i) {
+        n += WriteInline_varint32(d, src[i], (ptrdiff_t) n);
+    }
+    return n;
+}
+
+PIL_API(size_t)
+WriteArray_varint64
+(
+    void                *dst, 
+    uint64_t const      *src, 
+    size_t             count
+)
+{
+    uint8_t *d = (uint8_t*) dst;
+    size_t   n = 0;
+    size_t   i;
+    for (i = 0; i < count; ++i) {
+        n += WriteInline_varint64(d, src[i], (ptrdiff_t) n);
+    }
+    return n;
+}
+
+PIL_API(size_t)
+WriteArray_zigzag32
+(
+    void                *dst, 
+    int32_t const       *src, 
+    size_t             count
+)
+{
+    uint8_t *d = (uint8_t*) dst;
+    size_t   n = 0;
+    size_t   i;
+    for (i = 0; i < count; ++i) {
+        n += WriteInline_varint32(d, MemioZigZagEncode32(src[i]), (ptrdiff_t) n);
+    }
+    return n;
+}
+
+PIL_API(size_t)
+WriteArray_zigzag64
+(
+    void                *dst, 
+    int64_t const       *src, 
+    size_t             count
+)
+{
+    uint8_t *d = (uint8_t*) dst;
+    size_t   n = 0;
+    size_t   i;
+    for (i = 0; i < count; ++i) {
+        n += WriteInline_varint64(d, MemioZigZagEncode64(src[i]), (ptrdiff_t) n);
+    }
+    return n;
+}
+
+PIL_API(size_t)
+ReadArray_varint32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+)
+{
+    uint8_t const *s = (uint8_t const*) src;
+    uint8_t const *e = (uint8_t const*) src + src_size;
+    size_t         i = 0;
+    size_t         n;
+    uint64_t       v;
+    /* work through the data 16 bytes at a time. the continuation mask locates 
+     * every value ending in the block, so the values can be decoded without 
+     * each load depending on the length of the previous value. the block 
+     * must be followed by 8 readable bytes for MemioDecodeVarintFast. */
+    while (i + 16 <= count && e - s >= 24) {
+        uint32_t mask = MemioContinuationMask(s);
+        uint32_t ends =~mask & 0xFFFF;
+        uint32_t start= 0;
+        if (mask == 0) {
+            MemioExpandBytes32(dst + i, s);
+            i += 16; s += 16;
+            continue;
+        }
+        if (ends == 0) {
+            return 0; /* no value ends within 16 bytes */
+        }
+        while (ends != 0) {
+            if (MemioDecodeVarintFast(&v, s + start, MEMIO_VARINT32_MAX_SIZE) == 0 || v > 0xFFFFFFFFULL) {
+                return 0;
+            }
+            dst[i++] = (uint32_t) v;
+            start    =  MemioBitScanForward(ends) + 1;
+            ends    &= (ends - 1);
+        }
+        s += start;
+    }
+    for ( ; i < count; ++i, s += n) {
+        if ((n = ReadInline_varint32(&dst[i], s, (size_t)(e - s))) == 0) {
+            return 0;
+        }
+    }
+    return (size_t)(s - (uint8_t const*) src);
+}
+
+PIL_API(size_t)
+ReadArray_varint64
+(
+    uint64_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+)
+{
+    uint8_t const *s = (uint8_t const*) src;
+    uint8_t const *e = (uint8_t const*) src + src_size;
+    size_t         i = 0;
+    size_t         n;
+    while (i + 16 <= count && e - s >= 24) {
+        uint32_t mask = MemioContinuationMask(s);
+        uint32_t ends =~mask & 0xFFFF;
+        uint32_t start= 0;
+        if (mask == 0) {
+            MemioExpandBytes64(dst + i, s);
+            i += 16; s += 16;
+            continue;
+        }
+        if (ends == 0) {
+            /* a value of more than 56 bits spans the whole block */
+            if ((n = ReadInline_varint64(&dst[i], s, (size_t)(e - s))) == 0) {
+                return 0;
+            }
+            i += 1; s += n;
+            continue;
+        }
+        while (ends != 0) {
+            if (MemioDecodeVarintFast(&dst[i], s + start, 8) == 0) {
+                break; /* a value of more than 56 bits; decoded below */
+            }
+            i       += 1;
+            start    = MemioBitScanForward(ends) + 1;
+            ends    &=(ends - 1);
+        }
+        s += start;
+        if (ends != 0) {
+            if ((n = ReadInline_varint64(&dst[i], s, (size_t)(e - s))) == 0) {
+                return 0;
+            }
+            i += 1; s += n;
+        }
+    }
+    for ( ; i < count; ++i, s += n) {
+        if ((n = ReadInline_varint64(&dst[i], s, (size_t)(e - s))) == 0) {
+            return 0;
+        }
+    }
+    return (size_t)(s - (uint8_t const*) src);
+}
+
+PIL_API(size_t)
+ReadArray_zigzag32
+(
+    int32_t             *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+)
+{
+    uint32_t  *u = (uint32_t*) dst;
+    size_t     n = ReadArray_varint32(u, src, src_size, count);
+    size_t     i;
+    if (n != 0) {
+        for (i = 0; i < count; ++i) {
+            dst[i] = MemioZigZagDecode32(u[i]);
+        }
+    }
+    return n;
+}
+
+PIL_API(size_t)
+ReadArray_zigzag64
+(
+    int64_t             *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+)
+{
+    uint64_t  *u = (uint64_t*) dst;
+    size_t     n = ReadArray_varint64(u, src, src_size, count);
+    size_t     i;
+    if (n != 0) {
+        for (i = 0; i < count; ++i) {
+            dst[i] = MemioZigZagDecode64(u[i]);
+        }
+    }
+    return n;
+}
+
+PIL_API(size_t)
+WriteArray_svb32
+(
+    void                *dst, 
+    uint32_t const      *src, 
+    size_t             count
+)
+{
+    uint8_t   *ctrl = (uint8_t*) dst;
+    uint8_t   *data = (uint8_t*) dst + ((count + 3) / 4);
+    size_t        i;
+
+    memset(ctrl, 0, (count + 3) / 4);
+    for (i = 0; i < count; ++i) {
+        uint32_t  v = src[i];
+        uint32_t  c = (v > 0x000000FFUL) + (v > 0x0000FFFFUL) + (v > 0x00FFFFFFUL);
+        uint8_t   b[4];
+        WriteInline_ui32_lsb(b, v, 0);
+        memcpy(data, b, c + 1);
+        ctrl[i >> 2] |= (uint8_t)(c << ((i & 3) * 2));
+        data += c + 1;
+    }
+    return (size_t)(data - (uint8_t*) dst);
+}
+
+PIL_API(size_t)
+ReadArray_svb32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t             count
+)
+{
+    uint8_t const *ctrl = (uint8_t const*) src;
+    uint8_t const *data = (uint8_t const*) src + ((count + 3) / 4);
+    uint8_t const *end  = (uint8_t const*) src + src_size;
+    size_t           i  = 0;
+
+    if (src_size < (count + 3) / 4) {
+        return 0;
+    }
+#if MEMIO_USE_SSSE3
+    /* a group of four values occupies at most 16 bytes, so the full load is in bounds */
+    for ( ; i + 4 <= count && end - data >= 16; i += 4) {
+        uint8_t  c = ctrl[i >> 2];
+        __m128i  v = _mm_loadu_si128((__m128i const*) data);
+        __m128i  s = _mm_loadu_si128((__m128i const*) MemioStreamVByteShuffle[c]);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(v, s));
+        data += MemioStreamVByteLength[c];
+    }
+#elif MEMIO_USE_NEON
+    for ( ; i + 4 <= count && end - data >= 16; i += 4) {
+        uint8_t    c = ctrl[i >> 2];
+        uint8x16_t v = vld1q_u8(data);
+        uint8x16_t s = vld1q_u8(MemioStreamVByteShuffle[c]);
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(vqtbl1q_u8(v, s)));
+        data += MemioStreamVByteLength[c];
+    }
+#endif
+    for ( ; i + 4 <= count && end - data >= 16; i += 4) {
+        /* scalar groups check bounds once per group, and load each value with a single masked 4-byte read */
+        static uint32_t const mask[4] = { 0x000000FFUL, 0x0000FFFFUL, 0x00FFFFFFUL, 0xFFFFFFFFUL };
+        uint8_t  c = ctrl[i >> 2];
+        uint32_t k;
+        for (k = 0; k < 4; ++k) {
+            uint32_t code = (c >> (k * 2)) & 3;
+            dst[i + k]    = ReadInline_ui32_lsb(data, 0) & mask[code];
+            data         += code + 1;
+        }
+    }
+    for ( ; i < count; ++i) {
+        /* the final few values may be too close to the end of the buffer for a 4-byte load */
+        uint32_t code = (ctrl[i >> 2] >> ((i & 3) * 2)) & 3;
+        uint32_t    v = 0;
+        uint32_t    k;
+        if ((size_t)(end - data) < code + 1) {
+            return 0;
+        }
+        for (k = 0; k <= code; ++k) {
+            v |= (uint32_t) data[k] << (k * 8);
+        }
+        dst[i] = v;
+        data  += code + 1;
+    }
+    return (size_t)(data - (uint8_t const*) src);
+}
+
+#if MEMIO_USE_SSE2
+/* @summary Define the type used to operate on four 32-bit lanes at once when packing and unpacking bits.
+ */
+typedef __m128i MEMIO_LANES;
+
+static PIL_INLINE MEMIO_LANES LanesZero      (void)                          { return _mm_setzero_si128(); }
+static PIL_INLINE MEMIO_LANES LanesSet1      (uint32_t x)                    { return _mm_set1_epi32((int) x); }
+static PIL_INLINE MEMIO_LANES LanesAnd       (MEMIO_LANES a, MEMIO_LANES b)  { return _mm_and_si128(a, b); }
+static PIL_INLINE MEMIO_LANES LanesOr        (MEMIO_LANES a, MEMIO_LANES b)  { return _mm_or_si128(a, b); }
+static PIL_INLINE MEMIO_LANES LanesShl       (MEMIO_LANES a, uint32_t n)     { return _mm_slli_epi32(a, (int) n); }
+static PIL_INLINE MEMIO_LANES LanesShr       (MEMIO_LANES a, uint32_t n)     { return _mm_srli_epi32(a, (int) n); }
+static PIL_INLINE MEMIO_LANES LanesLoadValues(uint32_t const *src)           { return _mm_loadu_si128((__m128i const*) src); }
+static PIL_INLINE MEMIO_LANES LanesLoadPacked(uint8_t  const *src)           { return _mm_loadu_si128((__m128i const*) src); }
+static PIL_INLINE void        LanesStoreValues(uint32_t *dst, MEMIO_LANES v) { _mm_storeu_si128((__m128i*) dst, v); }
+static PIL_INLINE void        LanesStorePacked(uint8_t  *dst, MEMIO_LANES v) { _mm_storeu_si128((__m128i*) dst, v); }
+#elif MEMIO_USE_NEON
+typedef uint32x4_t MEMIO_LANES;
+
+static PIL_INLINE MEMIO_LANES LanesZero      (void)                          { return vdupq_n_u32(0); }
+static PIL_INLINE MEMIO_LANES LanesSet1      (uint32_t x)                    { return vdupq_n_u32(x); }
+static PIL_INLINE MEMIO_LANES LanesAnd       (MEMIO_LANES a, MEMIO_LANES b)  { return vandq_u32(a, b); }
+static PIL_INLINE MEMIO_LANES LanesOr        (MEMIO_LANES a, MEMIO_LANES b)  { return vorrq_u32(a, b); }
+static PIL_INLINE MEMIO_LANES LanesShl       (MEMIO_LANES a, uint32_t n)     { return vshlq_u32(a, vdupq_n_s32( (int32_t) n)); }
+static PIL_INLINE MEMIO_LANES LanesShr       (MEMIO_LANES a, uint32_t n)     { return vshlq_u32(a, vdupq_n_s32(-(int32_t) n)); }
+static PIL_INLINE MEMIO_LANES LanesLoadValues(uint32_t const *src)           { return vld1q_u32(src); }
+static PIL_INLINE MEMIO_LANES LanesLoadPacked(uint8_t  const *src)           { return vreinterpretq_u32_u8(vld1q_u8(src)); }
+static PIL_INLINE void        LanesStoreValues(uint32_t *dst, MEMIO_LANES v) { vst1q_u32(dst, v); }
+static PIL_INLINE void        LanesStorePacked(uint8_t  *dst, MEMIO_LANES v) { vst1q_u8(dst, vreinterpretq_u8_u32(v)); }
+#else
+typedef struct MEMIO_LANES {
+    uint32_t                       Lane[4];
+} MEMIO_LANES;
+
+static PIL_INLINE MEMIO_LANES LanesSet1      (uint32_t x)                    { MEMIO_LANES r; r.Lane[0] = r.Lane[1] = r.Lane[2] = r.Lane[3] = x; return r; }
+static PIL_INLINE MEMIO_LANES LanesZero      (void)                          { return LanesSet1(0); }
+static PIL_INLINE MEMIO_LANES LanesAnd       (MEMIO_LANES a, MEMIO_LANES b)  { for (int i = 0; i < 4; ++i) a.Lane[i] &= b.Lane[i]; return a; }
+static PIL_INLINE MEMIO_LANES LanesOr        (MEMIO_LANES a, MEMIO_LANES b)  { for (int i = 0; i < 4; ++i) a.Lane[i] |= b.Lane[i]; return a; }
+static PIL_INLINE MEMIO_LANES LanesShl       (MEMIO_LANES a, uint32_t n)     { for (int i = 0; i < 4; ++i) a.Lane[i] = n < 32 ? a.Lane[i] << n : 0; return a; }
+static PIL_INLINE MEMIO_LANES LanesShr       (MEMIO_LANES a, uint32_t n)     { for (int i = 0; i < 4; ++i) a.Lane[i] = n < 32 ? a.Lane[i] >> n : 0; return a; }
+static PIL_INLINE MEMIO_LANES LanesLoadValues(uint32_t const *src)           { MEMIO_LANES r; memcpy(r.Lane, src, sizeof(r.Lane)); return r; }
+static PIL_INLINE MEMIO_LANES LanesLoadPacked(uint8_t  const *src)           { MEMIO_LANES r; for (int i = 0; i < 4; ++i) r.Lane[i] = ReadInline_ui32_lsb(src, i * 4); return r; }
+static PIL_INLINE void        LanesStoreValues(uint32_t *dst, MEMIO_LANES v) { memcpy(dst, v.Lane, sizeof(v.Lane)); }
+static PIL_INLINE void        LanesStorePacked(uint8_t  *dst, MEMIO_LANES v) { for (int i = 0; i < 4; ++i) WriteInline_ui32_lsb(dst, v.Lane[i], i * 4); }
+#endif
+
+/* @summary Pack one block of MEMIO_BITPACK_BLOCK_SIZE values at a fixed bit width in the four-lane interleaved layout.
+ * The bit width is a template parameter so that every shift amount and branch is resolved at compile time once the loop is unrolled.
+ * @typeparam W The number of bits stored for each value, from 1 to 32.
+ * @param dst The buffer to write to. W * 16 bytes are written.
+ * @param src The MEMIO_BITPACK_BLOCK_SIZE values to pack.
+ */
+template <uint32_t W>
+static void
+BitPackBlock32
+(
+    uint8_t        *dst, 
+    uint32_t const *src
+)
+{
+    MEMIO_LANES mask = LanesSet1(W == 32 ? 0xFFFFFFFFUL : ((1UL << W) - 1));
+    MEMIO_LANES  acc = LanesZero();
+    uint32_t   shift = 0;
+    uint32_t       r;
+    for (r = 0; r < MEMIO_BITPACK_BLOCK_SIZE / 4; ++r) {
+        MEMIO_LANES v = LanesAnd(LanesLoadValues(src + r * 4), mask);
+        acc = LanesOr(acc, LanesShl(v, shift));
+        if (shift + W >= 32) {
+            LanesStorePacked(dst, acc); dst += 16;
+            acc   =(shift + W > 32) ? LanesShr(v, 32 - shift) : LanesZero();
+            shift = shift + W - 32;
+        } else {
+            shift = shift + W;
+        }
+    }
+}
+
+/* @summary Unpack one block of MEMIO_BITPACK_BLOCK_SIZE values at a fixed bit width from the four-lane interleaved layout.
+ * @typeparam W The number of bits stored for each value, from 1 to 32.
+ * @param dst The array to which the MEMIO_BITPACK_BLOCK_SIZE values will be written.
+ * @param src The packed block. W * 16 bytes are read.
+ */
+template <uint32_t W>
+static void
+BitUnpackBlock32
+(
+    uint32_t      *dst, 
+    uint8_t const *src
+)
+{
+    MEMIO_LANES mask = LanesSet1(W == 32 ? 0xFFFFFFFFUL : ((1UL << W) - 1));
+    MEMIO_LANES  cur = LanesLoadPacked(src);
+    uint32_t   shift = 0;
+    uint32_t       r;
+    for (r = 0; r < MEMIO_BITPACK_BLOCK_SIZE / 4; ++r) {
+        MEMIO_LANES v = LanesShr(cur, shift);
+        if (shift + W > 32) {
+            /* the value straddles two words of the lane */
+            src  += 16; cur = LanesLoadPacked(src);
+            v     = LanesOr(v, LanesShl(cur, 32 - shift));
+            shift = shift + W - 32;
+        } else if (shift + W == 32 && r != (MEMIO_BITPACK_BLOCK_SIZE / 4) - 1) {
+            src  += 16; cur = LanesLoadPacked(src);
+            shift = 0;
+        } else {
+            shift = shift + W;
+        }
+        LanesStoreValues(dst + r * 4, LanesAnd(v, mask));
+    }
+}
+
+/* @summary Define the signature of the functions used to pack or unpack a single block at a fixed bit width.
+ */
+typedef void (*MEMIO_BITPACK_BLOCK_FUNC)(uint8_t*, uint32_t const*);
+typedef void (*MEMIO_BITUNPACK_BLOCK_FUNC)(uint32_t*, uint8_t const*);
+
+/* @summary The block packing function for each bit width, indexed by bit_width - 1.
+ */
+static MEMIO_BITPACK_BLOCK_FUNC const MemioBitPackBlock[32] = {
+    BitPackBlock32< 1>,
+    BitPackBlock32< 2>,
+    BitPackBlock32< 3>,
+    BitPackBlock32< 4>,
+    BitPackBlock32< 5>,
+    BitPackBlock32< 6>,
+    BitPackBlock32< 7>,
+    BitPackBlock32< 8>,
+    BitPackBlock32< 9>,
+    BitPackBlock32<10>,
+    BitPackBlock32<11>,
+    BitPackBlock32<12>,
+    BitPackBlock32<13>,
+    BitPackBlock32<14>,
+    BitPackBlock32<15>,
+    BitPackBlock32<16>,
+    BitPackBlock32<17>,
+    BitPackBlock32<18>,
+    BitPackBlock32<19>,
+    BitPackBlock32<20>,
+    BitPackBlock32<21>,
+    BitPackBlock32<22>,
+    BitPackBlock32<23>,
+    BitPackBlock32<24>,
+    BitPackBlock32<25>,
+    BitPackBlock32<26>,
+    BitPackBlock32<27>,
+    BitPackBlock32<28>,
+    BitPackBlock32<29>,
+    BitPackBlock32<30>,
+    BitPackBlock32<31>,
+    BitPackBlock32<32>
+};
+
+/* @summary The block unpacking function for each bit width, indexed by bit_width - 1.
+ */
+static MEMIO_BITUNPACK_BLOCK_FUNC const MemioBitUnpackBlock[32] = {
+    BitUnpackBlock32< 1>,
+    BitUnpackBlock32< 2>,
+    BitUnpackBlock32< 3>,
+    BitUnpackBlock32< 4>,
+    BitUnpackBlock32< 5>,
+    BitUnpackBlock32< 6>,
+    BitUnpackBlock32< 7>,
+    BitUnpackBlock32< 8>,
+    BitUnpackBlock32< 9>,
+    BitUnpackBlock32<10>,
+    BitUnpackBlock32<11>,
+    BitUnpackBlock32<12>,
+    BitUnpackBlock32<13>,
+    BitUnpackBlock32<14>,
+    BitUnpackBlock32<15>,
+    BitUnpackBlock32<16>,
+    BitUnpackBlock32<17>,
+    BitUnpackBlock32<18>,
+    BitUnpackBlock32<19>,
+    BitUnpackBlock32<20>,
+    BitUnpackBlock32<21>,
+    BitUnpackBlock32<22>,
+    BitUnpackBlock32<23>,
+    BitUnpackBlock32<24>,
+    BitUnpackBlock32<25>,
+    BitUnpackBlock32<26>,
+    BitUnpackBlock32<27>,
+    BitUnpackBlock32<28>,
+    BitUnpackBlock32<29>,
+    BitUnpackBlock32<30>,
+    BitUnpackBlock32<31>,
+    BitUnpackBlock32<32>
+};
+
+PIL_API(size_t)
+BitPack32
+(
+    void                *dst, 
+    uint32_t const   *values, 
+    size_t             count, 
+    uint32_t       bit_width
+)
+{
+    uint8_t   *d = (uint8_t*) dst;
+    size_t     i = 0;
+    uint64_t   m;
+    uint64_t   bits = 0;
+    uint32_t   nbit = 0;
+
+    assert(bit_width <= 32);
+    if (bit_width == 0) {
+        return 0;
+    }
+    for ( ; i + MEMIO_BITPACK_BLOCK_SIZE <= count; i += MEMIO_BITPACK_BLOCK_SIZE) {
+        MemioBitPackBlock[bit_width - 1](d, values + i);
+        d += (MEMIO_BITPACK_BLOCK_SIZE / 8) * bit_width;
+    }
+    /* the remaining values are written as a plain little-endian bit stream */
+    for (m = (1ULL << bit_width) - 1; i < count; ++i) {
+        bits |= (values[i] & m) << nbit;
+        nbit += bit_width;
+        while (nbit >= 8) {
+           *d++   = (uint8_t) bits;
+            bits >>= 8;
+            nbit  -= 8;
+        }
+    }
+    if (nbit > 0) {
+       *d++ = (uint8_t) bits;
+    }
+    return (size_t)(d - (uint8_t*) dst);
+}
+
+PIL_API(size_t)
+BitUnpack32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t             count, 
+    uint32_t       bit_width
+)
+{
+    uint8_t const *s = (uint8_t const*) src;
+    size_t         i = 0;
+    uint64_t       m;
+    uint64_t       bits = 0;
+    uint32_t       nbit = 0;
+
+    assert(bit_width <= 32);
+    if (bit_width == 0) {
+        memset(dst, 0, count * sizeof(uint32_t));
+        return 0;
+    }
+    for ( ; i + MEMIO_BITPACK_BLOCK_SIZE <= count; i += MEMIO_BITPACK_BLOCK_SIZE) {
+        MemioBitUnpackBlock[bit_width - 1](dst + i, s);
+        s += (MEMIO_BITPACK_BLOCK_SIZE / 8) * bit_width;
+    }
+    for (m = (1ULL << bit_width) - 1; i < count; ++i) {
+        while (nbit < bit_width) {
+            bits |= (uint64_t)(*s++) << nbit;
+            nbit += 8;
+        }
+        dst[i] = (uint32_t)(bits & m);
+        bits >>= bit_width;
+        nbit  -= bit_width;
+    }
+    return (size_t)(s - (uint8_t const*) src);
+}
+
+PIL_API(uint32_t)
+BitWidth32
+(
+    uint32_t const   *values, 
+    size_t             count
+)
+{
+    uint32_t bits = 0;
+    uint32_t width= 0;
+    size_t      i;
+    for (i = 0; i < count; ++i) {
+        bits |= values[i];
+    }
+    while (bits != 0) {
+        bits >>= 1;
+        width++;
+    }
+    return width;
+}
+
+PIL_API(size_t)
+ConvertArray_f32_f16
+(
+    uint16_t            *dst, 
+    float const         *src, 
+    size_t             count, 
+    uint32_t   rounding_mode
+)
+{
+    size_t i = 0;
+#if MEMIO_USE_F16C
+    /* the rounding mode is an immediate operand of vcvtps2ph */
+    if (rounding_mode == MEMIO_ROUNDING_MODE_NEAREST) {
+        for ( ; i + 8 <= count; i += 8) {
+            _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    } else {
+        for ( ; i + 8 <= count; i += 8) {
+            _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+        }
+    }
+#elif MEMIO_USE_NEON
+    /* fcvtn rounds using the FPCR rounding mode, which is round to nearest even */
+    if (rounding_mode == MEMIO_ROUNDING_MODE_NEAREST) {
+        for ( ; i + 4 <= count; i += 4) {
+            vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+        }
+    }
+#endif
+    for ( ; i < count; ++i) {
+        dst[i] = MemioFloatToHalf(src[i], rounding_mode);
+    }
+    return count * sizeof(uint16_t);
+}
+
+PIL_API(size_t)
+ConvertArray_f16_f32
+(
+    float               *dst, 
+    uint16_t const      *src, 
+    size_t             count
+)
+{
+    size_t i = 0;
+#if MEMIO_USE_F16C
+    for ( ; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(src + i))));
+    }
+#elif MEMIO_USE_SSE2
+    /* move the exponent and mantissa into place and rebias with a multiply, which also 
+     * normalizes subnormal halves. infinity and NaN get the maximum exponent. */
+    __m128i const mask_nosign = _mm_set1_epi32(0x7FFF);
+    __m128i const was_infnan  = _mm_set1_epi32(0x7BFF);
+    __m128i const exp_infnan  = _mm_set1_epi32(255 << 23);
+    __m128  const magic       = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    for ( ; i + 8 <= count; i += 8) {
+        __m128i h  = _mm_loadu_si128((__m128i const*)(src + i));
+        __m128i hv[2];
+        size_t  k;
+        hv[0] = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+        hv[1] = _mm_unpackhi_epi16(h, _mm_setzero_si128());
+        for (k = 0; k < 2; ++k) {
+            __m128i expmant = _mm_and_si128(mask_nosign, hv[k]);
+            __m128i sign    = _mm_slli_epi32(_mm_xor_si128(hv[k], expmant), 16);
+            __m128  scaled  = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)), magic);
+            __m128i infnan  = _mm_and_si128(_mm_cmpgt_epi32(expmant, was_infnan), exp_infnan);
+            _mm_storeu_ps(dst + i + k * 4, _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infnan))));
+        }
+    }
+#elif MEMIO_USE_NEON
+    for ( ; i + 4 <= count; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        dst[i] = MemioHalfToFloat(src[i]);
+    }
+    return count * sizeof(float);
+}
+
+PIL_API(size_t)
+ConvertArray_f32_unorm8
+(
+    uint8_t             *dst, 
+    float const         *src, 
+    size_t             count, 
+    uint32_t   rounding_mode
+)
+{
+    size_t i = 0;
+#if MEMIO_USE_SSE2
+    __m128 const zero = _mm_setzero_ps();
+    __m128 const one  = _mm_set1_ps(1.0f);
+    __m128 const scale= _mm_set1_ps(255.0f);
+    for ( ; i + 16 <= count; i += 16) {
+        __m128i q[4];
+        size_t  k;
+        for (k = 0; k < 4; ++k) {
+            /* maxps returns the second operand when either is NaN, so NaN becomes zero */
+            __m128 v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + k * 4), zero), one), scale);
+            q[k] = rounding_mode == MEMIO_ROUNDING_MODE_NEAREST ? _mm_cvtps_epi32(v) : _mm_cvttps_epi32(v);
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packs_epi32(q[0], q[1]), _mm_packs_epi32(q[2], q[3])));
+    }
+#elif MEMIO_USE_NEON
+    float32x4_t const zero = vdupq_n_f32(0.0f);
+    float32x4_t const one  = vdupq_n_f32(1.0f);
+    for ( ; i + 8 <= count; i += 8) {
+        uint32x4_t q[2];
+        size_t     k;
+        for (k = 0; k < 2; ++k) {
+            /* fmaxnm returns the number when one operand is NaN */
+            float32x4_t v = vmulq_n_f32(vminq_f32(vmaxnmq_f32(vld1q_f32(src + i + k * 4), zero), one), 255.0f);
+            q[k] = rounding_mode == MEMIO_ROUNDING_MODE_NEAREST ? vcvtnq_u32_f32(v) : vcvtq_u32_f32(v);
+        }
+        vst1_u8(dst + i, vmovn_u16(vcombine_u16(vmovn_u32(q[0]), vmovn_u32(q[1]))));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        dst[i] = MemioFloatToUnorm8(src[i], rounding_mode);
+    }
+    return count * sizeof(uint8_t);
+}
+
+PIL_API(size_t)
+ConvertArray_unorm8_f32
+(
+    float               *dst, 
+    uint8_t const       *src, 
+    size_t             count
+)
+{
+    size_t i = 0;
+#if MEMIO_USE_SSE2
+    __m128 const scale = _mm_set1_ps(255.0f);
+    for ( ; i + 16 <= count; i += 16) {
+        __m128i z  = _mm_setzero_si128();
+        __m128i v  = _mm_loadu_si128((__m128i const*)(src + i));
+        __m128i lo = _mm_unpacklo_epi8(v, z);
+        __m128i hi = _mm_unpackhi_epi8(v, z);
+        _mm_storeu_ps(dst + i +  0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, z)), scale));
+        _mm_storeu_ps(dst + i +  4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, z)), scale));
+        _mm_storeu_ps(dst + i +  8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, z)), scale));
+        _mm_storeu_ps(dst + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, z)), scale));
+    }
+#elif MEMIO_USE_NEON
+    float32x4_t const scale = vdupq_n_f32(255.0f);
+    for ( ; i + 8 <= count; i += 8) {
+        uint16x8_t v = vmovl_u8(vld1_u8(src + i));
+        vst1q_f32(dst + i + 0, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16 (v))), scale));
+        vst1q_f32(dst + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), scale));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        dst[i] = MemioUnorm8ToFloat(src[i]);
+    }
+    return count * sizeof(float);
+}
+
+PIL_API(size_t)
+ConvertArray_f32_snorm16
+(
+    int16_t             *dst, 
+    float const         *src, 
+    size_t             count, 
+    uint32_t   rounding_mode
+)
+{
+    size_t i = 0;
+#if MEMIO_USE_SSE2
+    __m128 const neg  = _mm_set1_ps(-1.0f);
+    __m128 const pos  = _mm_set1_ps( 1.0f);
+    __m128 const scale= _mm_set1_ps(32767.0f);
+    for ( ; i + 8 <= count; i += 8) {
+        __m128i q[2];
+        size_t  k;
+        for (k = 0; k < 2; ++k) {
+            __m128 v = _mm_loadu_ps(src + i + k * 4);
+            v    = _mm_and_ps(v, _mm_cmpord_ps(v, v)); /* NaN becomes zero */
+            v    = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, neg), pos), scale);
+            q[k] = rounding_mode == MEMIO_ROUNDING_MODE_NEAREST ? _mm_cvtps_epi32(v) : _mm_cvttps_epi32(v);
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(q[0], q[1]));
+    }
+#elif MEMIO_USE_NEON
+    float32x4_t const neg = vdupq_n_f32(-1.0f);
+    float32x4_t const pos = vdupq_n_f32( 1.0f);
+    for ( ; i + 8 <= count; i += 8) {
+        int32x4_t q[2];
+        size_t    k;
+        for (k = 0; k < 2; ++k) {
+            /* the float to integer conversions return zero for NaN */
+            float32x4_t v = vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(src + i + k * 4), neg), pos), 32767.0f);
+            q[k] = rounding_mode == MEMIO_ROUNDING_MODE_NEAREST ? vcvtnq_s32_f32(v) : vcvtq_s32_f32(v);
+        }
+        vst1q_s16(dst + i, vcombine_s16(vmovn_s32(q[0]), vmovn_s32(q[1])));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        dst[i] = MemioFloatToSnorm16(src[i], rounding_mode);
+    }
+    return count * sizeof(int16_t);
+}
+
+PIL_API(size_t)
+ConvertArray_snorm16_f32
+(
+    float               *dst, 
+    int16_t const       *src, 
+    size_t             count
+)
+{
+    size_t i = 0;
+#if MEMIO_USE_SSE2
+    __m128 const neg   = _mm_set1_ps(-1.0f);
+    __m128 const scale = _mm_set1_ps(32767.0f);
+    for ( ; i + 8 <= count; i += 8) {
+        __m128i v  = _mm_loadu_si128((__m128i const*)(src + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_ps(dst + i + 0, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(lo), scale), neg));
+        _mm_storeu_ps(dst + i + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(hi), scale), neg));
+    }
+#elif MEMIO_USE_NEON
+    float32x4_t const neg   = vdupq_n_f32(-1.0f);
+    float32x4_t const scale = vdupq_n_f32(32767.0f);
+    for ( ; i + 8 <= count; i += 8) {
+        int16x8_t v = vld1q_s16(src + i);
+        vst1q_f32(dst + i + 0, vmaxq_f32(vdivq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16 (v))), scale), neg));
+        vst1q_f32(dst + i + 4, vmaxq_f32(vdivq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), scale), neg));
+    }
+#endif
+    for ( ; i < count; ++i) {
+        dst[i] = MemioSnorm16ToFloat(src[i]);
+    }
+    return count * sizeof(float);
+}
+
+/* @summary Read and validate the header of an array encoded by DeltaPack32 or DeltaPack64.
+ * @param o_header On return, the decoded header.
+ * @param src A pointer to the encoded array.
+ * @param src_size The number of bytes available at src.
+ * @param element_size The expected size of each value, 4 or 8.
+ * @return Zero if the header is valid, or -1 if the encoded data is invalid.
+ */
+static int
+DeltaPackReadHeader
+(
+    struct MEMIO_DELTA_PACK_HEADER *o_header, 
+    void const                          *src, 
+    size_t                          src_size, 
+    uint32_t                    element_size
+)
+{
+    size_t block_count;
+
+    if (src_size < sizeof(MEMIO_DELTA_PACK_HEADER)) {
+        return -1;
+    }
+    o_header->Magic       = ReadInline_ui32_lsb(src,  0);
+    o_header->ElementSize = ReadInline_ui32_lsb(src,  4);
+    o_header->Count       = ReadInline_ui32_lsb(src,  8);
+    o_header->DataSize    = ReadInline_ui32_lsb(src, 12);
+    block_count           =((size_t) o_header->Count + MEMIO_BITPACK_BLOCK_SIZE - 1) / MEMIO_BITPACK_BLOCK_SIZE;
+    if (o_header->Magic != MEMIO_DELTA_PACK_MAGIC || o_header->ElementSize != element_size || o_header->DataSize > src_size) {
+        return -1;
+    }
+    if (o_header->DataSize < sizeof(MEMIO_DELTA_PACK_HEADER) + (block_count * sizeof(MEMIO_DELTA_PACK_BLOCK))) {
+        return -1;
+    }
+    return 0;
+}
+
+/* @summary Read and validate the directory entry for one block of an array encoded by DeltaPack32 or DeltaPack64.
+ * @param o_block On return, the decoded directory entry.
+ * @param src A pointer to the encoded array.
+ * @param header The header returned by DeltaPackReadHeader.
+ * @param block_index The zero-based index of the block.
+ * @return The number of values in the block, or zero if the block index is out of range or the entry is invalid.
+ */
+static size_t
+DeltaPackReadBlock
+(
+    struct MEMIO_DELTA_PACK_BLOCK        *o_block, 
+    void const                               *src, 
+    struct MEMIO_DELTA_PACK_HEADER const  *header, 
+    size_t                            block_index
+)
+{
+    uint8_t const *entry;
+    size_t         first = block_index * MEMIO_BITPACK_BLOCK_SIZE;
+    size_t         count;
+    size_t         bytes;
+    size_t         start;
+
+    if (first >= header->Count) {
+        return 0;
+    }
+    entry = (uint8_t const*) src + sizeof(MEMIO_DELTA_PACK_HEADER) + (block_index * sizeof(MEMIO_DELTA_PACK_BLOCK));
+    count = header->Count - first;
+    count = count < MEMIO_BITPACK_BLOCK_SIZE ? count : MEMIO_BITPACK_BLOCK_SIZE;
+    start = sizeof(MEMIO_DELTA_PACK_HEADER) + ((((size_t) header->Count + MEMIO_BITPACK_BLOCK_SIZE - 1) / MEMIO_BITPACK_BLOCK_SIZE) * sizeof(MEMIO_DELTA_PACK_BLOCK));
+    o_block->DataOffset = ReadInline_ui32_lsb(entry,  0);
+    o_block->BitWidth   = ReadInline_ui32_lsb(entry,  4);
+    o_block->First      = ReadInline_ui64_lsb(entry,  8);
+    o_block->MinDelta   = ReadInline_ui64_lsb(entry, 16);
+    if (o_block->BitWidth == MEMIO_DELTA_PACK_RAW && header->ElementSize == sizeof(uint64_t)) {
+        bytes = count * sizeof(uint64_t);
+    } else if (o_block->BitWidth <= 32) {
+        bytes = BitPack32_GetSize(count, o_block->BitWidth);
+    } else {
+        return 0;
+    }
+    if (o_block->DataOffset < start || o_block->DataOffset > header->DataSize || bytes > header->DataSize - o_block->DataOffset) {
+        return 0;
+    }
+    return count;
+}
+
+/* @summary Write the directory entry for one block of an array being encoded by DeltaPack32 or DeltaPack64.
+ * @param dst A pointer to the start of the encoded array.
+ * @param block_index The zero-based index of the block.
+ * @param data_offset The byte offset of the packed data of the block from dst.
+ * @param bit_width The number of bits stored per delta, or MEMIO_DELTA_PACK_RAW.
+ * @param first The value of the First field.
+ * @param min_delta The value of the MinDelta field.
+ */
+static void
+DeltaPackWriteBlock
+(
+    void          *dst, 
+    size_t block_index, 
+    size_t data_offset, 
+    uint32_t bit_width, 
+    uint64_t     first, 
+    uint64_t min_delta
+)
+{
+    uint8_t *entry = (uint8_t*) dst + sizeof(MEMIO_DELTA_PACK_HEADER) + (block_index * sizeof(MEMIO_DELTA_PACK_BLOCK));
+    WriteInline_ui32_lsb(entry, (uint32_t) data_offset,  0);
+    WriteInline_ui32_lsb(entry, bit_width           ,  4);
+    WriteInline_ui64_lsb(entry, first               ,  8);
+    WriteInline_ui64_lsb(entry, min_delta           , 16);
+}
+
+/* @summary Write the header of an array being encoded by DeltaPack32 or DeltaPack64.
+ * @param dst A pointer to the start of the encoded array.
+ * @param element_size The size of each value, 4 or 8.
+ * @param count The number of values in the array.
+ * @param data_size The total size of the encoded array, in bytes.
+ */
+static void
+DeltaPackWriteHeader
+(
+    void               *dst, 
+    uint32_t   element_size, 
+    size_t            count, 
+    size_t        data_size
+)
+{
+    WriteInline_ui32_lsb(dst, MEMIO_DELTA_PACK_MAGIC,  0);
+    WriteInline_ui32_lsb(dst, element_size          ,  4);
+    WriteInline_ui32_lsb(dst, (uint32_t) count      ,  8);
+    WriteInline_ui32_lsb(dst, (uint32_t) data_size  , 12);
+}
+
+PIL_API(size_t)
+DeltaPack32
+(
+    void                *dst, 
+    uint32_t const      *src, 
+    size_t             count
+)
+{
+    uint32_t  deltas[MEMIO_BITPACK_BLOCK_SIZE];
+    size_t    nblock = (count + MEMIO_BITPACK_BLOCK_SIZE - 1) / MEMIO_BITPACK_BLOCK_SIZE;
+    size_t    offset = sizeof(MEMIO_DELTA_PACK_HEADER) + (nblock * sizeof(MEMIO_DELTA_PACK_BLOCK));
+    size_t         b;
+
+    assert(count <= 0xFFFFFFFFUL);
+    for (b = 0; b < nblock; ++b) {
+        uint32_t const *v = src + (b * MEMIO_BITPACK_BLOCK_SIZE);
+        size_t          n = count - (b * MEMIO_BITPACK_BLOCK_SIZE);
+        int32_t       min = 0;
+        uint32_t    width;
+        size_t          i;
+
+        n = n < MEMIO_BITPACK_BLOCK_SIZE ? n : MEMIO_BITPACK_BLOCK_SIZE;
+        if (n > 1) {
+            /* the frame of reference is the smallest delta, taken as a signed 
+             * value so that small backward steps in nearly-sorted data stay small */
+            min = (int32_t)(v[1] - v[0]);
+            for (i = 1; i < n; ++i) {
+                int32_t d = (int32_t)(v[i] - v[i-1]);
+                min = d < min ? d : min;
+            }
+        }
+        deltas[0] = 0;
+        for (i = 1; i < n; ++i) {
+            deltas[i] = (v[i] - v[i-1]) - (uint32_t) min;
+        }
+        /* First is adjusted so that adding MinDelta to the zero first delta yields v[0] */
+        width = BitWidth32(deltas, n);
+        DeltaPackWriteBlock(dst, b, offset, width, (uint32_t)(v[0] - (uint32_t) min), (uint64_t)(int64_t) min);
+        offset += BitPack32((uint8_t*) dst + offset, deltas, n, width);
+    }
+    DeltaPackWriteHeader(dst, sizeof(uint32_t), count, offset);
+    return offset;
+}
+
+PIL_API(size_t)
+DeltaPack64
+(
+    void                *dst, 
+    uint64_t const      *src, 
+    size_t             count
+)
+{
+    uint32_t  deltas[MEMIO_BITPACK_BLOCK_SIZE];
+    size_t    nblock = (count + MEMIO_BITPACK_BLOCK_SIZE - 1) / MEMIO_BITPACK_BLOCK_SIZE;
+    size_t    offset = sizeof(MEMIO_DELTA_PACK_HEADER) + (nblock * sizeof(MEMIO_DELTA_PACK_BLOCK));
+    size_t         b;
+
+    assert(count <= 0xFFFFFFFFUL);
+    for (b = 0; b < nblock; ++b) {
+        uint64_t const *v = src + (b * MEMIO_BITPACK_BLOCK_SIZE);
+        size_t          n = count - (b * MEMIO_BITPACK_BLOCK_SIZE);
+        int64_t       min = 0;
+        uint64_t    range = 0;
+        uint32_t    width;
+        size_t          i;
+
+        n = n < MEMIO_BITPACK_BLOCK_SIZE ? n : MEMIO_BITPACK_BLOCK_SIZE;
+        if (n > 1) {
+            min = (int64_t)(v[1] - v[0]);
+            for (i = 1; i < n; ++i) {
+                int64_t d = (int64_t)(v[i] - v[i-1]);
+                min = d < min ? d : min;
+            }
+        }
+        for (i = 1; i < n; ++i) {
+            uint64_t d = (v[i] - v[i-1]) - (uint64_t) min;
+            range = d > range ? d : range;
+        }
+        if (range > 0xFFFFFFFFULL) {
+            /* the deltas do not fit in 32 bits, so store the block unpacked */
+            DeltaPackWriteBlock(dst, b, offset, MEMIO_DELTA_PACK_RAW, v[0], 0);
+            offset += WriteArray_ui64_lsb((uint8_t*) dst + offset, v, n);
+            continue;
+        }
+        deltas[0] = 0;
+        for (i = 1; i < n; ++i) {
+            deltas[i] = (uint32_t)((v[i] - v[i-1]) - (uint64_t) min);
+        }
+        width = BitWidth32(deltas, n);
+        DeltaPackWriteBlock(dst, b, offset, width, v[0] - (uint64_t) min, (uint64_t) min);
+        offset += BitPack32((uint8_t*) dst + offset, deltas, n, width);
+    }
+    DeltaPackWriteHeader(dst, sizeof(uint64_t), count, offset);
+    return offset;
+}
+
+PIL_API(size_t)
+DeltaPackGetCount
+(
+    void const          *src, 
+    size_t          src_size, 
+    uint32_t    element_size
+)
+{
+    MEMIO_DELTA_PACK_HEADER header;
+    if (DeltaPackReadHeader(&header, src, src_size, element_size) != 0) {
+        return 0;
+    }
+    return header.Count;
+}
+
+/* @summary Decode one block of an array encoded by DeltaPack32, given its validated header.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded array.
+ * @param header The header returned by DeltaPackReadHeader.
+ * @param block_index The zero-based index of the block to decode.
+ * @return The number of values written to dst, or zero if the block is invalid.
+ */
+static size_t
+DeltaUnpackBlock32_Header
+(
+    uint32_t                                 *dst, 
+    void const                               *src, 
+    struct MEMIO_DELTA_PACK_HEADER const  *header, 
+    size_t                            block_index
+)
+{
+    MEMIO_DELTA_PACK_BLOCK block;
+    size_t     n = DeltaPackReadBlock(&block, src, header, block_index);
+    uint32_t run = (uint32_t) block.First;
+    uint32_t   m = (uint32_t) block.MinDelta;
+    size_t     i = 0;
+
+    if (n == 0) {
+        return 0;
+    }
+    BitUnpack32(dst, (uint8_t const*) src + block.DataOffset, n, block.BitWidth);
+    /* restore the values with an inclusive prefix sum, four lanes at a time */
+#if MEMIO_USE_SSE2
+    {
+        __m128i mv = _mm_set1_epi32((int) m);
+        __m128i rv = _mm_set1_epi32((int) run);
+        for ( ; i + 4 <= n; i += 4) {
+            __m128i x = _mm_add_epi32(_mm_loadu_si128((__m128i const*)(dst + i)), mv);
+            x  = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x  = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x  = _mm_add_epi32(x, rv);
+            _mm_storeu_si128((__m128i*)(dst + i), x);
+            rv = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        run = (uint32_t) _mm_cvtsi128_si32(rv);
+    }
+#elif MEMIO_USE_NEON
+    {
+        uint32x4_t mv = vdupq_n_u32(m);
+        uint32x4_t rv = vdupq_n_u32(run);
+        uint32x4_t zv = vdupq_n_u32(0);
+        for ( ; i + 4 <= n; i += 4) {
+            uint32x4_t x = vaddq_u32(vld1q_u32(dst + i), mv);
+            x  = vaddq_u32(x, vextq_u32(zv, x, 3));
+            x  = vaddq_u32(x, vextq_u32(zv, x, 2));
+            x  = vaddq_u32(x, rv);
+            vst1q_u32(dst + i, x);
+            rv = vdupq_laneq_u32(x, 3);
+        }
+        run = vgetq_lane_u32(rv, 0);
+    }
+#endif
+    for ( ; i < n; ++i) {
+        run   += dst[i] + m;
+        dst[i] = run;
+    }
+    return n;
+}
+
+/* @summary Decode one block of an array encoded by DeltaPack64, given its validated header.
+ * @param dst The array to which the values will be written.
+ * @param src A pointer to the encoded array.
+ * @param header The header returned by DeltaPackReadHeader.
+ * @param block_index The zero-based index of the block to decode.
+ * @return The number of values written to dst, or zero if the block is invalid.
+ */
+static size_t
+DeltaUnpackBlock64_Header
+(
+    uint64_t                                 *dst, 
+    void const                               *src, 
+    struct MEMIO_DELTA_PACK_HEADER const  *header, 
+    size_t                            block_index
+)
+{
+    MEMIO_DELTA_PACK_BLOCK block;
+    uint32_t  deltas[MEMIO_BITPACK_BLOCK_SIZE];
+    size_t     n = DeltaPackReadBlock(&block, src, header, block_index);
+    uint64_t run = block.First;
+    size_t     i;
+
+    if (n == 0) {
+        return 0;
+    }
+    if (block.BitWidth == MEMIO_DELTA_PACK_RAW) {
+        ReadArray_ui64_lsb(dst, (uint8_t const*) src + block.DataOffset, n);
+        return n;
+    }
+    BitUnpack32(deltas, (uint8_t const*) src + block.DataOffset, n, block.BitWidth);
+    for (i = 0; i < n; ++i) {
+        run   += deltas[i] + block.MinDelta;
+        dst[i] = run;
+    }
+    return n;
+}
+
+PIL_API(size_t)
+DeltaUnpack32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size
+)
+{
+    MEMIO_DELTA_PACK_HEADER header;
+    size_t                       i;
+    if (DeltaPackReadHeader(&header, src, src_size, sizeof(uint32_t)) != 0) {
+        return 0;
+    }
+    for (i = 0; i < header.Count; i += MEMIO_BITPACK_BLOCK_SIZE) {
+        if (DeltaUnpackBlock32_Header(dst + i, src, &header, i / MEMIO_BITPACK_BLOCK_SIZE) == 0) {
+            return 0;
+        }
+    }
+    return header.Count;
+}
+
+PIL_API(size_t)
+DeltaUnpack64
+(
+    uint64_t            *dst, 
+    void const          *src, 
+    size_t          src_size
+)
+{
+    MEMIO_DELTA_PACK_HEADER header;
+    size_t                       i;
+    if (DeltaPackReadHeader(&header, src, src_size, sizeof(uint64_t)) != 0) {
+        return 0;
+    }
+    for (i = 0; i < header.Count; i += MEMIO_BITPACK_BLOCK_SIZE) {
+        if (DeltaUnpackBlock64_Header(dst + i, src, &header, i / MEMIO_BITPACK_BLOCK_SIZE) == 0) {
+            return 0;
+        }
+    }
+    return header.Count;
+}
+
+PIL_API(size_t)
+DeltaUnpackBlock32
+(
+    uint32_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t       block_index
+)
+{
+    MEMIO_DELTA_PACK_HEADER header;
+    if (DeltaPackReadHeader(&header, src, src_size, sizeof(uint32_t)) != 0) {
+        return 0;
+    }
+    return DeltaUnpackBlock32_Header(dst, src, &header, block_index);
+}
+
+PIL_API(size_t)
+DeltaUnpackBlock64
+(
+    uint64_t            *dst, 
+    void const          *src, 
+    size_t          src_size, 
+    size_t       block_index
+)
+{
+    MEMIO_DELTA_PACK_HEADER header;
+    if (DeltaPackReadHeader(&header, src, src_size, sizeof(uint64_t)) != 0) {
+        return 0;
+    }
+    return DeltaUnpackBlock64_Header(dst, src, &header, block_index);
+}
+
+/* @summary Define constants used by the decimal text conversion functions.
+ * MEMIO_POW10_TABLE_MIN: The smallest power of ten in MemioPow10Table.
+ * MEMIO_POW10_TABLE_MAX: The largest power of ten in MemioPow10Table.
+ * MEMIO_DECIMAL_MAX_DIGITS: The number of significant digits passed to the C runtime when a floating point value cannot be parsed exactly. More digits never change the correctly rounded result, and any further non-zero digits are represented by a single trailing 1.
+ * MEMIO_DECIMAL_MAX_EXPONENT: The magnitude at which the exponent of parsed text is clamped. Any larger exponent overflows to infinity or underflows to zero.
+ */
+#ifndef MEMIO_DECIMAL_CONSTANTS
+#   define MEMIO_DECIMAL_CONSTANTS
+#   define MEMIO_POW10_TABLE_MIN        -292
+#   define MEMIO_POW10_TABLE_MAX         324
+#   define MEMIO_DECIMAL_MAX_DIGITS      800
+#   define MEMIO_DECIMAL_MAX_EXPONENT    100000
+#endif
+
+/* @summary Floating point values can be parsed using exact double or single precision arithmetic only where intermediate results are not kept at a higher precision, as they are with x87 code.
+ */
+#if MEMIO_USE_SSE2 || MEMIO_USE_NEON
+#   define MEMIO_USE_EXACT_FLOAT_PARSE  1
+#else
+#   define MEMIO_USE_EXACT_FLOAT_PARSE  0
+#endif
+
+/* @summary Define the kinds of special value recognized when parsing floating point text.
+ */
+typedef enum MEMIO_DECIMAL_SPECIAL {
+    MEMIO_DECIMAL_SPECIAL_NONE               = 0UL,                            /* The text is a finite number. */
+    MEMIO_DECIMAL_SPECIAL_INF                = 1UL,                            /* The text is inf or infinity. */
+    MEMIO_DECIMAL_SPECIAL_NAN                = 2UL,                            /* The text is nan. */
+} MEMIO_DECIMAL_SPECIAL;
+
+/* @summary Define an unsigned 128-bit value as a pair of 64-bit halves.
+ */
+typedef struct MEMIO_UINT128 {
+    uint64_t                       Hi;                                         /* The most-significant 64 bits. */
+    uint64_t                       Lo;                                         /* The least-significant 64 bits. */
+} MEMIO_UINT128;
+
+/* @summary Define the data produced by scanning decimal floating point text, before it is converted to binary.
+ */
+typedef struct MEMIO_DECIMAL_TEXT {
+    char const                    *Digits;                                     /* The first digit or decimal point of the significand. */
+    char const                    *DigitsEnd;                                  /* One past the last digit of the significand. */
+    uint64_t                       Mantissa;                                   /* Up to the first 19 significant digits of the significand, as an integer. */
+    int64_t                        Exponent;                                   /* The power of ten by which Mantissa is multiplied, including the explicit exponent. */
+    int64_t                        ExplicitExponent;                           /* The value following the e or E, clamped to MEMIO_DECIMAL_MAX_EXPONENT, or zero. */
+    int32_t                        Negative;                                   /* Non-zero if the text starts with a minus sign. */
+    int32_t                        Truncated;                                  /* Non-zero if non-zero significant digits did not fit in Mantissa. */
+    int32_t                        Special;                                    /* One of the values of the MEMIO_DECIMAL_SPECIAL enumeration. */
+    int32_t                        Reserved;                                   /* Zero. */
+} MEMIO_DECIMAL_TEXT;
+
+/* @summary The two-character text of each value from 0 to 99, so integers can be formatted two digits per division.
+ */
+static char const MemioDigitPairs[201] = 
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/* @summary The powers of ten that are exactly representable as 64-bit integers, used to count the digits of an integer.
+ */
+static uint64_t const MemioPow10Integer[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 
+    10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/* @summary The powers of ten that are exactly representable as double precision values, used by the exact parsing path.
+ */
+static double const MemioPow10F64[23] = {
+    1e0 , 1e1 , 1e2 , 1e3 , 1e4 , 1e5 , 1e6 , 1e7 , 1e8 , 1e9 , 1e10, 1e11, 
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* @summary The powers of ten that are exactly representable as single precision values, used by the exact parsing path.
+ */
+static float const MemioPow10F32[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+#if MEMIO_USE_SSSE3
+/* @summary Shuffle control vectors used to move the first n bytes of a vector to its end, filling the start with zero. The control for n bytes starts at index n.
+ */
+static uint8_t const MemioDigitAlign[32] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+};
+#endif
+
+/* @summary The 128-bit significands of the powers of ten from 10^MEMIO_POW10_TABLE_MIN to 10^MEMIO_POW10_TABLE_MAX, used by the shortest floating point formatting.
+ * Each entry is floor(10^k * 2^(127 - floor(log2(10^k)))) + 1, so that the most-significant bit is set and the value is never an underestimate.
+ */
+static MEMIO_UINT128 const MemioPow10Table[MEMIO_POW10_TABLE_MAX - MEMIO_POW10_TABLE_MIN + 1] = {
+    { 0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7BULL }, /* 1e-292 */
+    { 0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ADULL }, /* 1e-291 */
+    { 0xC795830D75038C1DULL, 0xD59DF5B9EF6A2418ULL }, /* 1e-290 */
+    { 0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1EULL }, /* 1e-289 */
+    { 0x9BECCE62836AC577ULL, 0x4EE367F9430AEC33ULL }, /* 1e-288 */
+    { 0xC2E801FB244576D5ULL, 0x229C41F793CDA740ULL }, /* 1e-287 */
+    { 0xF3A20279ED56D48AULL, 0x6B43527578C11110ULL }, /* 1e-286 */
+    { 0x9845418C345644D6ULL, 0x830A13896B78AAAAULL }, /* 1e-285 */
+    { 0xBE5691EF416BD60CULL, 0x23CC986BC656D554ULL }, /* 1e-284 */
+    { 0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA9ULL }, /* 1e-283 */
+    { 0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6AAULL }, /* 1e-282 */
+    { 0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC54ULL }, /* 1e-281 */
+    { 0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF69ULL }, /* 1e-280 */
+    { 0x91376C36D99995BEULL, 0x23100809B9C21FA2ULL }, /* 1e-279 */
+    { 0xB58547448FFFFB2DULL, 0xABD40A0C2832A78BULL }, /* 1e-278 */
+    { 0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516DULL }, /* 1e-277 */
+    { 0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E4ULL }, /* 1e-276 */
+    { 0xB1442798F49FFB4AULL, 0x99CD11CFDF41779DULL }, /* 1e-275 */
+    { 0xDD95317F31C7FA1DULL, 0x40405643D711D584ULL }, /* 1e-274 */
+    { 0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2573ULL }, /* 1e-273 */
+    { 0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EED0ULL }, /* 1e-272 */
+    { 0xD863B256369D4A40ULL, 0x90BED43E40076A83ULL }, /* 1e-271 */
+    { 0x873E4F75E2224E68ULL, 0x5A7744A6E804A292ULL }, /* 1e-270 */
+    { 0xA90DE3535AAAE202ULL, 0x711515D0A205CB37ULL }, /* 1e-269 */
+    { 0xD3515C2831559A83ULL, 0x0D5A5B44CA873E04ULL }, /* 1e-268 */
+    { 0x8412D9991ED58091ULL, 0xE858790AFE9486C3ULL }, /* 1e-267 */
+    { 0xA5178FFF668AE0B6ULL, 0x626E974DBE39A873ULL }, /* 1e-266 */
+    { 0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC81290ULL }, /* 1e-265 */
+    { 0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B9AULL }, /* 1e-264 */
+    { 0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E81ULL }, /* 1e-263 */
+    { 0xC987434744AC874EULL, 0xA327FFB266B56221ULL }, /* 1e-262 */
+    { 0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA9ULL }, /* 1e-261 */
+    { 0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4AAULL }, /* 1e-260 */
+    { 0xC4CE17B399107C22ULL, 0xCB550FB4384D21D4ULL }, /* 1e-259 */
+    { 0xF6019DA07F549B2BULL, 0x7E2A53A146606A49ULL }, /* 1e-258 */
+    { 0x99C102844F94E0FBULL, 0x2EDA7444CBFC426EULL }, /* 1e-257 */
+    { 0xC0314325637A1939ULL, 0xFA911155FEFB5309ULL }, /* 1e-256 */
+    { 0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CBULL }, /* 1e-255 */
+    { 0x96267C7535B763B5ULL, 0x4BC1558B2F3458DFULL }, /* 1e-254 */
+    { 0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F17ULL }, /* 1e-253 */
+    { 0xEA9C227723EE8BCBULL, 0x465E15A979C1CADDULL }, /* 1e-252 */
+    { 0x92A1958A7675175FULL, 0x0BFACD89EC191ECAULL }, /* 1e-251 */
+    { 0xB749FAED14125D36ULL, 0xCEF980EC671F667CULL }, /* 1e-250 */
+    { 0xE51C79A85916F484ULL, 0x82B7E12780E7401BULL }, /* 1e-249 */
+    { 0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908811ULL }, /* 1e-248 */
+    { 0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA16ULL }, /* 1e-247 */
+    { 0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49BULL }, /* 1e-246 */
+    { 0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E1ULL }, /* 1e-245 */
+    { 0xAECC49914078536DULL, 0x58FAE9F773886E19ULL }, /* 1e-244 */
+    { 0xDA7F5BF590966848ULL, 0xAF39A475506A899FULL }, /* 1e-243 */
+    { 0x888F99797A5E012DULL, 0x6D8406C952429604ULL }, /* 1e-242 */
+    { 0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B84ULL }, /* 1e-241 */
+    { 0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A65ULL }, /* 1e-240 */
+    { 0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A550680ULL }, /* 1e-239 */
+    { 0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481FULL }, /* 1e-238 */
+    { 0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA27ULL }, /* 1e-237 */
+    { 0x823C12795DB6CE57ULL, 0x76C53D08D6B70859ULL }, /* 1e-236 */
+    { 0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6FULL }, /* 1e-235 */
+    { 0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD0AULL }, /* 1e-234 */
+    { 0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4DULL }, /* 1e-233 */
+    { 0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DB0ULL }, /* 1e-232 */
+    { 0xC6B8E9B0709F109AULL, 0x359AB6419CA1091CULL }, /* 1e-231 */
+    { 0xF867241C8CC6D4C0ULL, 0xC30163D203C94B63ULL }, /* 1e-230 */
+    { 0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1EULL }, /* 1e-229 */
+    { 0xC21094364DFB5636ULL, 0x985915FC12F542E5ULL }, /* 1e-228 */
+    { 0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939EULL }, /* 1e-227 */
+    { 0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C43ULL }, /* 1e-226 */
+    { 0xBD8430BD08277231ULL, 0x50C6FF782A838354ULL }, /* 1e-225 */
+    { 0xECE53CEC4A314EBDULL, 0xA4F8BF5635246429ULL }, /* 1e-224 */
+    { 0x940F4613AE5ED136ULL, 0x871B7795E136BE9AULL }, /* 1e-223 */
+    { 0xB913179899F68584ULL, 0x28E2557B59846E40ULL }, /* 1e-222 */
+    { 0xE757DD7EC07426E5ULL, 0x331AEADA2FE589D0ULL }, /* 1e-221 */
+    { 0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7622ULL }, /* 1e-220 */
+    { 0xB4BCA50B065ABE63ULL, 0x0FED077A756B53AAULL }, /* 1e-219 */
+    { 0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62895ULL }, /* 1e-218 */
+    { 0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95DULL }, /* 1e-217 */
+    { 0xB080392CC4349DECULL, 0xBD8D794D96AACFB4ULL }, /* 1e-216 */
+    { 0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A1ULL }, /* 1e-215 */
+    { 0x89E42CAAF9491B60ULL, 0xF41686C49DB57245ULL }, /* 1e-214 */
+    { 0xAC5D37D5B79B6239ULL, 0x311C2875C522CED6ULL }, /* 1e-213 */
+    { 0xD77485CB25823AC7ULL, 0x7D633293366B828CULL }, /* 1e-212 */
+    { 0x86A8D39EF77164BCULL, 0xAE5DFF9C02033198ULL }, /* 1e-211 */
+    { 0xA8530886B54DBDEBULL, 0xD9F57F830283FDFDULL }, /* 1e-210 */
+    { 0xD267CAA862A12D66ULL, 0xD072DF63C324FD7CULL }, /* 1e-209 */
+    { 0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6EULL }, /* 1e-208 */
+    { 0xA46116538D0DEB78ULL, 0x52D9BE85F074E609ULL }, /* 1e-207 */
+    { 0xCD795BE870516656ULL, 0x67902E276C921F8CULL }, /* 1e-206 */
+    { 0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B7ULL }, /* 1e-205 */
+    { 0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A5ULL }, /* 1e-204 */
+    { 0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CEULL }, /* 1e-203 */
+    { 0xFAD2A4B13D1B5D6CULL, 0x796B805720085F82ULL }, /* 1e-202 */
+    { 0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB1ULL }, /* 1e-201 */
+    { 0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9DULL }, /* 1e-200 */
+    { 0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D45ULL }, /* 1e-199 */
+    { 0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4BULL }, /* 1e-198 */
+    { 0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635EULL }, /* 1e-197 */
+    { 0xEF340A98172AACE4ULL, 0x86FB897116C87C35ULL }, /* 1e-196 */
+    { 0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA1ULL }, /* 1e-195 */
+    { 0xBAE0A846D2195712ULL, 0x8974836059CCA10AULL }, /* 1e-194 */
+    { 0xE998D258869FACD7ULL, 0x2BD1A438703FC94CULL }, /* 1e-193 */
+    { 0x91FF83775423CC06ULL, 0x7B6306A34627DDD0ULL }, /* 1e-192 */
+    { 0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D543ULL }, /* 1e-191 */
+    { 0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A94ULL }, /* 1e-190 */
+    { 0x8E938662882AF53EULL, 0x547EB47B7282EE9DULL }, /* 1e-189 */
+    { 0xB23867FB2A35B28DULL, 0xE99E619A4F23AA44ULL }, /* 1e-188 */
+    { 0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D5ULL }, /* 1e-187 */
+    { 0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD05ULL }, /* 1e-186 */
+    { 0xAE0B158B4738705EULL, 0x9624AB50B148D446ULL }, /* 1e-185 */
+    { 0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0958ULL }, /* 1e-184 */
+    { 0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D7ULL }, /* 1e-183 */
+    { 0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4DULL }, /* 1e-182 */
+    { 0xD47487CC8470652BULL, 0x7647C32000696720ULL }, /* 1e-181 */
+    { 0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E074ULL }, /* 1e-180 */
+    { 0xA5FB0A17C777CF09ULL, 0xF468107100525891ULL }, /* 1e-179 */
+    { 0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB5ULL }, /* 1e-178 */
+    { 0x81AC1FE293D599BFULL, 0xC6F14CD848405531ULL }, /* 1e-177 */
+    { 0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7DULL }, /* 1e-176 */
+    { 0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851DULL }, /* 1e-175 */
+    { 0xFD442E4688BD304AULL, 0x908F4A166D1DA664ULL }, /* 1e-174 */
+    { 0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FFULL }, /* 1e-173 */
+    { 0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FEULL }, /* 1e-172 */
+    { 0xF7549530E188C128ULL, 0xD12BEE59E68EF47DULL }, /* 1e-171 */
+    { 0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CFULL }, /* 1e-170 */
+    { 0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF02ULL }, /* 1e-169 */
+    { 0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC2ULL }, /* 1e-168 */
+    { 0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0BAULL }, /* 1e-167 */
+    { 0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E8ULL }, /* 1e-166 */
+    { 0xEBDF661791D60F56ULL, 0x111B495B3464AD22ULL }, /* 1e-165 */
+    { 0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC35ULL }, /* 1e-164 */
+    { 0xB84687C269EF3BFBULL, 0x3D5D514F40EEA743ULL }, /* 1e-163 */
+    { 0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5113ULL }, /* 1e-162 */
+    { 0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ACULL }, /* 1e-161 */
+    { 0xB3F4E093DB73A093ULL, 0x59ED216765690F57ULL }, /* 1e-160 */
+    { 0xE0F218B8D25088B8ULL, 0x306869C13EC3532DULL }, /* 1e-159 */
+    { 0x8C974F7383725573ULL, 0x1E414218C73A13FCULL }, /* 1e-158 */
+    { 0xAFBD2350644EEACFULL, 0xE5D1929EF90898FBULL }, /* 1e-157 */
+    { 0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF3AULL }, /* 1e-156 */
+    { 0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB784ULL }, /* 1e-155 */
+    { 0xAB9EB47C81F5114FULL, 0x066EA92F3F326565ULL }, /* 1e-154 */
+    { 0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBEULL }, /* 1e-153 */
+    { 0x8613FD0145877585ULL, 0xBD06742CE95F5F37ULL }, /* 1e-152 */
+    { 0xA798FC4196E952E7ULL, 0x2C48113823B73705ULL }, /* 1e-151 */
+    { 0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C6ULL }, /* 1e-150 */
+    { 0x82EF85133DE648C4ULL, 0x9A984D73DBE722FCULL }, /* 1e-149 */
+    { 0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBBULL }, /* 1e-148 */
+    { 0xCC963FEE10B7D1B3ULL, 0x318DF905079926A9ULL }, /* 1e-147 */
+    { 0xFFBBCFE994E5C61FULL, 0xFDF17746497F7053ULL }, /* 1e-146 */
+    { 0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA634ULL }, /* 1e-145 */
+    { 0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC1ULL }, /* 1e-144 */
+    { 0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B1ULL }, /* 1e-143 */
+    { 0x9C1661A651213E2DULL, 0x06BEA10CA65C084FULL }, /* 1e-142 */
+    { 0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A63ULL }, /* 1e-141 */
+    { 0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFBULL }, /* 1e-140 */
+    { 0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01DULL }, /* 1e-139 */
+    { 0xBE89523386091465ULL, 0xF6BBB397F1135824ULL }, /* 1e-138 */
+    { 0xEE2BA6C0678B597FULL, 0x746AA07DED582E2DULL }, /* 1e-137 */
+    { 0x94DB483840B717EFULL, 0xA8C2A44EB4571CDDULL }, /* 1e-136 */
+    { 0xBA121A4650E4DDEBULL, 0x92F34D62616CE414ULL }, /* 1e-135 */
+    { 0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D18ULL }, /* 1e-134 */
+    { 0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122FULL }, /* 1e-133 */
+    { 0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BBULL }, /* 1e-132 */
+    { 0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C6AULL }, /* 1e-131 */
+    { 0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C2ULL }, /* 1e-130 */
+    { 0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB3ULL }, /* 1e-129 */
+    { 0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDFULL }, /* 1e-128 */
+    { 0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96CULL }, /* 1e-127 */
+    { 0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C7ULL }, /* 1e-126 */
+    { 0xD89D64D57A607744ULL, 0xE871C7BF077BA8B8ULL }, /* 1e-125 */
+    { 0x87625F056C7C4A8BULL, 0x11471CD764AD4973ULL }, /* 1e-124 */
+    { 0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BD0ULL }, /* 1e-123 */
+    { 0xD389B47879823479ULL, 0x4AFF1D108D4EC2C4ULL }, /* 1e-122 */
+    { 0x843610CB4BF160CBULL, 0xCEDF722A585139BBULL }, /* 1e-121 */
+    { 0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658829ULL }, /* 1e-120 */
+    { 0xCE947A3DA6A9273EULL, 0x733D226229FEEA33ULL }, /* 1e-119 */
+    { 0x811CCC668829B887ULL, 0x0806357D5A3F5260ULL }, /* 1e-118 */
+    { 0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F8ULL }, /* 1e-117 */
+    { 0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B6ULL }, /* 1e-116 */
+    { 0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE3ULL }, /* 1e-115 */
+    { 0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0EULL }, /* 1e-114 */
+    { 0xC5029163F384A931ULL, 0x0A9E795E65D4DF12ULL }, /* 1e-113 */
+    { 0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D6ULL }, /* 1e-112 */
+    { 0x99EA0196163FA42EULL, 0x504BCED1BF8E4E46ULL }, /* 1e-111 */
+    { 0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D7ULL }, /* 1e-110 */
+    { 0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4DULL }, /* 1e-109 */
+    { 0x964E858C91BA2655ULL, 0x3A6A07F8D510F870ULL }, /* 1e-108 */
+    { 0xBBE226EFB628AFEAULL, 0x890489F70A55368CULL }, /* 1e-107 */
+    { 0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842FULL }, /* 1e-106 */
+    { 0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929EULL }, /* 1e-105 */
+    { 0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173745ULL }, /* 1e-104 */
+    { 0xE55990879DDCAABDULL, 0xCC420A6A101D0516ULL }, /* 1e-103 */
+    { 0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232EULL }, /* 1e-102 */
+    { 0xB32DF8E9F3546564ULL, 0x47939822DC96ABFAULL }, /* 1e-101 */
+    { 0xDFF9772470297EBDULL, 0x59787E2B93BC56F8ULL }, /* 1e-100 */
+    { 0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65BULL }, /* 1e-99 */
+    { 0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F2ULL }, /* 1e-98 */
+    { 0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEEULL }, /* 1e-97 */
+    { 0x88B402F7FD75539BULL, 0x11DBCB0218EBB415ULL }, /* 1e-96 */
+    { 0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A11AULL }, /* 1e-95 */
+    { 0xD59944A37C0752A2ULL, 0x4BE76D3346F04960ULL }, /* 1e-94 */
+    { 0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDCULL }, /* 1e-93 */
+    { 0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB953ULL }, /* 1e-92 */
+    { 0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A8ULL }, /* 1e-91 */
+    { 0x825ECC24C873782FULL, 0x8ED400668C0C28C9ULL }, /* 1e-90 */
+    { 0xA2F67F2DFA90563BULL, 0x728900802F0F32FBULL }, /* 1e-89 */
+    { 0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFBAULL }, /* 1e-88 */
+    { 0xFEA126B7D78186BCULL, 0xE2F610C84987BFA9ULL }, /* 1e-87 */
+    { 0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7CAULL }, /* 1e-86 */
+    { 0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBCULL }, /* 1e-85 */
+    { 0xF8A95FCF88747D94ULL, 0x75A44C6397CE912BULL }, /* 1e-84 */
+    { 0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABBULL }, /* 1e-83 */
+    { 0xC24452DA229B021BULL, 0xFBE85BADCE996169ULL }, /* 1e-82 */
+    { 0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C4ULL }, /* 1e-81 */
+    { 0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41BULL }, /* 1e-80 */
+    { 0xBDB6B8E905CB600FULL, 0x5400E987BBC1C921ULL }, /* 1e-79 */
+    { 0xED246723473E3813ULL, 0x290123E9AAB23B69ULL }, /* 1e-78 */
+    { 0x9436C0760C86E30BULL, 0xF9A0B6720AAF6522ULL }, /* 1e-77 */
+    { 0xB94470938FA89BCEULL, 0xF808E40E8D5B3E6AULL }, /* 1e-76 */
+    { 0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E05ULL }, /* 1e-75 */
+    { 0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C3ULL }, /* 1e-74 */
+    { 0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF4ULL }, /* 1e-73 */
+    { 0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B1ULL }, /* 1e-72 */
+    { 0x8D590723948A535FULL, 0x579C487E5A38AD0FULL }, /* 1e-71 */
+    { 0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D852ULL }, /* 1e-70 */
+    { 0xDCDB1B2798182244ULL, 0xF8E431456CF88E66ULL }, /* 1e-69 */
+    { 0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B5900ULL }, /* 1e-68 */
+    { 0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F40ULL }, /* 1e-67 */
+    { 0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB10ULL }, /* 1e-66 */
+    { 0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4EAULL }, /* 1e-65 */
+    { 0xA87FEA27A539E9A5ULL, 0x3F2398D747B36225ULL }, /* 1e-64 */
+    { 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AAEULL }, /* 1e-63 */
+    { 0x83A3EEEEF9153E89ULL, 0x1953CF68300424ADULL }, /* 1e-62 */
+    { 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD8ULL }, /* 1e-61 */
+    { 0xCDB02555653131B6ULL, 0x3792F412CB06794EULL }, /* 1e-60 */
+    { 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD1ULL }, /* 1e-59 */
+    { 0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC5ULL }, /* 1e-58 */
+    { 0xC8DE047564D20A8BULL, 0xF245825A5A445276ULL }, /* 1e-57 */
+    { 0xFB158592BE068D2EULL, 0xEED6E2F0F0D56713ULL }, /* 1e-56 */
+    { 0x9CED737BB6C4183DULL, 0x55464DD69685606CULL }, /* 1e-55 */
+    { 0xC428D05AA4751E4CULL, 0xAA97E14C3C26B887ULL }, /* 1e-54 */
+    { 0xF53304714D9265DFULL, 0xD53DD99F4B3066A9ULL }, /* 1e-53 */
+    { 0x993FE2C6D07B7FABULL, 0xE546A8038EFE402AULL }, /* 1e-52 */
+    { 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD034ULL }, /* 1e-51 */
+    { 0xEF73D256A5C0F77CULL, 0x963E66858F6D4441ULL }, /* 1e-50 */
+    { 0x95A8637627989AADULL, 0xDDE7001379A44AA9ULL }, /* 1e-49 */
+    { 0xBB127C53B17EC159ULL, 0x5560C018580D5D53ULL }, /* 1e-48 */
+    { 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A7ULL }, /* 1e-47 */
+    { 0x9226712162AB070DULL, 0xCAB3961304CA70E9ULL }, /* 1e-46 */
+    { 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D23ULL }, /* 1e-45 */
+    { 0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506BULL }, /* 1e-44 */
+    { 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB243ULL }, /* 1e-43 */
+    { 0xB267ED1940F1C61CULL, 0x55F038B237591ED4ULL }, /* 1e-42 */
+    { 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6689ULL }, /* 1e-41 */
+    { 0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA016ULL }, /* 1e-40 */
+    { 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081BULL }, /* 1e-39 */
+    { 0xD9C7DCED53C72255ULL, 0x96E7BD358C904A22ULL }, /* 1e-38 */
+    { 0x881CEA14545C7575ULL, 0x7E50D64177DA2E55ULL }, /* 1e-37 */
+    { 0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9EAULL }, /* 1e-36 */
+    { 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E865ULL }, /* 1e-35 */
+    { 0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113FULL }, /* 1e-34 */
+    { 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58FULL }, /* 1e-33 */
+    { 0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF3ULL }, /* 1e-32 */
+    { 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED8ULL }, /* 1e-31 */
+    { 0xA2425FF75E14FC31ULL, 0xA1258379A94D028EULL }, /* 1e-30 */
+    { 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04331ULL }, /* 1e-29 */
+    { 0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FDULL }, /* 1e-28 */
+    { 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL }, /* 1e-27 */
+    { 0xC612062576589DDAULL, 0x95364AFE032A819EULL }, /* 1e-26 */
+    { 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL }, /* 1e-25 */
+    { 0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL }, /* 1e-24 */
+    { 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL }, /* 1e-23 */
+    { 0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL }, /* 1e-22 */
+    { 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL }, /* 1e-21 */
+    { 0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL }, /* 1e-20 */
+    { 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL }, /* 1e-19 */
+    { 0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL }, /* 1e-18 */
+    { 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL }, /* 1e-17 */
+    { 0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL }, /* 1e-16 */
+    { 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL }, /* 1e-15 */
+    { 0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL }, /* 1e-14 */
+    { 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL }, /* 1e-13 */
+    { 0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL }, /* 1e-12 */
+    { 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL }, /* 1e-11 */
+    { 0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL }, /* 1e-10 */
+    { 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL }, /* 1e-9 */
+    { 0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL }, /* 1e-8 */
+    { 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL }, /* 1e-7 */
+    { 0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL }, /* 1e-6 */
+    { 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL }, /* 1e-5 */
+    { 0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL }, /* 1e-4 */
+    { 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL }, /* 1e-3 */
+    { 0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL }, /* 1e-2 */
+    { 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL }, /* 1e-1 */
+    { 0x8000000000000000ULL, 0x0000000000000001ULL }, /* 1e0 */
+    { 0xA000000000000000ULL, 0x0000000000000001ULL }, /* 1e1 */
+    { 0xC800000000000000ULL, 0x0000000000000001ULL }, /* 1e2 */
+    { 0xFA00000000000000ULL, 0x0000000000000001ULL }, /* 1e3 */
+    { 0x9C40000000000000ULL, 0x0000000000000001ULL }, /* 1e4 */
+    { 0xC350000000000000ULL, 0x0000000000000001ULL }, /* 1e5 */
+    { 0xF424000000000000ULL, 0x0000000000000001ULL }, /* 1e6 */
+    { 0x9896800000000000ULL, 0x0000000000000001ULL }, /* 1e7 */
+    { 0xBEBC200000000000ULL, 0x0000000000000001ULL }, /* 1e8 */
+    { 0xEE6B280000000000ULL, 0x0000000000000001ULL }, /* 1e9 */
+    { 0x9502F90000000000ULL, 0x0000000000000001ULL }, /* 1e10 */
+    { 0xBA43B74000000000ULL, 0x0000000000000001ULL }, /* 1e11 */
+    { 0xE8D4A51000000000ULL, 0x0000000000000001ULL }, /* 1e12 */
+    { 0x9184E72A00000000ULL, 0x0000000000000001ULL }, /* 1e13 */
+    { 0xB5E620F480000000ULL, 0x0000000000000001ULL }, /* 1e14 */
+    { 0xE35FA931A0000000ULL, 0x0000000000000001ULL }, /* 1e15 */
+    { 0x8E1BC9BF04000000ULL, 0x0000000000000001ULL }, /* 1e16 */
+    { 0xB1A2BC2EC5000000ULL, 0x0000000000000001ULL }, /* 1e17 */
+    { 0xDE0B6B3A76400000ULL, 0x0000000000000001ULL }, /* 1e18 */
+    { 0x8AC7230489E80000ULL, 0x0000000000000001ULL }, /* 1e19 */
+    { 0xAD78EBC5AC620000ULL, 0x0000000000000001ULL }, /* 1e20 */
+    { 0xD8D726B7177A8000ULL, 0x0000000000000001ULL }, /* 1e21 */
+    { 0x878678326EAC9000ULL, 0x0000000000000001ULL }, /* 1e22 */
+    { 0xA968163F0A57B400ULL, 0x0000000000000001ULL }, /* 1e23 */
+    { 0xD3C21BCECCEDA100ULL, 0x0000000000000001ULL }, /* 1e24 */
+    { 0x84595161401484A0ULL, 0x0000000000000001ULL }, /* 1e25 */
+    { 0xA56FA5B99019A5C8ULL, 0x0000000000000001ULL }, /* 1e26 */
+    { 0xCECB8F27F4200F3AULL, 0x0000000000000001ULL }, /* 1e27 */
+    { 0x813F3978F8940984ULL, 0x4000000000000001ULL }, /* 1e28 */
+    { 0xA18F07D736B90BE5ULL, 0x5000000000000001ULL }, /* 1e29 */
+    { 0xC9F2C9CD04674EDEULL, 0xA400000000000001ULL }, /* 1e30 */
+    { 0xFC6F7C4045812296ULL, 0x4D00000000000001ULL }, /* 1e31 */
+    { 0x9DC5ADA82B70B59DULL, 0xF020000000000001ULL }, /* 1e32 */
+    { 0xC5371912364CE305ULL, 0x6C28000000000001ULL }, /* 1e33 */
+    { 0xF684DF56C3E01BC6ULL, 0xC732000000000001ULL }, /* 1e34 */
+    { 0x9A130B963A6C115CULL, 0x3C7F400000000001ULL }, /* 1e35 */
+    { 0xC097CE7BC90715B3ULL, 0x4B9F100000000001ULL }, /* 1e36 */
+    { 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000001ULL }, /* 1e37 */
+    { 0x96769950B50D88F4ULL, 0x1314448000000001ULL }, /* 1e38 */
+    { 0xBC143FA4E250EB31ULL, 0x17D955A000000001ULL }, /* 1e39 */
+    { 0xEB194F8E1AE525FDULL, 0x5DCFAB0800000001ULL }, /* 1e40 */
+    { 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000001ULL }, /* 1e41 */
+    { 0xB7ABC627050305ADULL, 0xF14A3D9E40000001ULL }, /* 1e42 */
+    { 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000001ULL }, /* 1e43 */
+    { 0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000001ULL }, /* 1e44 */
+    { 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800001ULL }, /* 1e45 */
+    { 0xE0352F62A19E306EULL, 0xD50B2037AD200001ULL }, /* 1e46 */
+    { 0x8C213D9DA502DE45ULL, 0x4526F422CC340001ULL }, /* 1e47 */
+    { 0xAF298D050E4395D6ULL, 0x9670B12B7F410001ULL }, /* 1e48 */
+    { 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114001ULL }, /* 1e49 */
+    { 0x88D8762BF324CD0FULL, 0xA5880A69FB6AC801ULL }, /* 1e50 */
+    { 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A01ULL }, /* 1e51 */
+    { 0xD5D238A4ABE98068ULL, 0x72A4904598D6D881ULL }, /* 1e52 */
+    { 0x85A36366EB71F041ULL, 0x47A6DA2B7F864751ULL }, /* 1e53 */
+    { 0xA70C3C40A64E6C51ULL, 0x999090B65F67D925ULL }, /* 1e54 */
+    { 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6EULL }, /* 1e55 */
+    { 0x82818F1281ED449FULL, 0xBFF8F10E7A8921A5ULL }, /* 1e56 */
+    { 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0EULL }, /* 1e57 */
+    { 0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764491ULL }, /* 1e58 */
+    { 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B5ULL }, /* 1e59 */
+    { 0x9F4F2726179A2245ULL, 0x01D762422C946591ULL }, /* 1e60 */
+    { 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF6ULL }, /* 1e61 */
+    { 0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB3ULL }, /* 1e62 */
+    { 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB30ULL }, /* 1e63 */
+    { 0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FCULL }, /* 1e64 */
+    { 0xF316271C7FC3908AULL, 0x8BEF464E3945EF7BULL }, /* 1e65 */
+    { 0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ADULL }, /* 1e66 */
+    { 0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA318ULL }, /* 1e67 */
+    { 0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDEULL }, /* 1e68 */
+    { 0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6BULL }, /* 1e69 */
+    { 0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B45ULL }, /* 1e70 */
+    { 0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B617ULL }, /* 1e71 */
+    { 0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CEULL }, /* 1e72 */
+    { 0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE42ULL }, /* 1e73 */
+    { 0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD2ULL }, /* 1e74 */
+    { 0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA3ULL }, /* 1e75 */
+    { 0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCCULL }, /* 1e76 */
+    { 0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBFULL }, /* 1e77 */
+    { 0x8A2DBF142DFCC7ABULL, 0x6E3569326C784338ULL }, /* 1e78 */
+    { 0xACB92ED9397BF996ULL, 0x49C2C37F07965405ULL }, /* 1e79 */
+    { 0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE907ULL }, /* 1e80 */
+    { 0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A4ULL }, /* 1e81 */
+    { 0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0DULL }, /* 1e82 */
+    { 0xD2D80DB02AABD62BULL, 0xF50A3FA490C30191ULL }, /* 1e83 */
+    { 0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FBULL }, /* 1e84 */
+    { 0xA4B8CAB1A1563F52ULL, 0x577001B891185939ULL }, /* 1e85 */
+    { 0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F87ULL }, /* 1e86 */
+    { 0x80B05E5AC60B6178ULL, 0x544F8158315B05B5ULL }, /* 1e87 */
+    { 0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C722ULL }, /* 1e88 */
+    { 0xC913936DD571C84CULL, 0x03BC3A19CD1E38EAULL }, /* 1e89 */
+    { 0xFB5878494ACE3A5FULL, 0x04AB48A04065C724ULL }, /* 1e90 */
+    { 0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C77ULL }, /* 1e91 */
+    { 0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8395ULL }, /* 1e92 */
+    { 0xF5746577930D6500ULL, 0xCA8F44EC7EE3647AULL }, /* 1e93 */
+    { 0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECCULL }, /* 1e94 */
+    { 0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67FULL }, /* 1e95 */
+    { 0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101FULL }, /* 1e96 */
+    { 0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A13ULL }, /* 1e97 */
+    { 0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC98ULL }, /* 1e98 */
+    { 0xEA1575143CF97226ULL, 0xF52D09D71A3293BEULL }, /* 1e99 */
+    { 0x924D692CA61BE758ULL, 0x593C2626705F9C57ULL }, /* 1e100 */
+    { 0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836DULL }, /* 1e101 */
+    { 0xE498F455C38B997AULL, 0x0B6DFB9C0F956448ULL }, /* 1e102 */
+    { 0x8EDF98B59A373FECULL, 0x4724BD4189BD5EADULL }, /* 1e103 */
+    { 0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB658ULL }, /* 1e104 */
+    { 0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EEULL }, /* 1e105 */
+    { 0x8B865B215899F46CULL, 0xBD79E0D20082EE75ULL }, /* 1e106 */
+    { 0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA12ULL }, /* 1e107 */
+    { 0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9496ULL }, /* 1e108 */
+    { 0x884134FE908658B2ULL, 0x3109058D147FDCDEULL }, /* 1e109 */
+    { 0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD416ULL }, /* 1e110 */
+    { 0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91BULL }, /* 1e111 */
+    { 0x850FADC09923329EULL, 0x03E2CF6BC604DDB1ULL }, /* 1e112 */
+    { 0xA6539930BF6BFF45ULL, 0x84DB8346B786151DULL }, /* 1e113 */
+    { 0xCFE87F7CEF46FF16ULL, 0xE612641865679A64ULL }, /* 1e114 */
+    { 0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07FULL }, /* 1e115 */
+    { 0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09EULL }, /* 1e116 */
+    { 0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC6ULL }, /* 1e117 */
+    { 0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F7ULL }, /* 1e118 */
+    { 0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFBULL }, /* 1e119 */
+    { 0xC646D63501A1511DULL, 0xB281E1FD541501B9ULL }, /* 1e120 */
+    { 0xF7D88BC24209A565ULL, 0x1F225A7CA91A4227ULL }, /* 1e121 */
+    { 0x9AE757596946075FULL, 0x3375788DE9B06959ULL }, /* 1e122 */
+    { 0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AFULL }, /* 1e123 */
+    { 0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49BULL }, /* 1e124 */
+    { 0x9745EB4D50CE6332ULL, 0xF840B7BA963646E1ULL }, /* 1e125 */
+    { 0xBD176620A501FBFFULL, 0xB650E5A93BC3D899ULL }, /* 1e126 */
+    { 0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBFULL }, /* 1e127 */
+    { 0x93BA47C980E98CDFULL, 0xC66F336C36B10138ULL }, /* 1e128 */
+    { 0xB8A8D9BBE123F017ULL, 0xB80B0047445D4185ULL }, /* 1e129 */
+    { 0xE6D3102AD96CEC1DULL, 0xA60DC059157491E6ULL }, /* 1e130 */
+    { 0x9043EA1AC7E41392ULL, 0x87C89837AD68DB30ULL }, /* 1e131 */
+    { 0xB454E4A179DD1877ULL, 0x29BABE4598C311FCULL }, /* 1e132 */
+    { 0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67BULL }, /* 1e133 */
+    { 0x8CE2529E2734BB1DULL, 0x1899E4A65F58660DULL }, /* 1e134 */
+    { 0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F90ULL }, /* 1e135 */
+    { 0xDC21A1171D42645DULL, 0x76707543F4FA1F74ULL }, /* 1e136 */
+    { 0x899504AE72497EBAULL, 0x6A06494A791C53A9ULL }, /* 1e137 */
+    { 0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636893ULL }, /* 1e138 */
+    { 0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B7ULL }, /* 1e139 */
+    { 0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B3ULL }, /* 1e140 */
+    { 0xA7F26836F282B732ULL, 0x8E6CAC7768D7141FULL }, /* 1e141 */
+    { 0xD1EF0244AF2364FFULL, 0x3207D795430CD927ULL }, /* 1e142 */
+    { 0x8335616AED761F1FULL, 0x7F44E6BD49E807B9ULL }, /* 1e143 */
+    { 0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A7ULL }, /* 1e144 */
+    { 0xCD036837130890A1ULL, 0x36DBA887C37A8C10ULL }, /* 1e145 */
+    { 0x802221226BE55A64ULL, 0xC2494954DA2C978AULL }, /* 1e146 */
+    { 0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6DULL }, /* 1e147 */
+    { 0xC83553C5C8965D3DULL, 0x6F92829494E5ACC8ULL }, /* 1e148 */
+    { 0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17FAULL }, /* 1e149 */
+    { 0x9C69A97284B578D7ULL, 0xFF2A760414536EFCULL }, /* 1e150 */
+    { 0xC38413CF25E2D70DULL, 0xFEF5138519684ABBULL }, /* 1e151 */
+    { 0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D6AULL }, /* 1e152 */
+    { 0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A62ULL }, /* 1e153 */
+    { 0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FBULL }, /* 1e154 */
+    { 0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF39ULL }, /* 1e155 */
+    { 0x952AB45CFA97A0B2ULL, 0xDD945A747BF26184ULL }, /* 1e156 */
+    { 0xBA756174393D88DFULL, 0x94F971119AEEF9E5ULL }, /* 1e157 */
+    { 0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85EULL }, /* 1e158 */
+    { 0x91ABB422CCB812EEULL, 0xAC62E055C10AB33BULL }, /* 1e159 */
+    { 0xB616A12B7FE617AAULL, 0x577B986B314D600AULL }, /* 1e160 */
+    { 0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80CULL }, /* 1e161 */
+    { 0x8E41ADE9FBEBC27DULL, 0x14588F13BE847308ULL }, /* 1e162 */
+    { 0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC9ULL }, /* 1e163 */
+    { 0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BCULL }, /* 1e164 */
+    { 0x8AEC23D680043BEEULL, 0x25DE7BB9480D5855ULL }, /* 1e165 */
+    { 0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6BULL }, /* 1e166 */
+    { 0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA05ULL }, /* 1e167 */
+    { 0x87AA9AFF79042286ULL, 0x90FB44D2F05D0843ULL }, /* 1e168 */
+    { 0xA99541BF57452B28ULL, 0x353A1607AC744A54ULL }, /* 1e169 */
+    { 0xD3FA922F2D1675F2ULL, 0x42889B8997915CE9ULL }, /* 1e170 */
+    { 0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA12ULL }, /* 1e171 */
+    { 0xA59BC234DB398C25ULL, 0x43FAB9837E699096ULL }, /* 1e172 */
+    { 0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BCULL }, /* 1e173 */
+    { 0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F6ULL }, /* 1e174 */
+    { 0xA1BA1BA79E1632DCULL, 0x6462D92A69731733ULL }, /* 1e175 */
+    { 0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFFULL }, /* 1e176 */
+    { 0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43FULL }, /* 1e177 */
+    { 0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A8ULL }, /* 1e178 */
+    { 0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD1ULL }, /* 1e179 */
+    { 0xF6C69A72A3989F5BULL, 0x8AAD549E57273D46ULL }, /* 1e180 */
+    { 0x9A3C2087A63F6399ULL, 0x36AC54E2F678864CULL }, /* 1e181 */
+    { 0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DEULL }, /* 1e182 */
+    { 0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D6ULL }, /* 1e183 */
+    { 0x969EB7C47859E743ULL, 0x9F644AE5A4B1B326ULL }, /* 1e184 */
+    { 0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEFULL }, /* 1e185 */
+    { 0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EBULL }, /* 1e186 */
+    { 0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F3ULL }, /* 1e187 */
+    { 0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB30ULL }, /* 1e188 */
+    { 0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FBULL }, /* 1e189 */
+    { 0x8FA475791A569D10ULL, 0xF96E017D694487BDULL }, /* 1e190 */
+    { 0xB38D92D760EC4455ULL, 0x37C981DCC395A9ADULL }, /* 1e191 */
+    { 0xE070F78D3927556AULL, 0x85BBE253F47B1418ULL }, /* 1e192 */
+    { 0x8C469AB843B89562ULL, 0x93956D7478CCEC8FULL }, /* 1e193 */
+    { 0xAF58416654A6BABBULL, 0x387AC8D1970027B3ULL }, /* 1e194 */
+    { 0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319FULL }, /* 1e195 */
+    { 0x88FCF317F22241E2ULL, 0x441FECE3BDF81F04ULL }, /* 1e196 */
+    { 0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C4ULL }, /* 1e197 */
+    { 0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B075ULL }, /* 1e198 */
+    { 0x85C7056562757456ULL, 0xF6872D5667844E4AULL }, /* 1e199 */
+    { 0xA738C6BEBB12D16CULL, 0xB428F8AC016561DCULL }, /* 1e200 */
+    { 0xD106F86E69D785C7ULL, 0xE13336D701BEBA53ULL }, /* 1e201 */
+    { 0x82A45B450226B39CULL, 0xECC0024661173474ULL }, /* 1e202 */
+    { 0xA34D721642B06084ULL, 0x27F002D7F95D0191ULL }, /* 1e203 */
+    { 0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F5ULL }, /* 1e204 */
+    { 0xFF290242C83396CEULL, 0x7E67047175A15272ULL }, /* 1e205 */
+    { 0x9F79A169BD203E41ULL, 0x0F0062C6E984D387ULL }, /* 1e206 */
+    { 0xC75809C42C684DD1ULL, 0x52C07B78A3E60869ULL }, /* 1e207 */
+    { 0xF92E0C3537826145ULL, 0xA7709A56CCDF8A83ULL }, /* 1e208 */
+    { 0x9BBCC7A142B17CCBULL, 0x88A66076400BB692ULL }, /* 1e209 */
+    { 0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA436ULL }, /* 1e210 */
+    { 0xF356F7EBF83552FEULL, 0x0583F6B8C4124D44ULL }, /* 1e211 */
+    { 0x98165AF37B2153DEULL, 0xC3727A337A8B704BULL }, /* 1e212 */
+    { 0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5DULL }, /* 1e213 */
+    { 0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF74ULL }, /* 1e214 */
+    { 0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA9ULL }, /* 1e215 */
+    { 0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173693ULL }, /* 1e216 */
+    { 0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0438ULL }, /* 1e217 */
+    { 0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A3ULL }, /* 1e218 */
+    { 0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4CULL }, /* 1e219 */
+    { 0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61EULL }, /* 1e220 */
+    { 0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D3ULL }, /* 1e221 */
+    { 0xB10D8E1456105DADULL, 0x7425A83E872C5F48ULL }, /* 1e222 */
+    { 0xDD50F1996B947518ULL, 0xD12F124E28F7771AULL }, /* 1e223 */
+    { 0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA70ULL }, /* 1e224 */
+    { 0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550CULL }, /* 1e225 */
+    { 0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4FULL }, /* 1e226 */
+    { 0x8714A775E3E95C78ULL, 0x65ACFAEC34810A72ULL }, /* 1e227 */
+    { 0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0EULL }, /* 1e228 */
+    { 0xD31045A8341CA07CULL, 0x1EDE48111209A051ULL }, /* 1e229 */
+    { 0x83EA2B892091E44DULL, 0x934AED0AAB460433ULL }, /* 1e230 */
+    { 0xA4E4B66B68B65D60ULL, 0xF81DA84D56178540ULL }, /* 1e231 */
+    { 0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668FULL }, /* 1e232 */
+    { 0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B42601AULL }, /* 1e233 */
+    { 0xA1075A24E4421730ULL, 0xB24CF65B8612F820ULL }, /* 1e234 */
+    { 0xC94930AE1D529CFCULL, 0xDEE033F26797B628ULL }, /* 1e235 */
+    { 0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B2ULL }, /* 1e236 */
+    { 0x9D412E0806E88AA5ULL, 0x8E1F289560EE864FULL }, /* 1e237 */
+    { 0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E3ULL }, /* 1e238 */
+    { 0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DCULL }, /* 1e239 */
+    { 0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF2AULL }, /* 1e240 */
+    { 0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF4ULL }, /* 1e241 */
+    { 0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B1ULL }, /* 1e242 */
+    { 0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98FULL }, /* 1e243 */
+    { 0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F2ULL }, /* 1e244 */
+    { 0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EEULL }, /* 1e245 */
+    { 0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB5ULL }, /* 1e246 */
+    { 0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A2ULL }, /* 1e247 */
+    { 0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334BULL }, /* 1e248 */
+    { 0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400FULL }, /* 1e249 */
+    { 0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511013ULL }, /* 1e250 */
+    { 0xDF78E4B2BD342CF6ULL, 0x914DA9246B255417ULL }, /* 1e251 */
+    { 0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548FULL }, /* 1e252 */
+    { 0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B2ULL }, /* 1e253 */
+    { 0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741FULL }, /* 1e254 */
+    { 0x8865899617FB1871ULL, 0x7E2FA67C7A658893ULL }, /* 1e255 */
+    { 0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB8ULL }, /* 1e256 */
+    { 0xD51EA6FA85785631ULL, 0x552A74227F3EA566ULL }, /* 1e257 */
+    { 0x8533285C936B35DEULL, 0xD53A88958F872760ULL }, /* 1e258 */
+    { 0xA67FF273B8460356ULL, 0x8A892ABAF368F138ULL }, /* 1e259 */
+    { 0xD01FEF10A657842CULL, 0x2D2B7569B0432D86ULL }, /* 1e260 */
+    { 0x8213F56A67F6B29BULL, 0x9C3B29620E29FC74ULL }, /* 1e261 */
+    { 0xA298F2C501F45F42ULL, 0x8349F3BA91B47B90ULL }, /* 1e262 */
+    { 0xCB3F2F7642717713ULL, 0x241C70A936219A74ULL }, /* 1e263 */
+    { 0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0111ULL }, /* 1e264 */
+    { 0x9EC95D1463E8A506ULL, 0xF4363804324A40ABULL }, /* 1e265 */
+    { 0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D6ULL }, /* 1e266 */
+    { 0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050BULL }, /* 1e267 */
+    { 0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8327ULL }, /* 1e268 */
+    { 0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F1ULL }, /* 1e269 */
+    { 0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CEDULL }, /* 1e270 */
+    { 0x976E41088617CA01ULL, 0xD5BE0503E085D814ULL }, /* 1e271 */
+    { 0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E19ULL }, /* 1e272 */
+    { 0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219FULL }, /* 1e273 */
+    { 0x93E1AB8252F33B45ULL, 0xCABB90E5C942B504ULL }, /* 1e274 */
+    { 0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936244ULL }, /* 1e275 */
+    { 0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD5ULL }, /* 1e276 */
+    { 0x906A617D450187E2ULL, 0x27FB2B80668B24C6ULL }, /* 1e277 */
+    { 0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF7ULL }, /* 1e278 */
+    { 0xE1A63853BBD26451ULL, 0x5E7873F8A0396974ULL }, /* 1e279 */
+    { 0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E9ULL }, /* 1e280 */
+    { 0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA63ULL }, /* 1e281 */
+    { 0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FCULL }, /* 1e282 */
+    { 0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9EULL }, /* 1e283 */
+    { 0xAC2820D9623BF429ULL, 0x546345FA9FBDCD45ULL }, /* 1e284 */
+    { 0xD732290FBACAF133ULL, 0xA97C177947AD4096ULL }, /* 1e285 */
+    { 0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485EULL }, /* 1e286 */
+    { 0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A75ULL }, /* 1e287 */
+    { 0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3112ULL }, /* 1e288 */
+    { 0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EACULL }, /* 1e289 */
+    { 0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E56ULL }, /* 1e290 */
+    { 0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35ECULL }, /* 1e291 */
+    { 0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B4ULL }, /* 1e292 */
+    { 0xA0555E361951C366ULL, 0xD7E105BCC3326220ULL }, /* 1e293 */
+    { 0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA8ULL }, /* 1e294 */
+    { 0xFA856334878FC150ULL, 0xB14F98F6F0FEB952ULL }, /* 1e295 */
+    { 0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D4ULL }, /* 1e296 */
+    { 0xC3B8358109E84F07ULL, 0x0A862F80EC4700C9ULL }, /* 1e297 */
+    { 0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FBULL }, /* 1e298 */
+    { 0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789DULL }, /* 1e299 */
+    { 0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C4ULL }, /* 1e300 */
+    { 0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC75ULL }, /* 1e301 */
+    { 0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC9ULL }, /* 1e302 */
+    { 0xBAA718E68396CFFDULL, 0xD30560258F54E6BBULL }, /* 1e303 */
+    { 0xE950DF20247C83FDULL, 0x47C6B82EF32A206AULL }, /* 1e304 */
+    { 0x91D28B7416CDD27EULL, 0x4CDC331D57FA5442ULL }, /* 1e305 */
+    { 0xB6472E511C81471DULL, 0xE0133FE4ADF8E953ULL }, /* 1e306 */
+    { 0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A7ULL }, /* 1e307 */
+    { 0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7649ULL }, /* 1e308 */
+    { 0xB201833B35D63F73ULL, 0x2CD2CC6551E513DBULL }, /* 1e309 */
+    { 0xDE81E40A034BCF4FULL, 0xF8077F7EA65E58D2ULL }, /* 1e310 */
+    { 0x8B112E86420F6191ULL, 0xFB04AFAF27FAF783ULL }, /* 1e311 */
+    { 0xADD57A27D29339F6ULL, 0x79C5DB9AF1F9B564ULL }, /* 1e312 */
+    { 0xD94AD8B1C7380874ULL, 0x18375281AE7822BDULL }, /* 1e313 */
+    { 0x87CEC76F1C830548ULL, 0x8F2293910D0B15B6ULL }, /* 1e314 */
+    { 0xA9C2794AE3A3C69AULL, 0xB2EB3875504DDB23ULL }, /* 1e315 */
+    { 0xD433179D9C8CB841ULL, 0x5FA60692A46151ECULL }, /* 1e316 */
+    { 0x849FEEC281D7F328ULL, 0xDBC7C41BA6BCD334ULL }, /* 1e317 */
+    { 0xA5C7EA73224DEFF3ULL, 0x12B9B522906C0801ULL }, /* 1e318 */
+    { 0xCF39E50FEAE16BEFULL, 0xD768226B34870A01ULL }, /* 1e319 */
+    { 0x81842F29F2CCE375ULL, 0xE6A1158300D46641ULL }, /* 1e320 */
+    { 0xA1E53AF46F801C53ULL, 0x60495AE3C1097FD1ULL }, /* 1e321 */
+    { 0xCA5E89B18B602368ULL, 0x385BB19CB14BDFC5ULL }, /* 1e322 */
+    { 0xFCF62C1DEE382C42ULL, 0x46729E03DD9ED7B6ULL }, /* 1e323 */
+    { 0x9E19DB92B4E31BA9ULL, 0x6C07A2C26A8346D2ULL }, /* 1e324 */
+};
+
+/* @summary Multiply two unsigned 64-bit values to produce the full 128-bit product.
+ * @param a The first value.
+ * @param b The second value.
+ * @return The 128-bit product a * b.
+ */
+static PIL_INLINE MEMIO_UINT128
+MemioMul128
+(
+    uint64_t a, 
+    uint64_t b
+)
+{
+    MEMIO_UINT128 r;
+#if   PIL_TARGET_COMPILER == PIL_COMPILER_MSVC && PIL_TARGET_ARCHITECTURE == PIL_ARCHITECTURE_X64
+    r.Lo = _umul128(a, b, &r.Hi);
+#elif PIL_TARGET_COMPILER == PIL_COMPILER_MSVC && PIL_TARGET_ARCHITECTURE == PIL_ARCHITECTURE_ARM64
+    r.Lo = a * b;
+    r.Hi = __umulh(a, b);
+#elif defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128) a * b;
+    r.Lo = (uint64_t)(p);
+    r.Hi = (uint64_t)(p >> 64);
+#else
+    uint64_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+    uint64_t   ll = a_lo * b_lo;
+    uint64_t   lh = a_lo * b_hi;
+    uint64_t   hl = a_hi * b_lo;
+    uint64_t   hh = a_hi * b_hi;
+    uint64_t  mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+    r.Lo = (mid << 32) | (ll & 0xFFFFFFFFULL);
+    r.Hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+    return r;
+}
+
+/* @summary Compute floor(log2(10^e)) for e in [-1233, 1233].
+ */
+static PIL_INLINE int32_t
+MemioFloorLog2Pow10
+(
+    int32_t e
+)
+{
+    return (e * 1741647) >> 19;
+}
+
+/* @summary Compute floor(log10(2^e)) for e in [-2620, 2620].
+ */
+static PIL_INLINE int32_t
+MemioFloorLog10Pow2
+(
+    int32_t e
+)
+{
+    return (e * 1262611) >> 22;
+}
+
+/* @summary Compute floor(log10(3/4 * 2^e)) for e in [-2985, 2936].
+ */
+static PIL_INLINE int32_t
+MemioFloorLog10ThreeQuartersPow2
+(
+    int32_t e
+)
+{
+    return (e * 1262611 - 524031) >> 22;
+}
+
+/* @summary Compute the product of a power of ten and a scaled double precision significand, rounded to odd, as used by the Schubfach algorithm.
+ * @param g The 128-bit significand of the power of ten, from MemioPow10Table.
+ * @param cp The scaled significand.
+ * @return The most-significant 64 bits of the 192-bit product, with the least-significant bit set if any discarded bit was set.
+ */
+static PIL_INLINE uint64_t
+MemioRoundToOdd64
+(
+    MEMIO_UINT128 g, 
+    uint64_t     cp
+)
+{
+    MEMIO_UINT128 x = MemioMul128(g.Lo, cp);
+    MEMIO_UINT128 y = MemioMul128(g.Hi, cp);
+    uint64_t      z = y.Lo + x.Hi;
+    uint64_t    vbp = y.Hi + (z < x.Hi ? 1 : 0);
+    return vbp | (z > 1 ? 1 : 0);
+}
+
+/* @summary Compute the product of a power of ten and a scaled single precision significand, rounded to odd, as used by the Schubfach algorithm.
+ * @param g The most-significant 64 bits of the significand of the power of ten, plus one.
+ * @param cp The scaled significand.
+ * @return Bits 64 to 95 of the 96-bit product, with the least-significant bit set if any discarded bit was set.
+ */
+static PIL_INLINE uint32_t
+MemioRoundToOdd32
+(
+    uint64_t  g, 
+    uint32_t cp
+)
+{
+    MEMIO_UINT128 p = MemioMul128(g, cp);
+    uint32_t     y1 =(uint32_t) (p.Hi);
+    uint32_t     y0 =(uint32_t) (p.Lo >> 32);
+    return y1 | (y0 > 1 ? 1 : 0);
+}
+
+/* @summary Find the shortest decimal significand and exponent that round-trips to a finite, non-zero double precision value, using the Schubfach algorithm.
+ * @param o_digits On return, set to the decimal significand, which may have trailing zeros.
+ * @param o_exponent On return, set to the power of ten by which the significand is multiplied.
+ * @param bits The bits of the value. The sign bit is ignored.
+ */
+static void
+MemioShortestDecimal64
+(
+    uint64_t   *o_digits, 
+    int32_t  *o_exponent, 
+    uint64_t        bits
+)
+{
+    uint64_t ieee_m = bits & ((1ULL << 52) - 1);
+    uint32_t ieee_e =(uint32_t)((bits >> 52) & 0x7FF);
+    MEMIO_UINT128 g;
+    uint64_t c, cbl, cb, cbr, vbl, vb, vbr, lower, upper, s;
+    uint32_t is_even, lower_closer;
+    int32_t  q, k, h;
+
+    if (ieee_e != 0) {
+        c = (1ULL << 52) | ieee_m;
+        q = (int32_t) ieee_e - 1075;
+        if (q <= 0 && q > -53 && (c & ((1ULL << -q) - 1)) == 0) {
+            /* the value is an integer below 2^53 - the digits are the integer itself */
+            *o_digits   = c >> -q;
+            *o_exponent = 0;
+            return;
+        }
+    } else {
+        c = ieee_m;
+        q = 1 - 1075;
+    }
+
+    is_even      = (c & 1) == 0 ? 1 : 0;
+    lower_closer = (ieee_m == 0 && ieee_e > 1) ? 1 : 0;
+    cbl = 4 * c - 2 + lower_closer;
+    cb  = 4 * c;
+    cbr = 4 * c + 2;
+    k   = lower_closer ? MemioFloorLog10ThreeQuartersPow2(q) : MemioFloorLog10Pow2(q);
+    h   = q + MemioFloorLog2Pow10(-k) + 1;
+    g   = MemioPow10Table[-k - MEMIO_POW10_TABLE_MIN];
+    vbl = MemioRoundToOdd64(g, cbl << h);
+    vb  = MemioRoundToOdd64(g, cb  << h);
+    vbr = MemioRoundToOdd64(g, cbr << h);
+    lower = vbl + !is_even;
+    upper = vbr - !is_even;
+    s     = vb / 4;
+
+    if (s >= 10) {
+        /* try the candidates with one digit fewer */
+        uint64_t    sp = s / 10;
+        int  up_inside = lower <= 40 * sp;
+        int  wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            *o_digits   = sp + (uint64_t) wp_inside;
+            *o_exponent = k + 1;
+            return;
+        }
+    }
+    {
+        int   u_inside = lower <= 4 * s;
+        int   w_inside = 4 * s + 4 <= upper;
+        if (u_inside != w_inside) {
+            *o_digits   = s + (uint64_t) w_inside;
+            *o_exponent = k;
+            return;
+        } else {
+            uint64_t mid = 4 * s + 2;
+            int round_up = vb > mid || (vb == mid && (s & 1) != 0);
+            *o_digits   = s + (uint64_t) round_up;
+            *o_exponent = k;
+        }
+    }
+}
+
+/* @summary Find the shortest decimal significand and exponent that round-trips to a finite, non-zero single precision value, using the Schubfach algorithm.
+ * @param o_digits On return, set to the decimal significand, which may have trailing zeros.
+ * @param o_exponent On return, set to the power of ten by which the significand is multiplied.
+ * @param bits The bits of the value. The sign bit is ignored.
+ */
+static void
+MemioShortestDecimal32
+(
+    uint64_t   *o_digits, 
+    int32_t  *o_exponent, 
+    uint32_t        bits
+)
+{
+    uint32_t ieee_m = bits & ((1UL << 23) - 1);
+    uint32_t ieee_e = (bits >> 23) & 0xFF;
+    uint64_t g;
+    uint32_t c, cbl, cb, cbr, vbl, vb, vbr, lower, upper, s;
+    uint32_t is_even, lower_closer;
+    int32_t  q, k, h;
+
+    if (ieee_e != 0) {
+        c = (1UL << 23) | ieee_m;
+        q = (int32_t) ieee_e - 150;
+        if (q <= 0 && q > -24 && (c & ((1UL << -q) - 1)) == 0) {
+            /* the value is an integer below 2^24 - the digits are the integer itself */
+            *o_digits   = c >> -q;
+            *o_exponent = 0;
+            return;
+        }
+    } else {
+        c = ieee_m;
+        q = 1 - 150;
+    }
+
+    is_even      = (c & 1) == 0 ? 1 : 0;
+    lower_closer = (ieee_m == 0 && ieee_e > 1) ? 1 : 0;
+    cbl = 4 * c - 2 + lower_closer;
+    cb  = 4 * c;
+    cbr = 4 * c + 2;
+    k   = lower_closer ? MemioFloorLog10ThreeQuartersPow2(q) : MemioFloorLog10Pow2(q);
+    h   = q + MemioFloorLog2Pow10(-k) + 1;
+    g   = MemioPow10Table[-k - MEMIO_POW10_TABLE_MIN].Hi + 1;
+    vbl = MemioRoundToOdd32(g, cbl << h);
+    vb  = MemioRoundToOdd32(g, cb  << h);
+    vbr = MemioRoundToOdd32(g, cbr << h);
+    lower = vbl + !is_even;
+    upper = vbr - !is_even;
+    s     = vb / 4;
+
+    if (s >= 10) {
+        /* try the candidates with one digit fewer */
+        uint32_t    sp = s / 10;
+        int  up_inside = lower <= 40 * sp;
+        int  wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            *o_digits   = sp + (uint32_t) wp_inside;
+            *o_exponent = k + 1;
+            return;
+        }
+    }
+    {
+        int   u_inside = lower <= 4 * s;
+        int   w_inside = 4 * s + 4 <= upper;
+        if (u_inside != w_inside) {
+            *o_digits   = s + (uint32_t) w_inside;
+            *o_exponent = k;
+            return;
+        } else {
+            uint32_t mid = 4 * s + 2;
+            int round_up = vb > mid || (vb == mid && (s & 1) != 0);
+            *o_digits   = s + (uint32_t) round_up;
+            *o_exponent = k;
+        }
+    }
+}
+
+/* @summary Count the number of decimal digits in an unsigned 64-bit integer.
+ * @param value The value.
+ * @return The number of digits in value, from 1 to 20.
+ */
+static PIL_INLINE uint32_t
+MemioDecimalDigitCount
+(
+    uint64_t value
+)
+{
+    /* 1233/4096 approximates log10(2) closely enough for 64-bit values */
+    uint32_t t = ((MemioBitScanReverse(value | 1) + 1) * 1233) >> 12;
+    uint32_t n = t + (value >= MemioPow10Integer[t] ? 1 : 0);
+    return n != 0 ? n : 1;
+}
+
+/* @summary Write the decimal digits of an unsigned 32-bit integer backwards, ending at a given address.
+ * @param end The address one past the last digit to write.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriteDigits32
+(
+    char       *end, 
+    uint32_t  value
+)
+{
+    while (value >= 100) {
+        uint32_t q = value / 100;
+        uint32_t r = value - (q * 100);
+        end  -= 2;
+        memcpy(end, &MemioDigitPairs[r * 2], 2);
+        value = q;
+    }
+    if (value >= 10) {
+        memcpy(end - 2, &MemioDigitPairs[value * 2], 2);
+    } else {
+        end[-1] = (char)('0' + value);
+    }
+}
+
+/* @summary Write the decimal digits of an unsigned 64-bit integer backwards, ending at a given address.
+ * The value is split into 32-bit parts of eight digits so that most divisions are 32-bit.
+ * @param end The address one past the last digit to write.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+MemioWriteDigits64
+(
+    char       *end, 
+    uint64_t  value
+)
+{
+    while (value > 0xFFFFFFFFULL) {
+        uint64_t q = value / 100000000;
+        uint32_t r =(uint32_t)(value - (q * 100000000));
+        uint32_t i;
+        for (i = 0; i < 4; ++i) {
+            uint32_t rq = r / 100;
+            end -= 2;
+            memcpy(end, &MemioDigitPairs[(r - (rq * 100)) * 2], 2);
+            r = rq;
+        }
+        value = q;
+    }
+    MemioWriteDigits32(end, (uint32_t) value);
+}
+
+/* @summary Format a finite floating point value, given its decimal significand and exponent, as text.
+ * @param dst The buffer to which the text is written.
+ * @param negative Non-zero to write a leading minus sign.
+ * @param digits The decimal significand. Trailing zeros are removed before formatting.
+ * @param exponent The power of ten by which the significand is multiplied.
+ * @return The number of characters written to dst.
+ */
+static size_t
+MemioFormatFloatText
+(
+    char         *dst, 
+    int      negative, 
+    uint64_t   digits, 
+    int32_t  exponent
+)
+{
+    char      text[20];
+    char      *out = dst;
+    uint32_t     n;
+    int32_t  point;
+
+    if (negative) {
+        *out++ = '-';
+    }
+    if (digits == 0) {
+        *out++ = '0';
+        return (size_t)(out - dst);
+    }
+    while (digits % 10 == 0) {
+        digits   /= 10;
+        exponent += 1;
+    }
+    n     = MemioDecimalDigitCount(digits);
+    point =(int32_t) n + exponent;
+    MemioWriteDigits64(text + n, digits);
+
+    if (exponent >= 0 && point <= 21) {
+        /* an integer - write the digits followed by zeros */
+        memcpy(out, text, n);
+        memset(out + n, '0', (size_t) exponent);
+        out += n + (size_t) exponent;
+    } else if (point > 0 && point <= 21) {
+        /* the decimal point falls within the digits */
+        memcpy(out, text, (size_t) point);
+        out   += point;
+        *out++ = '.';
+        memcpy(out, text + point, n - (uint32_t) point);
+        out   += n - (uint32_t) point;
+    } else if (point > -6 && point <= 0) {
+        /* the value is less than one - write leading zeros after the decimal point */
+        *out++ = '0';
+        *out++ = '.';
+        memset(out, '0', (size_t) -point);
+        out   += -point;
+        memcpy(out, text, n);
+        out   += n;
+    } else {
+        /* exponential notation with one digit before the decimal point */
+        int32_t  e = point - 1;
+        *out++ = text[0];
+        if (n > 1) {
+            *out++ = '.';
+            memcpy(out, text + 1, n - 1);
+            out   += n - 1;
+        }
+        *out++ = 'e';
+        *out++ = e < 0 ? '-' : '+';
+        e      = e < 0 ? -e : e;
+        if (e >= 100) {
+            *out++ = (char)('0' + (e / 100));
+            e      =  e % 100;
+            memcpy(out, &MemioDigitPairs[e * 2], 2);
+            out   += 2;
+        } else if (e >= 10) {
+            memcpy(out, &MemioDigitPairs[e * 2], 2);
+            out   += 2;
+        } else {
+            *out++ = (char)('0' + e);
+        }
+    }
+    return (size_t)(out - dst);
+}
+
+/* @summary Write the text of an infinity or NaN value.
+ * @param dst The buffer to which the text is written.
+ * @param negative Non-zero if the value is negative.
+ * @param is_nan Non-zero if the value is NaN.
+ * @return The number of characters written to dst.
+ */
+static size_t
+MemioFormatSpecialText
+(
+    char    *dst, 
+    int negative, 
+    int   is_nan
+)
+{
+    if (is_nan) {
+        memcpy(dst, "nan", 3);
+        return 3;
+    }
+    if (negative) {
+        memcpy(dst, "-inf", 4);
+        return 4;
+    }
+    memcpy(dst, "inf", 3);
+    return 3;
+}
+
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+/* @summary Determine whether eight bytes loaded from text in little-endian order are all decimal digits.
+ * @param chars The eight characters.
+ * @return Non-zero if all eight characters are in '0' to '9'.
+ */
+static PIL_INLINE int
+MemioIsEightDigits
+(
+    uint64_t chars
+)
+{
+    return ((chars & 0xF0F0F0F0F0F0F0F0ULL) | (((chars + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+/* @summary Convert eight decimal digits loaded from text in little-endian order to their value, combining digits pairwise using three multiplies.
+ * @param chars The eight characters, which must all be decimal digits.
+ * @return The value of the eight digits, from 0 to 99999999.
+ */
+static PIL_INLINE uint32_t
+MemioParseEightDigits
+(
+    uint64_t chars
+)
+{
+    uint64_t const mask = 0x000000FF000000FFULL;
+    uint64_t const mul1 = 100 + (1000000ULL << 32);
+    uint64_t const mul2 = 1   + (  10000ULL << 32);
+    chars -= 0x3030303030303030ULL;
+    chars  = (chars * 10) + (chars >> 8);
+    chars  = (((chars & mask) * mul1) + (((chars >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t) chars;
+}
+#endif
+
+/* @summary Parse a run of decimal digits as an unsigned 64-bit integer.
+ * Where SSSE3 is available, up to sixteen digits are located with a single compare and combined with multiply-add instructions; otherwise digits are converted eight at a time within a 64-bit register where possible.
+ * @param o_value On return, set to the parsed value.
+ * @param src The text to parse.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of digits consumed, or zero if src does not start with a digit or the value does not fit in 64 bits.
+ */
+static size_t
+MemioParseDigits64
+(
+    uint64_t    *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    char const *end = src + src_size;
+    char const   *p = src;
+    char const  *sd;
+    uint64_t  value = 0;
+
+    while (p < end && *p == '0') {
+        /* leading zeros do not contribute to the value or the digit limit */
+        ++p;
+    }
+    sd = p;
+
+#if MEMIO_USE_SSSE3
+    if (end - p >= 16) {
+        __m128i  text = _mm_loadu_si128((__m128i const*) p);
+        __m128i     d = _mm_sub_epi8(text, _mm_set1_epi8('0'));
+        __m128i  over = _mm_subs_epu8(d, _mm_set1_epi8(9));
+        uint32_t mask =(uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(over, _mm_setzero_si128()));
+        uint32_t    n =(uint32_t) MemioBitScanForward(~mask | 0x10000UL);
+        if (n > 0) {
+            __m128i   t = _mm_shuffle_epi8(d, _mm_loadu_si128((__m128i const*) &MemioDigitAlign[n]));
+            t     = _mm_maddubs_epi16(t, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+            t     = _mm_madd_epi16(t, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+            t     = _mm_packs_epi32(t, t);
+            t     = _mm_madd_epi16(t, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+            value = ((uint64_t)(uint32_t) _mm_cvtsi128_si32(t) * 100000000ULL) + (uint32_t) _mm_cvtsi128_si32(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 1, 1, 1)));
+            p    += n;
+        }
+        if (n < 16) {
+            goto done;
+        }
+    }
+#endif
+#if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    while (end - p >= 8 && (p - sd) <= 11) {
+        /* at most 19 digits can be accumulated without overflow */
+        uint64_t chars;
+        memcpy(&chars, p, sizeof(uint64_t));
+        if (!MemioIsEightDigits(chars)) {
+            break;
+        }
+        value = (value * 100000000ULL) + MemioParseEightDigits(chars);
+        p    += 8;
+    }
+#endif
+    while (p < end && (uint8_t)(*p - '0') <= 9) {
+        uint32_t digit =(uint32_t)(*p - '0');
+        if ((p - sd) >= 19 && value > (0xFFFFFFFFFFFFFFFFULL - digit) / 10) {
+            return 0;
+        }
+        value = (value * 10) + digit;
+        ++p;
+    }
+#if MEMIO_USE_SSSE3
+done:
+#endif
+    if (p == src) {
+        return 0;
+    }
+    *o_value = value;
+    return (size_t)(p - src);
+}
+
+/* @summary Parse an optional leading sign.
+ * @param o_negative On return, set to non-zero if a minus sign was present.
+ * @param src The text to parse.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, zero or one.
+ */
+static PIL_INLINE size_t
+MemioParseSign
+(
+    int       *o_negative, 
+    char const       *src, 
+    size_t       src_size
+)
+{
+    if (src_size > 0 && (src[0] == '-' || src[0] == '+')) {
+        *o_negative = src[0] == '-';
+        return 1;
+    }
+    *o_negative = 0;
+    return 0;
+}
+
+/* @summary Match a word at the start of text, ignoring case.
+ * @param src The text to match.
+ * @param src_size The maximum number of characters to read from src.
+ * @param word The lower case word to match.
+ * @param word_size The number of characters in word.
+ * @return Non-zero if src starts with word.
+ */
+static int
+MemioMatchWord
+(
+    char const  *src, 
+    size_t  src_size, 
+    char const *word, 
+    size_t word_size
+)
+{
+    size_t i;
+    if (src_size < word_size) {
+        return 0;
+    }
+    for (i = 0; i < word_size; ++i) {
+        if ((src[i] | 0x20) != word[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* @summary Scan the text of a floating point value, accumulating up to 19 significant digits and the decimal exponent.
+ * @param o_text On return, describes the scanned text.
+ * @param src The text to scan.
+ * @param src_size The maximum number of characters to read from src.
+ * @return The number of characters consumed, or zero if src does not start with a valid number.
+ */
+static size_t
+MemioScanDecimalText
+(
+    struct MEMIO_DECIMAL_TEXT *o_text, 
+    char const                   *src, 
+    size_t                   src_size
+)
+{
+    char const *end = src + src_size;
+    char const   *p = src;
+    uint64_t      m = 0;
+    int64_t       e = 0;
+    uint32_t    sig = 0;
+    size_t    count = 0;
+    int     trunc   = 0;
+    int     neg;
+
+    p += MemioParseSign(&neg, p, src_size);
+    o_text->Negative = neg;
+    o_text->Special  = MEMIO_DECIMAL_SPECIAL_NONE;
+    o_text->Reserved = 0;
+    if (p < end && (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N')) {
+        if (MemioMatchWord(p, (size_t)(end - p), "infinity", 8)) {
+            o_text->Special = MEMIO_DECIMAL_SPECIAL_INF;
+            return (size_t)(p - src) + 8;
+        }
+        if (MemioMatchWord(p, (size_t)(end - p), "inf", 3)) {
+            o_text->Special = MEMIO_DECIMAL_SPECIAL_INF;
+            return (size_t)(p - src) + 3;
+        }
+        if (MemioMatchWord(p, (size_t)(end - p), "nan", 3)) {
+            o_text->Special = MEMIO_DECIMAL_SPECIAL_NAN;
+            return (size_t)(p - src) + 3;
+        }
+        return 0;
+    }
+
+    o_text->Digits = p;
+    while (p < end && (uint8_t)(*p - '0') <= 9) {
+        uint32_t digit =(uint32_t)(*p - '0');
+        if (sig < 19) {
+            m    = (m * 10) + digit;
+            sig += (m != 0) ? 1 : 0;
+        } else {
+            /* the integer part has more digits than fit - keep the magnitude */
+            trunc |= (digit != 0);
+            e     += 1;
+        }
+        ++count;
+        ++p;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && (uint8_t)(*p - '0') <= 9) {
+            uint32_t digit =(uint32_t)(*p - '0');
+            if (sig < 19) {
+                m    = (m * 10) + digit;
+                sig += (m != 0) ? 1 : 0;
+                e   -= 1;
+            } else {
+                trunc |= (digit != 0);
+            }
+            ++count;
+            ++p;
+        }
+    }
+    if (count == 0) {
+        return 0;
+    }
+    o_text->DigitsEnd = p;
+    o_text->ExplicitExponent = 0;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        /* the exponent is only consumed if at least one digit follows the e */
+        char const *x = p + 1;
+        int64_t     v = 0;
+        int       neg_e;
+        x += MemioParseSign(&neg_e, x, (size_t)(end - x));
+        if (x < end && (uint8_t)(*x - '0') <= 9) {
+            while (x < end && (uint8_t)(*x - '0') <= 9) {
+                if (v < MEMIO_DECIMAL_MAX_EXPONENT) {
+                    v = (v * 10) + (*x - '0');
+                }
+                ++x;
+            }
+            if (v > MEMIO_DECIMAL_MAX_EXPONENT) {
+                v = MEMIO_DECIMAL_MAX_EXPONENT;
+            }
+            o_text->ExplicitExponent = neg_e ? -v : v;
+            e += o_text->ExplicitExponent;
+            p  = x;
+        }
+    }
+    o_text->Mantissa  = m;
+    o_text->Exponent  = e;
+    o_text->Truncated = trunc;
+    return (size_t)(p - src);
+}
+
+/* @summary Rewrite scanned floating point text into a nul-terminated buffer with at most MEMIO_DECIMAL_MAX_DIGITS significant digits and no decimal point, so that it can be converted by the C runtime independent of the locale and the length of the input.
+ * @param dst The buffer to write. The buffer must have space for at least MEMIO_DECIMAL_MAX_DIGITS + MEMIO_TEXT_MAX_SI64 + 3 characters.
+ * @param text The scanned text, which must not be zero.
+ */
+static void
+MemioNormalizeDecimalText
+(
+    char                            *dst, 
+    struct MEMIO_DECIMAL_TEXT const *text
+)
+{
+    char const    *p = text->Digits;
+    size_t         n = 0;
+    int64_t        e = 0;
+    int  after_point = 0;
+    int       sticky = 0;
+
+    for ( ; p < text->DigitsEnd; ++p) {
+        if (*p == '.') {
+            after_point = 1;
+            continue;
+        }
+        if (n == 0 && *p == '0') {
+            e -= after_point;
+            continue;
+        }
+        if (n < MEMIO_DECIMAL_MAX_DIGITS) {
+            dst[n++] = *p;
+            e -= after_point;
+        } else {
+            sticky |= (*p != '0');
+            e += !after_point;
+        }
+    }
+    if (sticky) {
+        /* any non-zero digits past the limit only matter as a tie-breaker */
+        dst[n++] = '1';
+        e -= 1;
+    }
+    dst[n++] = 'e';
+    n += FormatDecimal_si64(dst + n, e + text->ExplicitExponent);
+    dst[n] = '\0';
+}
+
+PIL_API(size_t)
+FormatDecimal_ui32
+(
+    char       *dst, 
+    uint32_t   value
+)
+{
+    uint32_t n = MemioDecimalDigitCount(value);
+    MemioWriteDigits32(dst + n, value);
+    return n;
+}
+
+PIL_API(size_t)
+FormatDecimal_si32
+(
+    char       *dst, 
+    int32_t    value
+)
+{
+    if (value < 0) {
+        *dst = '-';
+        return FormatDecimal_ui32(dst + 1, 0U - (uint32_t) value) + 1;
+    }
+    return FormatDecimal_ui32(dst, (uint32_t) value);
+}
+
+PIL_API(size_t)
+FormatDecimal_ui64
+(
+    char       *dst, 
+    uint64_t   value
+)
+{
+    uint32_t n = MemioDecimalDigitCount(value);
+    MemioWriteDigits64(dst + n, value);
+    return n;
+}
+
+PIL_API(size_t)
+FormatDecimal_si64
+(
+    char       *dst, 
+    int64_t    value
+)
+{
+    if (value < 0) {
+        *dst = '-';
+        return FormatDecimal_ui64(dst + 1, 0ULL - (uint64_t) value) + 1;
+    }
+    return FormatDecimal_ui64(dst, (uint64_t) value);
+}
+
+PIL_API(size_t)
+FormatDecimal_f32
+(
+    char       *dst, 
+    float     value
+)
+{
+    uint32_t bits;
+    uint64_t digits;
+    int32_t  exponent;
+    int      negative;
+
+    memcpy(&bits, &value, sizeof(uint32_t));
+    negative = (bits >> 31) != 0;
+    if ((bits & 0x7F800000UL) == 0x7F800000UL) {
+        return MemioFormatSpecialText(dst, negative, (bits & 0x007FFFFFUL) != 0);
+    }
+    if ((bits & 0x7FFFFFFFUL) == 0) {
+        return MemioFormatFloatText(dst, negative, 0, 0);
+    }
+    MemioShortestDecimal32(&digits, &exponent, bits);
+    return MemioFormatFloatText(dst, negative, digits, exponent);
+}
+
+PIL_API(size_t)
+FormatDecimal_f64
+(
+    char       *dst, 
+    double    value
+)
+{
+    uint64_t bits;
+    uint64_t digits;
+    int32_t  exponent;
+    int      negative;
+
+    memcpy(&bits, &value, sizeof(uint64_t));
+    negative = (bits >> 63) != 0;
+    if ((bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) {
+        return MemioFormatSpecialText(dst, negative, (bits & 0x000FFFFFFFFFFFFFULL) != 0);
+    }
+    if ((bits & 0x7FFFFFFFFFFFFFFFULL) == 0) {
+        return MemioFormatFloatText(dst, negative, 0, 0);
+    }
+    MemioShortestDecimal64(&digits, &exponent, bits);
+    return MemioFormatFloatText(dst, negative, digits, exponent);
+}
+
+PIL_API(size_t)
+ParseDecimal_ui32
+(
+    uint32_t  *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    uint64_t value;
+    size_t       n;
+
+    assert(o_value != NULL);
+    assert(src != NULL || src_size == 0);
+    if ((n = MemioParseDigits64(&value, src, src_size)) == 0 || value > 0xFFFFFFFFULL) {
+        return 0;
+    }
+    *o_value = (uint32_t) value;
+    return n;
+}
+
+PIL_API(size_t)
+ParseDecimal_si32
+(
+    int32_t   *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    uint64_t value;
+    size_t    sign;
+    size_t       n;
+    int   negative;
+
+    assert(o_value != NULL);
+    assert(src != NULL || src_size == 0);
+    sign = MemioParseSign(&negative, src, src_size);
+    if ((n = MemioParseDigits64(&value, src + sign, src_size - sign)) == 0) {
+        return 0;
+    }
+    if (value > (negative ? 0x80000000ULL : 0x7FFFFFFFULL)) {
+        return 0;
+    }
+    *o_value = negative ? (int32_t)(0U - (uint32_t) value) : (int32_t) value;
+    return n + sign;
+}
+
+PIL_API(size_t)
+ParseDecimal_ui64
+(
+    uint64_t  *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    assert(o_value != NULL);
+    assert(src != NULL || src_size == 0);
+    return MemioParseDigits64(o_value, src, src_size);
+}
+
+PIL_API(size_t)
+ParseDecimal_si64
+(
+    int64_t   *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    uint64_t value;
+    size_t    sign;
+    size_t       n;
+    int   negative;
+
+    assert(o_value != NULL);
+    assert(src != NULL || src_size == 0);
+    sign = MemioParseSign(&negative, src, src_size);
+    if ((n = MemioParseDigits64(&value, src + sign, src_size - sign)) == 0) {
+        return 0;
+    }
+    if (value > (negative ? 0x8000000000000000ULL : 0x7FFFFFFFFFFFFFFFULL)) {
+        return 0;
+    }
+    *o_value = negative ? (int64_t)(0ULL - value) : (int64_t) value;
+    return n + sign;
+}
+
+PIL_API(size_t)
+ParseDecimal_f32
+(
+    float     *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    MEMIO_DECIMAL_TEXT text;
+    char  buf[MEMIO_DECIMAL_MAX_DIGITS + MEMIO_TEXT_MAX_SI64 + 3];
+    float value;
+    size_t    n;
+
+    assert(o_value != NULL);
+    assert(src != NULL || src_size == 0);
+    if ((n = MemioScanDecimalText(&text, src, src_size)) == 0) {
+        return 0;
+    }
+    if (text.Special != MEMIO_DECIMAL_SPECIAL_NONE) {
+        value = text.Special == MEMIO_DECIMAL_SPECIAL_INF ? HUGE_VALF : NAN;
+        *o_value = text.Negative ? -value : value;
+        return n;
+    }
+    if (text.Mantissa == 0) {
+        *o_value = text.Negative ? -0.0f : 0.0f;
+        return n;
+    }
+#if MEMIO_USE_EXACT_FLOAT_PARSE
+    if (!text.Truncated && text.Mantissa <= (1ULL << 24) && text.Exponent >= -10 && text.Exponent <= 10) {
+        /* both the significand and the power of ten are exact, so one correctly rounded operation produces the result */
+        value = (float) text.Mantissa;
+        value = text.Exponent < 0 ? value / MemioPow10F32[-text.Exponent] : value * MemioPow10F32[text.Exponent];
+        *o_value = text.Negative ? -value : value;
+        return n;
+    }
+#endif
+    MemioNormalizeDecimalText(buf, &text);
+    value = strtof(buf, NULL);
+    *o_value = text.Negative ? -value : value;
+    return n;
+}
+
+PIL_API(size_t)
+ParseDecimal_f64
+(
+    double    *o_value, 
+    char const      *src, 
+    size_t      src_size
+)
+{
+    MEMIO_DECIMAL_TEXT text;
+    char   buf[MEMIO_DECIMAL_MAX_DIGITS + MEMIO_TEXT_MAX_SI64 + 3];
+    double value;
+    size_t     n;
+
+    assert(o_value != NULL);
+    assert(src != NULL || src_size == 0);
+    if ((n = MemioScanDecimalText(&text, src, src_size)) == 0) {
+        return 0;
+    }
+    if (text.Special != MEMIO_DECIMAL_SPECIAL_NONE) {
+        value = text.Special == MEMIO_DECIMAL_SPECIAL_INF ? HUGE_VAL : NAN;
+        *o_value = text.Negative ? -value : value;
+        return n;
+    }
+    if (text.Mantissa == 0) {
+        *o_value = text.Negative ? -0.0 : 0.0;
+        return n;
+    }
+#if MEMIO_USE_EXACT_FLOAT_PARSE
+    if (!text.Truncated && text.Mantissa <= (1ULL << 53) && text.Exponent >= -22 && text.Exponent <= 22 + 15) {
+        /* both the significand and the power of ten are exact, so one correctly rounded operation produces the result */
+        uint64_t m = text.Mantissa;
+        int64_t  e = text.Exponent;
+        while (e > 22 && m <= (1ULL << 53) / 10) {
+            /* move the excess power of ten into the significand while it remains exact */
+            m *= 10;
+            e -= 1;
+        }
+        if (e <= 22) {
+            value = (double) m;
+            value = e < 0 ? value / MemioPow10F64[-e] : value * MemioPow10F64[e];
+            *o_value = text.Negative ? -value : value;
+            return n;
+        }
+    }
+#endif
+    MemioNormalizeDecimalText(buf, &text);
+    value = strtod(buf, NULL);
+    *o_value = text.Negative ? -value : value;
+    return n;
+}
@@ -0,0 +1,722 @@
+/**
+ * @summary memio_lz.cc: Implement the LZ block codec and frame format declared
+ * in memio_lz.h. The compressor is a greedy single-probe match finder over a
+ * hash table of recent positions, and the decompressor copies matches eight
+ * bytes at a time wherever the output buffer has room to do so.
+ */
+#include <assert.h>
+#include <string.h>
+#include "memio_lz.h"
+
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#   include <intrin.h>
+#endif
+
+/* @summary Define constants describing the limits of the block format.
+ * MEMIO_LZ_MIN_MATCH: The length of the shortest match that can be encoded.
+ * MEMIO_LZ_LAST_LITERALS: The number of bytes at the end of a block that are always encoded as literals.
+ * MEMIO_LZ_MF_LIMIT: The minimum distance from the start of the last match to the end of the block.
+ * MEMIO_LZ_MAX_OFFSET: The largest distance back from the current position at which a match can start.
+ * MEMIO_LZ_SKIP_TRIGGER: The base-2 logarithm of the number of failed match probes after which the search step increases.
+ */
+#ifndef MEMIO_LZ_FORMAT_CONSTANTS
+#   define MEMIO_LZ_FORMAT_CONSTANTS
+#   define MEMIO_LZ_MIN_MATCH                  4
+#   define MEMIO_LZ_LAST_LITERALS              5
+#   define MEMIO_LZ_MF_LIMIT                   12
+#   define MEMIO_LZ_MAX_OFFSET                 65535
+#   define MEMIO_LZ_SKIP_TRIGGER               6
+#endif
+
+/* @summary Load four bytes from an arbitrarily-aligned address in host byte order.
+ * @param src The address to load from.
+ * @return The loaded value.
+ */
+static PIL_INLINE uint32_t
+MemioLzLoad32
+(
+    void const *src
+)
+{
+    uint32_t value;
+    memcpy(&value, src, sizeof(uint32_t));
+    return value;
+}
+
+/* @summary Load eight bytes from an arbitrarily-aligned address in host byte order.
+ * @param src The address to load from.
+ * @return The loaded value.
+ */
+static PIL_INLINE uint64_t
+MemioLzLoad64
+(
+    void const *src
+)
+{
+    uint64_t value;
+    memcpy(&value, src, sizeof(uint64_t));
+    return value;
+}
+
+/* @summary Compute the match-finder hash table index for the four bytes at a given position.
+ * @param src The position to hash. At least four bytes must be readable.
+ * @return A value in [0, 1 << MEMIO_LZ_HASH_LOG).
+ */
+static PIL_INLINE uint32_t
+MemioLzHash
+(
+    uint8_t const *src
+)
+{
+    return (uint32_t)(MemioLzLoad32(src) * 2654435761U) >> (32 - MEMIO_LZ_HASH_LOG);
+}
+
+/* @summary Count the number of leading bytes (in memory order) that are equal in two 64-bit words, given their non-zero XOR.
+ * @param diff The XOR of the two words. Must be non-zero.
+ * @return The number of equal bytes, from 0 to 7.
+ */
+static PIL_INLINE size_t
+MemioLzEqualBytes
+(
+    uint64_t diff
+)
+{
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+    unsigned long bit;
+#   if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    _BitScanForward64(&bit, diff);
+    return (size_t)(bit >> 3);
+#   else
+    _BitScanReverse64(&bit, diff);
+    return (size_t)((63 - bit) >> 3);
+#   endif
+#else
+#   if PIL_SYSTEM_ENDIANESS == PIL_ENDIANESS_LSB_FIRST
+    return (size_t)(__builtin_ctzll(diff) >> 3);
+#   else
+    return (size_t)(__builtin_clzll(diff) >> 3);
+#   endif
+#endif
+}
+
+/* @summary Determine the length of a match by comparing the data at two positions eight bytes at a time.
+ * @param src The current position.
+ * @param match The earlier position at which the match starts.
+ * @param limit The position in the source data at which matching stops.
+ * @return The number of bytes that are equal at src and match, without reading at or past limit.
+ */
+static PIL_INLINE size_t
+MemioLzMatchLength
+(
+    uint8_t const   *src,
+    uint8_t const *match,
+    uint8_t const *limit
+)
+{
+    uint8_t const *start = src;
+    while (src + sizeof(uint64_t) <= limit) {
+        uint64_t diff = MemioLzLoad64(src) ^ MemioLzLoad64(match);
+        if (diff != 0) {
+            return (size_t)(src - start) + MemioLzEqualBytes(diff);
+        }
+        src   += sizeof(uint64_t);
+        match += sizeof(uint64_t);
+    }
+    while (src < limit && *src == *match) {
+        src++; match++;
+    }
+    return (size_t)(src - start);
+}
+
+/* @summary Calculate the number of extension bytes required to encode a literal or match length.
+ * @param length The literal length, or the match length minus MEMIO_LZ_MIN_MATCH.
+ * @return The number of bytes following the token or offset used to encode the length.
+ */
+static PIL_INLINE size_t
+MemioLzLengthSize
+(
+    size_t length
+)
+{
+    return length >= 15 ? ((length - 15) / 255) + 1 : 0;
+}
+
+/* @summary Write the extension bytes for a literal or match length that does not fit in the 4-bit field of a token.
+ * @param dst The location at which to write the extension bytes.
+ * @param length The length minus 15.
+ * @return A pointer to the byte following the last extension byte written.
+ */
+static PIL_INLINE uint8_t*
+MemioLzWriteLength
+(
+    uint8_t   *dst,
+    size_t  length
+)
+{
+    while (length >= 255) {
+       *dst++  = 255;
+        length-= 255;
+    }
+   *dst++ = (uint8_t) length;
+    return dst;
+}
+
+/* @summary Read the extension bytes of a literal or match length whose 4-bit token field is 15.
+ * @param io_length On entry, the value of the token field. On return, the complete length.
+ * @param io_src On entry, the position of the first extension byte. On return, the position following the last extension byte.
+ * @param src_end One past the last readable byte of the compressed data.
+ * @return Zero if the length was read, or -1 if the compressed data is truncated or the length is implausibly large.
+ */
+static PIL_INLINE int
+MemioLzReadLength
+(
+    size_t         *io_length,
+    uint8_t const **io_src,
+    uint8_t const  *src_end
+)
+{
+    uint8_t const *src = *io_src;
+    size_t      length = *io_length;
+    uint8_t          s;
+    do {
+        if (src >= src_end) {
+            return -1;
+        }
+        s       = *src++;
+        length +=  s;
+    } while (s == 255);
+    if (length > MEMIO_LZ_MAX_INPUT_SIZE) {
+        return -1;
+    }
+   *io_length = length;
+   *io_src    = src;
+    return 0;
+}
+
+/* @summary Rotate a 32-bit value left.
+ * @param x The value to rotate.
+ * @param n The number of bits to rotate by, from 1 to 31.
+ * @return The rotated value.
+ */
+static PIL_INLINE uint32_t
+MemioLzRotl32
+(
+    uint32_t x,
+    uint32_t n
+)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+/* @summary Compute the checksum of a frame block, using the xxHash32 algorithm with a seed of zero.
+ * Four independent lanes are mixed per 16-byte stripe, so the checksum runs at close to memory bandwidth.
+ * @param data The data to checksum.
+ * @param size The number of bytes to checksum.
+ * @return The 32-bit checksum.
+ */
+static uint32_t
+MemioLzChecksum
+(
+    void const *data,
+    size_t      size
+)
+{
+    uint32_t const PRIME1 = 2654435761UL;
+    uint32_t const PRIME2 = 2246822519UL;
+    uint32_t const PRIME3 = 3266489917UL;
+    uint32_t const PRIME4 =  668265263UL;
+    uint32_t const PRIME5 =  374761393UL;
+    uint8_t const    *src = (uint8_t const*) data;
+    uint8_t const    *end = src + size;
+    uint32_t            h;
+
+    if (size >= 16) {
+        uint32_t v1 = PRIME1 + PRIME2;
+        uint32_t v2 = PRIME2;
+        uint32_t v3 = 0;
+        uint32_t v4 = 0 - PRIME1;
+        do {
+            v1  = MemioLzRotl32(v1 + ReadInline_ui32_lsb(src,  0) * PRIME2, 13) * PRIME1;
+            v2  = MemioLzRotl32(v2 + ReadInline_ui32_lsb(src,  4) * PRIME2, 13) * PRIME1;
+            v3  = MemioLzRotl32(v3 + ReadInline_ui32_lsb(src,  8) * PRIME2, 13) * PRIME1;
+            v4  = MemioLzRotl32(v4 + ReadInline_ui32_lsb(src, 12) * PRIME2, 13) * PRIME1;
+            src+= 16;
+        } while (src + 16 <= end);
+        h = MemioLzRotl32(v1, 1) + MemioLzRotl32(v2, 7) + MemioLzRotl32(v3, 12) + MemioLzRotl32(v4, 18);
+    } else {
+        h = PRIME5;
+    }
+    h += (uint32_t) size;
+    while (src + 4 <= end) {
+        h   = MemioLzRotl32(h + ReadInline_ui32_lsb(src, 0) * PRIME3, 17) * PRIME4;
+        src+= 4;
+    }
+    while (src < end) {
+        h   = MemioLzRotl32(h + (*src++) * PRIME5, 11) * PRIME1;
+    }
+    h ^= h >> 15; h *= PRIME2;
+    h ^= h >> 13; h *= PRIME3;
+    h ^= h >> 16;
+    return h;
+}
+
+PIL_API(size_t)
+MemioLzCompress
+(
+    void             *dst,
+    size_t       dst_size,
+    void const       *src,
+    size_t       src_size,
+    void         *scratch
+)
+{
+    uint32_t           *table = (uint32_t*) scratch;
+    uint8_t const       *base = (uint8_t const*) src;
+    uint8_t const         *ip = base;
+    uint8_t const     *anchor = base;
+    uint8_t const       *iend = base + src_size;
+    uint8_t const    *mflimit;
+    uint8_t const *matchlimit;
+    uint8_t const      *match;
+    uint8_t               *op = (uint8_t*) dst;
+    uint8_t             *oend = (uint8_t*) dst + dst_size;
+    uint8_t            *token;
+    size_t             length;
+
+    assert(src_size <= MEMIO_LZ_MAX_INPUT_SIZE);
+    assert(scratch  != NULL);
+    if (src_size <= MEMIO_LZ_MF_LIMIT) {
+        /* too short to contain a match - emit a single literal run */
+        goto last_literals;
+    }
+    mflimit    = iend - MEMIO_LZ_MF_LIMIT;
+    matchlimit = iend - MEMIO_LZ_LAST_LITERALS;
+    memset(table, 0, MEMIO_LZ_SCRATCH_SIZE);
+    table[MemioLzHash(ip++)] = 0;
+
+    for ( ; ; ) {
+        /* probe the hash table at successive positions, stepping further ahead
+         * the longer no match is found so that incompressible data is skipped quickly */
+        uint8_t const *next = ip;
+        uint32_t       step = 1;
+        uint32_t   attempts = 1U << MEMIO_LZ_SKIP_TRIGGER;
+        do {
+            uint32_t   h = MemioLzHash(next);
+            ip           = next;
+            next        += step;
+            step         = attempts++ >> MEMIO_LZ_SKIP_TRIGGER;
+            if (next > mflimit) {
+                goto last_literals;
+            }
+            match        = base + table[h];
+            table[h]     =(uint32_t)(ip - base);
+        } while ((size_t)(ip - match) > MEMIO_LZ_MAX_OFFSET || MemioLzLoad32(match) != MemioLzLoad32(ip));
+
+        /* extend the match backwards over any pending literals */
+        while (ip > anchor && match > base && ip[-1] == match[-1]) {
+            ip--; match--;
+        }
+
+        /* emit the token and literal run, checking for space for the match offset as well */
+        length = (size_t)(ip - anchor);
+        if (1 + MemioLzLengthSize(length) + length + 2 > (size_t)(oend - op)) {
+            return 0;
+        }
+        token = op++;
+        if (length >= 15) {
+           *token = (uint8_t)(15 << 4);
+            op    = MemioLzWriteLength(op, length - 15);
+        } else {
+           *token = (uint8_t)(length << 4);
+        }
+        memcpy(op, anchor, length);
+        op += length;
+
+    emit_match:
+        WriteInline_ui16_lsb(op, (uint16_t)(ip - match), 0);
+        op    += 2;
+        length = MemioLzMatchLength(ip + MEMIO_LZ_MIN_MATCH, match + MEMIO_LZ_MIN_MATCH, matchlimit);
+        ip    += length + MEMIO_LZ_MIN_MATCH;
+        if (MemioLzLengthSize(length) > (size_t)(oend - op)) {
+            return 0;
+        }
+        if (length >= 15) {
+           *token += 15;
+            op     = MemioLzWriteLength(op, length - 15);
+        } else {
+           *token += (uint8_t) length;
+        }
+        anchor = ip;
+        if (ip > mflimit) {
+            break;
+        }
+
+        /* update the table for a position inside the match, and test for an immediately following match */
+        table[MemioLzHash(ip - 2)] = (uint32_t)(ip - 2 - base);
+        {
+            uint32_t h = MemioLzHash(ip);
+            match      = base + table[h];
+            table[h]   =(uint32_t)(ip - base);
+            if ((size_t)(ip - match) <= MEMIO_LZ_MAX_OFFSET && MemioLzLoad32(match) == MemioLzLoad32(ip)) {
+                if (1 + 2 > (size_t)(oend - op)) {
+                    return 0;
+                }
+                token  = op++;
+               *token  = 0;
+                goto emit_match;
+            }
+        }
+        ip++;
+    }
+
+last_literals:
+    length = (size_t)(iend - anchor);
+    if (1 + MemioLzLengthSize(length) + length > (size_t)(oend - op)) {
+        return 0;
+    }
+    token = op++;
+    if (length >= 15) {
+       *token = (uint8_t)(15 << 4);
+        op    = MemioLzWriteLength(op, length - 15);
+    } else {
+       *token = (uint8_t)(length << 4);
+    }
+    if (length > 0) {
+        memcpy(op, anchor, length);
+        op += length;
+    }
+    return (size_t)(op - (uint8_t*) dst);
+}
+
+PIL_API(int)
+MemioLzDecompress
+(
+    size_t        *o_size,
+    void             *dst,
+    size_t       dst_size,
+    void const       *src,
+    size_t       src_size
+)
+{
+    uint8_t const   *ip = (uint8_t const*) src;
+    uint8_t const *iend = (uint8_t const*) src + src_size;
+    uint8_t         *op = (uint8_t*) dst;
+    uint8_t     *ostart = (uint8_t*) dst;
+    uint8_t       *oend = (uint8_t*) dst + dst_size;
+
+    assert(o_size != NULL);
+   *o_size = 0;
+    if (src_size == 0) {
+        return -1;
+    }
+    for ( ; ; ) {
+        uint8_t const *match;
+        uint32_t       token = *ip++;
+        size_t        length = token >> 4;
+        size_t        offset;
+
+        /* copy the literal run, using a single 16-byte copy for short runs away from the buffer ends */
+        if (length == 15 && MemioLzReadLength(&length, &ip, iend) != 0) {
+            return -1;
+        }
+        if (length > (size_t)(iend - ip) || length > (size_t)(oend - op)) {
+            return -1;
+        }
+        if (length <= 16 && (iend - ip) >= 16 && (oend - op) >= 16) {
+            memcpy(op, ip, 16);
+        } else if (length > 0) {
+            memcpy(op, ip, length);
+        }
+        op += length;
+        ip += length;
+        if (ip == iend) {
+            /* the last sequence of a block has no match */
+            break;
+        }
+
+        /* decode and validate the match */
+        if ((iend - ip) < 2) {
+            return -1;
+        }
+        offset = ReadInline_ui16_lsb(ip, 0);
+        ip    += 2;
+        if (offset == 0 || offset > (size_t)(op - ostart)) {
+            return -1;
+        }
+        length = token & 15;
+        if (length == 15 && MemioLzReadLength(&length, &ip, iend) != 0) {
+            return -1;
+        }
+        length += MEMIO_LZ_MIN_MATCH;
+        if (length > (size_t)(oend - op)) {
+            return -1;
+        }
+        if (ip == iend) {
+            /* a block always ends with a literal run */
+            return -1;
+        }
+
+        /* copy the match. the source may overlap the destination when the offset is less than the length */
+        match = op - offset;
+        if ((size_t)(oend - op) >= length + 8) {
+            uint8_t *copy_end = op + length;
+            if (offset < 8) {
+                /* copy the first eight bytes one at a time, after which the repeating
+                 * pattern is available at a distance of at least eight bytes */
+                size_t period = offset;
+                size_t i;
+                for (i = 0; i < 8; ++i) {
+                    op[i] = match[i];
+                }
+                while (period < 8) {
+                    period += offset;
+                }
+                op   += 8;
+                match = op - period;
+            }
+            while (op < copy_end) {
+                memcpy(op, match, 8);
+                op    += 8;
+                match += 8;
+            }
+            op = copy_end;
+        } else {
+            size_t i;
+            for (i = 0; i < length; ++i) {
+                op[i] = match[i];
+            }
+            op += length;
+        }
+    }
+   *o_size = (size_t)(op - ostart);
+    return 0;
+}
+
+PIL_API(int)
+MemioLzFrameWriteHeader
+(
+    struct MEMIO_WRITER *writer,
+    uint32_t         block_size
+)
+{
+    if (block_size == 0 || block_size > MEMIO_LZ_FRAME_BLOCK_SIZE_MAX) {
+        assert(block_size != 0);
+        assert(block_size <= MEMIO_LZ_FRAME_BLOCK_SIZE_MAX);
+        return -1;
+    }
+    if (MemioWriterReserve(writer, MEMIO_LZ_FRAME_HEADER_SIZE) != 0) {
+        return -1;
+    }
+    MemioWriterPut_ui32_lsb(writer, MEMIO_LZ_FRAME_MAGIC);
+    MemioWriterPut_ui32_lsb(writer, block_size);
+    return 0;
+}
+
+PIL_API(int)
+MemioLzFrameWriteBlock
+(
+    struct MEMIO_WRITER *writer,
+    void const             *src,
+    size_t             src_size,
+    void               *scratch
+)
+{
+    uint8_t    *data;
+    size_t data_size;
+    uint32_t   stored = 0;
+
+    if (src_size == 0 || src_size > MEMIO_LZ_FRAME_BLOCK_SIZE_MAX) {
+        assert(src_size != 0);
+        assert(src_size <= MEMIO_LZ_FRAME_BLOCK_SIZE_MAX);
+        return -1;
+    }
+    /* reserve space for the block stored uncompressed. the compressor fails if
+     * its output would not be smaller than the input, and the block is stored instead */
+    if (MemioWriterReserve(writer, MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE + src_size) != 0) {
+        return -1;
+    }
+    data      = writer->Cursor + MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE;
+    data_size = MemioLzCompress(data, src_size - 1, src, src_size, scratch);
+    if (data_size == 0) {
+        memcpy(data, src, src_size);
+        data_size = src_size;
+        stored    = MEMIO_LZ_FRAME_BLOCK_STORED;
+    }
+    MemioWriterPut_ui32_lsb(writer, (uint32_t) data_size | stored);
+    MemioWriterPut_ui32_lsb(writer, (uint32_t) src_size);
+    MemioWriterPut_ui32_lsb(writer, MemioLzChecksum(data, data_size));
+    writer->Cursor += data_size;
+    return 0;
+}
+
+PIL_API(int)
+MemioLzFrameWriteEnd
+(
+    struct MEMIO_WRITER *writer
+)
+{
+    if (MemioWriterReserve(writer, MEMIO_LZ_FRAME_END_SIZE) != 0) {
+        return -1;
+    }
+    MemioWriterPut_ui32_lsb(writer, 0);
+    return 0;
+}
+
+PIL_API(int)
+MemioLzFrameCompress
+(
+    struct MEMIO_WRITER      *writer,
+    void const                  *src,
+    size_t                  src_size,
+    uint32_t              block_size,
+    struct MEMORY_ARENA *scratch_arena
+)
+{
+    MEMORY_ARENA_MARKER marker = MemoryArenaMark(scratch_arena);
+    uint8_t const       *bytes = (uint8_t const*) src;
+    void              *scratch = NULL;
+    int                 result = -1;
+    size_t                 pos = 0;
+
+    if (block_size == 0) {
+        block_size = MEMIO_LZ_FRAME_BLOCK_SIZE_DEFAULT;
+    }
+    if ((scratch = MemoryArenaAllocateHost(NULL, scratch_arena, MEMIO_LZ_SCRATCH_SIZE, MEMIO_LZ_SCRATCH_ALIGN)) == NULL) {
+        return -1;
+    }
+    if (MemioLzFrameWriteHeader(writer, block_size) != 0) {
+        goto cleanup;
+    }
+    while (pos < src_size) {
+        size_t n = src_size - pos;
+        if (n  > block_size) {
+            n  = block_size;
+        }
+        if (MemioLzFrameWriteBlock(writer, bytes + pos, n, scratch) != 0) {
+            goto cleanup;
+        }
+        pos += n;
+    }
+    result = MemioLzFrameWriteEnd(writer);
+
+cleanup:
+    MemoryArenaResetToMarker(scratch_arena, marker);
+    return result;
+}
+
+PIL_API(int)
+MemioLzFrameReadHeader
+(
+    uint32_t     *o_block_size,
+    struct MEMIO_READER *reader
+)
+{
+    uint32_t      magic;
+    uint32_t block_size;
+
+    if (MemioReaderRequire(reader, MEMIO_LZ_FRAME_HEADER_SIZE) != 0) {
+        return -1;
+    }
+    magic      = MemioReaderGet_ui32_lsb(reader);
+    block_size = MemioReaderGet_ui32_lsb(reader);
+    if (magic != MEMIO_LZ_FRAME_MAGIC || block_size == 0 || block_size > MEMIO_LZ_FRAME_BLOCK_SIZE_MAX) {
+        reader->Error = 1;
+        return -1;
+    }
+   *o_block_size = block_size;
+    return 0;
+}
+
+PIL_API(int)
+MemioLzFrameReadBlock
+(
+    struct MEMIO_LZ_FRAME_BLOCK *o_block,
+    struct MEMIO_READER          *reader,
+    uint32_t                  block_size
+)
+{
+    uint32_t word;
+
+    if (MemioReaderRequire(reader, MEMIO_LZ_FRAME_END_SIZE) != 0) {
+        return -1;
+    }
+    if ((word = MemioReaderGet_ui32_lsb(reader)) == 0) {
+        return 0;
+    }
+    if (MemioReaderRequire(reader, MEMIO_LZ_FRAME_BLOCK_HEADER_SIZE - MEMIO_LZ_FRAME_END_SIZE) != 0) {
+        return -1;
+    }
+    o_block->DataSize    = word & ~MEMIO_LZ_FRAME_BLOCK_STORED;
+    o_block->ContentSize = MemioReaderGet_ui32_lsb(reader);
+    o_block->Checksum    = MemioReaderGet_ui32_lsb(reader);
+    o_block->Stored      =(word & MEMIO_LZ_FRAME_BLOCK_STORED) != 0 ? 1 : 0;
+    if (o_block->ContentSize == 0 || o_block->ContentSize > block_size || o_block->DataSize == 0) {
+        reader->Error = 1;
+        return -1;
+    }
+    if (o_block->Stored && o_block->DataSize != o_block->ContentSize) {
+        reader->Error = 1;
+        return -1;
+    }
+    if (MemioReaderRequire(reader, o_block->DataSize) != 0) {
+        return -1;
+    }
+    o_block->Data = reader->Cursor;
+    MemioReaderSkip(reader, o_block->DataSize);
+    return 1;
+}
+
+PIL_API(int)
+MemioLzFrameDecodeBlock
+(
+    void                                *dst,
+    size_t                          dst_size,
+    struct MEMIO_LZ_FRAME_BLOCK const *block
+)
+{
+    size_t size;
+
+    if (dst_size < block->ContentSize) {
+        return -1;
+    }
+    if (MemioLzChecksum(block->Data, block->DataSize) != block->Checksum) {
+        return -1;
+    }
+    if (block->Stored) {
+        memcpy(dst, block->Data, block->DataSize);
+        return 0;
+    }
+    if (MemioLzDecompress(&size, dst, block->ContentSize, block->Data, block->DataSize) != 0 || size != block->ContentSize) {
+        return -1;
+    }
+    return 0;
+}
+
+PIL_API(int)
+MemioLzFrameDecompress
+(
+    struct MEMIO_WRITER *writer,
+    void const             *src,
+    size_t             src_size
+)
+{
+    MEMIO_LZ_FRAME_BLOCK block;
+    MEMIO_READER        reader;
+    uint32_t        block_size;
+    int                 result;
+
+    MemioReaderInit(&reader, src, src_size);
+    if (MemioLzFrameReadHeader(&block_size, &reader) != 0) {
+        return -1;
+    }
+    while ((result = MemioLzFrameReadBlock(&block, &reader, block_size)) > 0) {
+        if (MemioWriterReserve(writer, block.ContentSize) != 0) {
+            return -1;
+        }
+        if (MemioLzFrameDecodeBlock(writer->Cursor, block.ContentSize, &block) != 0) {
+            return -1;
+        }
+        writer->Cursor += block.ContentSize;
+    }
+    return result;
+}
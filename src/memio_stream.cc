@@ -0,0 +1,235 @@
+/**
+ * @summary memio_stream.cc: Implement initialization and growth of the memory
+ * buffer cursors declared in memio_stream.h. The per-value read and write
+ * functions are inline, so this file only contains the slow paths.
+ */
+#include <string.h>
+#include "memio_stream.h"
+
+/* @summary Define the minimum number of bytes by which a MEMIO_WRITER grows.
+ */
+#ifndef MEMIO_WRITER_MIN_GROWTH
+#   define MEMIO_WRITER_MIN_GROWTH      4096
+#endif
+
+/* @summary Compute the number of bytes by which a writer should grow to satisfy a reservation.
+ * The writer grows geometrically so that a sequence of small reservations causes a logarithmic number of calls into the memory manager.
+ * @param writer The MEMIO_WRITER being grown.
+ * @param shortfall The number of bytes by which the reservation exceeds the remaining space.
+ * @return The preferred number of bytes by which to grow, which is at least shortfall.
+ */
+static size_t
+MemioWriterGrowthAmount
+(
+    struct MEMIO_WRITER *writer,
+    size_t            shortfall
+)
+{
+    size_t current = (size_t)(writer->BufferEnd - writer->BufferStart);
+    size_t  amount =  current > MEMIO_WRITER_MIN_GROWTH ? current : MEMIO_WRITER_MIN_GROWTH;
+    return (amount > shortfall) ? amount : shortfall;
+}
+
+/* @summary Grow a MEMIO_WRITER targeting a memory block by increasing the commitment of the block.
+ * @param writer The MEMIO_WRITER to grow.
+ * @param shortfall The minimum number of bytes by which the writer must grow.
+ * @return Zero if the writer grew by at least shortfall bytes, or -1 if the block reservation is exhausted.
+ */
+static int
+MemioWriterGrowBlock
+(
+    struct MEMIO_WRITER *writer,
+    size_t            shortfall
+)
+{
+    MEMORY_BLOCK   *block = writer->Block;
+    uint64_t   min_commit = block->BytesCommitted + shortfall;
+    uint64_t   new_commit = block->BytesCommitted + MemioWriterGrowthAmount(writer, shortfall);
+
+    if (min_commit > block->BytesReserved) {
+        return -1;
+    }
+    if (new_commit > block->BytesReserved) {
+        new_commit = block->BytesReserved;
+    }
+    if (!HostMemoryIncreaseCommitment(block, block, (size_t) new_commit)) {
+        return -1;
+    }
+    writer->BufferEnd = block->HostAddress + block->BytesCommitted;
+    return 0;
+}
+
+/* @summary Grow a MEMIO_WRITER targeting a memory arena by extending its allocation at the end of the arena.
+ * @param writer The MEMIO_WRITER to grow.
+ * @param shortfall The minimum number of bytes by which the writer must grow.
+ * @return Zero if the writer grew by at least shortfall bytes, or -1 if another allocation follows the writer or the arena is exhausted.
+ */
+static int
+MemioWriterGrowArena
+(
+    struct MEMIO_WRITER *writer,
+    size_t            shortfall
+)
+{
+    MEMORY_ARENA   *arena = writer->Arena;
+    MEMORY_BLOCK    block;
+    size_t         amount = MemioWriterGrowthAmount(writer, shortfall);
+
+    if ((uint8_t*)(uintptr_t)(arena->MemoryStart + arena->NextOffset) != writer->BufferEnd) {
+        /* another allocation was made from the arena after the writer's -
+         * growing would not be contiguous, and the written data is not moved */
+        return -1;
+    }
+    if (MemoryArenaAllocate(&block, arena, amount, 1) != 0) {
+        /* the preferred amount is not available - try for just the shortfall */
+        if (amount == shortfall || MemoryArenaAllocate(&block, arena, shortfall, 1) != 0) {
+            return -1;
+        }
+    }
+    assert(block.HostAddress == writer->BufferEnd);
+    writer->BufferEnd = block.HostAddress + block.BytesCommitted;
+    return 0;
+}
+
+PIL_API(void)
+MemioReaderInit
+(
+    struct MEMIO_READER *o_reader,
+    void const            *buffer,
+    size_t            buffer_size
+)
+{
+    assert(o_reader != NULL);
+    assert(buffer != NULL || buffer_size == 0);
+    o_reader->BufferStart =(uint8_t const*) buffer;
+    o_reader->Cursor      =(uint8_t const*) buffer;
+    o_reader->BufferEnd   =(uint8_t const*) buffer + buffer_size;
+    o_reader->Error       = 0;
+    o_reader->Reserved    = 0;
+}
+
+PIL_API(void)
+MemioWriterInitBuffer
+(
+    struct MEMIO_WRITER *o_writer,
+    void                  *buffer,
+    size_t            buffer_size
+)
+{
+    assert(o_writer != NULL);
+    assert(buffer != NULL || buffer_size == 0);
+    o_writer->BufferStart =(uint8_t*) buffer;
+    o_writer->Cursor      =(uint8_t*) buffer;
+    o_writer->BufferEnd   =(uint8_t*) buffer + buffer_size;
+    o_writer->Block       = NULL;
+    o_writer->Arena       = NULL;
+    o_writer->Error       = 0;
+    o_writer->WriterType  = MEMIO_WRITER_TYPE_BUFFER;
+}
+
+PIL_API(int)
+MemioWriterInitBlock
+(
+    struct MEMIO_WRITER *o_writer,
+    struct MEMORY_BLOCK    *block
+)
+{
+    assert(o_writer != NULL);
+    memset(o_writer, 0, sizeof(MEMIO_WRITER));
+    if (block == NULL || block->HostAddress == NULL || block->BytesReserved == 0) {
+        assert(block != NULL);
+        assert(block->HostAddress != NULL);
+        assert(block->BytesReserved != 0);
+        o_writer->Error = 1;
+        return -1;
+    }
+    o_writer->BufferStart = block->HostAddress;
+    o_writer->Cursor      = block->HostAddress;
+    o_writer->BufferEnd   = block->HostAddress + block->BytesCommitted;
+    o_writer->Block       = block;
+    o_writer->WriterType  = MEMIO_WRITER_TYPE_BLOCK;
+    return 0;
+}
+
+PIL_API(int)
+MemioWriterInitArena
+(
+    struct MEMIO_WRITER *o_writer,
+    struct MEMORY_ARENA    *arena,
+    size_t           initial_size,
+    size_t              alignment
+)
+{
+    MEMORY_BLOCK block;
+
+    assert(o_writer != NULL);
+    memset(o_writer, 0, sizeof(MEMIO_WRITER));
+    if (arena == NULL || (arena->AllocatorType != MEMORY_ALLOCATOR_TYPE_HOST_HEAP && arena->AllocatorType != MEMORY_ALLOCATOR_TYPE_HOST_VMM)) {
+        assert(arena != NULL);
+        assert(arena->AllocatorType == MEMORY_ALLOCATOR_TYPE_HOST_HEAP || arena->AllocatorType == MEMORY_ALLOCATOR_TYPE_HOST_VMM);
+        o_writer->Error = 1;
+        return -1;
+    }
+    if (MemoryArenaAllocate(&block, arena, initial_size, alignment) != 0) {
+        o_writer->Error = 1;
+        return -1;
+    }
+    o_writer->BufferStart = block.HostAddress;
+    o_writer->Cursor      = block.HostAddress;
+    o_writer->BufferEnd   = block.HostAddress + block.BytesCommitted;
+    o_writer->Arena       = arena;
+    o_writer->WriterType  = MEMIO_WRITER_TYPE_ARENA;
+    return 0;
+}
+
+PIL_API(int)
+MemioWriterGrow
+(
+    struct MEMIO_WRITER *writer,
+    size_t                 size
+)
+{
+    size_t available = (size_t)(writer->BufferEnd - writer->Cursor);
+    int       result = -1;
+
+    if (writer->Error != 0) {
+        return -1;
+    }
+    if (size <= available) {
+        return  0;
+    }
+    switch (writer->WriterType) {
+        case MEMIO_WRITER_TYPE_BLOCK:
+            result = MemioWriterGrowBlock(writer, size - available);
+            break;
+        case MEMIO_WRITER_TYPE_ARENA:
+            result = MemioWriterGrowArena(writer, size - available);
+            break;
+        default:
+            break;
+    }
+    if (result != 0) {
+        writer->Error = 1;
+    }
+    return result;
+}
+
+PIL_API(size_t)
+MemioWriterFinish
+(
+    struct MEMIO_WRITER *writer
+)
+{
+    if (writer->WriterType == MEMIO_WRITER_TYPE_ARENA) {
+        MEMORY_ARENA  *arena = writer->Arena;
+        if ((uint8_t*)(uintptr_t)(arena->MemoryStart + arena->NextOffset) == writer->BufferEnd) {
+            /* the writer holds the most recent allocation - return the unused tail */
+            MEMORY_ARENA_MARKER marker;
+            marker.Arena = arena;
+            marker.State =(uint64_t)((uintptr_t) writer->Cursor - arena->MemoryStart);
+            MemoryArenaResetToMarker(arena, marker);
+            writer->BufferEnd = writer->Cursor;
+        }
+    }
+    return writer->Error == 0 ? MemioWriter_GetSize(writer) : 0;
+}
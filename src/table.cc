@@ -95,43 +95,229 @@ MoveTableItemData
     }
 }
 
-PIL_API(void)
-TableDeleteAllIds
+/* @summary Read the key value for an item from the key column of a TABLE_KEY_INDEX.
+ * @param key_index The TABLE_KEY_INDEX describing the key column.
+ * @param desc Pointer to a TABLE_DESC describing the table data streams.
+ * @param dense_index The dense index of the item record.
+ * @return The key value, zero-extended to 64 bits.
+ */
+static inline uint64_t
+ReadTableItemKey
 (
-    struct TABLE_DESC *table
+    struct TABLE_KEY_INDEX *key_index, 
+    struct TABLE_DESC           *desc, 
+    uint32_t              dense_index
 )
 {
-    TABLE_INDEX     *index = table->Index;
-    uint32_t *sparse_array = index->SparseIndex;
-    uint32_t *handle_array = index->HandleArray;
-    uint32_t  handle_value;
-    uint32_t  sparse_index;
-    uint32_t    generation;
-    uint32_t          i, n;
-    for (i = 0, n = index->ActiveCount; i < n; ++i) {
-        handle_value = handle_array[i];
-        generation   = Table_HandleBitsExtractGeneration(handle_value);
-        sparse_index = Table_HandleBitsExtractSparseIndex(handle_value);
-        sparse_array[sparse_index] = ((generation + 1) & HANDLE_GENER_MASK) << HANDLE_GENER_SHIFT;
-        handle_array[i]  = sparse_index;
-    } index->ActiveCount = 0;
+    TABLE_DATA *stream = desc->Streams[key_index->StreamIndex];
+    uint8_t       *src = TableData_GetElementPointer(uint8_t, stream, dense_index) + key_index->KeyOffset;
+    uint64_t       k64 = 0;
+    uint32_t       k32 = 0;
+    if (key_index->KeySize == sizeof(uint64_t)) {
+        memcpy(&k64, src, sizeof(uint64_t));
+    } else {
+        memcpy(&k32, src, sizeof(uint32_t));
+        k64 = k32;
+    }
+    return k64;
 }
 
-PIL_API(void)
-TableRemoveAllIds
+/* @summary Insert a key-handle pair into the hash table of a TABLE_KEY_INDEX.
+ * @param key_index The TABLE_KEY_INDEX to update.
+ * @param key The key value.
+ * @param bits The handle of the item associated with the key.
+ * @return Zero if the pair is inserted, or -1 if the key is already present or the hash table is full.
+ */
+static int
+InsertTableKey
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    uint64_t                      key, 
+    HANDLE_BITS                  bits
+)
+{
+    TABLE_KEY_INDEX_SLOT *slots = key_index->SlotArray;
+    uint32_t               mask = key_index->SlotCount - 1;
+    uint32_t                  i = TableKeyIndex_HashKey(key) & mask;
+
+    if (key_index->ItemCount + 1 >= key_index->SlotCount) {
+        assert(key_index->ItemCount + 1 < key_index->SlotCount);
+        return -1;
+    }
+    while (slots[i].Handle != HANDLE_BITS_INVALID) {
+        if (slots[i].Key == key) {
+            return -1;
+        } i = (i + 1) & mask;
+    }
+    slots[i].Key    = key;
+    slots[i].Handle = bits;
+    key_index->ItemCount++;
+    return 0;
+}
+
+/* @summary Remove a key-handle pair from the hash table of a TABLE_KEY_INDEX.
+ * Slots following the removed slot in the probe sequence are shifted backwards, so no tombstones are required.
+ * @param key_index The TABLE_KEY_INDEX to update.
+ * @param key The key value.
+ * @param bits The handle of the item associated with the key. The pair is only removed if the stored handle matches.
+ */
+static void
+RemoveTableKey
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    uint64_t                      key, 
+    HANDLE_BITS                  bits
+)
+{
+    TABLE_KEY_INDEX_SLOT *slots = key_index->SlotArray;
+    uint32_t               mask = key_index->SlotCount - 1;
+    uint32_t                  i = TableKeyIndex_HashKey(key) & mask;
+    uint32_t                  j;
+    uint32_t                  k;
+
+    for ( ; ; ) {
+        if (slots[i].Handle == HANDLE_BITS_INVALID) {
+            return; /* not present */
+        }
+        if (slots[i].Key == key) {
+            break;
+        } i = (i + 1) & mask;
+    }
+    if (slots[i].Handle != bits) {
+        return; /* the key belongs to a different item */
+    }
+    for (j = i; ; ) {
+        j = (j + 1) & mask;
+        if (slots[j].Handle == HANDLE_BITS_INVALID) {
+            break;
+        }
+        /* move slot j into the hole at i unless its home slot k lies cyclically in (i, j] */
+        k = TableKeyIndex_HashKey(slots[j].Key) & mask;
+        if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) {
+            continue;
+        }
+        slots[i] = slots[j];
+        i = j;
+    }
+    slots[i].Key    = 0;
+    slots[i].Handle = HANDLE_BITS_INVALID;
+    key_index->ItemCount--;
+}
+
+/* @summary Remove an item from all of the key indices linked to a table.
+ * This must be called before the item record is overwritten.
+ * @param desc Pointer to a TABLE_DESC describing the table.
+ * @param dense_index The dense index of the item record.
+ * @param bits The handle of the item.
+ */
+static inline void
+RemoveTableItemKeys
+(
+    struct TABLE_DESC *desc, 
+    uint32_t    dense_index, 
+    HANDLE_BITS        bits
+)
+{
+    TABLE_KEY_INDEX *key_index;
+    for (key_index = desc->KeyIndex; key_index != NULL; key_index = key_index->Next) {
+        RemoveTableKey(key_index, ReadTableItemKey(key_index, desc, dense_index), bits);
+    }
+}
+
+/* @summary Free the blob referenced by a TABLE_BLOB_SPAN and reset the span.
+ * The blob is only freed if it is owned by the specified item, which protects against stale spans in uninitialized records.
+ * @param blob_heap The TABLE_BLOB_HEAP from which the blob was allocated.
+ * @param span The TABLE_BLOB_SPAN stored in the item record.
+ * @param bits The handle of the item that owns the blob.
+ */
+static void
+FreeTableBlob
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_BLOB_SPAN      *span, 
+    HANDLE_BITS                  bits
+)
+{
+    TABLE_BLOB_HEADER *header;
+    if (span->Size != 0 && span->Offset >= sizeof(TABLE_BLOB_HEADER) && span->Offset <= blob_heap->HeapSize) {
+        header = (TABLE_BLOB_HEADER*)(blob_heap->HeapBase + span->Offset - sizeof(TABLE_BLOB_HEADER));
+        if (header->Handle == bits) {
+            header->Handle = HANDLE_BITS_INVALID;
+            blob_heap->FreeBytes += header->Size;
+        }
+    }
+    span->Offset = 0;
+    span->Size   = 0;
+}
+
+/* @summary Free the blobs owned by an item in all of the blob heaps linked to a table.
+ * This must be called before the item record is overwritten.
+ * @param desc Pointer to a TABLE_DESC describing the table.
+ * @param dense_index The dense index of the item record.
+ * @param bits The handle of the item.
+ */
+static inline void
+RemoveTableItemBlobs
+(
+    struct TABLE_DESC *desc, 
+    uint32_t    dense_index, 
+    HANDLE_BITS        bits
+)
+{
+    TABLE_BLOB_HEAP *blob_heap;
+    for (blob_heap = desc->BlobHeap; blob_heap != NULL; blob_heap = blob_heap->Next) {
+        FreeTableBlob(blob_heap, TableBlobHeap_GetSpan(blob_heap, desc, dense_index), bits);
+    }
+}
+
+/* @summary Create an item in a table without writing a journal record.
+ * @param o_record_index On return, set to the dense index of the item record.
+ * @param table Pointer to a TABLE_DESC describing the table.
+ * @return The handle of the new item.
+ */
+static HANDLE_BITS
+CreateTableItemId
 (
+    uint32_t *o_record_index, 
     struct TABLE_DESC *table
 )
 {
     TABLE_INDEX     *index = table->Index;
     uint32_t *sparse_array = index->SparseIndex;
-    size_t    sparse_bytes = index->TableCapacity * sizeof(uint32_t);
-    memset(sparse_array, 0 , sparse_bytes);
-    index->ActiveCount = 0;
+    uint32_t *handle_array = index->HandleArray;
+    uint32_t  handle_index = index->ActiveCount;
+    uint32_t  sparse_index;
+    uint32_t    generation;
+    uint32_t    slot_value;
+    HANDLE_BITS       bits;
+
+    assert(index->ActiveCount < index->CommitCount);
+    if (handle_index == index->HighWatermark) {
+        index->HighWatermark = handle_index + 1;
+        sparse_index         = handle_index;
+        generation           = 0;
+        slot_value           = 0;
+    } else {
+        slot_value           = handle_array[handle_index];
+        generation           = Table_HandleBitsExtractGeneration(slot_value);
+        sparse_index         = Table_HandleBitsExtractSparseIndex(slot_value);
+    }
+    bits = Table_MakeHandleBits(sparse_index, generation);
+    sparse_array[sparse_index] = HANDLE_FLAG_MASK_PACKED | (handle_index << HANDLE_INDEX_SHIFT) | (generation << HANDLE_GENER_SHIFT);
+    handle_array[handle_index] = bits;
+   *o_record_index = handle_index; 
+    index->ActiveCount++;
+    return bits;
 }
 
-PIL_API(HANDLE_BITS)
-TableDeleteId
+/* @summary Delete an item from a table without writing a journal record.
+ * The item's keys are removed from the linked key indices and its blobs are freed.
+ * @param table Pointer to a TABLE_DESC describing the table.
+ * @param bits The handle of the item to delete.
+ * @return The handle of the item moved into the vacated slot, or HANDLE_BITS_INVALID.
+ */
+static HANDLE_BITS
+DeleteTableItemId
 (
     struct TABLE_DESC *table, 
     HANDLE_BITS         bits
@@ -153,6 +339,12 @@ TableDeleteId
         sparse_value = sparse_array[sparse_index];
         generation   = Table_SparseIndexExtractGeneration(sparse_value);
         dense_index  = Table_SparseIndexExtractDenseIndex(sparse_value);
+        if (table->KeyIndex != NULL) {
+            RemoveTableItemKeys(table, dense_index, bits);
+        }
+        if (table->BlobHeap != NULL) {
+            RemoveTableItemBlobs(table, dense_index, bits);
+        }
         sparse_array[sparse_index] = ((generation + 1) & HANDLE_GENER_MASK) << HANDLE_GENER_SHIFT;
         /* if the deleted item is not the last slot in the dense array, 
          * swap the last live item into the slot vacated by the deleted 
@@ -173,6 +365,95 @@ TableDeleteId
     return moved_value;
 }
 
+PIL_API(void)
+TableDeleteAllIds
+(
+    struct TABLE_DESC *table
+)
+{
+    TABLE_INDEX     *index = table->Index;
+    uint32_t *sparse_array = index->SparseIndex;
+    uint32_t *handle_array = index->HandleArray;
+    uint32_t  handle_value;
+    uint32_t  sparse_index;
+    uint32_t    generation;
+    uint32_t          i, n;
+    TABLE_KEY_INDEX  *kidx;
+    TABLE_BLOB_HEAP  *heap;
+    if (table->Journal != NULL) {
+        TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_DELETE_ALL, NULL, 0);
+    }
+    for (kidx = table->KeyIndex; kidx != NULL; kidx = kidx->Next) {
+        TableKeyIndexClear(kidx);
+    }
+    for (heap = table->BlobHeap; heap != NULL; heap = heap->Next) {
+        TableBlobHeapClear(heap);
+    }
+    for (i = 0, n = index->ActiveCount; i < n; ++i) {
+        handle_value = handle_array[i];
+        generation   = Table_HandleBitsExtractGeneration(handle_value);
+        sparse_index = Table_HandleBitsExtractSparseIndex(handle_value);
+        sparse_array[sparse_index] = ((generation + 1) & HANDLE_GENER_MASK) << HANDLE_GENER_SHIFT;
+        handle_array[i]  = (sparse_index << HANDLE_INDEX_SHIFT) | ((generation + 1) & HANDLE_GENER_MASK);
+    } index->ActiveCount = 0;
+}
+
+PIL_API(void)
+TableRemoveAllIds
+(
+    struct TABLE_DESC *table
+)
+{
+    TABLE_INDEX     *index = table->Index;
+    uint32_t *sparse_array = index->SparseIndex;
+    uint32_t    *page_mask = index->SparsePageMask;
+    size_t    sparse_bytes = index->TableCapacity * sizeof(uint32_t);
+    uint32_t    page_count;
+    uint32_t          p, w;
+    TABLE_KEY_INDEX  *kidx;
+    TABLE_BLOB_HEAP  *heap;
+
+    if (table->Journal != NULL) {
+        TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_REMOVE_ALL, NULL, 0);
+    }
+    for (kidx = table->KeyIndex; kidx != NULL; kidx = kidx->Next) {
+        TableKeyIndexClear(kidx);
+    }
+    for (heap = table->BlobHeap; heap != NULL; heap = heap->Next) {
+        TableBlobHeapClear(heap);
+    }
+    if (page_mask == NULL) {
+        memset(sparse_array, 0 , sparse_bytes);
+    } else {
+        /* only clear the pages of the sparse index that have been committed */
+        page_count = (index->TableCapacity + (TABLE_SPARSE_PAGE_ENTRIES-1)) >> TABLE_SPARSE_PAGE_SHIFT;
+        for (w = 0; w < page_count; w += 32) {
+            if (page_mask[w >> 5] == 0) {
+                continue;
+            }
+            for (p = w; p < w + 32 && p < page_count; ++p) {
+                if (page_mask[p >> 5] & (1UL << (p & 31))) {
+                    memset(sparse_array + (p << TABLE_SPARSE_PAGE_SHIFT), 0, TABLE_SPARSE_PAGE_SIZE);
+                }
+            }
+        }
+    }
+    index->ActiveCount = 0;
+}
+
+PIL_API(HANDLE_BITS)
+TableDeleteId
+(
+    struct TABLE_DESC *table, 
+    HANDLE_BITS         bits
+)
+{
+    if (table->Journal != NULL && Table_HandleBitsExtractSparseIndex(bits) < table->Index->TableCapacity) {
+        TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_DELETE_ID, &bits, 1);
+    }
+    return DeleteTableItemId(table, bits);
+}
+
 PIL_API(void)
 TableDeleteIds
 (
@@ -181,25 +462,19 @@ TableDeleteIds
     uint32_t    delete_count
 )
 {
-#   define              HC   64
-#   define              HM  (HC-1)
     TABLE_INDEX     *index = table->Index;
     uint32_t *sparse_array = index->SparseIndex;
     uint32_t *handle_array = index->HandleArray;
     uint32_t  active_count = index->ActiveCount;
     uint32_t    last_dense = index->ActiveCount - 1;
-    uint32_t    move_count = 0;
     uint32_t    generation;
     uint32_t   state_value; /* read from sparse_array  */
     uint32_t   state_index; /* index into sparse_array */
     uint32_t   dense_index; /* index into handle_array */
-    uint32_t deleted_index; /* index into sparse_array */
     uint32_t   moved_index; /* index into sparse_array */
     uint32_t   moved_value; /* read from handle_array  */
     uint32_t   moved_gener;
-    uint32_t   history[HC];
-    uint32_t         found;
-    uint32_t       i, j, n;
+    uint32_t             i;
 
     if (delete_count > active_count) {
         assert(delete_count <= active_count);
@@ -210,55 +485,51 @@ TableDeleteIds
         TableDeleteAllIds(table);
         return;
     }
+    if (table->Journal != NULL) {
+        TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_DELETE_IDS, delete_ids, delete_count);
+    }
     /* only part of the table is being deleted. 
      * for large deletions, there can be significant overhead due to repeatedly moving elements.
-     * optimize for this case by tracking which items are moved and where they were moved to. 
-     * then, perform a second pass so that any moved item gets moved at most once.
+     * the first pass invalidates each deleted handle and writes its free list entry into the 
+     * dense slot it occupied. the dense index is kept in the sparse slot until the second pass.
      */
     for (i = 0; i < delete_count; ++i) {
         state_index = Table_HandleBitsExtractSparseIndex(delete_ids[i]);
         state_value = sparse_array[state_index];
+        generation  = Table_SparseIndexExtractGeneration(state_value);
         dense_index = Table_SparseIndexExtractDenseIndex(state_value);
-        moved_value = handle_array[last_dense];
-        moved_index = Table_HandleBitsExtractSparseIndex(moved_value);
-        moved_gener = Table_HandleBitsExtractGeneration (moved_value);
-        /* invalidate the deleted handle */
-        sparse_array[state_index] = (state_value + HANDLE_GENER_ADD_PACKED) & HANDLE_GENER_MASK_PACKED;
-        if (dense_index != last_dense) { /* update the index arrays */
-            sparse_array[moved_index] = HANDLE_FLAG_MASK_PACKED | (dense_index << HANDLE_INDEX_SHIFT) | (moved_gener << HANDLE_GENER_SHIFT);
-            handle_array[dense_index] = handle_array[last_dense];
-        } last_dense--;
+        if (table->KeyIndex != NULL) {
+            RemoveTableItemKeys(table, dense_index, delete_ids[i]);
+        }
+        if (table->BlobHeap != NULL) {
+            RemoveTableItemBlobs(table, dense_index, delete_ids[i]);
+        }
+        sparse_array[state_index] = (state_value & HANDLE_INDEX_MASK_PACKED) | (((generation + 1) & HANDLE_GENER_MASK) << HANDLE_GENER_SHIFT);
+        handle_array[dense_index] = (state_index << HANDLE_INDEX_SHIFT) | ((generation + 1) & HANDLE_GENER_MASK);
     } index->ActiveCount -= delete_count;
-    /* second pass, move all of the actual data.
-     * the items in handle_array [index->ActiveCount, index->ActiveCount+delete_count) 
-     * can be used to retrieve the sparse index value stored at the given dense index.
+    /* second pass, fill each hole below the new ActiveCount with a live item from the tail of 
+     * the dense arrays. the number of holes equals the number of live items in the tail, and 
+     * since items only move out of the tail, each item's data is moved at most once.
      */
-    for (i = index->ActiveCount, n = index->ActiveCount + delete_count, j = 0; i < n; ++i, ++j) {
-        state_index = Table_HandleBitsExtractSparseIndex(handle_array[i]);
+    for (i = 0; i < delete_count; ++i) {
+        state_index = Table_HandleBitsExtractSparseIndex(delete_ids[i]);
         state_value = sparse_array[state_index];
-        if (Table_SparseIndexExtractLive(state_value) != 0 && (dense_index = Table_SparseIndexExtractDenseIndex(state_value)) != i) {
-            /* item at state_index was moved in handle_array from location i to location dense_index.
-             * if the state_index doesn't appear in the move history buffer, move the associated data.
-             */
-            for (j = 0, found = 0; j < HC && j < move_count; ++j) {
-                if (history[j] == state_index) {
-                    found = 1;
-                    break;
-                }
-            }
-            if (found == 0) {
-                MoveTableItemData(table  , dense_index, i);
-                history[move_count & HM] = state_index;
-                move_count++;
+        dense_index = Table_SparseIndexExtractDenseIndex(state_value);
+        sparse_array[state_index] = state_value & HANDLE_GENER_MASK_PACKED;
+        if (dense_index < index->ActiveCount) {
+            while (Table_HandleBitsExtractLive(handle_array[last_dense]) == 0) {
+                last_dense--;
             }
-            /* return the sparse index to the free list */
-            generation      = Table_HandleBitsExtractGeneration(delete_ids[j]);
-            deleted_index   = Table_HandleBitsExtractSparseIndex(delete_ids[j]);
-            handle_array[i] =(deleted_index << HANDLE_INDEX_SHIFT) | ((generation + HANDLE_GENER_ADD_PACKED) & HANDLE_GENER_MASK);
+            moved_value = handle_array[last_dense];
+            moved_index = Table_HandleBitsExtractSparseIndex(moved_value);
+            moved_gener = Table_HandleBitsExtractGeneration (moved_value);
+            MoveTableItemData(table, dense_index, last_dense);
+            sparse_array[moved_index] = HANDLE_FLAG_MASK_PACKED | (dense_index << HANDLE_INDEX_SHIFT) | (moved_gener << HANDLE_GENER_SHIFT);
+            handle_array[last_dense ] = handle_array[dense_index]; /* the free list entry */
+            handle_array[dense_index] = moved_value;
+            last_dense--;
         }
     }
-#   undef HM
-#   undef HC
 }
 
 PIL_API(HANDLE_BITS)
@@ -280,8 +551,17 @@ TableRemoveId
     uint32_t   dense_index;
 
     if (sparse_index < index->TableCapacity) {
+        if (table->Journal != NULL) {
+            TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_REMOVE_ID, &bits, 1);
+        }
         sparse_value = sparse_array[sparse_index];
         dense_index  = Table_SparseIndexExtractDenseIndex(sparse_value);
+        if (table->KeyIndex != NULL) {
+            RemoveTableItemKeys(table, dense_index, bits);
+        }
+        if (table->BlobHeap != NULL) {
+            RemoveTableItemBlobs(table, dense_index, bits);
+        }
         sparse_array[sparse_index] = 0;
         /* if the deleted item is not the last slot in the dense array, 
          * swap the last live item into the slot vacated by the deleted 
@@ -316,7 +596,7 @@ TableResolve
     uint32_t   sparse_value;
     uint32_t   generation_i;
 
-    if (is_live) {
+    if (is_live && TableIndex_IsSparseSlotCommitted(index, sparse_index)) {
         sparse_value   = sparse_array[sparse_index];
         generation_i   = Table_SparseIndexExtractGeneration(sparse_value);
        *o_record_index = Table_SparseIndexExtractDenseIndex(sparse_value);
@@ -334,31 +614,10 @@ TableCreateId
     struct TABLE_DESC *table
 )
 {
-    TABLE_INDEX     *index = table->Index;
-    uint32_t *sparse_array = index->SparseIndex;
-    uint32_t *handle_array = index->HandleArray;
-    uint32_t  handle_index = index->ActiveCount;
-    uint32_t  sparse_index;
-    uint32_t    generation;
-    uint32_t    slot_value;
-    HANDLE_BITS       bits;
-
-    assert(index->ActiveCount < index->CommitCount);
-    if (handle_index == index->HighWatermark) {
-        index->HighWatermark = handle_index + 1;
-        sparse_index         = handle_index;
-        generation           = 0;
-        slot_value           = 0;
-    } else {
-        slot_value           = handle_array[handle_index];
-        generation           = Table_HandleBitsExtractGeneration(slot_value);
-        sparse_index         = Table_HandleBitsExtractSparseIndex(slot_value);
+    HANDLE_BITS bits = CreateTableItemId(o_record_index, table);
+    if (table->Journal != NULL) {
+        TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_CREATE_ID, &bits, 1);
     }
-    bits = Table_MakeHandleBits(sparse_index, generation);
-    sparse_array[sparse_index] = HANDLE_FLAG_MASK_PACKED | (handle_index << HANDLE_INDEX_SHIFT) | (generation << HANDLE_GENER_SHIFT);
-    handle_array[handle_index] = bits;
-   *o_record_index = handle_index; 
-    index->ActiveCount++;
     return bits;
 }
 
@@ -373,20 +632,266 @@ TableInsertId
     TABLE_INDEX     *index = table->Index;
     uint32_t *sparse_array = index->SparseIndex;
     uint32_t *handle_array = index->HandleArray;
-    uint32_t  handle_index = index->ActiveCount + 1;
+    uint32_t  handle_index = index->ActiveCount;
     uint32_t    generation = Table_HandleBitsExtractGeneration(bits);
     uint32_t  sparse_index = Table_HandleBitsExtractSparseIndex(bits);
 
     assert(index->ActiveCount < index->CommitCount);
+    if (sparse_index < index->TableCapacity && TableCommitSparseIndex(index, sparse_index, sparse_index + 1) != 0) {
+        return -1;
+    }
     if (sparse_index < index->TableCapacity && sparse_array[sparse_index] == 0) {
         sparse_array[sparse_index] = HANDLE_FLAG_MASK_PACKED | (handle_index << HANDLE_INDEX_SHIFT) | (generation << HANDLE_GENER_SHIFT);
         handle_array[handle_index] = bits;
+        index->ActiveCount = handle_index + 1;
        *o_record_index = handle_index;
+        if (table->Journal != NULL) {
+            TableJournalAppend(table->Journal, TABLE_JOURNAL_RECORD_TYPE_INSERT_ID, &bits, 1);
+        }
         return 0;
     }
     return -1;
 }
 
+PIL_API(int)
+TableKeyIndexInsert
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    struct TABLE_DESC          *table, 
+    HANDLE_BITS                  bits
+)
+{
+    uint32_t dense_index;
+    if (TableResolve(&dense_index, table, bits) == 0) {
+        return -1;
+    }
+    return InsertTableKey(key_index, ReadTableItemKey(key_index, table, dense_index), bits);
+}
+
+PIL_API(HANDLE_BITS)
+TableKeyIndexLookup
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    uint64_t                      key
+)
+{
+    TABLE_KEY_INDEX_SLOT *slots = key_index->SlotArray;
+    uint32_t               mask = key_index->SlotCount - 1;
+    uint32_t                  i = TableKeyIndex_HashKey(key) & mask;
+    while (slots[i].Handle != HANDLE_BITS_INVALID) {
+        if (slots[i].Key == key) {
+            return slots[i].Handle;
+        } i = (i + 1) & mask;
+    }
+    return HANDLE_BITS_INVALID;
+}
+
+PIL_API(void)
+TableKeyIndexClear
+(
+    struct TABLE_KEY_INDEX *key_index
+)
+{
+    if (key_index->ItemCount > 0) {
+        memset(key_index->SlotArray, 0, key_index->SlotCount * sizeof(TABLE_KEY_INDEX_SLOT));
+        key_index->ItemCount = 0;
+    }
+}
+
+PIL_API(HANDLE_BITS)
+TableCreateKeyedId
+(
+    uint32_t *o_record_index, 
+    struct TABLE_DESC *table, 
+    uint64_t             key
+)
+{
+    TABLE_KEY_INDEX *key_index = table->KeyIndex;
+    TABLE_DATA         *stream;
+    uint8_t               *dst;
+    uint32_t               k32;
+    uint32_t       dense_index;
+    HANDLE_BITS           bits;
+
+    if (key_index == NULL) {
+        assert(key_index != NULL);
+        return HANDLE_BITS_INVALID;
+    }
+    /* validate against every linked index before the item is created */
+    for (key_index = table->KeyIndex; key_index != NULL; key_index = key_index->Next) {
+        if (key_index->KeySize == sizeof(uint32_t) && key > UINT32_MAX) {
+            return HANDLE_BITS_INVALID;
+        }
+        if (key_index->ItemCount + 1 >= key_index->SlotCount) {
+            assert(key_index->ItemCount + 1 < key_index->SlotCount);
+            return HANDLE_BITS_INVALID;
+        }
+        if (TableKeyIndexLookup(key_index, key) != HANDLE_BITS_INVALID) {
+            return HANDLE_BITS_INVALID;
+        }
+    }
+    /* the item is journaled as a single CREATE_KEYED record carrying the key, so that replay rebuilds the key columns and indices */
+    if ((bits = CreateTableItemId(&dense_index, table)) == HANDLE_BITS_INVALID) {
+        return HANDLE_BITS_INVALID;
+    }
+    for (key_index = table->KeyIndex; key_index != NULL; key_index = key_index->Next) {
+        stream = table->Streams[key_index->StreamIndex];
+        dst    = TableData_GetElementPointer(uint8_t, stream, dense_index) + key_index->KeyOffset;
+        if (key_index->KeySize == sizeof(uint64_t)) {
+            memcpy(dst, &key, sizeof(uint64_t));
+        } else {
+            k32 = (uint32_t) key;
+            memcpy(dst, &k32, sizeof(uint32_t));
+        }
+    }
+    for (key_index = table->KeyIndex; key_index != NULL; key_index = key_index->Next) {
+        if (InsertTableKey(key_index, key, bits) != 0) {
+            /* the same index is linked more than once - DeleteTableItemId removes the pairs added so far */
+            DeleteTableItemId(table, bits);
+            return HANDLE_BITS_INVALID;
+        }
+    }
+    if (table->Journal != NULL) {
+        TableJournalAppendKeyed(table->Journal, bits, key);
+    }
+   *o_record_index = dense_index;
+    return bits;
+}
+
+PIL_API(HANDLE_BITS)
+TableResolveKey
+(
+    uint32_t            *o_record_index, 
+    struct TABLE_DESC            *table, 
+    struct TABLE_KEY_INDEX   *key_index, 
+    uint64_t                        key
+)
+{
+    HANDLE_BITS bits = TableKeyIndexLookup(key_index, key);
+    if (bits != HANDLE_BITS_INVALID && TableResolve(o_record_index, table, bits) != 0) {
+        return bits;
+    }
+    return HANDLE_BITS_INVALID;
+}
+
+PIL_API(uint8_t*)
+TableBlobAlloc
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_DESC          *table, 
+    HANDLE_BITS                  bits, 
+    uint32_t                     size
+)
+{
+    TABLE_BLOB_SPAN     *span;
+    TABLE_BLOB_HEADER *header;
+    uint64_t       total_size;
+    uint32_t      dense_index;
+
+    if (TableResolve(&dense_index, table, bits) == 0) {
+        return NULL;
+    }
+    /* free the existing blob, if any. its space is reclaimed by TableBlobHeapCompact. */
+    span = TableBlobHeap_GetSpan(blob_heap, table, dense_index);
+    FreeTableBlob(blob_heap, span, bits);
+    if (size == 0) {
+        return NULL;
+    }
+    total_size = sizeof(TABLE_BLOB_HEADER) + PIL_AlignUp((uint64_t) size, TABLE_BLOB_ALIGN);
+    if (blob_heap->HeapSize + total_size > blob_heap->ReserveSize) {
+        return NULL;
+    }
+    if (TableBlobHeapEnsure(blob_heap, (uint32_t)(blob_heap->HeapSize + total_size)) != 0) {
+        return NULL;
+    }
+    header         = (TABLE_BLOB_HEADER*)(blob_heap->HeapBase + blob_heap->HeapSize);
+    header->Handle = bits;
+    header->Size   = (uint32_t) total_size;
+    span->Offset   = blob_heap->HeapSize + sizeof(TABLE_BLOB_HEADER);
+    span->Size     = size;
+    blob_heap->HeapSize += (uint32_t) total_size;
+    return blob_heap->HeapBase + span->Offset;
+}
+
+PIL_API(void)
+TableBlobFree
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_DESC          *table, 
+    HANDLE_BITS                  bits
+)
+{
+    uint32_t dense_index;
+    if (TableResolve(&dense_index, table, bits) != 0) {
+        FreeTableBlob(blob_heap, TableBlobHeap_GetSpan(blob_heap, table, dense_index), bits);
+    }
+}
+
+PIL_API(int)
+TableBlobHeapCompact
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    struct TABLE_DESC          *table, 
+    uint32_t                max_bytes
+)
+{
+    uint8_t            *base = blob_heap->HeapBase;
+    uint32_t            read = blob_heap->CompactRead;
+    uint32_t           write = blob_heap->CompactWrite;
+    uint32_t        examined = 0;
+    TABLE_BLOB_HEADER *header;
+    uint32_t       blob_size;
+    uint32_t     dense_index;
+
+    if (read == 0 && blob_heap->FreeBytes == 0) {
+        return 1; /* nothing to reclaim */
+    }
+    /* blobs in [0, write) have been compacted, [write, read) is free space and [read, HeapSize) 
+     * has not yet been examined. blobs allocated during the pass are appended at HeapSize and 
+     * are examined before the pass completes. */
+    while (read < blob_heap->HeapSize && examined < max_bytes) {
+        header    = (TABLE_BLOB_HEADER*)(base + read);
+        blob_size = header->Size;
+        if (header->Handle == HANDLE_BITS_INVALID) {
+            blob_heap->FreeBytes -= blob_size;
+        } else {
+            if (write != read) {
+                if (TableResolve(&dense_index, table, header->Handle) != 0) {
+                    TableBlobHeap_GetSpan(blob_heap, table, dense_index)->Offset = write + sizeof(TABLE_BLOB_HEADER);
+                } else {
+                    assert(0 && "Blob owner is not live");
+                }
+                memmove(base + write, header, blob_size);
+            }
+            write += blob_size;
+        }
+        read     += blob_size;
+        examined += blob_size;
+    }
+    if (read >= blob_heap->HeapSize) {
+        blob_heap->HeapSize     = write;
+        blob_heap->CompactRead  = 0;
+        blob_heap->CompactWrite = 0;
+        return 1;
+    } else {
+        blob_heap->CompactRead  = read;
+        blob_heap->CompactWrite = write;
+        return 0;
+    }
+}
+
+PIL_API(void)
+TableBlobHeapClear
+(
+    struct TABLE_BLOB_HEAP *blob_heap
+)
+{
+    blob_heap->HeapSize     = 0;
+    blob_heap->FreeBytes    = 0;
+    blob_heap->CompactRead  = 0;
+    blob_heap->CompactWrite = 0;
+}
+
 PIL_API(HANDLE_BITS)
 MakeHandleBits
 (
@@ -0,0 +1,510 @@
+/**
+ * @summary table_delta.cc: Implement delta encoding and application for data
+ * table replication. Sections are run-length coded in dense order, so the cost
+ * of a delta is proportional to the number of changed items rather than the
+ * size of the table.
+ */
+#include <string.h>
+#include "memmgr.h"
+#include "table_delta.h"
+
+/* @summary Define the data used to track the position within an encoded delta.
+ */
+typedef struct TABLE_DELTA_CURSOR {
+    uint8_t                       *Pos;                                        /* The current read or write position. */
+    uint8_t                       *End;                                        /* One past the last byte of the buffer. */
+} TABLE_DELTA_CURSOR;
+
+/* @summary Define the scratch data used to check the handle section of a delta before the replica is modified.
+ */
+typedef struct TABLE_DELTA_HANDLE_CHECK {
+    struct TABLE_INDEX            *Index;                                      /* The index of the replica table. */
+    uint64_t                      *SparseMarks;                                /* One bit per sparse index, set for each handle stored by the delta. */
+    uint64_t                      *SlotMarks;                                  /* One bit per dense slot, set for each slot whose handle is changed by the delta. */
+    uint32_t                       ChangeCount;                                /* The number of handles changed by the delta. */
+    uint32_t                       SparseEnd;                                  /* One past the largest sparse index of a handle changed by the delta, or zero. */
+} TABLE_DELTA_HANDLE_CHECK;
+
+/* @summary Write an unsigned 32-bit value to a delta buffer using a LEB128 variable-length encoding.
+ * @param cursor The TABLE_DELTA_CURSOR to update. The caller ensures at least TABLE_DELTA_MAX_VARINT_SIZE bytes are available.
+ * @param value The value to write.
+ */
+static PIL_INLINE void
+TableDeltaPutVarint
+(
+    struct TABLE_DELTA_CURSOR *cursor,
+    uint32_t                    value
+)
+{
+    while (value >= 0x80) {
+       *cursor->Pos++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+   *cursor->Pos++ = (uint8_t) value;
+}
+
+/* @summary Read an unsigned 32-bit value stored using a LEB128 variable-length encoding from a delta buffer.
+ * @param o_value On return, set to the decoded value.
+ * @param cursor The TABLE_DELTA_CURSOR to update.
+ * @return Zero if the value was read, or non-zero if the buffer is truncated or the value is malformed.
+ */
+static PIL_INLINE int
+TableDeltaGetVarint
+(
+    uint32_t                  *o_value,
+    struct TABLE_DELTA_CURSOR *cursor
+)
+{
+    uint32_t value = 0;
+    uint32_t shift = 0;
+    uint8_t   byte;
+    do {
+        if (cursor->Pos == cursor->End || shift > 28) {
+            return -1;
+        }
+        byte   = *cursor->Pos++;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+   *o_value = value;
+    return 0;
+}
+
+/* @summary Mark the sparse index entry of an item removed from the replica as dead, advancing its generation the way TableDeleteId does.
+ * @param sparse_array The sparse index of the replica.
+ * @param bits The handle of the removed item.
+ */
+static PIL_INLINE void
+TableDeltaInvalidateHandle
+(
+    uint32_t *sparse_array,
+    HANDLE_BITS      bits
+)
+{
+    uint32_t sparse_index = (bits & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+    uint32_t   generation = (bits & HANDLE_GENER_MASK_PACKED) >> HANDLE_GENER_SHIFT;
+    sparse_array[sparse_index] = ((generation + 1) & HANDLE_GENER_MASK) << HANDLE_GENER_SHIFT;
+}
+
+/* @summary Append a free list entry for a sparse index to the handle array of the replica, unless the sparse index is used by a live item.
+ * @param handle_array The handle array of the replica.
+ * @param io_free_slot On input, the dense slot at which to write the free list entry. On output, advanced past any entry written.
+ * @param sparse_array The sparse index of the replica.
+ * @param sparse_index The sparse index to return to the free list.
+ */
+static PIL_INLINE void
+TableDeltaPushFree
+(
+    uint32_t *handle_array,
+    uint32_t *io_free_slot,
+    uint32_t *sparse_array,
+    uint32_t  sparse_index
+)
+{
+    uint32_t sparse_value = sparse_array[sparse_index];
+    if ((sparse_value & HANDLE_FLAG_MASK_PACKED) == 0) {
+        handle_array[(*io_free_slot)++] = (sparse_index << HANDLE_INDEX_SHIFT) | (sparse_value & HANDLE_GENER_MASK_PACKED);
+    }
+}
+
+/* @summary Define the section index used to refer to the handle section of a delta.
+ */
+#ifndef TABLE_DELTA_HANDLE_SECTION
+#define TABLE_DELTA_HANDLE_SECTION    0xFFFFFFFFUL
+#endif
+
+/* @summary Determine whether the record at a given dense index differs between the source and shadow tables.
+ * @param source The source table.
+ * @param shadow The shadow table.
+ * @param stream_index The zero-based index of the data stream to compare, or TABLE_DELTA_HANDLE_SECTION to compare the handles.
+ * @param dense_index The dense index of the record to compare.
+ * @return Non-zero if the record has changed.
+ */
+static PIL_INLINE int
+TableDeltaIsChanged
+(
+    struct TABLE_DESC *source,
+    struct TABLE_DESC *shadow,
+    uint32_t    stream_index,
+    uint32_t     dense_index
+)
+{
+    uint32_t size;
+    if (dense_index >= shadow->Index->ActiveCount) {
+        return 1;
+    }
+    if (stream_index == TABLE_DELTA_HANDLE_SECTION) {
+        return source->Index->HandleArray[dense_index] != shadow->Index->HandleArray[dense_index];
+    }
+    /* a record in a slot whose handle changed belongs to a different item */
+    if (source->Index->HandleArray[dense_index] != shadow->Index->HandleArray[dense_index]) {
+        return 1;
+    }
+    size = source->Streams[stream_index]->ElementSize;
+    return memcmp(Table_GetStreamElement(uint8_t, source, stream_index, dense_index), Table_GetStreamElement(uint8_t, shadow, stream_index, dense_index), size) != 0;
+}
+
+/* @summary Encode one section of a delta as a sequence of runs of unchanged and changed dense slots.
+ * @param cursor The TABLE_DELTA_CURSOR to update.
+ * @param source The source table.
+ * @param shadow The shadow table.
+ * @param stream_index The zero-based index of the data stream to encode, or TABLE_DELTA_HANDLE_SECTION to encode the handles.
+ * @return The number of changed slots, or 0xFFFFFFFF if the buffer is too small.
+ */
+static uint32_t
+TableDeltaEncodeSection
+(
+    struct TABLE_DELTA_CURSOR *cursor,
+    struct TABLE_DESC         *source,
+    struct TABLE_DESC         *shadow,
+    uint32_t             stream_index
+)
+{
+    uint32_t         count = source->Index->ActiveCount;
+    uint32_t  element_size = stream_index == TABLE_DELTA_HANDLE_SECTION ? sizeof(HANDLE_BITS) : source->Streams[stream_index]->ElementSize;
+    uint8_t   const   *src = stream_index == TABLE_DELTA_HANDLE_SECTION ? (uint8_t const*) source->Index->HandleArray : (uint8_t const*) source->Streams[stream_index]->StorageBuffer;
+    uint32_t       changes = 0;
+    uint32_t     run_begin;
+    uint32_t         first;
+    uint32_t          skip;
+    uint32_t          copy;
+    uint32_t             i = 0;
+
+    while (i < count) {
+        run_begin = i;
+        while (i < count && !TableDeltaIsChanged(source, shadow, stream_index, i)) {
+            i++;
+        }
+        first = i;
+        while (i < count &&  TableDeltaIsChanged(source, shadow, stream_index, i)) {
+            i++;
+        }
+        skip = first - run_begin;
+        copy = i - first;
+        if ((size_t)(cursor->End - cursor->Pos) < (2 * TABLE_DELTA_MAX_VARINT_SIZE) + ((size_t) copy * element_size)) {
+            return 0xFFFFFFFFUL;
+        }
+        TableDeltaPutVarint(cursor, skip);
+        TableDeltaPutVarint(cursor, copy);
+        memcpy(cursor->Pos, src + ((size_t) first * element_size), (size_t) copy * element_size);
+        cursor->Pos += (size_t) copy * element_size;
+        changes += copy;
+    }
+    return changes;
+}
+
+/* @summary Validate one section of an encoded delta without applying it.
+ * For the handle section, each changed handle must refer to a sparse index within the table capacity, no two changed handles may share a sparse index, and no changed handle may refer to an item that remains in an unchanged slot.
+ * The sparse index pages of the changed handles are committed, which does not modify the contents of the replica.
+ * @param cursor The TABLE_DELTA_CURSOR to update. On return, the cursor points to the start of the next section.
+ * @param item_count The number of dense slots covered by the section.
+ * @param base_count The number of items in the table the delta applies to. Unchanged slots must be less than this value.
+ * @param element_size The size of each changed handle or record, in bytes.
+ * @param check The scratch data used to check the handle section, with all marks clear, or NULL for a data stream section.
+ * @return Zero if the section is valid, or non-zero if it is malformed.
+ */
+static int
+TableDeltaValidateSection
+(
+    struct TABLE_DELTA_CURSOR       *cursor,
+    uint32_t                     item_count,
+    uint32_t                     base_count,
+    uint32_t                   element_size,
+    struct TABLE_DELTA_HANDLE_CHECK  *check
+)
+{
+    TABLE_DELTA_CURSOR start = *cursor;
+    HANDLE_BITS         bits;
+    uint32_t    sparse_index;
+    uint32_t           entry;
+    uint32_t           owner;
+    uint32_t            slot;
+    uint32_t            skip;
+    uint32_t            copy;
+    uint32_t               i;
+
+    for (slot = 0; slot < item_count; slot += copy) {
+        if (TableDeltaGetVarint(&skip, cursor) != 0 || TableDeltaGetVarint(&copy, cursor) != 0) {
+            return -1;
+        }
+        if (skip > item_count - slot || copy > item_count - slot - skip || (skip > 0 && slot + skip > base_count)) {
+            return -1;
+        }
+        if ((size_t)(cursor->End - cursor->Pos) / element_size < copy) {
+            return -1;
+        }
+        slot += skip;
+        if (check != NULL) {
+            for (i = 0; i < copy; ++i) {
+                memcpy(&bits, cursor->Pos + (i * sizeof(HANDLE_BITS)), sizeof(HANDLE_BITS));
+                sparse_index = (bits & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+                if (sparse_index >= check->Index->TableCapacity) {
+                    return -1;
+                }
+                if (check->SparseMarks[sparse_index >> 6] & (1ULL << (sparse_index & 63))) {
+                    return -1;
+                }
+                if (TableCommitSparseIndex(check->Index, sparse_index, sparse_index + 1) != 0) {
+                    return -1;
+                }
+                check->SparseMarks[sparse_index >> 6] |= (1ULL << (sparse_index & 63));
+                check->SlotMarks[(slot + i) >> 6]     |= (1ULL << ((slot + i) & 63));
+                if (check->SparseEnd <= sparse_index) {
+                    check->SparseEnd  = sparse_index + 1;
+                }
+            }
+            check->ChangeCount += copy;
+        }
+        cursor->Pos += (size_t) copy * element_size;
+    }
+    if (check != NULL) {
+        /* once every changed slot is known, ensure no changed handle refers 
+         * to an item that keeps its handle in an unchanged slot */
+        for (slot = 0; slot < item_count; slot += copy) {
+            if (TableDeltaGetVarint(&skip, &start) != 0 || TableDeltaGetVarint(&copy, &start) != 0) {
+                return -1;
+            }
+            for (i = 0, slot += skip; i < copy; ++i, start.Pos += sizeof(HANDLE_BITS)) {
+                memcpy(&bits, start.Pos, sizeof(HANDLE_BITS));
+                sparse_index = (bits & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+                entry = check->Index->SparseIndex[sparse_index];
+                owner = (entry & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+                if ((entry & HANDLE_FLAG_MASK_PACKED) != 0 && owner != slot + i && owner < item_count && (check->SlotMarks[owner >> 6] & (1ULL << (owner & 63))) == 0) {
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+PIL_API(size_t)
+TableDeltaGetMaxSize
+(
+    struct TABLE_DESC *table
+)
+{
+    size_t   count = table->Index->ActiveCount;
+    size_t    size = sizeof(TABLE_DELTA_HEADER) + (table->StreamCount * sizeof(uint32_t));
+    uint32_t     i;
+    /* in the worst case every slot is a run of one unchanged and one changed slot */
+    size += count * ((2 * TABLE_DELTA_MAX_VARINT_SIZE) + sizeof(HANDLE_BITS));
+    for (i = 0; i < table->StreamCount; ++i) {
+        size += count * ((2 * TABLE_DELTA_MAX_VARINT_SIZE) + table->Streams[i]->ElementSize);
+    }
+    return size;
+}
+
+PIL_API(size_t)
+TableDeltaEncode
+(
+    void           *o_buffer,
+    size_t       buffer_size,
+    struct TABLE_DESC *source,
+    struct TABLE_DESC *shadow,
+    uint64_t      base_epoch,
+    uint64_t           epoch
+)
+{
+    TABLE_DELTA_HEADER header;
+    TABLE_DELTA_CURSOR cursor;
+    uint32_t          changes;
+    uint32_t             size;
+    uint32_t             i, n;
+
+    if (source->StreamCount != shadow->StreamCount) {
+        assert(source->StreamCount == shadow->StreamCount);
+        return 0;
+    }
+    for (i = 0, n = source->StreamCount; i < n; ++i) {
+        if (source->Streams[i]->ElementSize != shadow->Streams[i]->ElementSize) {
+            assert(source->Streams[i]->ElementSize == shadow->Streams[i]->ElementSize);
+            return 0;
+        }
+    }
+    if (buffer_size < sizeof(TABLE_DELTA_HEADER) + (source->StreamCount * sizeof(uint32_t))) {
+        return 0;
+    }
+    cursor.Pos = (uint8_t*) o_buffer + sizeof(TABLE_DELTA_HEADER);
+    cursor.End = (uint8_t*) o_buffer + buffer_size;
+    for (i = 0, n = source->StreamCount; i < n; ++i) {
+        size = source->Streams[i]->ElementSize;
+        memcpy(cursor.Pos, &size, sizeof(uint32_t));
+        cursor.Pos += sizeof(uint32_t);
+    }
+    if ((changes = TableDeltaEncodeSection(&cursor, source, shadow, TABLE_DELTA_HANDLE_SECTION)) == 0xFFFFFFFFUL) {
+        return 0;
+    }
+    header.ChangeCount = changes;
+    for (i = 0, n = source->StreamCount; i < n; ++i) {
+        if ((changes = TableDeltaEncodeSection(&cursor, source, shadow, i)) == 0xFFFFFFFFUL) {
+            return 0;
+        }
+        header.ChangeCount += changes;
+    }
+    header.Magic         = TABLE_DELTA_MAGIC;
+    header.StreamCount   = source->StreamCount;
+    header.BaseEpoch     = base_epoch;
+    header.Epoch         = epoch;
+    header.ItemCount     = source->Index->ActiveCount;
+    header.BaseItemCount = shadow->Index->ActiveCount;
+    header.DataSize      = (uint32_t)(cursor.Pos - (uint8_t*) o_buffer);
+    memcpy(o_buffer, &header, sizeof(TABLE_DELTA_HEADER));
+    return header.DataSize;
+}
+
+PIL_API(int)
+TableDeltaApply
+(
+    struct TABLE_DESC *replica,
+    uint64_t         *io_epoch,
+    void const          *delta,
+    size_t          delta_size
+)
+{
+    TABLE_INDEX       *index = replica->Index;
+    uint32_t   *sparse_array = index->SparseIndex;
+    uint32_t   *handle_array = index->HandleArray;
+    TABLE_DELTA_HEADER header;
+    TABLE_DELTA_CURSOR cursor;
+    TABLE_DELTA_CURSOR handles;
+    TABLE_DELTA_HANDLE_CHECK check;
+    HANDLE_BITS         bits;
+    uint32_t      *released;
+    uint32_t    element_size;
+    uint32_t      mark_words;
+    uint32_t      high_water;
+    uint32_t       free_slot;
+    uint32_t    sparse_index;
+    uint32_t  released_count = 0;
+    uint32_t        skip = 0;
+    uint32_t        copy = 0;
+    uint32_t            slot;
+    uint32_t            i, s;
+
+    if (delta_size < sizeof(TABLE_DELTA_HEADER)) {
+        return -1;
+    }
+    memcpy(&header, delta, sizeof(TABLE_DELTA_HEADER));
+    if (header.Magic != TABLE_DELTA_MAGIC || header.DataSize > delta_size || header.DataSize < sizeof(TABLE_DELTA_HEADER)) {
+        return -1;
+    }
+    if (header.BaseEpoch != *io_epoch || header.BaseItemCount != index->ActiveCount) {
+        return -1;
+    }
+    if (header.StreamCount != replica->StreamCount || header.ItemCount > index->TableCapacity) {
+        return -1;
+    }
+    cursor.Pos = (uint8_t*) delta + sizeof(TABLE_DELTA_HEADER);
+    cursor.End = (uint8_t*) delta + header.DataSize;
+    if ((size_t)(cursor.End - cursor.Pos) < header.StreamCount * sizeof(uint32_t)) {
+        return -1;
+    }
+    for (s = 0; s < header.StreamCount; ++s) {
+        memcpy(&element_size, cursor.Pos, sizeof(uint32_t));
+        cursor.Pos += sizeof(uint32_t);
+        if (element_size != replica->Streams[s]->ElementSize) {
+            return -1;
+        }
+    }
+
+    /* validate every section before the replica is modified. the sparse 
+     * index pages referenced by the delta are committed during validation, 
+     * which leaves the contents of the replica unchanged. */
+    mark_words        = (index->TableCapacity + 63) / 64;
+    check.Index       = index;
+    if ((check.SparseMarks = HostMemoryAllocateHeapArray(uint64_t, 2 * (size_t) mark_words)) == NULL) {
+        return -1;
+    }
+    check.SlotMarks   = check.SparseMarks + mark_words;
+    check.ChangeCount = 0;
+    check.SparseEnd   = 0;
+    memset(check.SparseMarks, 0, 2 * (size_t) mark_words * sizeof(uint64_t));
+    handles = cursor;
+    if (TableDeltaValidateSection(&cursor, header.ItemCount, header.BaseItemCount, sizeof(HANDLE_BITS), &check) != 0) {
+        HostMemoryFreeHeap(check.SparseMarks);
+        return -1;
+    }
+    HostMemoryFreeHeap(check.SparseMarks);
+    for (s = 0; s < header.StreamCount; ++s) {
+        if (TableDeltaValidateSection(&cursor, header.ItemCount, header.BaseItemCount, replica->Streams[s]->ElementSize, NULL) != 0) {
+            return -1;
+        }
+    }
+    /* TableCreateId issues sparse index HighWatermark to a new item, so the 
+     * high watermark must cover every sparse index stored by the delta */
+    high_water = index->HighWatermark > header.ItemCount ? index->HighWatermark : header.ItemCount;
+    high_water = high_water > check.SparseEnd ? high_water : check.SparseEnd;
+    if (TableEnsure(replica, high_water, TABLE_CHUNK_SIZE) != 0) {
+        return -1;
+    }
+    if ((released = HostMemoryAllocateHeapArray(uint32_t, (size_t) check.ChangeCount + 1)) == NULL) {
+        return -1;
+    }
+
+    /* the first pass over the handle section invalidates the sparse index 
+     * entries of the items leaving each changed slot, saves the replaced 
+     * handles and free list entries, and stores the new handles. the entries 
+     * of items that moved to another slot are then restored by the second 
+     * pass. the sections were validated above, so the runs are not checked 
+     * again. */
+    cursor = handles;
+    for (slot = 0; slot < header.ItemCount; slot += copy) {
+        TableDeltaGetVarint(&skip, &cursor);
+        TableDeltaGetVarint(&copy, &cursor);
+        for (i = 0, slot += skip; i < copy; ++i, cursor.Pos += sizeof(HANDLE_BITS)) {
+            memcpy(&bits, cursor.Pos, sizeof(HANDLE_BITS));
+            if (slot + i < header.BaseItemCount) {
+                TableDeltaInvalidateHandle(sparse_array, handle_array[slot + i]);
+            }
+            if (slot + i < index->HighWatermark) {
+                released[released_count++] = handle_array[slot + i];
+            }
+            handle_array[slot + i] = bits;
+        }
+    }
+    for (slot = header.ItemCount; slot < header.BaseItemCount; ++slot) {
+        TableDeltaInvalidateHandle(sparse_array, handle_array[slot]);
+    }
+    for (slot = 0; slot < header.ItemCount; slot += copy) {
+        TableDeltaGetVarint(&skip, &handles);
+        TableDeltaGetVarint(&copy, &handles);
+        for (i = 0, slot += skip; i < copy; ++i, handles.Pos += sizeof(HANDLE_BITS)) {
+            bits = handle_array[slot + i];
+            sparse_array[(bits & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT] = HANDLE_FLAG_MASK_PACKED | ((slot + i) << HANDLE_INDEX_SHIFT) | (bits & HANDLE_GENER_MASK_PACKED);
+        }
+    }
+    /* rebuild the free list in [ItemCount, high_water) the way TableDeleteId 
+     * leaves it, with one dead entry for each sparse index not used by a live 
+     * item. the candidates are the existing entries at or above ItemCount, 
+     * the handles and entries replaced by the first pass, and the sparse 
+     * indices newly covered by the high watermark. */
+    free_slot = header.ItemCount;
+    for (slot = header.ItemCount; slot < index->HighWatermark; ++slot) {
+        TableDeltaPushFree(handle_array, &free_slot, sparse_array, (handle_array[slot] & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT);
+    }
+    for (i = 0; i < released_count; ++i) {
+        TableDeltaPushFree(handle_array, &free_slot, sparse_array, (released[i] & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT);
+    }
+    for (sparse_index = index->HighWatermark; sparse_index < high_water; ++sparse_index) {
+        TableDeltaPushFree(handle_array, &free_slot, sparse_array, sparse_index);
+    }
+    HostMemoryFreeHeap(released);
+    assert(free_slot == high_water);
+    index->ActiveCount   = header.ItemCount;
+    index->HighWatermark = high_water;
+
+    /* copy the changed records for each data stream */
+    for (s = 0; s < header.StreamCount; ++s) {
+        element_size = replica->Streams[s]->ElementSize;
+        for (slot = 0; slot < header.ItemCount; slot += copy) {
+            TableDeltaGetVarint(&skip, &cursor);
+            TableDeltaGetVarint(&copy, &cursor);
+            slot += skip;
+            memcpy(Table_GetStreamElement(uint8_t, replica, s, slot), cursor.Pos, (size_t) copy * element_size);
+            cursor.Pos += (size_t) copy * element_size;
+        }
+    }
+   *io_epoch = header.Epoch;
+    return 0;
+}
@@ -0,0 +1,491 @@
+/**
+ * @summary table_journal.cc: Implement the write-ahead journal for data tables.
+ * Records are stored in host byte order, since a journal is only replayed by
+ * the process image that produced the base snapshot it applies to.
+ */
+#include <string.h>
+#include "memmgr.h"
+#include "table_journal.h"
+
+/* @summary Calculate the checksum of the record data in a journal group.
+ * @param sequence The sequence number of the group, used to seed the checksum.
+ * @param data The record data.
+ * @param size The number of bytes of record data.
+ * @return The 32-bit FNV-1a hash of the record data.
+ */
+static uint32_t
+TableJournalChecksum
+(
+    uint32_t   sequence,
+    uint8_t const *data,
+    uint32_t       size
+)
+{
+    uint32_t hash = 2166136261UL ^ sequence;
+    uint32_t    i;
+    for (i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+/* @summary Portably read a 32-bit value from a memory location which may or may not be properly aligned.
+ * @param mem The memory location to read.
+ * @return The 32-bit value at address mem.
+ */
+static PIL_INLINE uint32_t
+TableJournalReadU32
+(
+    uint8_t const *mem
+)
+{
+    uint32_t val;
+    memcpy(&val, mem, sizeof(val));
+    return val;
+}
+
+/* @summary Reserve space for a record in the group buffer of a table journal.
+ * If the buffer is full, the pending records are committed. If a single record is larger than the buffer, the buffer is grown.
+ * @param journal The TABLE_JOURNAL to update.
+ * @param size The size of the record, in bytes.
+ * @return A pointer to the start of the record, or NULL if the journal has encountered an error.
+ */
+static uint8_t*
+TableJournalReserve
+(
+    struct TABLE_JOURNAL *journal,
+    uint32_t                 size
+)
+{
+    uint8_t       *record;
+    uint8_t   *new_buffer;
+    uint32_t new_capacity;
+
+    if (journal->ErrorCode != 0) {
+        return NULL;
+    }
+    if (journal->BufferSize + size > journal->BufferCapacity) {
+        if (journal->RecordCount > 0 && TableJournalCommit(journal, 0) != 0) {
+            return NULL;
+        }
+        if (sizeof(TABLE_JOURNAL_GROUP_HEADER) + size > journal->BufferCapacity) {
+            /* the buffer is empty, so there is nothing to preserve */
+            new_capacity = (uint32_t) PIL_AlignUp(sizeof(TABLE_JOURNAL_GROUP_HEADER) + size, TABLE_JOURNAL_MIN_BUFFER_SIZE);
+            if ((new_buffer = (uint8_t*) HostMemoryAllocateHeap(NULL, new_capacity, PIL_ALIGN_OF(TABLE_JOURNAL_GROUP_HEADER))) == NULL) {
+                journal->ErrorCode = -1;
+                return NULL;
+            }
+            HostMemoryFreeHeap(journal->Buffer);
+            journal->Buffer         = new_buffer;
+            journal->BufferCapacity = new_capacity;
+        }
+    }
+    record = journal->Buffer + journal->BufferSize;
+    journal->BufferSize += size;
+    journal->RecordCount++;
+    return record;
+}
+
+/* @summary Apply a single journal record to a table.
+ * @param o_record_size On return, set to the size of the record, in bytes.
+ * @param table The table to update.
+ * @param record The start of the record.
+ * @param size The number of bytes of record data remaining in the group.
+ * @return Zero if the record was applied, or non-zero if the record is malformed or cannot be applied.
+ */
+static int
+TableJournalApply
+(
+    uint32_t *o_record_size,
+    struct TABLE_DESC *table,
+    uint8_t const     *record,
+    uint32_t             size
+)
+{
+    HANDLE_BITS      bits;
+    HANDLE_BITS  *handles;
+    uint8_t      *element;
+    uint64_t          key;
+    uint32_t  dense_index;
+    uint32_t stream_index;
+    uint32_t  write_count;
+    uint32_t  write_offset;
+    uint32_t        count;
+    uint32_t            i;
+
+    switch (record[0]) {
+        case TABLE_JOURNAL_RECORD_TYPE_CREATE_ID:
+            {
+                if (size < 5) {
+                    return -1;
+                }
+                if (TableEnsure(table, table->Index->ActiveCount + 1, TABLE_CHUNK_SIZE) != 0) {
+                    return -1;
+                }
+               *o_record_size = 5;
+                bits = TableJournalReadU32(record + 1);
+                /* the base snapshot includes the table index, so the handle is re-issued */
+                return TableCreateId(&dense_index, table) == bits ? 0 : -1;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_CREATE_KEYED:
+            {
+                if (size < 13) {
+                    return -1;
+                }
+                if (TableEnsure(table, table->Index->ActiveCount + 1, TABLE_CHUNK_SIZE) != 0) {
+                    return -1;
+                }
+               *o_record_size = 13;
+                bits = TableJournalReadU32(record + 1);
+                memcpy(&key, record + 5, sizeof(uint64_t));
+                /* the key columns are written and every linked key index is updated */
+                return TableCreateKeyedId(&dense_index, table, key) == bits ? 0 : -1;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_INSERT_ID:
+            {
+                if (size < 5) {
+                    return -1;
+                }
+                if (TableEnsure(table, table->Index->ActiveCount + 1, TABLE_CHUNK_SIZE) != 0) {
+                    return -1;
+                }
+               *o_record_size = 5;
+                bits = TableJournalReadU32(record + 1);
+                return TableInsertId(&dense_index, table, bits);
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_REMOVE_ID:
+            {
+                if (size < 5) {
+                    return -1;
+                }
+               *o_record_size = 5;
+                bits = TableJournalReadU32(record + 1);
+                if (TableResolve(&dense_index, table, bits) == 0) {
+                    return -1;
+                }
+                TableRemoveId(table, bits);
+                return 0;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_REMOVE_ALL:
+            {
+               *o_record_size = 1;
+                TableRemoveAllIds(table);
+                return 0;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_DELETE_ID:
+            {
+                if (size < 5) {
+                    return -1;
+                }
+               *o_record_size = 5;
+                bits = TableJournalReadU32(record + 1);
+                if (TableResolve(&dense_index, table, bits) == 0) {
+                    return -1;
+                }
+                TableDeleteId(table, bits);
+                return 0;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_DELETE_IDS:
+            {
+                if (size < 5) {
+                    return -1;
+                }
+                count = TableJournalReadU32(record + 1);
+                if (count > table->Index->ActiveCount || (size - 5) / sizeof(HANDLE_BITS) < count) {
+                    return -1;
+                }
+               *o_record_size = 5 + (count * sizeof(HANDLE_BITS));
+                if ((handles = HostMemoryAllocateHeapArray(HANDLE_BITS, count)) == NULL) {
+                    return -1;
+                }
+                for (i = 0; i < count; ++i) {
+                    handles[i] = TableJournalReadU32(record + 5 + (i * sizeof(HANDLE_BITS)));
+                    if (TableResolve(&dense_index, table, handles[i]) == 0) {
+                        HostMemoryFreeHeap(handles);
+                        return -1;
+                    }
+                }
+                TableDeleteIds(table, handles, count);
+                HostMemoryFreeHeap(handles);
+                return 0;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_DELETE_ALL:
+            {
+               *o_record_size = 1;
+                TableDeleteAllIds(table);
+                return 0;
+            }
+        case TABLE_JOURNAL_RECORD_TYPE_WRITE:
+            {
+                if (size < 12) {
+                    return -1;
+                }
+                stream_index = record[1];
+                write_count  = record[2] | ((uint32_t) record[3] << 8);
+                bits         = TableJournalReadU32(record + 4);
+                write_offset = TableJournalReadU32(record + 8);
+                if (size - 12 < write_count || stream_index >= table->StreamCount) {
+                    return -1;
+                }
+                if (write_offset > table->Streams[stream_index]->ElementSize || write_count > table->Streams[stream_index]->ElementSize - write_offset) {
+                    return -1;
+                }
+                if (TableResolve(&dense_index, table, bits) == 0) {
+                    return -1;
+                }
+               *o_record_size = 12 + write_count;
+                element = Table_GetStreamElement(uint8_t, table, stream_index, dense_index);
+                memcpy(element + write_offset, record + 12, write_count);
+                return 0;
+            }
+        default:
+            return -1;
+    }
+}
+
+PIL_API(int)
+TableJournalCreate
+(
+    struct TABLE_JOURNAL_INIT *init
+)
+{
+    TABLE_JOURNAL *journal = init->Journal;
+    uint32_t      capacity = init->BufferSize;
+
+    if (init->Journal == NULL) {
+        assert(init->Journal != NULL);
+        return -1;
+    }
+    if (capacity < TABLE_JOURNAL_MIN_BUFFER_SIZE) {
+        capacity = TABLE_JOURNAL_MIN_BUFFER_SIZE;
+    }
+    if ((journal->Buffer = (uint8_t*) HostMemoryAllocateHeap(NULL, capacity, PIL_ALIGN_OF(TABLE_JOURNAL_GROUP_HEADER))) == NULL) {
+        return -1;
+    }
+    journal->File           = init->File;
+    journal->BufferSize     = sizeof(TABLE_JOURNAL_GROUP_HEADER);
+    journal->BufferCapacity = capacity;
+    journal->RecordCount    = 0;
+    journal->Sequence       = 0;
+    journal->SyncInterval   = init->SyncInterval;
+    journal->UnsyncedGroups = 0;
+    journal->FileOffset     = 0;
+    journal->ErrorCode      = 0;
+    return 0;
+}
+
+PIL_API(void)
+TableJournalDelete
+(
+    struct TABLE_JOURNAL *journal
+)
+{
+    if (journal->Buffer != NULL) {
+        HostMemoryFreeHeap(journal->Buffer);
+        journal->Buffer         = NULL;
+        journal->BufferSize     = 0;
+        journal->BufferCapacity = 0;
+        journal->RecordCount    = 0;
+    }
+}
+
+PIL_API(int)
+TableJournalCommit
+(
+    struct TABLE_JOURNAL *journal,
+    int                      sync
+)
+{
+    TABLE_JOURNAL_GROUP_HEADER header;
+    IO_WRITE_DATA               write = {};
+    IO_WRITE_RESULT      write_result = {};
+    IO_FLUSH_DATA               flush = {};
+    IO_FLUSH_RESULT      flush_result = {};
+
+    if (journal->ErrorCode != 0) {
+        return -1;
+    }
+    if (journal->RecordCount > 0) {
+        /* the group header and records are written with a single write */
+        header.Magic       = TABLE_JOURNAL_GROUP_MAGIC;
+        header.Sequence    = journal->Sequence;
+        header.DataSize    = journal->BufferSize - sizeof(TABLE_JOURNAL_GROUP_HEADER);
+        header.Checksum    = TableJournalChecksum(journal->Sequence, journal->Buffer + sizeof(TABLE_JOURNAL_GROUP_HEADER), header.DataSize);
+        memcpy(journal->Buffer, &header, sizeof(TABLE_JOURNAL_GROUP_HEADER));
+        write.File         = journal->File;
+        write.Source       = journal->Buffer;
+        write.WriteOffset  = journal->FileOffset;
+        write.WriteAmount  = journal->BufferSize;
+        if (FileWrite(&write_result, &write) != 0 || write_result.TransferAmount != journal->BufferSize) {
+            journal->ErrorCode = -1;
+            return -1;
+        }
+        journal->FileOffset += journal->BufferSize;
+        journal->BufferSize  = sizeof(TABLE_JOURNAL_GROUP_HEADER);
+        journal->RecordCount = 0;
+        journal->Sequence++;
+        journal->UnsyncedGroups++;
+    }
+    if (journal->UnsyncedGroups > 0 && (sync || (journal->SyncInterval != 0 && journal->UnsyncedGroups >= journal->SyncInterval))) {
+        flush.File = journal->File;
+        if (FileFlush(&flush_result, &flush) != 0) {
+            journal->ErrorCode = -1;
+            return -1;
+        }
+        journal->UnsyncedGroups = 0;
+    }
+    return 0;
+}
+
+PIL_API(int)
+TableJournalWrite
+(
+    struct TABLE_DESC *table,
+    HANDLE_BITS         bits,
+    uint32_t    stream_index,
+    uint32_t    field_offset,
+    void const         *data,
+    uint32_t            size
+)
+{
+    uint8_t      *record;
+    uint8_t     *element;
+    uint32_t dense_index;
+
+    if (stream_index >= table->StreamCount || stream_index > 0xFF) {
+        assert(stream_index < table->StreamCount);
+        assert(stream_index <= 0xFF);
+        return -1;
+    }
+    if (size > TABLE_JOURNAL_MAX_WRITE_SIZE || field_offset > table->Streams[stream_index]->ElementSize || size > table->Streams[stream_index]->ElementSize - field_offset) {
+        assert(size <= TABLE_JOURNAL_MAX_WRITE_SIZE);
+        assert(field_offset + size <= table->Streams[stream_index]->ElementSize);
+        return -1;
+    }
+    if (TableResolve(&dense_index, table, bits) == 0) {
+        return -1;
+    }
+    element = Table_GetStreamElement(uint8_t, table, stream_index, dense_index);
+    memcpy(element + field_offset, data, size);
+    if (table->Journal != NULL && (record = TableJournalReserve(table->Journal, 12 + size)) != NULL) {
+        record[0] = TABLE_JOURNAL_RECORD_TYPE_WRITE;
+        record[1] = (uint8_t) (stream_index);
+        record[2] = (uint8_t) (size & 0xFF);
+        record[3] = (uint8_t) (size >> 8);
+        memcpy(record + 4 , &bits, sizeof(HANDLE_BITS));
+        memcpy(record + 8 , &field_offset, sizeof(uint32_t));
+        memcpy(record + 12, data, size);
+    }
+    return 0;
+}
+
+PIL_API(void)
+TableJournalAppend
+(
+    struct TABLE_JOURNAL *journal,
+    uint32_t          record_type,
+    HANDLE_BITS const    *handles,
+    uint32_t         handle_count
+)
+{
+    uint8_t *record;
+    switch (record_type) {
+        case TABLE_JOURNAL_RECORD_TYPE_CREATE_ID:
+        case TABLE_JOURNAL_RECORD_TYPE_DELETE_ID:
+        case TABLE_JOURNAL_RECORD_TYPE_INSERT_ID:
+        case TABLE_JOURNAL_RECORD_TYPE_REMOVE_ID:
+            {
+                assert(handle_count == 1);
+                if ((record = TableJournalReserve(journal, 1 + sizeof(HANDLE_BITS))) != NULL) {
+                    record[0] = (uint8_t) record_type;
+                    memcpy(record + 1, handles, sizeof(HANDLE_BITS));
+                }
+            } break;
+        case TABLE_JOURNAL_RECORD_TYPE_DELETE_IDS:
+            {
+                if ((record = TableJournalReserve(journal, 5 + (handle_count * sizeof(HANDLE_BITS)))) != NULL) {
+                    record[0] = (uint8_t) record_type;
+                    memcpy(record + 1, &handle_count, sizeof(uint32_t));
+                    memcpy(record + 5, handles, handle_count * sizeof(HANDLE_BITS));
+                }
+            } break;
+        case TABLE_JOURNAL_RECORD_TYPE_DELETE_ALL:
+        case TABLE_JOURNAL_RECORD_TYPE_REMOVE_ALL:
+            {
+                if ((record = TableJournalReserve(journal, 1)) != NULL) {
+                    record[0] = (uint8_t) record_type;
+                }
+            } break;
+        default:
+            {
+                assert(0 && "Unsupported TABLE_JOURNAL_RECORD_TYPE");
+            } break;
+    }
+}
+
+PIL_API(void)
+TableJournalAppendKeyed
+(
+    struct TABLE_JOURNAL *journal,
+    HANDLE_BITS              bits,
+    uint64_t                  key
+)
+{
+    uint8_t *record;
+    if ((record = TableJournalReserve(journal, 1 + sizeof(HANDLE_BITS) + sizeof(uint64_t))) != NULL) {
+        record[0] = TABLE_JOURNAL_RECORD_TYPE_CREATE_KEYED;
+        memcpy(record + 1, &bits, sizeof(HANDLE_BITS));
+        memcpy(record + 5, &key , sizeof(uint64_t));
+    }
+}
+
+PIL_API(int)
+TableJournalReplay
+(
+    uint32_t *o_bytes_used,
+    struct TABLE_DESC *table,
+    void const         *data,
+    uint32_t            size
+)
+{
+    uint8_t const     *bytes = (uint8_t const*) data;
+    uint32_t             pos = 0;
+    uint32_t        sequence = 0;
+    uint32_t     record_size = 0;
+    uint32_t          offset;
+    TABLE_JOURNAL_GROUP_HEADER header;
+
+    if (table->Journal != NULL) {
+        assert(table->Journal == NULL);
+        return -1;
+    }
+    while (size - pos >= sizeof(TABLE_JOURNAL_GROUP_HEADER)) {
+        memcpy(&header, bytes + pos, sizeof(TABLE_JOURNAL_GROUP_HEADER));
+        if (header.Magic != TABLE_JOURNAL_GROUP_MAGIC || header.Sequence != sequence) {
+            break;
+        }
+        if (header.DataSize > size - pos - sizeof(TABLE_JOURNAL_GROUP_HEADER)) {
+            break;
+        }
+        if (header.Checksum != TableJournalChecksum(sequence, bytes + pos + sizeof(TABLE_JOURNAL_GROUP_HEADER), header.DataSize)) {
+            break;
+        }
+        /* the group is complete - apply each record in order */
+        for (offset = 0; offset < header.DataSize; offset += record_size) {
+            uint8_t const *record = bytes + pos + sizeof(TABLE_JOURNAL_GROUP_HEADER) + offset;
+            if (TableJournalApply(&record_size, table, record, header.DataSize - offset) != 0) {
+                if (o_bytes_used) {
+                   *o_bytes_used = pos;
+                }
+                return -1;
+            }
+        }
+        pos += sizeof(TABLE_JOURNAL_GROUP_HEADER) + header.DataSize;
+        sequence++;
+    }
+    if (o_bytes_used) {
+       *o_bytes_used = pos;
+    }
+    return 0;
+}
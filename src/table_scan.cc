@@ -0,0 +1,890 @@
+/**
+ * @summary table_scan.cc: Implement the table column scan, filter, join and aggregate
+ * routines. Scans and aggregates over densely-packed columns are vectorized with
+ * SSE2 on x64. Aggregates over int64 columns and histograms are vectorized with 
+ * AVX2 when it is enabled at compile time, and with NEON on ARM64. Other column 
+ * layouts and architectures use scalar loops.
+ */
+#include <math.h>
+#include <string.h>
+#include "table_scan.h"
+
+#if PIL_TARGET_ARCHITECTURE == PIL_ARCHITECTURE_X64
+#   include <emmintrin.h>
+#   define TABLE_SCAN_USE_SSE2    1
+#   define TABLE_SCAN_USE_NEON    0
+#   if defined(__AVX2__)
+#       include <immintrin.h>
+#       define TABLE_SCAN_USE_AVX2    1
+#   else
+#       define TABLE_SCAN_USE_AVX2    0
+#   endif
+#elif PIL_TARGET_ARCHITECTURE == PIL_ARCHITECTURE_ARM64
+#   include <arm_neon.h>
+#   define TABLE_SCAN_USE_SSE2    0
+#   define TABLE_SCAN_USE_AVX2    0
+#   define TABLE_SCAN_USE_NEON    1
+#else
+#   define TABLE_SCAN_USE_SSE2    0
+#   define TABLE_SCAN_USE_AVX2    0
+#   define TABLE_SCAN_USE_NEON    0
+#endif
+
+/* @summary Define the number of handles whose sparse index slots are prefetched together by TableJoin.
+ */
+#ifndef TABLE_JOIN_BATCH_SIZE
+#define TABLE_JOIN_BATCH_SIZE     16
+#endif
+
+/* @summary Hint that the cache line containing a given address will be read in the near future.
+ * @param _p The address to prefetch.
+ */
+#ifndef TableScan_Prefetch
+#   if   TABLE_SCAN_USE_SSE2
+#       define TableScan_Prefetch(_p)    _mm_prefetch((char const*)(_p), _MM_HINT_T0)
+#   elif PIL_TARGET_COMPILER == PIL_COMPILER_GNUC || PIL_TARGET_COMPILER == PIL_COMPILER_CLANG
+#       define TableScan_Prefetch(_p)    __builtin_prefetch((_p), 0, 3)
+#   else
+#       define TableScan_Prefetch(_p)    ((void)(_p))
+#   endif
+#endif
+
+/* @summary Portably read a 32-bit value from a memory location which may or may not be properly aligned.
+ * @param mem The memory location to read.
+ * @return The 32-bit value at address mem.
+ */
+static PIL_INLINE uint32_t
+TableScanReadU32
+(
+    void const *mem
+)
+{
+    uint32_t val;
+    memcpy(&val, mem, sizeof(val));
+    return val;
+}
+
+/* @summary Evaluate a predicate against a single 32-bit column value.
+ * @param predicate The predicate to evaluate.
+ * @param value The column value, reinterpreted as an unsigned 32-bit integer.
+ * @return One if the value satisfies the predicate, or zero if it does not.
+ */
+static PIL_INLINE uint32_t
+TableScanTest
+(
+    struct TABLE_SCAN_PREDICATE const *predicate,
+    uint32_t                               value
+)
+{
+    switch (predicate->Operation) {
+        case TABLE_SCAN_OPERATION_F32_RANGE:
+            {   float f;
+                memcpy(&f, &value, sizeof(float));
+                return (f >= predicate->Operand.F32.Min) & (f <= predicate->Operand.F32.Max);
+            }
+        case TABLE_SCAN_OPERATION_I32_RANGE:
+            return ((int32_t) value >= predicate->Operand.I32.Min) & ((int32_t) value <= predicate->Operand.I32.Max);
+        case TABLE_SCAN_OPERATION_U32_RANGE:
+            return (value - predicate->Operand.U32.Min) <= (predicate->Operand.U32.Max - predicate->Operand.U32.Min);
+        case TABLE_SCAN_OPERATION_U32_MASK_EQUAL:
+            return (value & predicate->Operand.Bits.Mask) == predicate->Operand.Bits.Value;
+        case TABLE_SCAN_OPERATION_U32_MASK_ANY:
+            return (value & predicate->Operand.Bits.Mask) != 0;
+        default:
+            return 0;
+    }
+}
+
+/* @summary Validate a predicate against the table it will be evaluated on.
+ * @param table Pointer to a TABLE_DESC describing the table.
+ * @param predicate The predicate to validate.
+ * @return Zero if the predicate is valid, or -1 if the predicate is not valid.
+ */
+static int
+TableScanValidatePredicate
+(
+    struct TABLE_DESC                     *table,
+    struct TABLE_SCAN_PREDICATE const *predicate
+)
+{
+    if (predicate->StreamIndex >= table->StreamCount) {
+        assert(predicate->StreamIndex < table->StreamCount);
+        return -1;
+    }
+    if (predicate->FieldOffset + sizeof(uint32_t) > table->Streams[predicate->StreamIndex]->ElementSize) {
+        assert(predicate->FieldOffset + sizeof(uint32_t) <= table->Streams[predicate->StreamIndex]->ElementSize);
+        return -1;
+    }
+    if (predicate->Operation > TABLE_SCAN_OPERATION_U32_MASK_ANY) {
+        assert(predicate->Operation <= TABLE_SCAN_OPERATION_U32_MASK_ANY);
+        return -1;
+    }
+    return 0;
+}
+
+#if TABLE_SCAN_USE_SSE2
+/* @summary Evaluate a predicate against four packed 32-bit column values.
+ * @param predicate The predicate to evaluate.
+ * @param v The four column values.
+ * @return A 4-bit mask with bit i set if lane i satisfies the predicate.
+ */
+static PIL_INLINE uint32_t
+TableScanTest4
+(
+    struct TABLE_SCAN_PREDICATE const *predicate,
+    __m128i                                    v
+)
+{
+    switch (predicate->Operation) {
+        case TABLE_SCAN_OPERATION_F32_RANGE:
+            {   __m128  f  = _mm_castsi128_ps(v);
+                __m128 lo  = _mm_cmpge_ps(f, _mm_set1_ps(predicate->Operand.F32.Min));
+                __m128 hi  = _mm_cmple_ps(f, _mm_set1_ps(predicate->Operand.F32.Max));
+                return (uint32_t) _mm_movemask_ps(_mm_and_ps(lo, hi));
+            }
+        case TABLE_SCAN_OPERATION_I32_RANGE:
+            {   __m128i lo = _mm_cmplt_epi32(v, _mm_set1_epi32(predicate->Operand.I32.Min));
+                __m128i hi = _mm_cmpgt_epi32(v, _mm_set1_epi32(predicate->Operand.I32.Max));
+                return (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(lo, hi))) ^ 0xF;
+            }
+        case TABLE_SCAN_OPERATION_U32_RANGE:
+            {   /* (v - min) <=u (max - min), using a signed compare after flipping the sign bits */
+                __m128i sign = _mm_set1_epi32((int32_t) 0x80000000UL);
+                __m128i  d   = _mm_xor_si128(_mm_sub_epi32(v, _mm_set1_epi32((int32_t) predicate->Operand.U32.Min)), sign);
+                __m128i  r   = _mm_set1_epi32((int32_t)((predicate->Operand.U32.Max - predicate->Operand.U32.Min) ^ 0x80000000UL));
+                return (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(d, r))) ^ 0xF;
+            }
+        case TABLE_SCAN_OPERATION_U32_MASK_EQUAL:
+            {   __m128i  m = _mm_and_si128(v, _mm_set1_epi32((int32_t) predicate->Operand.Bits.Mask));
+                return (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(m, _mm_set1_epi32((int32_t) predicate->Operand.Bits.Value))));
+            }
+        case TABLE_SCAN_OPERATION_U32_MASK_ANY:
+            {   __m128i  m = _mm_and_si128(v, _mm_set1_epi32((int32_t) predicate->Operand.Bits.Mask));
+                return (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(m, _mm_setzero_si128()))) ^ 0xF;
+            }
+        default:
+            return 0;
+    }
+}
+#endif
+
+PIL_API(int)
+TableScan
+(
+    struct TABLE_SELECTION             *o_selection,
+    struct TABLE_DESC                        *table,
+    struct TABLE_SCAN_PREDICATE const    *predicate
+)
+{
+    uint32_t     active_count = Table_GetCount(table);
+    uint32_t       *out_index = o_selection->Indices;
+    uint32_t        out_count = 0;
+    TABLE_DATA        *stream;
+    uint8_t const    *src_ptr;
+    uint32_t           stride;
+    uint32_t                i = 0;
+
+    if (TableScanValidatePredicate(table, predicate) != 0) {
+        return -1;
+    }
+    if (o_selection->Capacity < active_count) {
+        assert(o_selection->Capacity >= active_count);
+        return -1;
+    }
+    stream  = table->Streams[predicate->StreamIndex];
+    stride  = stream->ElementSize;
+    src_ptr =(uint8_t const*) stream->StorageBuffer + predicate->FieldOffset;
+#if TABLE_SCAN_USE_SSE2
+    if (stride == sizeof(uint32_t)) {
+        /* the column is densely packed - test four values per iteration.
+         * each index is written unconditionally and the output cursor only
+         * advances for matching lanes, which keeps the loop branch-free. */
+        for ( ; i + 4 <= active_count; i += 4) {
+            __m128i  v = _mm_loadu_si128((__m128i const*)(src_ptr + (i * sizeof(uint32_t))));
+            uint32_t m = TableScanTest4(predicate, v);
+            out_index[out_count] = i + 0; out_count += (m >> 0) & 1;
+            out_index[out_count] = i + 1; out_count += (m >> 1) & 1;
+            out_index[out_count] = i + 2; out_count += (m >> 2) & 1;
+            out_index[out_count] = i + 3; out_count += (m >> 3) & 1;
+        }
+    }
+#endif
+    for ( ; i < active_count; ++i) {
+        out_index[out_count] = i;
+        out_count += TableScanTest(predicate, TableScanReadU32(src_ptr + ((size_t) i * stride)));
+    }
+    o_selection->Count = out_count;
+    return 0;
+}
+
+PIL_API(int)
+TableFilter
+(
+    struct TABLE_SELECTION               *selection,
+    struct TABLE_DESC                        *table,
+    struct TABLE_SCAN_PREDICATE const    *predicate
+)
+{
+    uint32_t        *indices = selection->Indices;
+    uint32_t       in_count  = selection->Count;
+    uint32_t      out_count  = 0;
+    TABLE_DATA        *stream;
+    uint8_t const    *src_ptr;
+    uint32_t           stride;
+    uint32_t      dense_index;
+    uint32_t                i;
+
+    if (TableScanValidatePredicate(table, predicate) != 0) {
+        return -1;
+    }
+    stream  = table->Streams[predicate->StreamIndex];
+    stride  = stream->ElementSize;
+    src_ptr =(uint8_t const*) stream->StorageBuffer + predicate->FieldOffset;
+    /* the output cursor never passes the input cursor, so the selection can be compacted in-place */
+    for (i = 0; i < in_count; ++i) {
+        dense_index         = indices[i];
+        indices[out_count]  = dense_index;
+        out_count          += TableScanTest(predicate, TableScanReadU32(src_ptr + ((size_t) dense_index * stride)));
+    }
+    selection->Count = out_count;
+    return 0;
+}
+
+PIL_API(void)
+TableSelectionToHandles
+(
+    HANDLE_BITS                       *o_handles,
+    struct TABLE_DESC                     *table,
+    struct TABLE_SELECTION const      *selection
+)
+{
+    uint32_t const *handles = table->Index->HandleArray;
+    uint32_t const *indices = selection->Indices;
+    uint32_t              i;
+    uint32_t              n;
+    for (i = 0, n = selection->Count; i < n; ++i) {
+        o_handles[i] = handles[indices[i]];
+    }
+}
+
+PIL_API(uint32_t)
+TableJoin
+(
+    struct TABLE_JOIN *join,
+    struct TABLE_DESC *left,
+    struct TABLE_DESC *right
+)
+{
+    TABLE_INDEX      *drive;
+    TABLE_INDEX      *probe;
+    uint32_t     *drive_out;
+    uint32_t     *probe_out;
+    uint32_t const *handles;
+    uint32_t const  *sparse;
+    uint32_t    slots[TABLE_JOIN_BATCH_SIZE];
+    uint32_t    cursor = join->Cursor;
+    uint32_t     count = 0;
+    uint32_t  capacity = join->Capacity;
+    uint32_t drive_count;
+    uint32_t  bits, slot;
+    uint32_t   i, n;
+
+    if (capacity == 0) {
+        assert(capacity != 0);
+        join->Count = 0;
+        return 0;
+    }
+    /* drive the join from the smaller table. the choice must not change 
+     * between batches, which holds as long as neither table is modified. */
+    if (left->Index->ActiveCount <= right->Index->ActiveCount) {
+        drive     = left->Index;
+        probe     = right->Index;
+        drive_out = join->LeftIndices;
+        probe_out = join->RightIndices;
+    } else {
+        drive     = right->Index;
+        probe     = left->Index;
+        drive_out = join->RightIndices;
+        probe_out = join->LeftIndices;
+    }
+    handles     = drive->HandleArray;
+    sparse      = probe->SparseIndex;
+    drive_count = drive->ActiveCount;
+
+    while (cursor < drive_count && count < capacity) {
+        /* limit the batch so that every handle in it can produce a pair */
+        n = drive_count - cursor;
+        n = n < TABLE_JOIN_BATCH_SIZE ? n : TABLE_JOIN_BATCH_SIZE;
+        n = n < (capacity - count)    ? n : (capacity - count);
+        /* the first pass issues loads for the probed sparse index slots,
+         * which are effectively random accesses into a large array. */
+        for (i = 0; i < n; ++i) {
+            slot = (handles[cursor + i] & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+            if (slot < probe->TableCapacity && TableIndex_IsSparseSlotCommitted(probe, slot)) {
+                TableScan_Prefetch(&sparse[slot]);
+            } else {
+                slot = HANDLE_INDEX_MASK + 1;
+            }
+            slots[i] = slot;
+        }
+        /* the second pass compares the generation of each live probed slot 
+         * with the generation of the driving handle. */
+        for (i = 0; i < n; ++i) {
+            if (slots[i] > HANDLE_INDEX_MASK) {
+                continue;
+            }
+            bits = sparse[slots[i]];
+            if ((bits & HANDLE_FLAG_MASK_PACKED) != 0 && ((bits ^ handles[cursor + i]) & HANDLE_GENER_MASK_PACKED) == 0) {
+                drive_out[count] = cursor + i;
+                probe_out[count] = (bits & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+                count++;
+            }
+        }
+        cursor += n;
+    }
+    join->Cursor = cursor;
+    join->Count  = count;
+    return count;
+}
+
+/* @summary Retrieve the size of a single value stored in a numeric table column.
+ * @param column_type One of the values of the TABLE_COLUMN_TYPE enumeration.
+ * @return The size of a single column value, in bytes.
+ */
+static PIL_INLINE uint32_t
+TableColumnValueSize
+(
+    uint32_t column_type
+)
+{
+    return (column_type == TABLE_COLUMN_TYPE_INT64 || column_type == TABLE_COLUMN_TYPE_FLOAT64) ? 8 : 4;
+}
+
+/* @summary Validate a column description against the table it will be read from.
+ * @param table Pointer to a TABLE_DESC describing the table.
+ * @param column The column to validate.
+ * @return Zero if the column is valid, or -1 if the column is not valid.
+ */
+static int
+TableScanValidateColumn
+(
+    struct TABLE_DESC             *table,
+    struct TABLE_COLUMN const    *column
+)
+{
+    if (column->ColumnType > TABLE_COLUMN_TYPE_FLOAT64) {
+        assert(column->ColumnType <= TABLE_COLUMN_TYPE_FLOAT64);
+        return -1;
+    }
+    if (column->StreamIndex >= table->StreamCount) {
+        assert(column->StreamIndex < table->StreamCount);
+        return -1;
+    }
+    if (column->FieldOffset + TableColumnValueSize(column->ColumnType) > table->Streams[column->StreamIndex]->ElementSize) {
+        assert(column->FieldOffset + TableColumnValueSize(column->ColumnType) <= table->Streams[column->StreamIndex]->ElementSize);
+        return -1;
+    }
+    return 0;
+}
+
+/* @summary Read a numeric column value and convert it to double precision.
+ * @param src A pointer to the column value within the record.
+ * @param column_type One of the values of the TABLE_COLUMN_TYPE enumeration.
+ * @return The column value.
+ */
+static PIL_INLINE double
+TableColumnReadF64
+(
+    uint8_t const *src,
+    uint32_t column_type
+)
+{
+    switch (column_type) {
+        case TABLE_COLUMN_TYPE_INT32  : { int32_t v; memcpy(&v, src, sizeof(v)); return (double) v; }
+        case TABLE_COLUMN_TYPE_INT64  : { int64_t v; memcpy(&v, src, sizeof(v)); return (double) v; }
+        case TABLE_COLUMN_TYPE_FLOAT32: { float   v; memcpy(&v, src, sizeof(v)); return (double) v; }
+        default                       : { double  v; memcpy(&v, src, sizeof(v)); return v; }
+    }
+}
+
+/* @summary Read an integer column value and sign-extend it to 64 bits.
+ * @param src A pointer to the column value within the record.
+ * @param column_type Either TABLE_COLUMN_TYPE_INT32 or TABLE_COLUMN_TYPE_INT64.
+ * @return The column value.
+ */
+static PIL_INLINE int64_t
+TableColumnReadI64
+(
+    uint8_t const *src,
+    uint32_t column_type
+)
+{
+    if (column_type == TABLE_COLUMN_TYPE_INT32) {
+        int32_t v; memcpy(&v, src, sizeof(v)); return v;
+    } else {
+        int64_t v; memcpy(&v, src, sizeof(v)); return v;
+    }
+}
+
+#if TABLE_SCAN_USE_SSE2
+/* @summary Aggregate a densely-packed int32_t column four values at a time.
+ * @param result The TABLE_AGGREGATE to update.
+ * @param src The address of the first column value.
+ * @param count The number of column values to aggregate.
+ * @return The number of values consumed, which is a multiple of four.
+ */
+static uint32_t
+TableAggregateDenseI32
+(
+    struct TABLE_AGGREGATE *result,
+    int32_t const             *src,
+    uint32_t                 count
+)
+{
+    __m128i   sum = _mm_setzero_si128();
+    __m128i   min = _mm_set1_epi32(INT32_MAX);
+    __m128i   max = _mm_set1_epi32(INT32_MIN);
+    int64_t    s64[2];
+    int32_t    m32[8];
+    uint32_t      i;
+    uint32_t      n = count & ~3U;
+
+    for (i = 0; i < n; i += 4) {
+        __m128i    v = _mm_loadu_si128((__m128i const*)(src + i));
+        __m128i sign = _mm_srai_epi32(v, 31);
+        __m128i  ltm = _mm_cmplt_epi32(v, min);
+        __m128i  gtm = _mm_cmpgt_epi32(v, max);
+        /* sign-extend each lane to 64 bits and accumulate */
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, sign));
+        sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(v, sign));
+        min = _mm_or_si128(_mm_and_si128(ltm, v), _mm_andnot_si128(ltm, min));
+        max = _mm_or_si128(_mm_and_si128(gtm, v), _mm_andnot_si128(gtm, max));
+    }
+    if (n > 0) {
+        _mm_storeu_si128((__m128i*) s64, sum);
+        _mm_storeu_si128((__m128i*)(m32 + 0), min);
+        _mm_storeu_si128((__m128i*)(m32 + 4), max);
+        result->SumI64 += s64[0] + s64[1];
+        for (i = 0; i < 4; ++i) {
+            if (m32[i + 0] < result->MinI64) result->MinI64 = m32[i + 0];
+            if (m32[i + 4] > result->MaxI64) result->MaxI64 = m32[i + 4];
+        }
+        result->Count  += n;
+    }
+    return n;
+}
+
+/* @summary Aggregate a densely-packed float column four values at a time. Sums are accumulated in double precision.
+ * @param result The TABLE_AGGREGATE to update.
+ * @param src The address of the first column value.
+ * @param count The number of column values to aggregate.
+ * @return The number of values consumed, which is a multiple of four.
+ */
+static uint32_t
+TableAggregateDenseF32
+(
+    struct TABLE_AGGREGATE *result,
+    float const               *src,
+    uint32_t                 count
+)
+{
+    __m128d  sum0 = _mm_setzero_pd();
+    __m128d  sum1 = _mm_setzero_pd();
+    __m128    min = _mm_set1_ps(src[0]);
+    __m128    max = min;
+    double    s64[4];
+    float     m32[8];
+    uint32_t    i;
+    uint32_t    n = count & ~3U;
+
+    for (i = 0; i < n; i += 4) {
+        __m128 v = _mm_loadu_ps(src + i);
+        sum0 = _mm_add_pd(sum0, _mm_cvtps_pd(v));
+        sum1 = _mm_add_pd(sum1, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+        min  = _mm_min_ps(min, v);
+        max  = _mm_max_ps(max, v);
+    }
+    if (n > 0) {
+        _mm_storeu_pd(s64 + 0, sum0);
+        _mm_storeu_pd(s64 + 2, sum1);
+        _mm_storeu_ps(m32 + 0, min);
+        _mm_storeu_ps(m32 + 4, max);
+        result->SumF64 += (s64[0] + s64[2]) + (s64[1] + s64[3]);
+        for (i = 0; i < 4; ++i) {
+            if (m32[i + 0] < result->MinF64) result->MinF64 = m32[i + 0];
+            if (m32[i + 4] > result->MaxF64) result->MaxF64 = m32[i + 4];
+        }
+        result->Count  += n;
+    }
+    return n;
+}
+
+/* @summary Aggregate a densely-packed double column four values at a time.
+ * @param result The TABLE_AGGREGATE to update.
+ * @param src The address of the first column value.
+ * @param count The number of column values to aggregate.
+ * @return The number of values consumed, which is a multiple of four.
+ */
+static uint32_t
+TableAggregateDenseF64
+(
+    struct TABLE_AGGREGATE *result,
+    double const              *src,
+    uint32_t                 count
+)
+{
+    __m128d  sum0 = _mm_setzero_pd();
+    __m128d  sum1 = _mm_setzero_pd();
+    __m128d  min0 = _mm_set1_pd(src[0]);
+    __m128d  min1 = min0;
+    __m128d  max0 = min0;
+    __m128d  max1 = min0;
+    double    tmp[6];
+    uint32_t    i;
+    uint32_t    n = count & ~3U;
+
+    for (i = 0; i < n; i += 4) {
+        __m128d v0 = _mm_loadu_pd(src + i + 0);
+        __m128d v1 = _mm_loadu_pd(src + i + 2);
+        sum0 = _mm_add_pd(sum0, v0); sum1 = _mm_add_pd(sum1, v1);
+        min0 = _mm_min_pd(min0, v0); min1 = _mm_min_pd(min1, v1);
+        max0 = _mm_max_pd(max0, v0); max1 = _mm_max_pd(max1, v1);
+    }
+    if (n > 0) {
+        _mm_storeu_pd(tmp + 0, _mm_add_pd(sum0, sum1));
+        _mm_storeu_pd(tmp + 2, _mm_min_pd(min0, min1));
+        _mm_storeu_pd(tmp + 4, _mm_max_pd(max0, max1));
+        result->SumF64 += tmp[0] + tmp[1];
+        if (tmp[2] < result->MinF64) result->MinF64 = tmp[2];
+        if (tmp[3] < result->MinF64) result->MinF64 = tmp[3];
+        if (tmp[4] > result->MaxF64) result->MaxF64 = tmp[4];
+        if (tmp[5] > result->MaxF64) result->MaxF64 = tmp[5];
+        result->Count  += n;
+    }
+    return n;
+}
+#endif
+
+#if TABLE_SCAN_USE_AVX2 || TABLE_SCAN_USE_NEON
+/* @summary Aggregate a densely-packed int64_t column four values at a time. Sums wrap on overflow, matching the scalar loop.
+ * @param result The TABLE_AGGREGATE to update.
+ * @param src The address of the first column value.
+ * @param count The number of column values to aggregate.
+ * @return The number of values consumed, which is a multiple of four.
+ */
+static uint32_t
+TableAggregateDenseI64
+(
+    struct TABLE_AGGREGATE *result,
+    int64_t const             *src,
+    uint32_t                 count
+)
+{
+    int64_t    tmp[12];
+    uint32_t      i;
+    uint32_t      n = count & ~3U;
+#if TABLE_SCAN_USE_AVX2
+    __m256i   sum = _mm256_setzero_si256();
+    __m256i   min = _mm256_set1_epi64x(INT64_MAX);
+    __m256i   max = _mm256_set1_epi64x(INT64_MIN);
+
+    for (i = 0; i < n; i += 4) {
+        __m256i   v = _mm256_loadu_si256((__m256i const*)(src + i));
+        __m256i ltm = _mm256_cmpgt_epi64(min, v);
+        __m256i gtm = _mm256_cmpgt_epi64(v, max);
+        sum = _mm256_add_epi64(sum, v);
+        min = _mm256_blendv_epi8(min, v, ltm);
+        max = _mm256_blendv_epi8(max, v, gtm);
+    }
+    if (n > 0) {
+        _mm256_storeu_si256((__m256i*)(tmp + 0), sum);
+        _mm256_storeu_si256((__m256i*)(tmp + 4), min);
+        _mm256_storeu_si256((__m256i*)(tmp + 8), max);
+    }
+#else
+    int64x2_t sum0 = vdupq_n_s64(0);
+    int64x2_t sum1 = sum0;
+    int64x2_t min0 = vdupq_n_s64(INT64_MAX);
+    int64x2_t min1 = min0;
+    int64x2_t max0 = vdupq_n_s64(INT64_MIN);
+    int64x2_t max1 = max0;
+
+    for (i = 0; i < n; i += 4) {
+        int64x2_t v0 = vld1q_s64(src + i + 0);
+        int64x2_t v1 = vld1q_s64(src + i + 2);
+        sum0 = vaddq_s64(sum0, v0); sum1 = vaddq_s64(sum1, v1);
+        min0 = vbslq_s64(vcgtq_s64(min0, v0), v0, min0); min1 = vbslq_s64(vcgtq_s64(min1, v1), v1, min1);
+        max0 = vbslq_s64(vcgtq_s64(v0, max0), v0, max0); max1 = vbslq_s64(vcgtq_s64(v1, max1), v1, max1);
+    }
+    if (n > 0) {
+        vst1q_s64(tmp + 0, sum0); vst1q_s64(tmp + 2 , sum1);
+        vst1q_s64(tmp + 4, min0); vst1q_s64(tmp + 6 , min1);
+        vst1q_s64(tmp + 8, max0); vst1q_s64(tmp + 10, max1);
+    }
+#endif
+    if (n > 0) {
+        for (i = 0; i < 4; ++i) {
+            result->SumI64 = (int64_t)((uint64_t) result->SumI64 + (uint64_t) tmp[i]);
+            if (tmp[i + 4] < result->MinI64) result->MinI64 = tmp[i + 4];
+            if (tmp[i + 8] > result->MaxI64) result->MaxI64 = tmp[i + 8];
+        }
+        result->Count  += n;
+    }
+    return n;
+}
+
+/* @summary Count the values of a densely-packed int32_t, float or double column into histogram bins four values at a time.
+ * Bin indices are computed exactly as in the scalar loop, and NaN values are skipped.
+ * @param o_bins The array of bin counts to update.
+ * @param last_bin The index of the last bin.
+ * @param min_value The value at the lower edge of the first bin.
+ * @param scale The number of bins per unit of the column value.
+ * @param src The address of the first column value.
+ * @param column_type One of TABLE_COLUMN_TYPE_INT32, TABLE_COLUMN_TYPE_FLOAT32 or TABLE_COLUMN_TYPE_FLOAT64.
+ * @param count The number of column values to count.
+ * @return The number of values consumed, which is a multiple of four.
+ */
+static uint32_t
+TableHistogramDense
+(
+    uint32_t              *o_bins,
+    uint32_t             last_bin,
+    double              min_value,
+    double                  scale,
+    uint8_t const            *src,
+    uint32_t          column_type,
+    uint32_t                count
+)
+{
+    uint32_t   bin[4];
+    uint32_t   ord;
+    uint32_t  i, j;
+    uint32_t     n = count & ~3U;
+#if TABLE_SCAN_USE_AVX2
+    __m256d   minv = _mm256_set1_pd(min_value);
+    __m256d  scalev= _mm256_set1_pd(scale);
+    __m256d  zero  = _mm256_setzero_pd();
+    __m256d  lastv = _mm256_set1_pd((double) last_bin);
+
+    for (i = 0; i < n; i += 4) {
+        __m256d v;
+        __m256d t;
+        switch (column_type) {
+            case TABLE_COLUMN_TYPE_INT32  : v = _mm256_cvtepi32_pd(_mm_loadu_si128((__m128i const*)(src + (i * sizeof(int32_t))))); break;
+            case TABLE_COLUMN_TYPE_FLOAT32: v = _mm256_cvtps_pd(_mm_loadu_ps((float const*)(src + (i * sizeof(float))))); break;
+            default                       : v = _mm256_loadu_pd((double const*)(src + (i * sizeof(double)))); break;
+        }
+        t   = _mm256_mul_pd(_mm256_sub_pd(v, minv), scalev);
+        ord = (uint32_t) _mm256_movemask_pd(_mm256_cmp_pd(t, t, _CMP_ORD_Q));
+        /* clamp to [0, last_bin] before truncating; NaN lanes are masked out by ord */
+        t   = _mm256_min_pd(_mm256_max_pd(t, zero), lastv);
+        _mm_storeu_si128((__m128i*) bin, _mm256_cvttpd_epi32(t));
+        for (j = 0; j < 4; ++j) {
+            o_bins[bin[j]] += (ord >> j) & 1;
+        }
+    }
+#else
+    float64x2_t minv = vdupq_n_f64(min_value);
+    float64x2_t scalev= vdupq_n_f64(scale);
+    float64x2_t zero = vdupq_n_f64(0.0);
+    float64x2_t lastv= vdupq_n_f64((double) last_bin);
+
+    for (i = 0; i < n; i += 4) {
+        float64x2_t v0, v1;
+        float64x2_t t0, t1;
+        uint64x2_t  o0, o1;
+        switch (column_type) {
+            case TABLE_COLUMN_TYPE_INT32:
+                {   int32x4_t iv = vld1q_s32((int32_t const*)(src + (i * sizeof(int32_t))));
+                    v0 = vcvtq_f64_s64(vmovl_s32(vget_low_s32 (iv)));
+                    v1 = vcvtq_f64_s64(vmovl_s32(vget_high_s32(iv)));
+                } break;
+            case TABLE_COLUMN_TYPE_FLOAT32:
+                {   float32x4_t fv = vld1q_f32((float const*)(src + (i * sizeof(float))));
+                    v0 = vcvt_f64_f32(vget_low_f32(fv));
+                    v1 = vcvt_high_f64_f32(fv);
+                } break;
+            default:
+                {   v0 = vld1q_f64((double const*)(src + (i * sizeof(double))) + 0);
+                    v1 = vld1q_f64((double const*)(src + (i * sizeof(double))) + 2);
+                } break;
+        }
+        t0  = vmulq_f64(vsubq_f64(v0, minv), scalev);
+        t1  = vmulq_f64(vsubq_f64(v1, minv), scalev);
+        o0  = vceqq_f64(t0, t0);
+        o1  = vceqq_f64(t1, t1);
+        ord = ((uint32_t) vgetq_lane_u64(o0, 0) & 1) | ((uint32_t) vgetq_lane_u64(o0, 1) & 2) | ((uint32_t) vgetq_lane_u64(o1, 0) & 4) | ((uint32_t) vgetq_lane_u64(o1, 1) & 8);
+        /* clamp to [0, last_bin] before truncating; NaN lanes are masked out by ord */
+        t0  = vminq_f64(vmaxq_f64(t0, zero), lastv);
+        t1  = vminq_f64(vmaxq_f64(t1, zero), lastv);
+        vst1q_u32(bin, vcombine_u32(vmovn_u64(vcvtq_u64_f64(t0)), vmovn_u64(vcvtq_u64_f64(t1))));
+        for (j = 0; j < 4; ++j) {
+            o_bins[bin[j]] += (ord >> j) & 1;
+        }
+    }
+#endif
+    return n;
+}
+#endif
+
+PIL_API(int)
+TableAggregate
+(
+    struct TABLE_AGGREGATE              *o_result,
+    struct TABLE_DESC                       *table,
+    struct TABLE_COLUMN const              *column,
+    struct TABLE_SELECTION const        *selection,
+    uint32_t                           range_begin,
+    uint32_t                             range_end
+)
+{
+    uint32_t   column_type = column->ColumnType;
+    uint32_t const *sel_ix = NULL;
+    uint8_t const *src_ptr;
+    TABLE_DATA     *stream;
+    uint32_t        stride;
+    uint32_t         limit;
+    uint32_t             i;
+
+    o_result->SumI64     = 0;
+    o_result->MinI64     = INT64_MAX;
+    o_result->MaxI64     = INT64_MIN;
+    o_result->SumF64     = 0.0;
+    o_result->MinF64     = HUGE_VAL;
+    o_result->MaxF64     =-HUGE_VAL;
+    o_result->Count      = 0;
+    o_result->ColumnType = column_type;
+    if (TableScanValidateColumn(table, column) != 0) {
+        return -1;
+    }
+    if (selection != NULL) {
+        limit  = selection->Count;
+        sel_ix = selection->Indices;
+    } else {
+        limit  = Table_GetCount(table);
+    }
+    if (range_end > limit) {
+        range_end = limit;
+    }
+    if (range_begin >= range_end) {
+        return 0;
+    }
+    stream  = table->Streams[column->StreamIndex];
+    stride  = stream->ElementSize;
+    src_ptr =(uint8_t const*) stream->StorageBuffer + column->FieldOffset;
+#if TABLE_SCAN_USE_SSE2 || TABLE_SCAN_USE_NEON
+    if (selection == NULL && stride == TableColumnValueSize(column_type)) {
+        uint8_t const *first = src_ptr + ((size_t) range_begin * stride);
+        uint32_t       count = range_end - range_begin;
+        switch (column_type) {
+#if TABLE_SCAN_USE_SSE2
+            case TABLE_COLUMN_TYPE_INT32  : range_begin += TableAggregateDenseI32(o_result, (int32_t const*) first, count); break;
+            case TABLE_COLUMN_TYPE_FLOAT32: range_begin += TableAggregateDenseF32(o_result, (float   const*) first, count); break;
+            case TABLE_COLUMN_TYPE_FLOAT64: range_begin += TableAggregateDenseF64(o_result, (double  const*) first, count); break;
+#endif
+#if TABLE_SCAN_USE_AVX2 || TABLE_SCAN_USE_NEON
+            case TABLE_COLUMN_TYPE_INT64  : range_begin += TableAggregateDenseI64(o_result, (int64_t const*) first, count); break;
+#endif
+            default: break;
+        }
+    }
+#endif
+    if (column_type == TABLE_COLUMN_TYPE_INT32 || column_type == TABLE_COLUMN_TYPE_INT64) {
+        for (i = range_begin; i < range_end; ++i) {
+            uint32_t dense_index = sel_ix ? sel_ix[i] : i;
+            int64_t            v = TableColumnReadI64(src_ptr + ((size_t) dense_index * stride), column_type);
+            o_result->SumI64 = (int64_t)((uint64_t) o_result->SumI64 + (uint64_t) v);
+            o_result->MinI64 = v < o_result->MinI64 ? v : o_result->MinI64;
+            o_result->MaxI64 = v > o_result->MaxI64 ? v : o_result->MaxI64;
+        }
+    } else {
+        for (i = range_begin; i < range_end; ++i) {
+            uint32_t dense_index = sel_ix ? sel_ix[i] : i;
+            double             v = TableColumnReadF64(src_ptr + ((size_t) dense_index * stride), column_type);
+            o_result->SumF64 += v;
+            o_result->MinF64  = v < o_result->MinF64 ? v : o_result->MinF64;
+            o_result->MaxF64  = v > o_result->MaxF64 ? v : o_result->MaxF64;
+        }
+    }
+    o_result->Count += range_end - range_begin;
+    return 0;
+}
+
+PIL_API(void)
+TableAggregateMerge
+(
+    struct TABLE_AGGREGATE             *dst,
+    struct TABLE_AGGREGATE const       *src
+)
+{
+    assert(dst->ColumnType == src->ColumnType);
+    dst->SumI64 = (int64_t)((uint64_t) dst->SumI64 + (uint64_t) src->SumI64);
+    dst->MinI64 = src->MinI64 < dst->MinI64 ? src->MinI64 : dst->MinI64;
+    dst->MaxI64 = src->MaxI64 > dst->MaxI64 ? src->MaxI64 : dst->MaxI64;
+    dst->SumF64 = dst->SumF64 + src->SumF64;
+    dst->MinF64 = src->MinF64 < dst->MinF64 ? src->MinF64 : dst->MinF64;
+    dst->MaxF64 = src->MaxF64 > dst->MaxF64 ? src->MaxF64 : dst->MaxF64;
+    dst->Count += src->Count;
+}
+
+PIL_API(int)
+TableHistogram
+(
+    uint32_t                               *o_bins,
+    uint32_t                             bin_count,
+    double                               min_value,
+    double                               max_value,
+    struct TABLE_DESC                       *table,
+    struct TABLE_COLUMN const              *column,
+    struct TABLE_SELECTION const        *selection,
+    uint32_t                           range_begin,
+    uint32_t                             range_end
+)
+{
+    uint32_t   column_type = column->ColumnType;
+    uint32_t const *sel_ix = NULL;
+    uint32_t      last_bin = bin_count - 1;
+    uint8_t const *src_ptr;
+    TABLE_DATA     *stream;
+    uint32_t        stride;
+    uint32_t         limit;
+    uint32_t             i;
+    double           scale;
+
+    if (bin_count == 0 || !(max_value > min_value)) {
+        assert(bin_count > 0);
+        assert(max_value > min_value);
+        return -1;
+    }
+    if (TableScanValidateColumn(table, column) != 0) {
+        return -1;
+    }
+    if (selection != NULL) {
+        limit  = selection->Count;
+        sel_ix = selection->Indices;
+    } else {
+        limit  = Table_GetCount(table);
+    }
+    if (range_end > limit) {
+        range_end = limit;
+    }
+    stream  = table->Streams[column->StreamIndex];
+    stride  = stream->ElementSize;
+    src_ptr =(uint8_t const*) stream->StorageBuffer + column->FieldOffset;
+    scale   = (double) bin_count / (max_value - min_value);
+#if TABLE_SCAN_USE_AVX2 || TABLE_SCAN_USE_NEON
+    if (selection == NULL && range_begin < range_end && column_type != TABLE_COLUMN_TYPE_INT64 && stride == TableColumnValueSize(column_type)) {
+        range_begin += TableHistogramDense(o_bins, last_bin, min_value, scale, src_ptr + ((size_t) range_begin * stride), column_type, range_end - range_begin);
+    }
+#endif
+    for (i = range_begin; i < range_end; ++i) {
+        uint32_t dense_index = sel_ix ? sel_ix[i] : i;
+        double             t =(TableColumnReadF64(src_ptr + ((size_t) dense_index * stride), column_type) - min_value) * scale;
+        if (t >= 0.0) {
+            o_bins[t < (double) last_bin ? (uint32_t) t : last_bin]++;
+        } else if (t < 0.0) {
+            o_bins[0]++;
+        } /* else NaN */
+    }
+    return 0;
+}
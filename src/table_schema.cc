@@ -0,0 +1,379 @@
+/**
+ * @summary table_schema.cc: Implement schema validation and the conversion of
+ * table data stream records to and from their serialized column-chunk form.
+ * Each column is gathered from (or scattered to) the strided records with a
+ * loop specialized for the size of the value, and byte-swapped as a whole
+ * using the vectorized memio routines when the record byte order differs from
+ * the little-endian serialized byte order.
+ */
+#include <assert.h>
+#include <string.h>
+#include "memio.h"
+#include "table_schema.h"
+
+/* @summary The size of a single value of each TABLE_FIELD_TYPE, in bytes.
+ */
+static uint32_t const TableFieldTypeSize[TABLE_FIELD_TYPE_COUNT] = {
+    1, /* TABLE_FIELD_TYPE_BYTES */
+    1, /* TABLE_FIELD_TYPE_SI8   */
+    1, /* TABLE_FIELD_TYPE_UI8   */
+    2, /* TABLE_FIELD_TYPE_SI16  */
+    2, /* TABLE_FIELD_TYPE_UI16  */
+    4, /* TABLE_FIELD_TYPE_SI32  */
+    4, /* TABLE_FIELD_TYPE_UI32  */
+    8, /* TABLE_FIELD_TYPE_SI64  */
+    8, /* TABLE_FIELD_TYPE_UI64  */
+    4, /* TABLE_FIELD_TYPE_F32   */
+    8  /* TABLE_FIELD_TYPE_F64   */
+};
+
+/* @summary Describe how a field is split into columns within a chunk. A field of TABLE_FIELD_TYPE_BYTES is stored as a single column of Count-byte values, and any other field as Count columns of single values.
+ * @param o_column_size On return, set to the size of each value in a column, in bytes.
+ * @param o_swap On return, set to non-zero if each value must be byte-swapped between the record and the serialized form.
+ * @param field The TABLE_FIELD_DESC to describe.
+ * @return The number of columns for the field.
+ */
+static uint32_t
+TableFieldColumns
+(
+    uint32_t           *o_column_size,
+    int                       *o_swap,
+    struct TABLE_FIELD_DESC const *field
+)
+{
+    uint32_t size  = TableFieldTypeSize[field->FieldType];
+    uint32_t order = field->Endianess != PIL_ENDIANESS_UNKNOWN ? field->Endianess : PIL_SYSTEM_ENDIANESS;
+    if (field->FieldType == TABLE_FIELD_TYPE_BYTES) {
+       *o_column_size = field->Count;
+       *o_swap        = 0;
+        return 1;
+    }
+   *o_column_size = size;
+   *o_swap        =(size > 1 && order != PIL_ENDIANESS_LSB_FIRST) ? 1 : 0;
+    return field->Count;
+}
+
+/* @summary Copy one value from each of a sequence of strided records into a contiguous column.
+ * @param dst The column to write.
+ * @param src The address of the value in the first record.
+ * @param stride The size of each record, in bytes.
+ * @param count The number of records.
+ * @param size The size of each value, in bytes.
+ */
+static void
+TableSchemaGather
+(
+    uint8_t       * PIL_RESTRICT dst,
+    uint8_t const * PIL_RESTRICT src,
+    size_t                    stride,
+    size_t                     count,
+    uint32_t                    size
+)
+{
+    size_t i;
+    if (stride == size) {
+        memcpy(dst, src, count * size);
+        return;
+    }
+    switch (size) {
+        case 1:
+            for (i = 0; i < count; ++i) dst[i] = src[i * stride];
+            break;
+        case 2:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * 2), src + (i * stride), 2);
+            break;
+        case 4:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * 4), src + (i * stride), 4);
+            break;
+        case 8:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * 8), src + (i * stride), 8);
+            break;
+        default:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * size), src + (i * stride), size);
+            break;
+    }
+}
+
+/* @summary Copy the values of a contiguous column into a sequence of strided records.
+ * @param dst The address of the value in the first record.
+ * @param src The column to read.
+ * @param stride The size of each record, in bytes.
+ * @param count The number of records.
+ * @param size The size of each value, in bytes.
+ */
+static void
+TableSchemaScatter
+(
+    uint8_t       * PIL_RESTRICT dst,
+    uint8_t const * PIL_RESTRICT src,
+    size_t                    stride,
+    size_t                     count,
+    uint32_t                    size
+)
+{
+    size_t i;
+    if (stride == size) {
+        memcpy(dst, src, count * size);
+        return;
+    }
+    switch (size) {
+        case 1:
+            for (i = 0; i < count; ++i) dst[i * stride] = src[i];
+            break;
+        case 2:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * stride), src + (i * 2), 2);
+            break;
+        case 4:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * stride), src + (i * 4), 4);
+            break;
+        case 8:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * stride), src + (i * 8), 8);
+            break;
+        default:
+            for (i = 0; i < count; ++i) memcpy(dst + (i * stride), src + (i * size), size);
+            break;
+    }
+}
+
+/* @summary Reverse the byte order of each value in a contiguous column, in place.
+ * @param data The column to swap.
+ * @param count The number of values in the column.
+ * @param size The size of each value, 2, 4 or 8 bytes.
+ */
+static void
+TableSchemaSwap
+(
+    void     *data,
+    size_t   count,
+    uint32_t  size
+)
+{
+    switch (size) {
+        case 2: ByteSwapArray16(data, count); break;
+        case 4: ByteSwapArray32(data, count); break;
+        case 8: ByteSwapArray64(data, count); break;
+        default: assert(0 && "Unexpected value size"); break;
+    }
+}
+
+PIL_API(int)
+TableSchemaInit
+(
+    struct TABLE_SCHEMA          *o_schema,
+    struct TABLE_FIELD_DESC const  *fields,
+    uint32_t                   field_count,
+    uint32_t                   record_size
+)
+{
+    uint32_t   hash = 2166136261UL;
+    uint32_t packed = 0;
+    uint32_t   i, j;
+
+    assert(o_schema != NULL);
+    memset(o_schema, 0, sizeof(TABLE_SCHEMA));
+    if (fields == NULL || field_count == 0 || field_count > TABLE_SCHEMA_MAX_FIELDS) {
+        assert(fields != NULL);
+        assert(field_count > 0 && field_count <= TABLE_SCHEMA_MAX_FIELDS);
+        return -1;
+    }
+    for (i = 0; i < field_count; ++i) {
+        TABLE_FIELD_DESC const *f = &fields[i];
+        uint64_t             size;
+        uint32_t             word[2];
+        uint32_t             b;
+
+        if (f->FieldType >= TABLE_FIELD_TYPE_COUNT || f->Count == 0) {
+            assert(f->FieldType < TABLE_FIELD_TYPE_COUNT);
+            assert(f->Count > 0);
+            return -1;
+        }
+        if (f->Endianess != PIL_ENDIANESS_UNKNOWN && f->Endianess != PIL_ENDIANESS_LSB_FIRST && f->Endianess != PIL_ENDIANESS_MSB_FIRST) {
+            assert(0 && "Invalid field byte order");
+            return -1;
+        }
+        size = (uint64_t) f->Count * TableFieldTypeSize[f->FieldType];
+        if ((uint64_t) f->Offset + size > record_size) {
+            assert((uint64_t) f->Offset + size <= record_size);
+            return -1;
+        }
+        for (j = 0; j < i; ++j) {
+            uint64_t other_size = (uint64_t) fields[j].Count * TableFieldTypeSize[fields[j].FieldType];
+            if (f->Offset < fields[j].Offset + other_size && fields[j].Offset < f->Offset + size) {
+                assert(0 && "Fields overlap");
+                return -1;
+            }
+        }
+        /* the hash covers only what determines the serialized form, so records
+         * with a different in-memory layout can still read each other's data */
+        word[0] = f->FieldType;
+        word[1] = f->Count;
+        for (b = 0; b < sizeof(word); ++b) {
+            hash ^= ((uint8_t const*) word)[b];
+            hash *= 16777619UL;
+        }
+        packed += (uint32_t) size;
+    }
+    o_schema->Fields     = fields;
+    o_schema->FieldCount = field_count;
+    o_schema->RecordSize = record_size;
+    o_schema->PackedSize = packed;
+    o_schema->SchemaHash = hash;
+    return 0;
+}
+
+PIL_API(size_t)
+TableSchemaPackRecords
+(
+    void                        *dst,
+    struct TABLE_SCHEMA const *schema,
+    void const              *records,
+    size_t                     count
+)
+{
+    uint8_t             *out = (uint8_t*) dst;
+    uint8_t const       *rec = (uint8_t const*) records;
+    size_t            stride = schema->RecordSize;
+    size_t              base;
+
+    for (base = 0; base < count; base += TABLE_SCHEMA_CHUNK_SIZE) {
+        size_t     n = (count - base) < TABLE_SCHEMA_CHUNK_SIZE ? (count - base) : TABLE_SCHEMA_CHUNK_SIZE;
+        uint32_t   f;
+        for (f = 0; f < schema->FieldCount; ++f) {
+            TABLE_FIELD_DESC const *field = &schema->Fields[f];
+            uint8_t const            *src = rec + (base * stride) + field->Offset;
+            uint32_t                 size;
+            int                      swap;
+            uint32_t      ncol = TableFieldColumns(&size, &swap, field);
+            uint32_t         c;
+            for (c = 0; c < ncol; ++c, src += size, out += n * size) {
+                TableSchemaGather(out, src, stride, n, size);
+                if (swap) {
+                    TableSchemaSwap(out, n, size);
+                }
+            }
+        }
+    }
+    return (size_t)(out - (uint8_t*) dst);
+}
+
+PIL_API(size_t)
+TableSchemaUnpackRecords
+(
+    void                    *records,
+    struct TABLE_SCHEMA const *schema,
+    void const                  *src,
+    size_t                     count
+)
+{
+    uint64_t   temp[TABLE_SCHEMA_CHUNK_SIZE];
+    uint8_t const        *in = (uint8_t const*) src;
+    uint8_t             *rec = (uint8_t*) records;
+    size_t            stride = schema->RecordSize;
+    size_t              base;
+
+    for (base = 0; base < count; base += TABLE_SCHEMA_CHUNK_SIZE) {
+        size_t     n = (count - base) < TABLE_SCHEMA_CHUNK_SIZE ? (count - base) : TABLE_SCHEMA_CHUNK_SIZE;
+        uint32_t   f;
+        for (f = 0; f < schema->FieldCount; ++f) {
+            TABLE_FIELD_DESC const *field = &schema->Fields[f];
+            uint8_t                  *dst = rec + (base * stride) + field->Offset;
+            uint32_t                 size;
+            int                      swap;
+            uint32_t      ncol = TableFieldColumns(&size, &swap, field);
+            uint32_t         c;
+            for (c = 0; c < ncol; ++c, dst += size, in += n * size) {
+                if (swap) {
+                    /* swap a copy of the column, since the source is read-only */
+                    memcpy(temp, in, n * size);
+                    TableSchemaSwap(temp, n, size);
+                    TableSchemaScatter(dst, (uint8_t const*) temp, stride, n, size);
+                } else {
+                    TableSchemaScatter(dst, in, stride, n, size);
+                }
+            }
+        }
+    }
+    return (size_t)(in - (uint8_t const*) src);
+}
+
+PIL_API(int)
+TableSchemaWriteStream
+(
+    struct MEMIO_WRITER       *writer,
+    struct TABLE_SCHEMA const *schema,
+    struct TABLE_DATA const   *stream,
+    uint32_t             record_count
+)
+{
+    if (schema->RecordSize != stream->ElementSize) {
+        assert(schema->RecordSize == stream->ElementSize);
+        return -1;
+    }
+    if (MemioWriterReserve(writer, TableSchema_GetStreamSize(schema, record_count)) != 0) {
+        return -1;
+    }
+    MemioWriterPut_ui32_lsb(writer, TABLE_SCHEMA_MAGIC);
+    MemioWriterPut_ui32_lsb(writer, schema->SchemaHash);
+    MemioWriterPut_ui32_lsb(writer, record_count);
+    MemioWriterPut_ui32_lsb(writer, schema->PackedSize);
+    MemioWriterPut_ui32_lsb(writer, TABLE_SCHEMA_CHUNK_SIZE);
+    MemioWriterPut_ui32_lsb(writer, 0);
+    writer->Cursor += TableSchemaPackRecords(writer->Cursor, schema, stream->StorageBuffer, record_count);
+    return 0;
+}
+
+PIL_API(int)
+TableSchemaReadStreamHeader
+(
+    uint32_t          *o_record_count,
+    struct TABLE_SCHEMA const *schema,
+    struct MEMIO_READER       *reader
+)
+{
+    TABLE_SCHEMA_STREAM_HEADER header;
+
+    if (MemioReaderRequire(reader, sizeof(TABLE_SCHEMA_STREAM_HEADER)) != 0) {
+        return -1;
+    }
+    header.Magic       = MemioReaderGet_ui32_lsb(reader);
+    header.SchemaHash  = MemioReaderGet_ui32_lsb(reader);
+    header.RecordCount = MemioReaderGet_ui32_lsb(reader);
+    header.PackedSize  = MemioReaderGet_ui32_lsb(reader);
+    header.ChunkSize   = MemioReaderGet_ui32_lsb(reader);
+    header.Reserved    = MemioReaderGet_ui32_lsb(reader);
+    if (header.Magic != TABLE_SCHEMA_MAGIC || header.SchemaHash != schema->SchemaHash || header.PackedSize != schema->PackedSize || header.ChunkSize != TABLE_SCHEMA_CHUNK_SIZE) {
+        reader->Error = 1;
+        return -1;
+    }
+   *o_record_count = header.RecordCount;
+    return 0;
+}
+
+PIL_API(int)
+TableSchemaReadStream
+(
+    struct TABLE_DATA         *stream,
+    struct TABLE_SCHEMA const *schema,
+    struct MEMIO_READER       *reader,
+    uint32_t             record_count,
+    uint32_t              max_records
+)
+{
+    uint64_t data_size = (uint64_t) record_count * schema->PackedSize;
+
+    if (schema->RecordSize != stream->ElementSize) {
+        assert(schema->RecordSize == stream->ElementSize);
+        return -1;
+    }
+    if (record_count > max_records) {
+        /* the count comes from the serialized header and cannot be trusted */
+        reader->Error = 1;
+        return -1;
+    }
+    if (data_size > (uint64_t) MemioReader_GetRemaining(reader) || MemioReaderRequire(reader, (size_t) data_size) != 0) {
+        reader->Error = 1;
+        return -1;
+    }
+    MemioReaderSkip(reader, TableSchemaUnpackRecords(stream->StorageBuffer, schema, reader->Cursor, record_count));
+    return 0;
+}
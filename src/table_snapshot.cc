@@ -0,0 +1,400 @@
+/**
+ * @summary table_snapshot.cc: Implement multi-version read snapshots of data
+ * tables. Version descriptors are allocated once and never freed while the
+ * snapshot set exists, so a reader that races with the reclamation of a
+ * version only ever touches its pin count, never its chunks.
+ */
+#include <string.h>
+#include "memmgr.h"
+#include "table_snapshot.h"
+
+#if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#   include <intrin.h>
+#endif
+
+/* @summary Atomically increment or decrement a 32-bit pin count, with sequentially-consistent ordering.
+ * @param _p A pointer to the int32_t value to update.
+ * @return The updated value.
+ */
+#ifndef TableSnapshot_AtomicIncrement
+#   if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#       define TableSnapshot_AtomicIncrement(_p)    _InterlockedIncrement((long volatile*)(_p))
+#       define TableSnapshot_AtomicDecrement(_p)    _InterlockedDecrement((long volatile*)(_p))
+#   else
+#       define TableSnapshot_AtomicIncrement(_p)    __atomic_add_fetch((_p), 1, __ATOMIC_SEQ_CST)
+#       define TableSnapshot_AtomicDecrement(_p)    __atomic_sub_fetch((_p), 1, __ATOMIC_SEQ_CST)
+#   endif
+#endif
+
+/* @summary Atomically load a 32-bit pin count, with sequentially-consistent ordering.
+ * @param _p A pointer to the int32_t value to read.
+ * @return The current value.
+ */
+#ifndef TableSnapshot_AtomicLoad
+#   if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#       define TableSnapshot_AtomicLoad(_p)         _InterlockedOr((long volatile*)(_p), 0)
+#   else
+#       define TableSnapshot_AtomicLoad(_p)         __atomic_load_n((_p), __ATOMIC_SEQ_CST)
+#   endif
+#endif
+
+/* @summary Atomically load or store the current version pointer of a snapshot set, with sequentially-consistent ordering.
+ * @param _p A pointer to the TABLE_SNAPSHOT* to access.
+ * @param _v The TABLE_SNAPSHOT* to store.
+ */
+#ifndef TableSnapshot_AtomicLoadPointer
+#   if PIL_TARGET_COMPILER == PIL_COMPILER_MSVC
+#       define TableSnapshot_AtomicLoadPointer(_p)      ((TABLE_SNAPSHOT*) _InterlockedCompareExchangePointer((void* volatile*)(_p), NULL, NULL))
+#       define TableSnapshot_AtomicStorePointer(_p, _v) _InterlockedExchangePointer((void* volatile*)(_p), (_v))
+#   else
+#       define TableSnapshot_AtomicLoadPointer(_p)      __atomic_load_n((_p), __ATOMIC_SEQ_CST)
+#       define TableSnapshot_AtomicStorePointer(_p, _v) __atomic_store_n((_p), (_v), __ATOMIC_SEQ_CST)
+#   endif
+#endif
+
+/* @summary Drop the references a version holds on its chunks, freeing any chunk no longer referenced, and mark the version unused.
+ * @param snapshot The TABLE_SNAPSHOT to clear. The version must not be current or pinned by a reader.
+ */
+static void
+TableSnapshotReleaseChunks
+(
+    struct TABLE_SNAPSHOT *snapshot
+)
+{
+    TABLE_SNAPSHOT_REGION *region;
+    TABLE_SNAPSHOT_CHUNK   *chunk;
+    uint32_t                 i, j;
+
+    for (i = 0; i < snapshot->RegionCount; ++i) {
+        region = &snapshot->Regions[i];
+        for (j = 0; j < region->ChunkCount; ++j) {
+            chunk = region->Chunks[j];
+            if (--chunk->RefCount == 0) {
+                HostMemoryFreeHeap(chunk);
+            } region->Chunks[j] = NULL;
+        }
+        region->ElementCount = 0;
+        region->ChunkCount   = 0;
+    }
+    snapshot->ItemCount = 0;
+    snapshot->Epoch     = 0;
+}
+
+/* @summary Retrieve a pointer to the source data for one chunk of a snapshot region.
+ * Chunks of a paged sparse index may span uncommitted pages, and are staged through the scratch buffer with uncommitted slots read as zero.
+ * @param snapshot_set The TABLE_SNAPSHOT_SET being published.
+ * @param region_index The zero-based index of the region.
+ * @param first The index of the first element in the chunk.
+ * @param count The number of elements in the chunk.
+ * @return A pointer to the source data for the chunk.
+ */
+static uint8_t const*
+TableSnapshotGetSourceChunk
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set,
+    uint32_t                   region_index,
+    uint32_t                          first,
+    uint32_t                          count
+)
+{
+    TABLE_DESC  *table = snapshot_set->Table;
+    TABLE_INDEX *index = table->Index;
+    uint32_t  *scratch;
+    uint32_t         i;
+
+    if (region_index == TABLE_SNAPSHOT_REGION_SPARSE) {
+        if (index->SparsePageMask == NULL) {
+            return (uint8_t const*)(index->SparseIndex + first);
+        }
+        scratch = (uint32_t*) snapshot_set->Scratch;
+        for (i = 0; i < count; ++i) {
+            scratch[i] = TableIndex_IsSparseSlotCommitted(index, first + i) ? index->SparseIndex[first + i] : 0;
+        }
+        return (uint8_t const*) scratch;
+    }
+    if (region_index == TABLE_SNAPSHOT_REGION_HANDLE) {
+        return (uint8_t const*)(index->HandleArray + first);
+    }
+    return Table_GetStreamElement(uint8_t, table, region_index - TABLE_SNAPSHOT_REGION_STREAM, first);
+}
+
+/* @summary Build the chunks of one region of a new version, sharing unchanged chunks with the previous version.
+ * @param snapshot_set The TABLE_SNAPSHOT_SET being published.
+ * @param snapshot The TABLE_SNAPSHOT being built.
+ * @param previous The most recently published TABLE_SNAPSHOT, or NULL.
+ * @param region_index The zero-based index of the region to build.
+ * @param element_count The number of elements in the region.
+ * @return Zero if the region was built, or non-zero if memory could not be allocated.
+ */
+static int
+TableSnapshotBuildRegion
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set,
+    struct TABLE_SNAPSHOT         *snapshot,
+    struct TABLE_SNAPSHOT         *previous,
+    uint32_t                   region_index,
+    uint32_t                  element_count
+)
+{
+    TABLE_SNAPSHOT_REGION *region = &snapshot->Regions[region_index];
+    TABLE_SNAPSHOT_REGION   *prev = previous != NULL ? &previous->Regions[region_index] : NULL;
+    TABLE_SNAPSHOT_CHUNK   *chunk;
+    uint8_t const            *src;
+    uint32_t            per_chunk = 1UL << region->ChunkShift;
+    uint32_t                first;
+    uint32_t                count;
+    uint32_t                bytes;
+    uint32_t                    c;
+
+    region->ElementCount = element_count;
+    for (c = 0, first = 0; first < element_count; ++c, first += per_chunk) {
+        count = (element_count - first) < per_chunk ? (element_count - first) : per_chunk;
+        bytes =  count * region->ElementSize;
+        src   =  TableSnapshotGetSourceChunk(snapshot_set, region_index, first, count);
+        if (prev != NULL && c < prev->ChunkCount) {
+            chunk = prev->Chunks[c];
+            if (chunk->DataSize == bytes && memcmp(chunk->Data, src, bytes) == 0) {
+                chunk->RefCount++;
+                region->Chunks[c] = chunk;
+                region->ChunkCount = c + 1;
+                continue;
+            }
+        }
+        if ((chunk = (TABLE_SNAPSHOT_CHUNK*) HostMemoryAllocateHeap(NULL, TABLE_SNAPSHOT_CHUNK_ALIGN + bytes, TABLE_SNAPSHOT_CHUNK_ALIGN)) == NULL) {
+            return -1;
+        }
+        chunk->Data     =(uint8_t*) chunk + TABLE_SNAPSHOT_CHUNK_ALIGN;
+        chunk->DataSize = bytes;
+        chunk->RefCount = 1;
+        memcpy(chunk->Data, src, bytes);
+        region->Chunks[c] = chunk;
+        region->ChunkCount = c + 1;
+    }
+    return 0;
+}
+
+PIL_API(int)
+TableSnapshotSetCreate
+(
+    struct TABLE_SNAPSHOT_SET_INIT *init
+)
+{
+    TABLE_SNAPSHOT_SET *snapshot_set = init->SnapshotSet;
+    TABLE_DESC                *table = init->Table;
+    TABLE_SNAPSHOT         *versions = NULL;
+    TABLE_SNAPSHOT_REGION   *regions = NULL;
+    TABLE_SNAPSHOT_CHUNK    **chunks = NULL;
+    uint8_t                 *scratch = NULL;
+    uint32_t                capacity = table->Index->TableCapacity;
+    uint32_t            region_count = table->StreamCount + TABLE_SNAPSHOT_REGION_STREAM;
+    uint32_t           version_count = init->VersionCount;
+    uint32_t            element_size;
+    uint32_t             chunk_count;
+    uint32_t             chunk_shift;
+    uint32_t              chunk_base;
+    uint32_t                    i, j;
+
+    if (version_count < TABLE_SNAPSHOT_MIN_VERSIONS) {
+        assert(version_count >= TABLE_SNAPSHOT_MIN_VERSIONS);
+        return -1;
+    }
+    /* determine the total number of chunk pointers required by a single version */
+    for (j = 0, chunk_count = 0; j < region_count; ++j) {
+        element_size = j >= TABLE_SNAPSHOT_REGION_STREAM ? table->Streams[j - TABLE_SNAPSHOT_REGION_STREAM]->ElementSize : sizeof(uint32_t);
+        for (chunk_shift = 0; (element_size << (chunk_shift + 1)) <= TABLE_SNAPSHOT_CHUNK_SIZE; ++chunk_shift) {
+            /* empty */
+        }
+        chunk_count += (capacity + (1UL << chunk_shift) - 1) >> chunk_shift;
+    }
+    if ((versions = HostMemoryAllocateHeapArray(TABLE_SNAPSHOT, version_count)) == NULL) {
+        goto cleanup_and_fail;
+    }
+    if ((regions = HostMemoryAllocateHeapArray(TABLE_SNAPSHOT_REGION, version_count * region_count)) == NULL) {
+        goto cleanup_and_fail;
+    }
+    if ((chunks = HostMemoryAllocateHeapArray(TABLE_SNAPSHOT_CHUNK*, version_count * chunk_count)) == NULL) {
+        goto cleanup_and_fail;
+    }
+    if ((scratch = (uint8_t*) HostMemoryAllocateHeap(NULL, TABLE_SNAPSHOT_CHUNK_SIZE, TABLE_SNAPSHOT_CHUNK_ALIGN)) == NULL) {
+        goto cleanup_and_fail;
+    }
+    memset(chunks, 0, version_count * chunk_count * sizeof(TABLE_SNAPSHOT_CHUNK*));
+    for (i = 0, chunk_base = 0; i < version_count; ++i) {
+        versions[i].Regions     = &regions[i * region_count];
+        versions[i].Epoch       = 0;
+        versions[i].ItemCount   = 0;
+        versions[i].RegionCount = region_count;
+        versions[i].PinCount    = 0;
+        versions[i].Reserved    = 0;
+        for (j = 0; j < region_count; ++j) {
+            TABLE_SNAPSHOT_REGION *region = &versions[i].Regions[j];
+            element_size = j >= TABLE_SNAPSHOT_REGION_STREAM ? table->Streams[j - TABLE_SNAPSHOT_REGION_STREAM]->ElementSize : sizeof(uint32_t);
+            for (chunk_shift = 0; (element_size << (chunk_shift + 1)) <= TABLE_SNAPSHOT_CHUNK_SIZE; ++chunk_shift) {
+                /* empty */
+            }
+            region->Chunks        = &chunks[chunk_base];
+            region->ElementCount  = 0;
+            region->ElementSize   = element_size;
+            region->ChunkShift    = chunk_shift;
+            region->ChunkCount    = 0;
+            region->ChunkCapacity =(capacity + (1UL << chunk_shift) - 1) >> chunk_shift;
+            chunk_base += region->ChunkCapacity;
+        }
+    }
+    snapshot_set->Table        = table;
+    snapshot_set->Versions     = versions;
+    snapshot_set->Current      = NULL;
+    snapshot_set->Scratch      = scratch;
+    snapshot_set->Epoch        = 0;
+    snapshot_set->VersionCount = version_count;
+    snapshot_set->StreamCount  = table->StreamCount;
+    return 0;
+
+cleanup_and_fail:
+    HostMemoryFreeHeap(scratch);
+    HostMemoryFreeHeap(chunks);
+    HostMemoryFreeHeap(regions);
+    HostMemoryFreeHeap(versions);
+    memset(snapshot_set, 0, sizeof(TABLE_SNAPSHOT_SET));
+    return -1;
+}
+
+PIL_API(void)
+TableSnapshotSetDelete
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set
+)
+{
+    uint32_t i;
+    if (snapshot_set->Versions != NULL) {
+        for (i = 0; i < snapshot_set->VersionCount; ++i) {
+            assert(snapshot_set->Versions[i].PinCount == 0 && "TableSnapshotSetDelete called while a version is held by a reader");
+            TableSnapshotReleaseChunks(&snapshot_set->Versions[i]);
+        }
+        HostMemoryFreeHeap(snapshot_set->Versions[0].Regions[0].Chunks);
+        HostMemoryFreeHeap(snapshot_set->Versions[0].Regions);
+        HostMemoryFreeHeap(snapshot_set->Versions);
+        HostMemoryFreeHeap(snapshot_set->Scratch);
+    }
+    memset(snapshot_set, 0, sizeof(TABLE_SNAPSHOT_SET));
+}
+
+PIL_API(int)
+TableSnapshotPublish
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set
+)
+{
+    TABLE_DESC           *table = snapshot_set->Table;
+    TABLE_INDEX          *index = table->Index;
+    TABLE_SNAPSHOT     *current = snapshot_set->Current;
+    TABLE_SNAPSHOT      *target = NULL;
+    TABLE_SNAPSHOT     *version;
+    uint32_t       sparse_count = 0;
+    uint32_t       sparse_index;
+    uint32_t                  i;
+
+    if (table->StreamCount != snapshot_set->StreamCount) {
+        assert(table->StreamCount == snapshot_set->StreamCount && "Table streams changed after TableSnapshotSetCreate");
+        return -1;
+    }
+    /* reclaim every version other than the current version that no reader holds.
+     * a reader may briefly pin a version it then finds is not current, but it never reads the chunks. */
+    for (i = 0; i < snapshot_set->VersionCount; ++i) {
+        version = &snapshot_set->Versions[i];
+        if (version == current || TableSnapshot_AtomicLoad(&version->PinCount) != 0) {
+            continue;
+        }
+        if (version->Epoch != 0) {
+            TableSnapshotReleaseChunks(version);
+        }
+        if (target == NULL) {
+            target = version;
+        }
+    }
+    if (target == NULL) {
+        return -1;
+    }
+    /* only the sparse slots referenced by live items need to be captured */
+    for (i = 0; i < index->ActiveCount; ++i) {
+        sparse_index = (index->HandleArray[i] & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+        if (sparse_index >= sparse_count) {
+            sparse_count = sparse_index + 1;
+        }
+    }
+    if (TableSnapshotBuildRegion(snapshot_set, target, current, TABLE_SNAPSHOT_REGION_SPARSE, sparse_count) != 0) {
+        goto cleanup_and_fail;
+    }
+    for (i = TABLE_SNAPSHOT_REGION_HANDLE; i < target->RegionCount; ++i) {
+        if (TableSnapshotBuildRegion(snapshot_set, target, current, i, index->ActiveCount) != 0) {
+            goto cleanup_and_fail;
+        }
+    }
+    target->ItemCount = index->ActiveCount;
+    target->Epoch     = ++snapshot_set->Epoch;
+    TableSnapshot_AtomicStorePointer(&snapshot_set->Current, target);
+    return 0;
+
+cleanup_and_fail:
+    TableSnapshotReleaseChunks(target);
+    return -1;
+}
+
+PIL_API(struct TABLE_SNAPSHOT*)
+TableSnapshotAcquire
+(
+    struct TABLE_SNAPSHOT_SET *snapshot_set
+)
+{
+    TABLE_SNAPSHOT *snapshot;
+    for ( ; ; ) {
+        if ((snapshot = TableSnapshot_AtomicLoadPointer(&snapshot_set->Current)) == NULL) {
+            return NULL;
+        }
+        /* the pin only protects the version if it is still current after the pin is taken */
+        TableSnapshot_AtomicIncrement(&snapshot->PinCount);
+        if (TableSnapshot_AtomicLoadPointer(&snapshot_set->Current) == snapshot) {
+            return snapshot;
+        }
+        TableSnapshot_AtomicDecrement(&snapshot->PinCount);
+    }
+}
+
+PIL_API(void)
+TableSnapshotRelease
+(
+    struct TABLE_SNAPSHOT *snapshot
+)
+{
+    if (snapshot != NULL) {
+        TableSnapshot_AtomicDecrement(&snapshot->PinCount);
+    }
+}
+
+PIL_API(int)
+TableSnapshotResolve
+(
+    uint32_t *o_record_index,
+    struct TABLE_SNAPSHOT *snapshot,
+    HANDLE_BITS       bits
+)
+{
+    TABLE_SNAPSHOT_REGION *sparse = &snapshot->Regions[TABLE_SNAPSHOT_REGION_SPARSE];
+    uint32_t         sparse_index = (bits & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+    uint32_t          dense_index;
+    uint32_t                 word;
+
+    if ((bits & HANDLE_FLAG_MASK_PACKED) == 0 || sparse_index >= sparse->ElementCount) {
+        return 0;
+    }
+    word = *TableSnapshotRegion_GetElement(uint32_t, sparse, sparse_index);
+    if ((word & HANDLE_FLAG_MASK_PACKED) == 0 || (word & HANDLE_GENER_MASK_PACKED) != (bits & HANDLE_GENER_MASK_PACKED)) {
+        return 0;
+    }
+    dense_index = (word & HANDLE_INDEX_MASK_PACKED) >> HANDLE_INDEX_SHIFT;
+    if (dense_index >= snapshot->ItemCount || TableSnapshot_GetHandle(snapshot, dense_index) != bits) {
+        return 0;
+    }
+   *o_record_index = dense_index;
+    return 1;
+}
@@ -0,0 +1,225 @@
+/**
+ * @summary chunk_table_win32.cc: Implement the Windows platform-specific
+ * components of the chunked data table API.
+ */
+#include <Windows.h>
+#include "chunk_table.h"
+
+/* @summary Calculate the number of bytes of address space required by a chunked table data stream, including tail padding.
+ * @param _count The number of records in the data stream.
+ * @param _data The TABLE_DATA describing the data stream.
+ * @return The number of bytes required to store _count records, plus the stream tail padding.
+ */
+#ifndef ChunkTableData_GetStreamBytes
+#define ChunkTableData_GetStreamBytes(_count, _data)                           \
+    (((size_t)(_count) * (_data)->ElementSize) + (_data)->Alignment)
+#endif
+
+/* @summary Commit the index data and item records for a range of chunks and add them to the head of the free list.
+ * @param index The CHUNK_TABLE_INDEX to update.
+ * @param streams The set of data streams associated with the table.
+ * @param stream_count The number of data streams associated with the table.
+ * @param chunk_end One past the last chunk to commit. Chunks in [index->ChunkCount, chunk_end) are committed.
+ * @return Zero if the chunks are committed, or non-zero if an error occurred.
+ */
+static int
+ChunkTableCommitChunks
+(
+    struct CHUNK_TABLE_INDEX *index,
+    struct TABLE_DATA     **streams,
+    uint32_t           stream_count,
+    uint32_t              chunk_end
+)
+{
+    uint32_t chunk_begin = index->ChunkCount;
+    uint32_t  slot_count = chunk_end << CHUNK_TABLE_CHUNK_SHIFT;
+    uint32_t           i;
+
+    if (chunk_end <= chunk_begin) {
+        return 0;
+    }
+    if (VirtualAlloc(index->OccupancyMask  , chunk_end  * sizeof(uint64_t), MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+        return -1;
+    }
+    if (VirtualAlloc(index->GenerationArray, slot_count * sizeof(uint16_t), MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+        return -1;
+    }
+    if (VirtualAlloc(index->ChunkFreeList  , chunk_end  * sizeof(uint32_t), MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+        return -1;
+    }
+    for (i = 0; i < stream_count; ++i) {
+        if (VirtualAlloc(streams[i]->StorageBuffer, ChunkTableData_GetStreamBytes(slot_count, streams[i]), MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+            return -1;
+        }
+    }
+    /* freshly-committed pages are zero-filled, so the new chunks are empty with generation zero.
+     * push the new chunks onto the free list such that the lowest new chunk is filled first. */
+    for (i = chunk_end; i > chunk_begin; --i) {
+        index->ChunkFreeList[i - 1] = index->FreeChunkHead;
+        index->FreeChunkHead = i - 1;
+    }
+    index->ChunkCount = chunk_end;
+    return 0;
+}
+
+PIL_API(int)
+ChunkTableCreate
+(
+    struct CHUNK_TABLE_INIT *init
+)
+{
+    uint8_t              *index_ptr = nullptr;
+    void                *stream_ptr = nullptr;
+    size_t             mask_reserve = 0;
+    size_t            gener_reserve = 0;
+    size_t             list_reserve = 0;
+    size_t            index_reserve = 0;
+    CHUNK_TABLE_INDEX        *index = init->Index;
+    TABLE_DATA_STREAM_DESC *streams = init->Streams;
+    uint32_t           stream_count = init->StreamCount;
+    uint32_t         chunk_capacity = 0;
+    uint32_t            chunk_count = 0;
+    uint32_t                      i;
+
+    if (init->Index == nullptr) {
+        assert(init->Index != nullptr);
+        return -1;
+    }
+    if (init->TableCapacity < TABLE_MIN_OBJECT_COUNT) {
+        assert(init->TableCapacity >= TABLE_MIN_OBJECT_COUNT);
+        return -1;
+    }
+    if (init->TableCapacity > TABLE_MAX_OBJECT_COUNT) {
+        assert(init->TableCapacity <= TABLE_MAX_OBJECT_COUNT);
+        return -1;
+    }
+    if (init->InitialCommit > init->TableCapacity) {
+        assert(init->InitialCommit <= init->TableCapacity);
+        return -1;
+    }
+    for (i = 0; i < stream_count; ++i) {
+        if (streams[i].Data == nullptr) {
+            assert(streams[i].Data != nullptr);
+            return -1;
+        }
+        if (streams[i].Size == 0) {
+            assert(streams[i].Size != 0);
+            return -1;
+        }
+        if ((streams[i].Alignment & (streams[i].Alignment - 1)) != 0 || streams[i].Alignment > TABLE_STREAM_ALIGN_MAX) {
+            assert((streams[i].Alignment & (streams[i].Alignment - 1)) == 0);
+            assert(streams[i].Alignment <= TABLE_STREAM_ALIGN_MAX);
+            return -1;
+        }
+        streams[i].Data->StorageBuffer = nullptr;
+    }
+
+    /* reserve process address space for the index & data.
+     * the occupancy masks, slot generations and free list links are stored
+     * in separate page-aligned regions of a single reservation. */
+    chunk_capacity = (init->TableCapacity + CHUNK_TABLE_CHUNK_MASK) >> CHUNK_TABLE_CHUNK_SHIFT;
+    chunk_count    = (init->InitialCommit + CHUNK_TABLE_CHUNK_MASK) >> CHUNK_TABLE_CHUNK_SHIFT;
+    mask_reserve   = PIL_AlignUp(chunk_capacity * sizeof(uint64_t), TABLE_SPARSE_PAGE_SIZE);
+    gener_reserve  = PIL_AlignUp(chunk_capacity * CHUNK_TABLE_CHUNK_SIZE * sizeof(uint16_t), TABLE_SPARSE_PAGE_SIZE);
+    list_reserve   = PIL_AlignUp(chunk_capacity * sizeof(uint32_t), TABLE_SPARSE_PAGE_SIZE);
+    index_reserve  = mask_reserve + gener_reserve + list_reserve;
+    if ((index_ptr = (uint8_t*) VirtualAlloc(nullptr, index_reserve, MEM_RESERVE, PAGE_NOACCESS)) == nullptr) {
+        goto cleanup_and_fail;
+    }
+    for (i = 0; i < stream_count; ++i) {
+        streams[i].Data->ElementSize   = streams[i].Size;
+        streams[i].Data->Alignment     = streams[i].Alignment != 0 ? streams[i].Alignment : TABLE_STREAM_ALIGN_DEFAULT;
+        if ((stream_ptr = VirtualAlloc(nullptr, ChunkTableData_GetStreamBytes(chunk_capacity * CHUNK_TABLE_CHUNK_SIZE, streams[i].Data), MEM_RESERVE, PAGE_NOACCESS)) == nullptr) {
+            goto cleanup_and_fail;
+        }
+        streams[i].Data->StorageBuffer = stream_ptr;
+    }
+    index->OccupancyMask   = (uint64_t*)(index_ptr);
+    index->GenerationArray = (uint16_t*)(index_ptr + mask_reserve);
+    index->ChunkFreeList   = (uint32_t*)(index_ptr + mask_reserve + gener_reserve);
+    index->FreeChunkHead   = CHUNK_TABLE_CHUNK_NONE;
+    index->ActiveCount     = 0;
+    index->ChunkCount      = 0;
+    index->ChunkCapacity   = chunk_capacity;
+    index->TableCapacity   = chunk_capacity * CHUNK_TABLE_CHUNK_SIZE;
+    if (chunk_count > 0) {
+        /* the item records and index data are committed on-demand, one chunk at a time */
+        for (i = 0; i < stream_count; ++i) {
+            size_t     stream_commit  = ChunkTableData_GetStreamBytes(chunk_count * CHUNK_TABLE_CHUNK_SIZE, streams[i].Data);
+            if (VirtualAlloc(streams[i].Data->StorageBuffer, stream_commit, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+                goto cleanup_and_fail;
+            }
+        }
+        if (ChunkTableCommitChunks(index, nullptr, 0, chunk_count) != 0) {
+            goto cleanup_and_fail;
+        }
+    }
+    return 0;
+
+cleanup_and_fail:
+    for (i = 0; i < stream_count; ++i) {
+        if (streams[i].Data->StorageBuffer != nullptr) {
+            VirtualFree(streams[i].Data->StorageBuffer, 0, MEM_RELEASE);
+            streams[i].Data->StorageBuffer = nullptr;
+        }
+    }
+    if (index_ptr != nullptr) {
+        VirtualFree(index_ptr, 0, MEM_RELEASE);
+        index->OccupancyMask   = nullptr;
+        index->GenerationArray = nullptr;
+        index->ChunkFreeList   = nullptr;
+        index->FreeChunkHead   = CHUNK_TABLE_CHUNK_NONE;
+        index->ChunkCount      = 0;
+    }
+    return -1;
+}
+
+PIL_API(int)
+ChunkTableEnsure
+(
+    struct CHUNK_TABLE_DESC *table,
+    uint32_t            total_need
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    uint32_t     chunk_count;
+
+    /* every chunk with a free slot is on the free list, so the table
+     * can hold total_need items as long as enough chunks are committed */
+    chunk_count = (total_need + CHUNK_TABLE_CHUNK_MASK) >> CHUNK_TABLE_CHUNK_SHIFT;
+    if (index->ChunkCount >= chunk_count) {
+        return 0;
+    }
+    if (chunk_count > index->ChunkCapacity) {
+        return -1;
+    }
+    return ChunkTableCommitChunks(index, table->Streams, table->StreamCount, chunk_count);
+}
+
+PIL_API(void)
+ChunkTableDelete
+(
+    struct CHUNK_TABLE_DESC *table
+)
+{
+    CHUNK_TABLE_INDEX *index = table->Index;
+    TABLE_DATA     **streams = table->Streams;
+    uint32_t            i, n;
+    for (i = 0, n = table->StreamCount; i < n; ++i) {
+        if (streams[i]->StorageBuffer) {
+            VirtualFree(streams[i]->StorageBuffer, 0, MEM_RELEASE);
+            streams[i]->StorageBuffer = nullptr;
+        }
+    }
+    if (index && index->OccupancyMask) {
+        VirtualFree(index->OccupancyMask, 0, MEM_RELEASE);
+        index->OccupancyMask   = nullptr;
+        index->GenerationArray = nullptr;
+        index->ChunkFreeList   = nullptr;
+        index->FreeChunkHead   = CHUNK_TABLE_CHUNK_NONE;
+        index->ActiveCount     = 0;
+        index->ChunkCount      = 0;
+        index->ChunkCapacity   = 0;
+        index->TableCapacity   = 0;
+    }
+}
@@ -281,6 +281,9 @@ D3D12_CreateDisplayDeviceTable
     table->TableDesc.Index       =&table->TableIndex;
     table->TableDesc.Streams     = table->TableStreams;
     table->TableDesc.StreamCount = stream_count;
+    table->TableDesc.KeyIndex    = nullptr;
+    table->TableDesc.BlobHeap    = nullptr;
+    table->TableDesc.Journal     = nullptr;
     return 0;
 }
 
@@ -619,6 +619,9 @@ D3D12_CreateDisplayWindowTable
     table->TableDesc.Index                                   =&table->TableIndex;
     table->TableDesc.Streams                                 = table->TableStreams;
     table->TableDesc.StreamCount                             = stream_count;
+    table->TableDesc.KeyIndex                                = nullptr;
+    table->TableDesc.BlobHeap                                = nullptr;
+    table->TableDesc.Journal                                 = nullptr;
     return 0;
 }
 
@@ -3,8 +3,19 @@
  * of the data table API.
  */
 #include <Windows.h>
+#include <string.h>
 #include "table.h"
 
+/* @summary Calculate the number of bytes of address space required by a data stream, including tail padding.
+ * @param _count The number of records in the data stream.
+ * @param _data The TABLE_DATA describing the data stream.
+ * @return The number of bytes required to store _count records, plus the stream tail padding.
+ */
+#ifndef TableData_GetStreamBytes
+#define TableData_GetStreamBytes(_count, _data)                                \
+    (((size_t)(_count) * (_data)->ElementSize) + (_data)->Alignment)
+#endif
+
 PIL_API(int)
 TableCreate
 (
@@ -14,10 +25,12 @@ TableCreate
     uint8_t              *index_ptr = nullptr;
     uint32_t            *sparse_ptr = nullptr;
     uint32_t            *handle_ptr = nullptr;
+    uint32_t              *mask_ptr = nullptr;
     void                *stream_ptr = nullptr;
-    size_t            sparse_commit = 0;
+    size_t           sparse_reserve = 0;
     size_t            handle_commit = 0;
     size_t           handle_reserve = 0;
+    size_t             mask_reserve = 0;
     size_t            index_reserve = 0;
     TABLE_INDEX              *index = init->Index;
     TABLE_DATA_STREAM_DESC *streams = init->Streams;
@@ -45,28 +58,52 @@ TableCreate
             assert(streams[i].Size != 0);
             return -1;
         }
+        if ((streams[i].Alignment & (streams[i].Alignment - 1)) != 0 || streams[i].Alignment > TABLE_STREAM_ALIGN_MAX) {
+            assert((streams[i].Alignment & (streams[i].Alignment - 1)) == 0);
+            assert(streams[i].Alignment <= TABLE_STREAM_ALIGN_MAX);
+            return -1;
+        }
     }
 
-    /* reserve process address space for the index & data */
-    sparse_commit  = init->TableCapacity * sizeof(uint32_t);
+    /* reserve process address space for the index & data.
+     * the sparse index is padded out to a whole number of pages so that 
+     * sparse index pages can be committed independently of the handle array.
+     * the sparse page mask, if any, follows the handle array. */
+    sparse_reserve = PIL_AlignUp(init->TableCapacity * sizeof(uint32_t), TABLE_SPARSE_PAGE_SIZE);
     handle_commit  = init->InitialCommit * sizeof(uint32_t);
     handle_reserve = init->TableCapacity * sizeof(uint32_t);
-    index_reserve  = sparse_commit + handle_reserve;
+    if (init->TableFlags & TABLE_FLAG_PAGED_SPARSE_INDEX) {
+        handle_reserve = PIL_AlignUp(handle_reserve, sizeof(uint32_t) * 32);
+        mask_reserve   =(sparse_reserve / TABLE_SPARSE_PAGE_SIZE + 31) / 32 * sizeof(uint32_t);
+    }
+    index_reserve  = sparse_reserve + handle_reserve + mask_reserve;
     if ((index_ptr =(uint8_t*) VirtualAlloc(nullptr, index_reserve, MEM_RESERVE, PAGE_NOACCESS)) == nullptr) {
         goto cleanup_and_fail;
     }
     sparse_ptr = (uint32_t*)(index_ptr + 0);
-    handle_ptr = (uint32_t*)(index_ptr + sparse_commit);
+    handle_ptr = (uint32_t*)(index_ptr + sparse_reserve);
     for (i = 0 ; i < stream_count; ++i) {
-        if ((stream_ptr = VirtualAlloc(nullptr, init->TableCapacity * streams[i].Size, MEM_RESERVE, PAGE_NOACCESS)) == NULL) {
+        /* VirtualAlloc returns addresses aligned to the allocation granularity, which satisfies any stream alignment */
+        streams[i].Data->ElementSize   = streams[i].Size;
+        streams[i].Data->Alignment     = streams[i].Alignment != 0 ? streams[i].Alignment : TABLE_STREAM_ALIGN_DEFAULT;
+        streams[i].Data->DataFlags     = TABLE_DATA_FLAGS_NONE;
+        streams[i].Data->Reserved      = 0;
+        if ((stream_ptr = VirtualAlloc(nullptr, TableData_GetStreamBytes(init->TableCapacity, streams[i].Data), MEM_RESERVE, PAGE_NOACCESS)) == NULL) {
             goto cleanup_and_fail;
         }
         streams[i].Data->StorageBuffer = stream_ptr;
-        streams[i].Data->ElementSize   = streams[i].Size;
     }
-    /* the sparse portion of the index is always fully committed */
-    if (VirtualAlloc(sparse_ptr, sparse_commit, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
-        goto cleanup_and_fail;
+    if (mask_reserve > 0) {
+        /* the sparse portion of the index is committed on-demand, one page at a time */
+        mask_ptr = (uint32_t*)(index_ptr + sparse_reserve + handle_reserve);
+        if (VirtualAlloc(mask_ptr, mask_reserve, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+            goto cleanup_and_fail;
+        }
+    } else {
+        /* the sparse portion of the index is fully committed */
+        if (VirtualAlloc(sparse_ptr, sparse_reserve, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+            goto cleanup_and_fail;
+        }
     }
     if (init->InitialCommit > 0) {
         /* the dense portion of the index and the data streams are committed on-demand */
@@ -74,7 +111,7 @@ TableCreate
             goto cleanup_and_fail;
         }
         for (i = 0; i < stream_count; ++i) {
-            size_t     stream_commit  = init->InitialCommit * streams[i].Size;
+            size_t     stream_commit  = TableData_GetStreamBytes(init->InitialCommit, streams[i].Data);
             if (VirtualAlloc(streams[i].Data->StorageBuffer , stream_commit, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
                 goto cleanup_and_fail;
             }
@@ -82,10 +119,15 @@ TableCreate
     }
     index->SparseIndex   = sparse_ptr;
     index->HandleArray   = handle_ptr;
+    index->SparsePageMask= mask_ptr;
     index->ActiveCount   = 0;
     index->HighWatermark = 0;
     index->CommitCount   = init->InitialCommit;
     index->TableCapacity = init->TableCapacity;
+    index->IndexFlags    = init->TableFlags;
+    if (TableCommitSparseIndex(index, 0, init->InitialCommit) != 0) {
+        goto cleanup_and_fail;
+    }
     return 0;
 
 cleanup_and_fail:
@@ -97,10 +139,84 @@ cleanup_and_fail:
     }
     if (index_ptr != nullptr) {
         VirtualFree(index_ptr, 0, MEM_RELEASE);
+        index->SparseIndex   = nullptr;
+        index->HandleArray   = nullptr;
+        index->SparsePageMask= nullptr;
     }
     return -1;
 }
 
+PIL_API(int)
+TableAdopt
+(
+    HANDLE_BITS           *o_handles, 
+    struct TABLE_INIT          *init, 
+    void * const     *stream_storage, 
+    uint32_t              item_count
+)
+{
+    TABLE_INIT            index_init;
+    TABLE_INDEX               *index = init->Index;
+    TABLE_DATA_STREAM_DESC  *streams = init->Streams;
+    uint32_t            stream_count = init->StreamCount;
+    uint32_t               alignment;
+    HANDLE_BITS                 bits;
+    uint32_t                       i;
+
+    if (item_count > init->TableCapacity) {
+        assert(item_count <= init->TableCapacity);
+        return -1;
+    }
+    for (i = 0; i < stream_count; ++i) {
+        if (streams[i].Data == nullptr || stream_storage[i] == nullptr) {
+            assert(streams[i].Data != nullptr);
+            assert(stream_storage[i] != nullptr);
+            return -1;
+        }
+        if (streams[i].Size == 0) {
+            assert(streams[i].Size != 0);
+            return -1;
+        }
+        if ((streams[i].Alignment & (streams[i].Alignment - 1)) != 0 || streams[i].Alignment > TABLE_STREAM_ALIGN_MAX) {
+            assert((streams[i].Alignment & (streams[i].Alignment - 1)) == 0);
+            assert(streams[i].Alignment <= TABLE_STREAM_ALIGN_MAX);
+            return -1;
+        }
+        alignment = streams[i].Alignment != 0 ? streams[i].Alignment : TABLE_STREAM_ALIGN_DEFAULT;
+        if (((uintptr_t) stream_storage[i] & (alignment - 1)) != 0) {
+            assert(((uintptr_t) stream_storage[i] & (alignment - 1)) == 0);
+            return -1;
+        }
+    }
+    /* allocate only the index, committing the handle array and sparse index for the adopted items */
+    index_init               = *init;
+    index_init.Streams       = nullptr;
+    index_init.StreamCount   = 0;
+    index_init.InitialCommit = item_count;
+    if (TableCreate(&index_init) != 0) {
+        return -1;
+    }
+    for (i = 0; i < stream_count; ++i) {
+        streams[i].Data->StorageBuffer = stream_storage[i];
+        streams[i].Data->ElementSize   = streams[i].Size;
+        streams[i].Data->Alignment     = streams[i].Alignment != 0 ? streams[i].Alignment : TABLE_STREAM_ALIGN_DEFAULT;
+        streams[i].Data->DataFlags     = TABLE_DATA_FLAG_EXTERNAL_STORAGE;
+        streams[i].Data->Reserved      = 0;
+    }
+    /* with generation zero and identical dense and sparse indices, the sparse index value and the handle are the same word */
+    for (i = 0; i < item_count; ++i) {
+        bits = HANDLE_FLAG_MASK_PACKED | (i << HANDLE_INDEX_SHIFT);
+        index->SparseIndex[i] = bits;
+        index->HandleArray[i] = bits;
+    }
+    if (o_handles != nullptr) {
+        memcpy(o_handles, index->HandleArray, item_count * sizeof(HANDLE_BITS));
+    }
+    index->ActiveCount   = item_count;
+    index->HighWatermark = item_count;
+    return 0;
+}
+
 PIL_API(int)
 TableEnsure
 (
@@ -111,12 +227,18 @@ TableEnsure
 {
     TABLE_INDEX      *index = table->Index;
     TABLE_DATA    **streams = table->Streams;
+    TABLE_KEY_INDEX      *key_index;
     size_t    handle_commit;
     size_t    stream_commit;
     uint32_t    chunk_count;
     uint32_t new_item_count;
     uint32_t           i, n;
 
+    for (key_index = table->KeyIndex; key_index != nullptr; key_index = key_index->Next) {
+        if (TableKeyIndexEnsure(key_index, total_need) != 0) {
+            return -1;
+        }
+    }
     if (index->CommitCount  >= total_need) {
         return 0;
     }
@@ -133,15 +255,337 @@ TableEnsure
         return -1;
     }
     for (i = 0, n = table->StreamCount; i < n; ++i) {
-        stream_commit = new_item_count * streams[i]->ElementSize;
+        if (streams[i]->DataFlags & TABLE_DATA_FLAG_EXTERNAL_STORAGE) {
+            continue; /* the application guarantees storage for TableCapacity records */
+        }
+        stream_commit = TableData_GetStreamBytes(new_item_count, streams[i]);
         if (VirtualAlloc(streams[i]->StorageBuffer, stream_commit, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
             return -1;
         }
     }
+    /* TableCreateId never issues a new sparse index slot beyond CommitCount */
+    if (TableCommitSparseIndex(index, index->CommitCount, new_item_count) != 0) {
+        return -1;
+    }
     index->CommitCount = new_item_count;
     return 0;
 }
 
+PIL_API(int)
+TableCommitSparseIndex
+(
+    struct TABLE_INDEX *index, 
+    uint32_t     sparse_begin, 
+    uint32_t       sparse_end
+)
+{
+    uint32_t *page_mask = index->SparsePageMask;
+    uint32_t page_begin;
+    uint32_t   page_end;
+    uint32_t   page_bit;
+    uint32_t          p;
+
+    if (page_mask == nullptr || sparse_begin >= sparse_end) {
+        return 0;
+    }
+    if (sparse_end > index->TableCapacity) {
+        assert(sparse_end <= index->TableCapacity);
+        return -1;
+    }
+    page_begin = (sparse_begin    ) >> TABLE_SPARSE_PAGE_SHIFT;
+    page_end   = (sparse_end   - 1) >> TABLE_SPARSE_PAGE_SHIFT;
+    for (p = page_begin; p <= page_end; ++p) {
+        page_bit = 1UL << (p & 31);
+        if ((page_mask[p >> 5] & page_bit) == 0) {
+            /* freshly-committed pages are zero-filled, which matches the initial state of a sparse index slot */
+            if (VirtualAlloc(index->SparseIndex + (p << TABLE_SPARSE_PAGE_SHIFT), TABLE_SPARSE_PAGE_SIZE, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+                return -1;
+            }
+            page_mask[p >> 5] |= page_bit;
+        }
+    }
+    return 0;
+}
+
+PIL_API(int)
+TableKeyIndexCreate
+(
+    struct TABLE_KEY_INDEX_INIT *init
+)
+{
+    TABLE_KEY_INDEX *key_index = init->KeyIndex;
+
+    if (init->KeyIndex == nullptr) {
+        assert(init->KeyIndex != nullptr);
+        return -1;
+    }
+    if (init->KeySize != sizeof(uint32_t) && init->KeySize != sizeof(uint64_t)) {
+        assert(init->KeySize == sizeof(uint32_t) || init->KeySize == sizeof(uint64_t));
+        return -1;
+    }
+    key_index->Next        = nullptr;
+    key_index->SlotArray   = nullptr;
+    key_index->SlotCount   = 0;
+    key_index->ItemCount   = 0;
+    key_index->StreamIndex = init->StreamIndex;
+    key_index->KeyOffset   = init->KeyOffset;
+    key_index->KeySize     = init->KeySize;
+    return TableKeyIndexEnsure(key_index, init->InitialCommit);
+}
+
+PIL_API(int)
+TableKeyIndexEnsure
+(
+    struct TABLE_KEY_INDEX *key_index, 
+    uint32_t               total_need
+)
+{
+    TABLE_KEY_INDEX_SLOT  *old_slots = key_index->SlotArray;
+    TABLE_KEY_INDEX_SLOT  *new_slots = nullptr;
+    uint32_t               old_count = key_index->SlotCount;
+    uint32_t               new_count = TABLE_KEY_INDEX_MIN_SLOTS;
+    uint32_t                    mask;
+    uint32_t                    i, j;
+
+    /* keep the load factor at or below 50% */
+    while (new_count < (uint64_t) total_need * 2) {
+        new_count *= 2;
+    }
+    if (old_count >= new_count) {
+        return 0;
+    }
+    if ((new_slots = (TABLE_KEY_INDEX_SLOT*) VirtualAlloc(nullptr, new_count * sizeof(TABLE_KEY_INDEX_SLOT), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE)) == nullptr) {
+        return -1;
+    }
+    for (i = 0, mask = new_count - 1; i < old_count; ++i) {
+        if (old_slots[i].Handle != HANDLE_BITS_INVALID) {
+            j = TableKeyIndex_HashKey(old_slots[i].Key) & mask;
+            while (new_slots[j].Handle != HANDLE_BITS_INVALID) {
+                j = (j + 1) & mask;
+            }
+            new_slots[j] = old_slots[i];
+        }
+    }
+    if (old_slots != nullptr) {
+        VirtualFree(old_slots, 0, MEM_RELEASE);
+    }
+    key_index->SlotArray = new_slots;
+    key_index->SlotCount = new_count;
+    return 0;
+}
+
+PIL_API(void)
+TableKeyIndexDelete
+(
+    struct TABLE_KEY_INDEX *key_index
+)
+{
+    if (key_index->SlotArray != nullptr) {
+        VirtualFree(key_index->SlotArray, 0, MEM_RELEASE);
+        key_index->SlotArray = nullptr;
+    }
+    key_index->SlotCount = 0;
+    key_index->ItemCount = 0;
+}
+
+PIL_API(int)
+TableBlobHeapCreate
+(
+    struct TABLE_BLOB_HEAP_INIT *init
+)
+{
+    TABLE_BLOB_HEAP *blob_heap = init->BlobHeap;
+    size_t        reserve_size = PIL_AlignUp((size_t) init->ReserveSize, TABLE_SPARSE_PAGE_SIZE);
+    uint8_t          *heap_ptr = nullptr;
+
+    if (init->BlobHeap == nullptr) {
+        assert(init->BlobHeap != nullptr);
+        return -1;
+    }
+    if (init->ReserveSize == 0 || reserve_size > 0xFFFFFFFFUL) {
+        assert(init->ReserveSize != 0);
+        assert(reserve_size <= 0xFFFFFFFFUL);
+        return -1;
+    }
+    if (init->InitialCommit > init->ReserveSize) {
+        assert(init->InitialCommit <= init->ReserveSize);
+        return -1;
+    }
+    if ((heap_ptr = (uint8_t*) VirtualAlloc(nullptr, reserve_size, MEM_RESERVE, PAGE_NOACCESS)) == nullptr) {
+        return -1;
+    }
+    blob_heap->Next         = nullptr;
+    blob_heap->HeapBase     = heap_ptr;
+    blob_heap->HeapSize     = 0;
+    blob_heap->CommitSize   = 0;
+    blob_heap->ReserveSize  = (uint32_t) reserve_size;
+    blob_heap->FreeBytes    = 0;
+    blob_heap->CompactRead  = 0;
+    blob_heap->CompactWrite = 0;
+    blob_heap->StreamIndex  = init->StreamIndex;
+    blob_heap->SpanOffset   = init->SpanOffset;
+    if (TableBlobHeapEnsure(blob_heap, init->InitialCommit) != 0) {
+        VirtualFree(heap_ptr, 0, MEM_RELEASE);
+        blob_heap->HeapBase = nullptr;
+        return -1;
+    }
+    return 0;
+}
+
+PIL_API(int)
+TableBlobHeapEnsure
+(
+    struct TABLE_BLOB_HEAP *blob_heap, 
+    uint32_t               total_need
+)
+{
+    size_t commit_size;
+
+    if (blob_heap->CommitSize >= total_need) {
+        return 0;
+    }
+    if (total_need > blob_heap->ReserveSize) {
+        return -1;
+    }
+    commit_size = PIL_AlignUp((size_t) total_need, TABLE_SPARSE_PAGE_SIZE);
+    if (VirtualAlloc(blob_heap->HeapBase, commit_size, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+        return -1;
+    }
+    blob_heap->CommitSize = (uint32_t) commit_size;
+    return 0;
+}
+
+PIL_API(void)
+TableBlobHeapDelete
+(
+    struct TABLE_BLOB_HEAP *blob_heap
+)
+{
+    if (blob_heap->HeapBase != nullptr) {
+        VirtualFree(blob_heap->HeapBase, 0, MEM_RELEASE);
+        blob_heap->HeapBase = nullptr;
+    }
+    blob_heap->HeapSize     = 0;
+    blob_heap->CommitSize   = 0;
+    blob_heap->ReserveSize  = 0;
+    blob_heap->FreeBytes    = 0;
+    blob_heap->CompactRead  = 0;
+    blob_heap->CompactWrite = 0;
+}
+
+PIL_API(int)
+TableAddStream
+(
+    uint32_t                *o_stream_index, 
+    struct TABLE_DESC                *table, 
+    uint32_t                stream_capacity, 
+    struct TABLE_DATA_STREAM_DESC   *stream, 
+    void const               *default_value, 
+    PFN_TableStreamInit           init_func, 
+    void                      *init_context
+)
+{
+    TABLE_INDEX   *index = table->Index;
+    TABLE_DATA     *data = stream->Data;
+    uint8_t      *record;
+    void     *stream_ptr;
+    uint32_t           i;
+
+    if (table->StreamCount >= stream_capacity) {
+        assert(table->StreamCount < stream_capacity);
+        return -1;
+    }
+    if (stream->Data == nullptr) {
+        assert(stream->Data != nullptr);
+        return -1;
+    }
+    if (stream->Size == 0) {
+        assert(stream->Size != 0);
+        return -1;
+    }
+    if ((stream->Alignment & (stream->Alignment - 1)) != 0 || stream->Alignment > TABLE_STREAM_ALIGN_MAX) {
+        assert((stream->Alignment & (stream->Alignment - 1)) == 0);
+        assert(stream->Alignment <= TABLE_STREAM_ALIGN_MAX);
+        return -1;
+    }
+    data->ElementSize   = stream->Size;
+    data->Alignment     = stream->Alignment != 0 ? stream->Alignment : TABLE_STREAM_ALIGN_DEFAULT;
+    data->StorageBuffer = nullptr;
+    data->DataFlags     = TABLE_DATA_FLAGS_NONE;
+    data->Reserved      = 0;
+    if ((stream_ptr = VirtualAlloc(nullptr, TableData_GetStreamBytes(index->TableCapacity, data), MEM_RESERVE, PAGE_NOACCESS)) == nullptr) {
+        return -1;
+    }
+    if (index->CommitCount > 0) {
+        /* freshly-committed pages are zero-filled, which is the default record state */
+        if (VirtualAlloc(stream_ptr, TableData_GetStreamBytes(index->CommitCount, data), MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+            VirtualFree(stream_ptr, 0, MEM_RELEASE);
+            return -1;
+        }
+    }
+    data->StorageBuffer = stream_ptr;
+    if (init_func != nullptr) {
+        init_func(stream_ptr, index->HandleArray, index->ActiveCount, data->ElementSize, init_context);
+    } else if (default_value != nullptr) {
+        for (i = 0, record = (uint8_t*) stream_ptr; i < index->ActiveCount; ++i, record += data->ElementSize) {
+            memcpy(record, default_value, data->ElementSize);
+        }
+    }
+    table->Streams[table->StreamCount] = data;
+   *o_stream_index = table->StreamCount++;
+    return 0;
+}
+
+PIL_API(int)
+TableRemoveStream
+(
+    struct TABLE_DESC *table, 
+    uint32_t    stream_index
+)
+{
+    TABLE_DATA    **streams = table->Streams;
+    TABLE_KEY_INDEX    *key_index;
+    TABLE_BLOB_HEAP    *blob_heap;
+    uint32_t               i, n;
+
+    if (stream_index >= table->StreamCount) {
+        assert(stream_index < table->StreamCount);
+        return -1;
+    }
+    for (key_index = table->KeyIndex; key_index != nullptr; key_index = key_index->Next) {
+        if (key_index->StreamIndex == stream_index) {
+            assert(key_index->StreamIndex != stream_index);
+            return -1;
+        }
+    }
+    for (blob_heap = table->BlobHeap; blob_heap != nullptr; blob_heap = blob_heap->Next) {
+        if (blob_heap->StreamIndex == stream_index) {
+            assert(blob_heap->StreamIndex != stream_index);
+            return -1;
+        }
+    }
+    if (streams[stream_index]->StorageBuffer) {
+        if ((streams[stream_index]->DataFlags & TABLE_DATA_FLAG_EXTERNAL_STORAGE) == 0) {
+            VirtualFree(streams[stream_index]->StorageBuffer, 0, MEM_RELEASE);
+        } streams[stream_index]->StorageBuffer = nullptr;
+    }
+    for (i = stream_index, n = table->StreamCount - 1; i < n; ++i) {
+        streams[i] = streams[i + 1];
+    }
+    for (key_index = table->KeyIndex; key_index != nullptr; key_index = key_index->Next) {
+        if (key_index->StreamIndex > stream_index) {
+            key_index->StreamIndex--;
+        }
+    }
+    for (blob_heap = table->BlobHeap; blob_heap != nullptr; blob_heap = blob_heap->Next) {
+        if (blob_heap->StreamIndex > stream_index) {
+            blob_heap->StreamIndex--;
+        }
+    }
+    table->StreamCount = n;
+    return 0;
+}
+
 PIL_API(void)
 TableDelete
 (
@@ -153,14 +597,16 @@ TableDelete
     uint32_t        i, n;
     for (i = 0, n = table->StreamCount; i < n; ++i) {
         if (streams[i]->StorageBuffer) {
-            VirtualFree(streams[i]->StorageBuffer, 0, MEM_RELEASE);
-            streams[i]->StorageBuffer = nullptr;
+            if ((streams[i]->DataFlags & TABLE_DATA_FLAG_EXTERNAL_STORAGE) == 0) {
+                VirtualFree(streams[i]->StorageBuffer, 0, MEM_RELEASE);
+            } streams[i]->StorageBuffer = nullptr;
         }
     }
     if (index && index->SparseIndex) {
         VirtualFree(index->SparseIndex, 0, MEM_RELEASE);
         index->SparseIndex   = nullptr;
         index->HandleArray   = nullptr;
+        index->SparsePageMask= nullptr;
         index->ActiveCount   = 0;
         index->CommitCount   = 0;
         index->TableCapacity = 0;